@@ -8,6 +8,7 @@
 
 #include <map>
 #include <set>
+#include <vector>
 
 #include <vsomeip/primitive_types.hpp>
 #include <vsomeip/plugin.hpp>
@@ -22,11 +23,14 @@ struct application_configuration {
     client_t client_;
     std::size_t max_dispatchers_;
     std::size_t max_dispatch_time_;
+    std::size_t dispatch_lanes_;
     std::size_t max_detach_thread_wait_time_;
     std::size_t thread_count_;
     std::size_t request_debouncing_;
     std::map<plugin_type_e, std::set<std::string> > plugins_;
     int nice_level_;
+    std::size_t io_shards_;
+    std::vector<int> io_shard_cpus_;
     debounce_configuration_t debounces_;
     bool has_session_handling_;
 };
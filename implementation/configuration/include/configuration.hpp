@@ -85,6 +85,9 @@ public:
     virtual bool has_dlt_log() const = 0;
     virtual const std::string &get_logfile() const = 0;
     virtual logger::level_e get_loglevel() const = 0;
+    virtual bool has_async_log() const = 0;
+    virtual std::uint32_t get_async_log_buffer_size() const = 0;
+    virtual std::uint32_t get_log_rate_limit() const = 0;
 
     virtual bool is_routing_enabled() const = 0;
     virtual const std::string &get_routing_host_name() const = 0;
@@ -141,9 +144,12 @@ public:
 
     virtual std::size_t get_max_dispatchers(const std::string &_name) const = 0;
     virtual std::size_t get_max_dispatch_time(const std::string &_name) const = 0;
+    virtual std::size_t get_dispatch_lanes(const std::string &_name) const = 0;
     virtual std::size_t get_max_detached_thread_wait_time(const std::string& _name) const = 0;
     virtual std::size_t get_io_thread_count(const std::string &_name) const = 0;
     virtual int get_io_thread_nice_level(const std::string &_name) const = 0;
+    virtual std::size_t get_io_shards(const std::string &_name) const = 0;
+    virtual std::vector<int> get_io_shard_cpus(const std::string &_name) const = 0;
     virtual std::size_t get_request_debouncing(const std::string &_name) const = 0;
     virtual bool has_session_handling(const std::string &_name) const = 0;
 
@@ -271,6 +277,20 @@ public:
     virtual bool is_secure_service(service_t _service, instance_t _instance) const = 0;
 
     virtual int get_udp_receive_buffer_size() const = 0;
+    virtual std::uint32_t get_udp_receive_batch_size(
+            const std::string& _address, std::uint16_t _port) const = 0;
+    virtual std::uint32_t get_udp_transmit_batch_size() const = 0;
+    virtual bool is_udp_transmit_gso_enabled() const = 0;
+
+    // Minimum size of local notifications that are sent via shared memory
+    // (0 if shared memory is not used)
+    virtual std::uint32_t get_shm_threshold() const = 0;
+    virtual std::uint32_t get_shm_slot_count() const = 0;
+    virtual std::uint32_t get_shm_slot_size() const = 0;
+
+    // Time [ms] the routing manager collects routing info changes before it
+    // sends them (0 if every change is sent immediately)
+    virtual std::uint32_t get_routing_info_coalescing_time() const = 0;
 
     virtual bool check_routing_credentials(client_t _client,
             const vsomeip_sec_client_t *_sec_client) const = 0;
@@ -296,6 +316,7 @@ public:
     virtual uint32_t get_statistics_interval() const = 0;
     virtual uint32_t get_statistics_min_freq() const = 0;
     virtual uint32_t get_statistics_max_messages() const = 0;
+    virtual const std::string& get_statistics_metrics_file() const = 0;
 
     virtual uint8_t get_max_remote_subscribers() const = 0;
 
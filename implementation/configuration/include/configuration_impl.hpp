@@ -19,6 +19,7 @@
 #include "application_configuration.hpp"
 #include "configuration.hpp"
 #include "configuration_element.hpp"
+#include "configuration_snapshot.hpp"
 #include "e2e.hpp"
 #include "routing.hpp"
 #include "watchdog.hpp"
@@ -99,6 +100,9 @@ public:
     VSOMEIP_EXPORT bool has_dlt_log() const;
     VSOMEIP_EXPORT const std::string & get_logfile() const;
     VSOMEIP_EXPORT vsomeip_v3::logger::level_e get_loglevel() const;
+    VSOMEIP_EXPORT bool has_async_log() const;
+    VSOMEIP_EXPORT std::uint32_t get_async_log_buffer_size() const;
+    VSOMEIP_EXPORT std::uint32_t get_log_rate_limit() const;
 
     VSOMEIP_EXPORT std::string get_unicast_address(service_t _service, instance_t _instance) const;
 
@@ -140,9 +144,12 @@ public:
 
     VSOMEIP_EXPORT std::size_t get_max_dispatchers(const std::string &_name) const;
     VSOMEIP_EXPORT std::size_t get_max_dispatch_time(const std::string &_name) const;
+    VSOMEIP_EXPORT std::size_t get_dispatch_lanes(const std::string &_name) const;
     VSOMEIP_EXPORT std::size_t get_max_detached_thread_wait_time(const std::string& _name) const;
     VSOMEIP_EXPORT std::size_t get_io_thread_count(const std::string &_name) const;
     VSOMEIP_EXPORT int get_io_thread_nice_level(const std::string &_name) const;
+    VSOMEIP_EXPORT std::size_t get_io_shards(const std::string &_name) const;
+    VSOMEIP_EXPORT std::vector<int> get_io_shard_cpus(const std::string &_name) const;
     VSOMEIP_EXPORT std::size_t get_request_debouncing(const std::string &_name) const;
     VSOMEIP_EXPORT bool has_session_handling(const std::string &_name) const;
 
@@ -260,6 +267,16 @@ public:
     VSOMEIP_EXPORT bool is_secure_service(service_t _service, instance_t _instance) const;
 
     VSOMEIP_EXPORT int get_udp_receive_buffer_size() const;
+    VSOMEIP_EXPORT std::uint32_t get_udp_receive_batch_size(
+            const std::string& _address, std::uint16_t _port) const;
+    VSOMEIP_EXPORT std::uint32_t get_udp_transmit_batch_size() const;
+    VSOMEIP_EXPORT bool is_udp_transmit_gso_enabled() const;
+
+    VSOMEIP_EXPORT std::uint32_t get_shm_threshold() const;
+    VSOMEIP_EXPORT std::uint32_t get_shm_slot_count() const;
+    VSOMEIP_EXPORT std::uint32_t get_shm_slot_size() const;
+
+    VSOMEIP_EXPORT std::uint32_t get_routing_info_coalescing_time() const;
 
     VSOMEIP_EXPORT bool is_tp_client(
             service_t _service,
@@ -277,6 +294,7 @@ public:
     VSOMEIP_EXPORT uint32_t get_statistics_interval() const;
     VSOMEIP_EXPORT uint32_t get_statistics_min_freq() const;
     VSOMEIP_EXPORT uint32_t get_statistics_max_messages() const;
+    VSOMEIP_EXPORT const std::string& get_statistics_metrics_file() const;
 
     VSOMEIP_EXPORT uint8_t get_max_remote_subscribers() const;
 
@@ -420,6 +438,10 @@ private:
     void load_acceptances(const configuration_element &_element);
     void load_acceptance_data(const boost::property_tree::ptree &_tree);
     void load_udp_receive_buffer_size(const configuration_element &_element);
+    void load_udp_receive_batch_sizes(const configuration_element &_element);
+    void load_udp_transmit_batching(const configuration_element &_element);
+    void load_shared_memory(const configuration_element &_element);
+    void load_routing_info_coalescing(const configuration_element &_element);
     bool load_npdu_debounce_times_configuration(
             const std::shared_ptr<service>& _service,
             const boost::property_tree::ptree &_tree);
@@ -482,6 +504,11 @@ private:
 
     std::set<std::string> mandatory_;
 
+    // Pre-parsed configuration files and the files that were parsed
+    // because they changed after the snapshot was written
+    std::shared_ptr<configuration_snapshot> snapshot_;
+    std::set<std::string> snapshot_outdated_;
+
     std::shared_ptr<policy_manager_impl> policy_manager_;
     std::shared_ptr<security> security_;
 
@@ -500,6 +527,9 @@ protected:
     std::string logfile_;
     mutable std::mutex mutex_loglevel_;
     vsomeip_v3::logger::level_e loglevel_;
+    bool has_async_log_;
+    std::uint32_t async_log_buffer_size_;
+    std::uint32_t log_rate_limit_;
 
     std::map<
         std::string,
@@ -569,6 +599,8 @@ protected:
         ET_LOGGING_FILE,
         ET_LOGGING_DLT,
         ET_LOGGING_LEVEL,
+        ET_LOGGING_ASYNC,
+        ET_LOGGING_RATE_LIMIT,
         ET_ROUTING,
         ET_SERVICE_DISCOVERY_ENABLE,
         ET_SERVICE_DISCOVERY_PROTOCOL,
@@ -598,6 +630,10 @@ protected:
         ET_SD_ACCEPTANCE_REQUIRED,
         ET_NETMASK,
         ET_UDP_RECEIVE_BUFFER_SIZE,
+        ET_UDP_RECEIVE_BATCH_SIZE,
+        ET_UDP_RECEIVE_BATCH_SIZES,
+        ET_UDP_TRANSMIT_BATCH_SIZE,
+        ET_UDP_TRANSMIT_GSO,
         ET_NPDU_DEFAULT_TIMINGS,
         ET_PLUGIN_NAME,
         ET_PLUGIN_TYPE,
@@ -606,7 +642,9 @@ protected:
         ET_PARTITIONS,
         ET_SECURITY_AUDIT_MODE,
         ET_SECURITY_REMOTE_ACCESS,
-        ET_MAX = 46
+        ET_SHARED_MEMORY,
+        ET_ROUTING_INFO_COALESCING,
+        ET_MAX = 54
     };
 
     bool is_configured_[ET_MAX];
@@ -645,6 +683,18 @@ protected:
 
     int udp_receive_buffer_size_;
 
+    std::map<std::string, std::map<std::uint16_t, std::uint32_t>> udp_receive_batch_sizes_;
+    std::uint32_t udp_receive_batch_size_;
+
+    std::uint32_t udp_transmit_batch_size_;
+    bool udp_transmit_gso_;
+
+    std::uint32_t shm_threshold_;
+    std::uint32_t shm_slot_count_;
+    std::uint32_t shm_slot_size_;
+
+    std::uint32_t routing_info_coalescing_time_;
+
     std::chrono::nanoseconds npdu_default_debounce_requ_;
     std::chrono::nanoseconds npdu_default_debounce_resp_;
     std::chrono::nanoseconds npdu_default_max_retention_requ_;
@@ -659,6 +709,7 @@ protected:
     uint32_t statistics_interval_;
     uint32_t statistics_min_freq_;
     uint32_t statistics_max_messages_;
+    std::string statistics_metrics_file_;
 
     uint8_t max_remote_subscribers_;
 
@@ -0,0 +1,71 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_CFG_CONFIGURATION_SNAPSHOT_HPP_
+#define VSOMEIP_V3_CFG_CONFIGURATION_SNAPSHOT_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include <vsomeip/export.hpp>
+
+#include "configuration_element.hpp"
+
+namespace vsomeip_v3 {
+namespace cfg {
+
+//
+// Pre-parsed configuration files in a single binary file, i.e. a cache of
+// the JSON parser. Each file is stored with its size and modification time,
+// and its tree is only restored from the snapshot if the file is unchanged.
+// Otherwise the file must be parsed again. Restoring copies the tree to the
+// heap of the application, which then loads it as if it was parsed, so the
+// snapshot saves the JSON parsing only. Snapshots are written in host byte
+// order and are rejected if they were written by another format version.
+//
+class VSOMEIP_IMPORT_EXPORT configuration_snapshot
+{
+public:
+    static const std::uint32_t VERSION = 1;
+
+    // Writes the elements, which must have been read from the files named
+    // by their names, to a snapshot at _path.
+    static bool write(const std::string&                        _path,
+                      const std::vector<configuration_element>& _elements);
+
+    // Maps the snapshot at _path. Returns nullptr if the file does not
+    // exist or is not a valid snapshot of this version.
+    static std::shared_ptr<configuration_snapshot> open(const std::string& _path);
+
+    ~configuration_snapshot();
+
+    // Restores the tree of the file _name. Returns false if the file is not
+    // part of the snapshot or was changed after the snapshot was written.
+    bool get(const std::string& _name, boost::property_tree::ptree& _tree) const;
+
+    std::size_t get_size() const;
+
+private:
+    struct entry;
+
+    configuration_snapshot(const std::uint8_t* _data, std::size_t _size, bool _is_mapped);
+
+    bool find(const std::string& _name, entry& _entry) const;
+    bool read(std::size_t& _offset, std::size_t _end, std::uint32_t& _value) const;
+    bool restore(std::size_t& _offset, std::size_t _end, boost::property_tree::ptree& _tree) const;
+
+    const std::uint8_t* data_;
+    const std::size_t   size_;
+    const bool          is_mapped_;
+};
+
+} // namespace cfg
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_CFG_CONFIGURATION_SNAPSHOT_HPP_
@@ -22,6 +22,25 @@ struct debounce_filter_impl_t : debounce_filter_t {
           last_forwarded_(std::chrono::steady_clock::time_point::max()) {
     }
 
+    // Returns whether a notification must be forwarded. _is_changed tells
+    // whether the payload changed in bits that are not ignored.
+    bool is_forwarded(bool _is_changed) {
+        bool is_elapsed(false);
+        if (interval_ > -1) {
+            // Check whether we should forward because of the elapsed time since
+            // we did last time
+            std::chrono::steady_clock::time_point its_current =
+                std::chrono::steady_clock::now();
+            int64_t elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    its_current - last_forwarded_).count();
+            is_elapsed = (last_forwarded_ == std::chrono::steady_clock::time_point::max()
+                    || elapsed >= interval_);
+            if (is_elapsed || (_is_changed && on_change_resets_interval_))
+                last_forwarded_ = its_current;
+        }
+        return (_is_changed || is_elapsed);
+    }
+
     std::chrono::steady_clock::time_point last_forwarded_;
 };
 
@@ -15,6 +15,7 @@
 
 #define VSOMEIP_ENV_APPLICATION_NAME            "VSOMEIP_APPLICATION_NAME"
 #define VSOMEIP_ENV_CONFIGURATION               "VSOMEIP_CONFIGURATION"
+#define VSOMEIP_ENV_CONFIGURATION_SNAPSHOT      "VSOMEIP_CONFIGURATION_SNAPSHOT"
 #define VSOMEIP_ENV_CONFIGURATION_MODULE        "VSOMEIP_CONFIGURATION_MODULE"
 #define VSOMEIP_ENV_E2E_PROTECTION_MODULE       "VSOMEIP_E2E_PROTECTION_MODULE"
 #define VSOMEIP_ENV_MANDATORY_CONFIGURATION_FILES "VSOMEIP_MANDATORY_CONFIGURATION_FILES"
@@ -66,6 +67,9 @@
 
 #define VSOMEIP_DEFAULT_QUEUE_WARN_SIZE         102400
 
+#define VSOMEIP_REPLY_ROUTE_TABLE_SIZE          1024
+#define VSOMEIP_REPLY_ROUTE_MAX_AGE             10000 // milliseconds
+
 #define VSOMEIP_MAX_TCP_CONNECT_TIME            5000
 #define VSOMEIP_MAX_TCP_RESTART_ABORTS          5
 #define VSOMEIP_MAX_TCP_SENT_WAIT_TIME          10000
@@ -81,11 +85,31 @@
 
 #define VSOMEIP_DEFAULT_UDP_RCV_BUFFER_SIZE     1703936
 
+#define VSOMEIP_DEFAULT_UDP_RECEIVE_BATCH_SIZE  1
+#define VSOMEIP_MAX_UDP_RECEIVE_BATCH_SIZE      64
+
+#define VSOMEIP_DEFAULT_UDP_TRANSMIT_BATCH_SIZE 1
+#define VSOMEIP_MAX_UDP_TRANSMIT_BATCH_SIZE     64
+
+#define VSOMEIP_DEFAULT_SHM_THRESHOLD           65536
+#define VSOMEIP_DEFAULT_SHM_SLOT_COUNT          16
+#define VSOMEIP_DEFAULT_SHM_SLOT_SIZE           4194304
+#define VSOMEIP_DEFAULT_SHM_RECLAIM_TIME        10000
+
+#define VSOMEIP_DEFAULT_ROUTING_INFO_COALESCING_TIME 0
+
 #define VSOMEIP_DEFAULT_IO_THREAD_COUNT         2
 #define VSOMEIP_DEFAULT_IO_THREAD_NICE_LEVEL    0
+#define VSOMEIP_DEFAULT_IO_SHARDS               0
+#define VSOMEIP_MAX_IO_SHARDS                   32
+
+#define VSOMEIP_DEFAULT_ASYNC_LOG_BUFFER_SIZE   1024
 
 #define VSOMEIP_MAX_DISPATCHERS                 10
 #define VSOMEIP_MAX_DISPATCH_TIME               100
+#define VSOMEIP_DEFAULT_DISPATCH_LANES          1
+#define VSOMEIP_MAX_DISPATCH_LANES              32
+#define VSOMEIP_DISPATCH_QUEUE_SIZE             1024
 
 #define VSOMEIP_MAX_WAIT_TIME_DETACHED_THREADS  5
 
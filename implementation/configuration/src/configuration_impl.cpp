@@ -55,6 +55,9 @@ configuration_impl::configuration_impl(const std::string& _path)
       has_dlt_log_(false),
       logfile_("/tmp/vsomeip.log"),
       loglevel_(vsomeip_v3::logger::level_e::LL_INFO),
+      has_async_log_(false),
+      async_log_buffer_size_(VSOMEIP_DEFAULT_ASYNC_LOG_BUFFER_SIZE),
+      log_rate_limit_(0),
       is_sd_enabled_(VSOMEIP_SD_DEFAULT_ENABLED),
       sd_protocol_(VSOMEIP_SD_DEFAULT_PROTOCOL),
       sd_multicast_(VSOMEIP_SD_DEFAULT_MULTICAST),
@@ -91,6 +94,13 @@ configuration_impl::configuration_impl(const std::string& _path)
       has_issued_methods_warning_(false),
       has_issued_clients_warning_(false),
       udp_receive_buffer_size_(VSOMEIP_DEFAULT_UDP_RCV_BUFFER_SIZE),
+      udp_receive_batch_size_(VSOMEIP_DEFAULT_UDP_RECEIVE_BATCH_SIZE),
+      udp_transmit_batch_size_(VSOMEIP_DEFAULT_UDP_TRANSMIT_BATCH_SIZE),
+      udp_transmit_gso_(false),
+      shm_threshold_(0),
+      shm_slot_count_(VSOMEIP_DEFAULT_SHM_SLOT_COUNT),
+      shm_slot_size_(VSOMEIP_DEFAULT_SHM_SLOT_SIZE),
+      routing_info_coalescing_time_(VSOMEIP_DEFAULT_ROUTING_INFO_COALESCING_TIME),
       npdu_default_debounce_requ_(VSOMEIP_DEFAULT_NPDU_DEBOUNCING_NANO),
       npdu_default_debounce_resp_(VSOMEIP_DEFAULT_NPDU_DEBOUNCING_NANO),
       npdu_default_max_retention_requ_(VSOMEIP_DEFAULT_NPDU_MAXIMUM_RETENTION_NANO),
@@ -142,6 +152,13 @@ configuration_impl::configuration_impl(const configuration_impl& _other)
       tcp_restart_aborts_max_(_other.tcp_restart_aborts_max_),
       tcp_connect_time_max_(_other.tcp_connect_time_max_),
       udp_receive_buffer_size_(_other.udp_receive_buffer_size_),
+      udp_receive_batch_size_(_other.udp_receive_batch_size_),
+      udp_transmit_batch_size_(_other.udp_transmit_batch_size_),
+      udp_transmit_gso_(_other.udp_transmit_gso_),
+      shm_threshold_(_other.shm_threshold_),
+      shm_slot_count_(_other.shm_slot_count_),
+      shm_slot_size_(_other.shm_slot_size_),
+      routing_info_coalescing_time_(_other.routing_info_coalescing_time_),
       npdu_default_debounce_requ_(_other.npdu_default_debounce_requ_),
       npdu_default_debounce_resp_(_other.npdu_default_debounce_resp_),
       npdu_default_max_retention_requ_(_other.npdu_default_max_retention_requ_),
@@ -164,6 +181,10 @@ configuration_impl::configuration_impl(const configuration_impl& _other)
 
     loglevel_ = _other.loglevel_;
 
+    has_async_log_         = _other.has_async_log_;
+    async_log_buffer_size_ = _other.async_log_buffer_size_;
+    log_rate_limit_        = _other.log_rate_limit_;
+
     routing_ = _other.routing_;
 
     is_sd_enabled_ = _other.is_sd_enabled_;
@@ -211,6 +232,8 @@ configuration_impl::configuration_impl(const configuration_impl& _other)
     debounces_             = _other.debounces_;
     endpoint_queue_limits_ = _other.endpoint_queue_limits_;
 
+    udp_receive_batch_sizes_ = _other.udp_receive_batch_sizes_;
+
     sd_acceptance_rules_ = _other.sd_acceptance_rules_;
 
     has_issued_methods_warning_ = _other.has_issued_methods_warning_;
@@ -220,6 +243,7 @@ configuration_impl::configuration_impl(const configuration_impl& _other)
     statistics_interval_     = _other.statistics_interval_;
     statistics_min_freq_     = _other.statistics_min_freq_;
     statistics_max_messages_ = _other.statistics_max_messages_;
+    statistics_metrics_file_ = _other.statistics_metrics_file_;
     max_remote_subscribers_  = _other.max_remote_subscribers_;
 
     is_security_enabled_      = _other.is_security_enabled_.load();
@@ -322,6 +346,15 @@ bool configuration_impl::load(const std::string& _name)
         set_mandatory(VSOMEIP_MANDATORY_CONFIGURATION_FILES);
     }
 
+    // Use pre-parsed configuration files (if existing)
+    std::string its_snapshot;
+    its_env = getenv(VSOMEIP_ENV_CONFIGURATION_SNAPSHOT);
+    if (nullptr != its_env)
+    {
+        its_snapshot = its_env;
+        snapshot_    = configuration_snapshot::open(its_snapshot);
+    }
+
     // Start reading
     std::set<std::string> its_failed;
 
@@ -355,6 +388,20 @@ bool configuration_impl::load(const std::string& _name)
         VSOMEIP_WARNING << "Reading of configuration file \"" << f
                         << "\" failed. Configuration may be incomplete.";
 
+    if (snapshot_)
+    {
+        VSOMEIP_INFO << "Using configuration snapshot: \"" << its_snapshot << "\".";
+        for (const auto& o : snapshot_outdated_)
+            VSOMEIP_WARNING << "Configuration file \"" << o
+                            << "\" is not part of the snapshot or changed. Parsed it.";
+        snapshot_outdated_.clear();
+    }
+    else if (!its_snapshot.empty())
+    {
+        VSOMEIP_WARNING << "Configuration snapshot \"" << its_snapshot
+                        << "\" is missing or invalid. Parsed the configuration files.";
+    }
+
     // set global unicast address for all services with magic cookies enabled
     set_magic_cookies_unicast_address();
 
@@ -587,6 +634,16 @@ void configuration_impl::load_policy_data(const std::string&                  _i
         }
 #endif
         boost::property_tree::ptree its_tree;
+        if (snapshot_)
+        {
+            if (snapshot_->get(_input, its_tree))
+            {
+                _elements.push_back({_input, its_tree});
+                return;
+            }
+            if (!is_loaded_)
+                snapshot_outdated_.insert(_input);
+        }
         try
         {
             boost::property_tree::json_parser::read_json(_input, its_tree);
@@ -636,6 +693,10 @@ bool configuration_impl::load_data(const std::vector<configuration_element>& _el
             load_security(e);
             load_tracing(e);
             load_udp_receive_buffer_size(e);
+            load_udp_receive_batch_sizes(e);
+            load_udp_transmit_batching(e);
+            load_shared_memory(e);
+            load_routing_info_coalescing(e);
             load_services(e);
         }
     }
@@ -764,6 +825,54 @@ bool configuration_impl::load_logging(const configuration_element& _element,
                     is_configured_[ET_LOGGING_LEVEL] = true;
                 }
             }
+            else if (its_key == "async")
+            {
+                if (is_configured_[ET_LOGGING_ASYNC])
+                {
+                    _warnings.insert("Multiple definitions for logging.async."
+                                     " Ignoring definition from "
+                                     + _element.name_);
+                }
+                else
+                {
+                    for (auto j : i->second)
+                    {
+                        std::string its_sub_key(j.first);
+                        std::string its_sub_value(j.second.data());
+                        if (its_sub_key == "enable")
+                        {
+                            has_async_log_ = (its_sub_value == "true");
+                        }
+                        else if (its_sub_key == "buffer-size")
+                        {
+                            std::stringstream its_converter;
+                            its_converter << std::dec << its_sub_value;
+                            its_converter >> async_log_buffer_size_;
+                            if (async_log_buffer_size_ == 0)
+                            {
+                                async_log_buffer_size_ = VSOMEIP_DEFAULT_ASYNC_LOG_BUFFER_SIZE;
+                            }
+                        }
+                    }
+                    is_configured_[ET_LOGGING_ASYNC] = true;
+                }
+            }
+            else if (its_key == "rate-limit")
+            {
+                if (is_configured_[ET_LOGGING_RATE_LIMIT])
+                {
+                    _warnings.insert("Multiple definitions for logging.rate-limit."
+                                     " Ignoring definition from "
+                                     + _element.name_);
+                }
+                else
+                {
+                    std::stringstream its_converter;
+                    its_converter << std::dec << i->second.data();
+                    its_converter >> log_rate_limit_;
+                    is_configured_[ET_LOGGING_RATE_LIMIT] = true;
+                }
+            }
             else if (its_key == "version")
             {
                 std::stringstream its_converter;
@@ -828,6 +937,10 @@ bool configuration_impl::load_logging(const configuration_element& _element,
                         its_converter << std::dec << its_sub_value;
                         its_converter >> statistics_max_messages_;
                     }
+                    else if (its_sub_key == "metrics-file")
+                    {
+                        statistics_metrics_file_ = its_sub_value;
+                    }
                 }
             }
         }
@@ -1126,11 +1239,14 @@ void configuration_impl::load_application_data(const boost::property_tree::ptree
     client_t    its_id(VSOMEIP_CLIENT_UNSET);
     std::size_t its_max_dispatchers(VSOMEIP_MAX_DISPATCHERS);
     std::size_t its_max_dispatch_time(VSOMEIP_MAX_DISPATCH_TIME);
+    std::size_t its_dispatch_lanes(VSOMEIP_DEFAULT_DISPATCH_LANES);
     std::size_t its_max_detached_thread_wait_time(VSOMEIP_MAX_WAIT_TIME_DETACHED_THREADS);
     std::size_t its_io_thread_count(VSOMEIP_DEFAULT_IO_THREAD_COUNT);
     std::size_t its_request_debounce_time(VSOMEIP_REQUEST_DEBOUNCE_TIME);
     std::map<plugin_type_e, std::set<std::string>> plugins;
     int                      its_io_thread_nice_level(VSOMEIP_DEFAULT_IO_THREAD_NICE_LEVEL);
+    std::size_t              its_io_shards(VSOMEIP_DEFAULT_IO_SHARDS);
+    std::vector<int>         its_io_shard_cpus;
     debounce_configuration_t its_debounces;
     bool                     has_session_handling(true);
     for (auto i = _tree.begin(); i != _tree.end(); ++i)
@@ -1164,6 +1280,22 @@ void configuration_impl::load_application_data(const boost::property_tree::ptree
             its_converter << std::dec << its_value;
             its_converter >> its_max_dispatch_time;
         }
+        else if (its_key == "dispatch_lanes")
+        {
+            its_converter << std::dec << its_value;
+            its_converter >> its_dispatch_lanes;
+            if (its_dispatch_lanes == 0)
+            {
+                VSOMEIP_WARNING << "Min. number of dispatch lanes per application is 1";
+                its_dispatch_lanes = 1;
+            }
+            else if (its_dispatch_lanes > VSOMEIP_MAX_DISPATCH_LANES)
+            {
+                VSOMEIP_WARNING << "Max. number of dispatch lanes per application is "
+                                << VSOMEIP_MAX_DISPATCH_LANES;
+                its_dispatch_lanes = VSOMEIP_MAX_DISPATCH_LANES;
+            }
+        }
         else if (its_key == "max_detached_thread_wait_time")
         {
             its_converter << std::dec << its_value;
@@ -1189,6 +1321,36 @@ void configuration_impl::load_application_data(const boost::property_tree::ptree
             its_converter << std::dec << its_value;
             its_converter >> its_io_thread_nice_level;
         }
+        else if (its_key == "io_shards")
+        {
+            its_converter << std::dec << its_value;
+            its_converter >> its_io_shards;
+            if (its_io_shards > VSOMEIP_MAX_IO_SHARDS)
+            {
+                VSOMEIP_WARNING << "Max. number of io shards per application is "
+                                << VSOMEIP_MAX_IO_SHARDS;
+                its_io_shards = VSOMEIP_MAX_IO_SHARDS;
+            }
+        }
+        else if (its_key == "io_shard_cpus")
+        {
+            for (auto j = i->second.begin(); j != i->second.end(); ++j)
+            {
+                int               its_cpu(-1);
+                std::stringstream its_cpu_converter;
+                its_cpu_converter << std::dec << j->second.data();
+                its_cpu_converter >> its_cpu;
+                if (its_cpu >= 0)
+                {
+                    its_io_shard_cpus.push_back(its_cpu);
+                }
+                else
+                {
+                    VSOMEIP_WARNING << "Ignoring invalid io shard cpu \"" << j->second.data()
+                                    << "\" of application " << its_name;
+                }
+            }
+        }
         else if (its_key == "request_debounce_time")
         {
             its_converter << std::dec << its_value;
@@ -1243,11 +1405,14 @@ void configuration_impl::load_application_data(const boost::property_tree::ptree
             applications_[its_name] = {its_id,
                                        its_max_dispatchers,
                                        its_max_dispatch_time,
+                                       its_dispatch_lanes,
                                        its_max_detached_thread_wait_time,
                                        its_io_thread_count,
                                        its_request_debounce_time,
                                        plugins,
                                        its_io_thread_nice_level,
+                                       its_io_shards,
+                                       its_io_shard_cpus,
                                        its_debounces,
                                        has_session_handling};
         }
@@ -3634,6 +3799,21 @@ vsomeip_v3::logger::level_e configuration_impl::get_loglevel() const
     return loglevel_;
 }
 
+bool configuration_impl::has_async_log() const
+{
+    return has_async_log_;
+}
+
+std::uint32_t configuration_impl::get_async_log_buffer_size() const
+{
+    return async_log_buffer_size_;
+}
+
+std::uint32_t configuration_impl::get_log_rate_limit() const
+{
+    return log_rate_limit_;
+}
+
 std::string configuration_impl::get_unicast_address(service_t _service, instance_t _instance) const
 {
     std::string its_unicast_address("");
@@ -3912,6 +4092,32 @@ int configuration_impl::get_io_thread_nice_level(const std::string& _name) const
     return its_io_thread_nice_level;
 }
 
+std::size_t configuration_impl::get_io_shards(const std::string& _name) const
+{
+    std::size_t its_io_shards = VSOMEIP_DEFAULT_IO_SHARDS;
+
+    auto found_application = applications_.find(_name);
+    if (found_application != applications_.end())
+    {
+        its_io_shards = found_application->second.io_shards_;
+    }
+
+    return its_io_shards;
+}
+
+std::vector<int> configuration_impl::get_io_shard_cpus(const std::string& _name) const
+{
+    std::vector<int> its_io_shard_cpus;
+
+    auto found_application = applications_.find(_name);
+    if (found_application != applications_.end())
+    {
+        its_io_shard_cpus = found_application->second.io_shard_cpus_;
+    }
+
+    return its_io_shard_cpus;
+}
+
 std::size_t configuration_impl::get_max_dispatchers(const std::string& _name) const
 {
     std::size_t its_max_dispatchers(VSOMEIP_MAX_DISPATCHERS);
@@ -3938,6 +4144,19 @@ std::size_t configuration_impl::get_max_dispatch_time(const std::string& _name)
     return its_max_dispatch_time;
 }
 
+std::size_t configuration_impl::get_dispatch_lanes(const std::string& _name) const
+{
+    std::size_t its_dispatch_lanes = VSOMEIP_DEFAULT_DISPATCH_LANES;
+
+    auto found_application = applications_.find(_name);
+    if (found_application != applications_.end())
+    {
+        its_dispatch_lanes = found_application->second.dispatch_lanes_;
+    }
+
+    return its_dispatch_lanes;
+}
+
 std::size_t configuration_impl::get_max_detached_thread_wait_time(const std::string& _name) const
 {
     std::size_t its_max_detached_thread_wait_time = VSOMEIP_MAX_WAIT_TIME_DETACHED_THREADS;
@@ -5572,6 +5791,250 @@ void configuration_impl::load_udp_receive_buffer_size(const configuration_elemen
     }
 }
 
+void configuration_impl::load_udp_receive_batch_sizes(const configuration_element& _element)
+{
+    const std::string its_batch_size("udp-receive-batch-size");
+    const std::string its_batch_sizes("udp-receive-batch-sizes");
+
+    auto to_batch_size = [](const std::string& _value) {
+        auto its_size = static_cast<std::uint32_t>(std::stoul(_value.c_str(), nullptr, 10));
+        if (its_size == 0)
+            its_size = 1;
+        if (its_size > VSOMEIP_MAX_UDP_RECEIVE_BATCH_SIZE)
+        {
+            VSOMEIP_WARNING << "udp-receive-batch-size " << its_size << " exceeds maximum. Using "
+                            << VSOMEIP_MAX_UDP_RECEIVE_BATCH_SIZE;
+            its_size = VSOMEIP_MAX_UDP_RECEIVE_BATCH_SIZE;
+        }
+        return its_size;
+    };
+
+    try
+    {
+        if (_element.tree_.get_child_optional(its_batch_size))
+        {
+            if (is_configured_[ET_UDP_RECEIVE_BATCH_SIZE])
+            {
+                VSOMEIP_WARNING << "Multiple definitions of " << its_batch_size
+                                << " Ignoring definition from " << _element.name_;
+            }
+            else
+            {
+                try
+                {
+                    udp_receive_batch_size_ =
+                        to_batch_size(_element.tree_.get_child(its_batch_size).data());
+                } catch (const std::exception& e)
+                {
+                    VSOMEIP_ERROR << __func__ << ": " << its_batch_size << " " << e.what();
+                }
+                is_configured_[ET_UDP_RECEIVE_BATCH_SIZE] = true;
+            }
+        }
+
+        if (_element.tree_.get_child_optional(its_batch_sizes))
+        {
+            if (is_configured_[ET_UDP_RECEIVE_BATCH_SIZES])
+            {
+                VSOMEIP_WARNING << "Multiple definitions of " << its_batch_sizes
+                                << " Ignoring definition from " << _element.name_;
+            }
+            else
+            {
+                is_configured_[ET_UDP_RECEIVE_BATCH_SIZES] = true;
+                const std::string unicast("unicast");
+                const std::string ports("ports");
+                const std::string port("port");
+                const std::string batch_size("batch-size");
+
+                for (const auto& i : _element.tree_.get_child(its_batch_sizes))
+                {
+                    if (!i.second.get_child_optional(unicast)
+                        || !i.second.get_child_optional(ports))
+                    {
+                        continue;
+                    }
+                    std::string its_unicast(i.second.get_child(unicast).data());
+                    for (const auto& j : i.second.get_child(ports))
+                    {
+                        if (!j.second.get_child_optional(port)
+                            || !j.second.get_child_optional(batch_size))
+                        {
+                            continue;
+                        }
+
+                        try
+                        {
+                            std::string p(j.second.get_child(port).data());
+                            auto its_port =
+                                static_cast<std::uint16_t>(std::stoul(p.c_str(), nullptr, 10));
+                            if (its_port != ILLEGAL_PORT)
+                            {
+                                udp_receive_batch_sizes_[its_unicast][its_port] =
+                                    to_batch_size(j.second.get_child(batch_size).data());
+                            }
+                        } catch (const std::exception& e)
+                        {
+                            VSOMEIP_ERROR << __func__ << ":" << e.what();
+                        }
+                    }
+                }
+            }
+        }
+    } catch (...)
+    {
+        // intentionally left empty
+    }
+}
+
+void configuration_impl::load_udp_transmit_batching(const configuration_element& _element)
+{
+    const std::string its_batch_size("udp-transmit-batch-size");
+    const std::string its_gso("udp-transmit-gso");
+    try
+    {
+        if (_element.tree_.get_child_optional(its_batch_size))
+        {
+            if (is_configured_[ET_UDP_TRANSMIT_BATCH_SIZE])
+            {
+                VSOMEIP_WARNING << "Multiple definitions of " << its_batch_size
+                                << " Ignoring definition from " << _element.name_;
+            }
+            else
+            {
+                const std::string its_data(_element.tree_.get_child(its_batch_size).data());
+                try
+                {
+                    udp_transmit_batch_size_ =
+                        static_cast<std::uint32_t>(std::stoul(its_data.c_str(), nullptr, 10));
+                    if (udp_transmit_batch_size_ == 0)
+                        udp_transmit_batch_size_ = 1;
+                    if (udp_transmit_batch_size_ > VSOMEIP_MAX_UDP_TRANSMIT_BATCH_SIZE)
+                    {
+                        VSOMEIP_WARNING << its_batch_size << " " << udp_transmit_batch_size_
+                                        << " exceeds maximum. Using "
+                                        << VSOMEIP_MAX_UDP_TRANSMIT_BATCH_SIZE;
+                        udp_transmit_batch_size_ = VSOMEIP_MAX_UDP_TRANSMIT_BATCH_SIZE;
+                    }
+                } catch (const std::exception& e)
+                {
+                    VSOMEIP_ERROR << __func__ << ": " << its_batch_size << " " << e.what();
+                }
+                is_configured_[ET_UDP_TRANSMIT_BATCH_SIZE] = true;
+            }
+        }
+
+        if (_element.tree_.get_child_optional(its_gso))
+        {
+            if (is_configured_[ET_UDP_TRANSMIT_GSO])
+            {
+                VSOMEIP_WARNING << "Multiple definitions of " << its_gso
+                                << " Ignoring definition from " << _element.name_;
+            }
+            else
+            {
+                udp_transmit_gso_ = (_element.tree_.get_child(its_gso).data() == "true");
+                is_configured_[ET_UDP_TRANSMIT_GSO] = true;
+            }
+        }
+    } catch (...)
+    {
+        // intentionally left empty
+    }
+}
+
+void configuration_impl::load_shared_memory(const configuration_element& _element)
+{
+    const std::string its_shared_memory("shared-memory");
+    try
+    {
+        auto its_tree = _element.tree_.get_child_optional(its_shared_memory);
+        if (!its_tree)
+            return;
+
+        if (is_configured_[ET_SHARED_MEMORY])
+        {
+            VSOMEIP_WARNING << "Multiple definitions of " << its_shared_memory
+                            << " Ignoring definition from " << _element.name_;
+            return;
+        }
+
+        shm_threshold_ = VSOMEIP_DEFAULT_SHM_THRESHOLD;
+        for (const auto& i : *its_tree)
+        {
+            try
+            {
+                const auto its_value =
+                    static_cast<std::uint32_t>(std::stoul(i.second.data(), nullptr, 0));
+                if (i.first == "threshold")
+                {
+                    shm_threshold_ = its_value;
+                }
+                else if (i.first == "slot-count")
+                {
+                    shm_slot_count_ = its_value;
+                }
+                else if (i.first == "slot-size")
+                {
+                    shm_slot_size_ = its_value;
+                }
+            } catch (const std::exception& e)
+            {
+                VSOMEIP_ERROR << __func__ << ": " << its_shared_memory << "." << i.first << " "
+                              << e.what();
+            }
+        }
+
+        if (shm_slot_count_ == 0 || shm_slot_size_ == 0 || shm_threshold_ > shm_slot_size_)
+        {
+            VSOMEIP_WARNING << its_shared_memory << ": threshold " << shm_threshold_
+                            << " does not fit into " << shm_slot_count_ << " slots of "
+                            << shm_slot_size_ << " bytes. Disabling shared memory.";
+            shm_threshold_ = 0;
+        }
+        else if (shm_threshold_ == 0)
+        {
+            shm_threshold_ = 1;
+        }
+        is_configured_[ET_SHARED_MEMORY] = true;
+    } catch (...)
+    {
+        // intentionally left empty
+    }
+}
+
+void configuration_impl::load_routing_info_coalescing(const configuration_element& _element)
+{
+    const std::string its_coalescing("routing-info-coalescing");
+    try
+    {
+        if (_element.tree_.get_child_optional(its_coalescing))
+        {
+            if (is_configured_[ET_ROUTING_INFO_COALESCING])
+            {
+                VSOMEIP_WARNING << "Multiple definitions of " << its_coalescing
+                                << " Ignoring definition from " << _element.name_;
+            }
+            else
+            {
+                const std::string its_data(_element.tree_.get_child(its_coalescing).data());
+                try
+                {
+                    routing_info_coalescing_time_ =
+                        static_cast<std::uint32_t>(std::stoul(its_data.c_str(), nullptr, 10));
+                } catch (const std::exception& e)
+                {
+                    VSOMEIP_ERROR << __func__ << ": " << its_coalescing << " " << e.what();
+                }
+                is_configured_[ET_ROUTING_INFO_COALESCING] = true;
+            }
+        }
+    } catch (...)
+    {
+        // intentionally left empty
+    }
+}
+
 void configuration_impl::load_secure_services(const configuration_element& _element)
 {
     std::lock_guard<std::mutex> its_lock(secure_services_mutex_);
@@ -5992,6 +6455,51 @@ int configuration_impl::get_udp_receive_buffer_size() const
     return udp_receive_buffer_size_;
 }
 
+std::uint32_t configuration_impl::get_udp_receive_batch_size(const std::string& _address,
+                                                             std::uint16_t      _port) const
+{
+    auto found_address = udp_receive_batch_sizes_.find(_address);
+    if (found_address != udp_receive_batch_sizes_.end())
+    {
+        auto found_port = found_address->second.find(_port);
+        if (found_port != found_address->second.end())
+        {
+            return found_port->second;
+        }
+    }
+    return udp_receive_batch_size_;
+}
+
+std::uint32_t configuration_impl::get_udp_transmit_batch_size() const
+{
+    return udp_transmit_batch_size_;
+}
+
+bool configuration_impl::is_udp_transmit_gso_enabled() const
+{
+    return udp_transmit_gso_;
+}
+
+std::uint32_t configuration_impl::get_shm_threshold() const
+{
+    return shm_threshold_;
+}
+
+std::uint32_t configuration_impl::get_shm_slot_count() const
+{
+    return shm_slot_count_;
+}
+
+std::uint32_t configuration_impl::get_shm_slot_size() const
+{
+    return shm_slot_size_;
+}
+
+std::uint32_t configuration_impl::get_routing_info_coalescing_time() const
+{
+    return routing_info_coalescing_time_;
+}
+
 bool configuration_impl::is_tp_client(service_t _service, instance_t _instance,
                                       method_t _method) const
 {
@@ -6094,6 +6602,11 @@ uint32_t configuration_impl::get_statistics_max_messages() const
     return statistics_max_messages_;
 }
 
+const std::string& configuration_impl::get_statistics_metrics_file() const
+{
+    return statistics_metrics_file_;
+}
+
 uint8_t configuration_impl::get_max_remote_subscribers() const
 {
     return max_remote_subscribers_;
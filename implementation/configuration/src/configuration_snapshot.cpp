@@ -0,0 +1,335 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <boost/filesystem.hpp>
+
+#include "../include/configuration_snapshot.hpp"
+
+namespace vsomeip_v3 {
+namespace cfg {
+
+namespace {
+
+const char MAGIC[8] = {'V', 'S', 'I', 'P', 'C', 'F', 'G', '\0'};
+
+struct header
+{
+    char          magic_[8];
+    std::uint32_t version_;
+    std::uint32_t count_;
+    std::uint64_t size_;
+};
+
+// The names are stored as absolute paths, so the snapshot can be used
+// independent of the working directory.
+std::string get_key(const std::string& _name)
+{
+    try
+    {
+        return boost::filesystem::absolute(_name).lexically_normal().string();
+    } catch (const boost::filesystem::filesystem_error&)
+    {
+        return _name;
+    }
+}
+
+bool get_status(const std::string& _name, std::uint64_t& _size, std::int64_t& _modified)
+{
+    struct stat its_status;
+    if (stat(_name.c_str(), &its_status) != 0)
+        return false;
+
+    _size = static_cast<std::uint64_t>(its_status.st_size);
+#if defined(__linux__) || defined(ANDROID)
+    _modified = static_cast<std::int64_t>(its_status.st_mtim.tv_sec) * 1000000000
+                + static_cast<std::int64_t>(its_status.st_mtim.tv_nsec);
+#else
+    _modified = static_cast<std::int64_t>(its_status.st_mtime) * 1000000000;
+#endif
+    return true;
+}
+
+void append(std::vector<std::uint8_t>& _buffer, const void* _data, std::size_t _size)
+{
+    const auto its_data = reinterpret_cast<const std::uint8_t*>(_data);
+    _buffer.insert(_buffer.end(), its_data, its_data + _size);
+}
+
+void append(std::vector<std::uint8_t>& _buffer, std::uint32_t _value)
+{
+    append(_buffer, &_value, sizeof(_value));
+}
+
+void append(std::vector<std::uint8_t>& _buffer, const std::string& _value)
+{
+    append(_buffer, static_cast<std::uint32_t>(_value.size()));
+    append(_buffer, _value.data(), _value.size());
+}
+
+// node := data, number of children, (key, node) of each child
+void append(std::vector<std::uint8_t>& _buffer, const boost::property_tree::ptree& _tree)
+{
+    append(_buffer, _tree.data());
+    append(_buffer, static_cast<std::uint32_t>(_tree.size()));
+    for (const auto& c : _tree)
+    {
+        append(_buffer, c.first);
+        append(_buffer, c.second);
+    }
+}
+
+} // namespace
+
+struct configuration_snapshot::entry
+{
+    std::uint64_t size_;
+    std::int64_t  modified_;
+    std::uint32_t name_offset_;
+    std::uint32_t name_length_;
+    std::uint32_t tree_offset_;
+    std::uint32_t tree_length_;
+};
+
+bool configuration_snapshot::write(const std::string&                        _path,
+                                   const std::vector<configuration_element>& _elements)
+{
+    std::vector<std::pair<std::string, const configuration_element*>> its_elements;
+    for (const auto& e : _elements)
+        its_elements.emplace_back(get_key(e.name_), &e);
+    std::sort(its_elements.begin(), its_elements.end(),
+              [](const std::pair<std::string, const configuration_element*>& _a,
+                 const std::pair<std::string, const configuration_element*>& _b) {
+                  return _a.first < _b.first;
+              });
+
+    std::vector<entry>        its_entries(its_elements.size());
+    std::vector<std::uint8_t> its_data;
+    const std::size_t         its_base = sizeof(header) + its_entries.size() * sizeof(entry);
+    for (std::size_t i = 0; i < its_elements.size(); ++i)
+    {
+        auto& its_entry = its_entries[i];
+        if (!get_status(its_elements[i].second->name_, its_entry.size_, its_entry.modified_))
+            return false;
+
+        its_entry.name_offset_ = static_cast<std::uint32_t>(its_base + its_data.size());
+        its_entry.name_length_ = static_cast<std::uint32_t>(its_elements[i].first.size());
+        append(its_data, its_elements[i].first.data(), its_elements[i].first.size());
+
+        its_entry.tree_offset_ = static_cast<std::uint32_t>(its_base + its_data.size());
+        append(its_data, its_elements[i].second->tree_);
+        its_entry.tree_length_ =
+            static_cast<std::uint32_t>(its_base + its_data.size() - its_entry.tree_offset_);
+    }
+    if (its_base + its_data.size() > std::numeric_limits<std::uint32_t>::max())
+        return false;
+
+    header its_header;
+    std::memcpy(its_header.magic_, MAGIC, sizeof(MAGIC));
+    its_header.version_ = VERSION;
+    its_header.count_   = static_cast<std::uint32_t>(its_entries.size());
+    its_header.size_    = its_base + its_data.size();
+
+    // Replace an existing snapshot instead of overwriting it, as
+    // applications might have mapped it
+    const std::string its_temporary(_path + ".tmp");
+    {
+        std::ofstream its_file(its_temporary, std::ios::binary | std::ios::trunc);
+        its_file.write(reinterpret_cast<const char*>(&its_header), sizeof(its_header));
+        if (!its_entries.empty())
+            its_file.write(reinterpret_cast<const char*>(its_entries.data()),
+                           static_cast<std::streamsize>(its_entries.size() * sizeof(entry)));
+        its_file.write(reinterpret_cast<const char*>(its_data.data()),
+                       static_cast<std::streamsize>(its_data.size()));
+        if (!its_file.good())
+        {
+            std::remove(its_temporary.c_str());
+            return false;
+        }
+    }
+    return (std::rename(its_temporary.c_str(), _path.c_str()) == 0);
+}
+
+std::shared_ptr<configuration_snapshot> configuration_snapshot::open(const std::string& _path)
+{
+    const std::uint8_t* its_data(nullptr);
+    std::size_t         its_size(0);
+    bool                is_mapped(false);
+
+#ifndef _WIN32
+    int its_descriptor = ::open(_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (its_descriptor < 0)
+        return nullptr;
+
+    struct stat its_status;
+    if (fstat(its_descriptor, &its_status) == 0
+        && static_cast<std::size_t>(its_status.st_size) >= sizeof(header))
+    {
+        its_size      = static_cast<std::size_t>(its_status.st_size);
+        void* its_map = mmap(nullptr, its_size, PROT_READ, MAP_SHARED, its_descriptor, 0);
+        if (its_map != MAP_FAILED)
+        {
+            its_data  = reinterpret_cast<const std::uint8_t*>(its_map);
+            is_mapped = true;
+        }
+    }
+    ::close(its_descriptor);
+#else
+    std::ifstream its_file(_path, std::ios::binary | std::ios::ate);
+    if (its_file.is_open())
+    {
+        its_size = static_cast<std::size_t>(its_file.tellg());
+        if (its_size >= sizeof(header))
+        {
+            auto its_buffer = new std::uint8_t[its_size];
+            its_file.seekg(0);
+            its_file.read(reinterpret_cast<char*>(its_buffer),
+                          static_cast<std::streamsize>(its_size));
+            its_data = its_buffer;
+        }
+    }
+#endif
+    if (its_data == nullptr)
+        return nullptr;
+
+    std::shared_ptr<configuration_snapshot> its_snapshot(
+        new configuration_snapshot(its_data, its_size, is_mapped));
+
+    header its_header;
+    std::memcpy(&its_header, its_data, sizeof(its_header));
+    if (std::memcmp(its_header.magic_, MAGIC, sizeof(MAGIC)) != 0 || its_header.version_ != VERSION
+        || its_header.size_ != its_size
+        || (its_size - sizeof(header)) / sizeof(entry) < its_header.count_)
+        return nullptr;
+
+    return its_snapshot;
+}
+
+configuration_snapshot::configuration_snapshot(const std::uint8_t* _data, std::size_t _size,
+                                               bool _is_mapped)
+    : data_(_data), size_(_size), is_mapped_(_is_mapped)
+{}
+
+configuration_snapshot::~configuration_snapshot()
+{
+#ifndef _WIN32
+    if (is_mapped_)
+    {
+        munmap(const_cast<std::uint8_t*>(data_), size_);
+        return;
+    }
+#endif
+    delete[] data_;
+}
+
+bool configuration_snapshot::get(const std::string& _name, boost::property_tree::ptree& _tree) const
+{
+    entry its_entry;
+    if (!find(get_key(_name), its_entry))
+        return false;
+
+    std::uint64_t its_size;
+    std::int64_t  its_modified;
+    if (!get_status(_name, its_size, its_modified) || its_size != its_entry.size_
+        || its_modified != its_entry.modified_)
+        return false;
+
+    const std::size_t its_end = std::size_t(its_entry.tree_offset_) + its_entry.tree_length_;
+    if (its_end > size_)
+        return false;
+
+    std::size_t                 its_offset(its_entry.tree_offset_);
+    boost::property_tree::ptree its_tree;
+    if (!restore(its_offset, its_end, its_tree) || its_offset != its_end)
+        return false;
+
+    _tree.swap(its_tree);
+    return true;
+}
+
+std::size_t configuration_snapshot::get_size() const
+{
+    header its_header;
+    std::memcpy(&its_header, data_, sizeof(its_header));
+    return its_header.count_;
+}
+
+bool configuration_snapshot::find(const std::string& _name, entry& _entry) const
+{
+    const std::size_t its_count(get_size());
+    std::size_t       its_first(0), its_last(its_count);
+    while (its_first < its_last)
+    {
+        const std::size_t its_middle = its_first + (its_last - its_first) / 2;
+        std::memcpy(&_entry, data_ + sizeof(header) + its_middle * sizeof(entry), sizeof(entry));
+        if (std::size_t(_entry.name_offset_) + _entry.name_length_ > size_)
+            return false;
+
+        const int its_result = _name.compare(
+            0, std::string::npos, reinterpret_cast<const char*>(data_ + _entry.name_offset_),
+            _entry.name_length_);
+        if (its_result == 0)
+            return true;
+        if (its_result > 0)
+            its_first = its_middle + 1;
+        else
+            its_last = its_middle;
+    }
+    return false;
+}
+
+bool configuration_snapshot::read(std::size_t& _offset, std::size_t _end,
+                                  std::uint32_t& _value) const
+{
+    if (_end - _offset < sizeof(_value))
+        return false;
+
+    std::memcpy(&_value, data_ + _offset, sizeof(_value));
+    _offset += sizeof(_value);
+    return true;
+}
+
+bool configuration_snapshot::restore(std::size_t& _offset, std::size_t _end,
+                                     boost::property_tree::ptree& _tree) const
+{
+    std::uint32_t its_length, its_count;
+    if (!read(_offset, _end, its_length) || _end - _offset < its_length)
+        return false;
+    _tree.data().assign(reinterpret_cast<const char*>(data_ + _offset), its_length);
+    _offset += its_length;
+
+    if (!read(_offset, _end, its_count))
+        return false;
+    for (std::uint32_t i = 0; i < its_count; ++i)
+    {
+        if (!read(_offset, _end, its_length) || _end - _offset < its_length)
+            return false;
+        auto its_child = _tree.push_back(
+            std::make_pair(std::string(reinterpret_cast<const char*>(data_ + _offset), its_length),
+                           boost::property_tree::ptree()));
+        _offset += its_length;
+
+        if (!restore(_offset, _end, its_child->second))
+            return false;
+    }
+    return true;
+}
+
+} // namespace cfg
+} // namespace vsomeip_v3
@@ -35,9 +35,9 @@ public:
     VSOMEIP_EXPORT std::size_t get_protection_base(e2exf::data_identifier_t _id) const override;
 
     VSOMEIP_EXPORT void protect(e2exf::data_identifier_t id,
-            e2e_buffer &_buffer, instance_t _instance) override;
+            const buffer_span &_buffer, instance_t _instance) override;
     VSOMEIP_EXPORT void check(e2exf::data_identifier_t id,
-            const e2e_buffer &_buffer, instance_t _instance,
+            const buffer_view &_buffer, instance_t _instance,
             profile_interface::check_status_t &_generic_check_status) override;
 
 private:
@@ -22,12 +22,11 @@ public:
     explicit profile_01_checker(const profile_config &_config) :
             config_(_config) {}
 
-    void check(const e2e_buffer &_buffer, instance_t _instance,
+    void check(const buffer_view &_buffer, instance_t _instance,
             e2e::profile_interface::check_status_t &_generic_check_status) override final;
 
 private:
     profile_config config_;
-    std::mutex check_mutex_;
 
 };
 
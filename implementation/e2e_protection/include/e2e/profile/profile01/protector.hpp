@@ -6,7 +6,7 @@
 #ifndef VSOMEIP_V3_E2E_PROFILE01_PROTECTOR_HPP
 #define VSOMEIP_V3_E2E_PROFILE01_PROTECTOR_HPP
 
-#include <mutex>
+#include <atomic>
 
 #include "../profile01/profile_01.hpp"
 #include "../profile_interface/protector.hpp"
@@ -21,22 +21,21 @@ public:
 
     explicit protector(const profile_config &_config) : config_(_config), counter_(0) {};
 
-    void protect(e2e_buffer &_buffer, instance_t _instance) override final;
+    void protect(const buffer_span &_buffer, instance_t _instance) override final;
 
 private:
 
-    void write_counter(e2e_buffer &_buffer);
+    void write_counter(const buffer_span &_buffer, uint8_t _counter);
 
-    void write_data_id(e2e_buffer &_buffer);
+    void write_data_id(const buffer_span &_buffer);
 
-    void write_crc(e2e_buffer &_buffer, uint8_t _computed_crc);
+    void write_crc(const buffer_span &_buffer, uint8_t _computed_crc);
 
-    void increment_counter(void);
+    uint8_t next_counter(void);
 
 private:
     profile_config config_;
-    uint8_t counter_;
-    std::mutex protect_mutex_;
+    std::atomic<uint8_t> counter_;
 };
 
 } // namespace profile01
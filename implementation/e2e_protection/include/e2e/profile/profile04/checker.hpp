@@ -6,10 +6,9 @@
 #ifndef VSOMEIP_V3_E2E_PROFILE04_CHECKER_HPP
 #define VSOMEIP_V3_E2E_PROFILE04_CHECKER_HPP
 
-#include <map>
-
 #include "../profile04/profile_04.hpp"
 #include "../profile_interface/checker.hpp"
+#include "../profile_interface/instance_counters.hpp"
 
 namespace vsomeip_v3 {
 namespace e2e {
@@ -24,20 +23,18 @@ public:
     explicit profile_04_checker(const profile_config &_config) :
             config_(_config) {}
 
-    void check(const e2e_buffer &_buffer, instance_t _instance,
+    void check(const buffer_view &_buffer, instance_t _instance,
             e2e::profile_interface::check_status_t &_generic_check_status) override final;
 
 private:
-    bool verify_input(const e2e_buffer &_buffer) const;
+    bool verify_input(const buffer_view &_buffer) const;
     bool verify_counter(instance_t _instance, uint16_t _received_counter);
 
-    bool read_16(const e2e_buffer &_buffer, uint16_t &_data, size_t _index) const;
-    bool read_32(const e2e_buffer &_buffer, uint32_t &_data, size_t _index) const;
-
-    std::mutex check_mutex_;
+    bool read_16(const buffer_view &_buffer, uint16_t &_data, size_t _index) const;
+    bool read_32(const buffer_view &_buffer, uint32_t &_data, size_t _index) const;
 
     profile_config config_;
-    std::map<instance_t, uint16_t> counter_;
+    e2e::profile_interface::instance_counters<uint16_t> counter_;
 };
 
 } // namespace profile_04
@@ -6,10 +6,8 @@
 #ifndef VSOMEIP_V3_E2E_PROFILE05_PROTECTOR_HPP
 #define VSOMEIP_V3_E2E_PROFILE05_PROTECTOR_HPP
 
-#include <map>
-#include <mutex>
-
 #include "../profile05/profile_05.hpp"
+#include "../profile_interface/instance_counters.hpp"
 #include "../profile_interface/protector.hpp"
 
 namespace vsomeip_v3 {
@@ -23,20 +21,18 @@ public:
     explicit protector(const profile_config &_config)
         : config_(_config) {}
 
-    void protect(e2e_buffer &_buffer, instance_t _instance) override final;
+    void protect(const buffer_span &_buffer, instance_t _instance) override final;
 
 private:
-    bool verify_inputs(e2e_buffer &_buffer);
-    uint8_t get_counter(instance_t _instance) const;
-    void increment_counter(instance_t _instance);
+    bool verify_inputs(const buffer_span &_buffer);
+    uint8_t next_counter(instance_t _instance);
 
-    void write_counter(e2e_buffer &_buffer, uint8_t _data, size_t _index);
-    void write_crc(e2e_buffer &_buffer, uint16_t _data, size_t _index);
+    void write_counter(const buffer_span &_buffer, uint8_t _data, size_t _index);
+    void write_crc(const buffer_span &_buffer, uint16_t _data, size_t _index);
 
 private:
     profile_config config_;
-    std::map<instance_t, uint8_t> counter_;
-    std::mutex protect_mutex_;
+    e2e::profile_interface::instance_counters<uint8_t> counter_;
 };
 
 } // namespace profile_05
@@ -8,7 +8,6 @@
 
 #include "../profile_custom/profile_custom.hpp"
 #include "../profile_interface/checker.hpp"
-#include <mutex>
 
 namespace vsomeip_v3 {
 namespace e2e {
@@ -23,15 +22,14 @@ public:
     explicit profile_custom_checker(const e2e::profile_custom::profile_config &_config) :
             config_(_config) {}
 
-    void check(const e2e_buffer &_buffer, instance_t _instance,
+    void check(const buffer_view &_buffer, instance_t _instance,
             e2e::profile_interface::check_status_t &_generic_check_status) override final;
 
 private:
-    uint32_t read_crc(const e2e_buffer &_buffer) const;
+    uint32_t read_crc(const buffer_view &_buffer) const;
 
 private:
     profile_config config_;
-    std::mutex check_mutex_;
 
 };
 
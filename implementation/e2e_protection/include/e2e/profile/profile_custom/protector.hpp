@@ -6,7 +6,6 @@
 #ifndef VSOMEIP_V3_E2E_PROFILE_CUSTOM_PROTECTOR_HPP
 #define VSOMEIP_V3_E2E_PROFILE_CUSTOM_PROTECTOR_HPP
 
-#include <mutex>
 #include "../profile_custom/profile_custom.hpp"
 #include "../profile_interface/protector.hpp"
 
@@ -20,15 +19,14 @@ public:
 
     explicit protector(const profile_config &_config) : config_(_config){};
 
-    void protect(e2e_buffer &_buffer, instance_t _instance) override final;
+    void protect(const buffer_span &_buffer, instance_t _instance) override final;
 
 private:
 
-    void write_crc(e2e_buffer &_buffer, uint32_t _computed_crc);
+    void write_crc(const buffer_span &_buffer, uint32_t _computed_crc);
 
 private:
     profile_config config_;
-    std::mutex protect_mutex_;
 };
 
 } // namespace profile_custom
@@ -0,0 +1,89 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_E2E_PROFILE_INTERFACE_INSTANCE_COUNTERS_HPP
+#define VSOMEIP_V3_E2E_PROFILE_INTERFACE_INSTANCE_COUNTERS_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include <vsomeip/primitive_types.hpp>
+
+namespace vsomeip_v3 {
+namespace e2e {
+namespace profile_interface {
+
+//
+// Per-instance E2E counters that are shared by concurrent protect/check calls
+// without a lock. Slots are claimed by CAS on first use and never released,
+// as a profile instance only ever sees the instances of its data element.
+//
+template<typename counter_t_, std::size_t size_ = 256>
+class instance_counters {
+    static_assert((size_ & (size_ - 1)) == 0, "size must be a power of two");
+
+public:
+    // Returns the counter of _instance. If the instance is new, its counter is
+    // set to _initial and _is_inserted becomes true. Returns nullptr if all
+    // slots are taken by other instances.
+    std::atomic<counter_t_>* get(instance_t _instance, counter_t_ _initial, bool& _is_inserted)
+    {
+        const std::uint32_t its_key = std::uint32_t(_instance) + 1;
+
+        _is_inserted = false;
+        for (std::size_t i = 0; i < size_; ++i)
+        {
+            slot& its_slot = slots_[(std::size_t(_instance) + i) & (size_ - 1)];
+
+            std::uint32_t its_current = its_slot.key_.load(std::memory_order_acquire);
+            if (its_current == 0)
+            {
+                if (its_slot.key_.compare_exchange_strong(its_current, its_key | BUSY,
+                                                          std::memory_order_acq_rel))
+                {
+                    its_slot.counter_.store(_initial, std::memory_order_relaxed);
+                    its_slot.key_.store(its_key, std::memory_order_release);
+                    _is_inserted = true;
+                    return &its_slot.counter_;
+                }
+            }
+
+            // Another thread is just initializing the slot
+            while (its_current & BUSY)
+            {
+                std::this_thread::yield();
+                its_current = its_slot.key_.load(std::memory_order_acquire);
+            }
+
+            if (its_current == its_key)
+                return &its_slot.counter_;
+        }
+        return nullptr;
+    }
+
+    std::atomic<counter_t_>* get(instance_t _instance)
+    {
+        bool is_inserted;
+        return get(_instance, counter_t_(0), is_inserted);
+    }
+
+private:
+    static constexpr std::uint32_t BUSY = 0x80000000U;
+
+    struct slot {
+        std::atomic<std::uint32_t> key_{0};
+        std::atomic<counter_t_>    counter_{0};
+    };
+
+    std::array<slot, size_> slots_;
+};
+
+} // namespace profile_interface
+} // namespace e2e
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_E2E_PROFILE_INTERFACE_INSTANCE_COUNTERS_HPP
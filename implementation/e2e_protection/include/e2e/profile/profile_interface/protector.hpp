@@ -17,7 +17,7 @@ namespace profile_interface {
 
 class protector : public profile_interface {
 public:
-    virtual void protect(e2e_buffer &_buffer,
+    virtual void protect(const buffer_span &_buffer,
             instance_t _instance) = 0;
 };
 
@@ -8,8 +8,278 @@
 #include <string>
 #include <iomanip>
 
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define VSOMEIP_E2E_CRC_CLMUL
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRYPTO)
+#include <arm_neon.h>
+#define VSOMEIP_E2E_CRC_PMULL
+#endif
+
 namespace vsomeip_v3 {
 
+namespace {
+
+// Buffers of at least this size are folded with carry-less multiplication
+const size_t fold_threshold = 128;
+
+inline uint64_t load_le64(const uint8_t* _data)
+{
+    return (uint64_t(_data[0]) | uint64_t(_data[1]) << 8 | uint64_t(_data[2]) << 16
+            | uint64_t(_data[3]) << 24 | uint64_t(_data[4]) << 32 | uint64_t(_data[5]) << 40
+            | uint64_t(_data[6]) << 48 | uint64_t(_data[7]) << 56);
+}
+
+/**
+ * Slice-by-8 tables of a reflected CRC, derived from its byte-wise table.
+ * Table k holds the CRC of a byte that is followed by k zero bytes.
+ */
+template<typename crc_t_>
+class reflected_slices {
+public:
+    explicit reflected_slices(const crc_t_ (&_table)[256])
+    {
+        for (size_t b = 0; b < 256; ++b)
+            table_[0][b] = _table[b];
+        for (size_t k = 1; k < 8; ++k)
+            for (size_t b = 0; b < 256; ++b)
+                table_[k][b] = static_cast<crc_t_>(
+                    (table_[k - 1][b] >> 8U) ^ table_[0][table_[k - 1][b] & 0xFFU]);
+    }
+
+    crc_t_ update(crc_t_ _crc, const uint8_t* _data, size_t _length) const
+    {
+        for (; _length >= 8; _data += 8, _length -= 8)
+        {
+            const uint64_t its_word = load_le64(_data) ^ _crc;
+            _crc = static_cast<crc_t_>(
+                table_[7][its_word & 0xFFU] ^ table_[6][(its_word >> 8U) & 0xFFU]
+                ^ table_[5][(its_word >> 16U) & 0xFFU] ^ table_[4][(its_word >> 24U) & 0xFFU]
+                ^ table_[3][(its_word >> 32U) & 0xFFU] ^ table_[2][(its_word >> 40U) & 0xFFU]
+                ^ table_[1][(its_word >> 48U) & 0xFFU] ^ table_[0][its_word >> 56U]);
+        }
+        for (; _length > 0; ++_data, --_length)
+            _crc = static_cast<crc_t_>(table_[0][static_cast<uint8_t>(*_data ^ _crc)]
+                                       ^ (_crc >> 8U));
+        return _crc;
+    }
+
+private:
+    crc_t_ table_[8][256];
+};
+
+/**
+ * Slice-by-8 tables of the non-reflected 16 bit CRC of profile 05.
+ */
+class slices_16 {
+public:
+    explicit slices_16(const uint16_t (&_table)[256])
+    {
+        for (size_t b = 0; b < 256; ++b)
+            table_[0][b] = _table[b];
+        for (size_t k = 1; k < 8; ++k)
+            for (size_t b = 0; b < 256; ++b)
+                table_[k][b] = static_cast<uint16_t>(
+                    (table_[k - 1][b] << 8U) ^ table_[0][table_[k - 1][b] >> 8U]);
+    }
+
+    uint16_t update(uint16_t _crc, const uint8_t* _data, size_t _length) const
+    {
+        for (; _length >= 8; _data += 8, _length -= 8)
+        {
+            _crc = static_cast<uint16_t>(
+                table_[7][_data[0] ^ (_crc >> 8U)] ^ table_[6][_data[1] ^ (_crc & 0xFFU)]
+                ^ table_[5][_data[2]] ^ table_[4][_data[3]] ^ table_[3][_data[4]]
+                ^ table_[2][_data[5]] ^ table_[1][_data[6]] ^ table_[0][_data[7]]);
+        }
+        for (; _length > 0; ++_data, --_length)
+            _crc = static_cast<uint16_t>(table_[0][static_cast<uint8_t>((_crc >> 8U) ^ *_data)]
+                                         ^ (_crc << 8U));
+        return _crc;
+    }
+
+private:
+    uint16_t table_[8][256];
+};
+
+/**
+ * Folding constants of a reflected CRC. The carry-less product of two
+ * reflected 64 bit values is the product of their polynomials times x, so
+ * folding a 128 bit block over a distance of d bits multiplies its upper
+ * half by x^(d+63) mod P and its lower half by x^(d-1) mod P.
+ */
+struct fold_constants {
+    fold_constants(uint64_t _poly, unsigned _width)
+        : k_128_upper_(get_reflected_power(191, _poly, _width)),
+          k_128_lower_(get_reflected_power(127, _poly, _width)),
+          k_512_upper_(get_reflected_power(575, _poly, _width)),
+          k_512_lower_(get_reflected_power(511, _poly, _width))
+    {}
+
+    // Returns x^_power mod P with bit i holding the coefficient of x^(63-i)
+    static uint64_t get_reflected_power(unsigned _power, uint64_t _poly, unsigned _width)
+    {
+        const uint64_t its_top(uint64_t(1) << (_width - 1));
+        uint64_t       its_remainder(1);
+        for (unsigned i = 0; i < _power; ++i)
+        {
+            const bool has_carry((its_remainder & its_top) != 0);
+            its_remainder <<= 1U;
+            if (_width < 64)
+                its_remainder &= (uint64_t(1) << _width) - 1;
+            if (has_carry)
+                its_remainder ^= _poly;
+        }
+
+        uint64_t its_reflected(0);
+        for (unsigned i = 0; i < 64; ++i)
+            if (its_remainder & (uint64_t(1) << i))
+                its_reflected |= uint64_t(1) << (63 - i);
+        return its_reflected;
+    }
+
+    uint64_t k_128_upper_;
+    uint64_t k_128_lower_;
+    uint64_t k_512_upper_;
+    uint64_t k_512_lower_;
+};
+
+#if defined(VSOMEIP_E2E_CRC_CLMUL)
+bool has_clmul()
+{
+    static const bool is_supported(__builtin_cpu_supports("pclmul"));
+    return is_supported;
+}
+
+__attribute__((target("pclmul,sse2"))) inline __m128i fold(__m128i _block, __m128i _k)
+{
+    return _mm_xor_si128(_mm_clmulepi64_si128(_block, _k, 0x00),
+                         _mm_clmulepi64_si128(_block, _k, 0x11));
+}
+
+/**
+ * Folds _data (at least 64 bytes) into a 16 byte block that has the same
+ * remainder. _crc is the CRC state before _data. Returns the number of bytes
+ * that were folded, the remaining ones must be processed byte- or slice-wise
+ * after the block.
+ */
+__attribute__((target("pclmul,sse2"))) size_t fold_blocks(const uint8_t* _data, size_t _length,
+                                                          uint64_t _crc,
+                                                          const fold_constants& _constants,
+                                                          uint8_t (&_block)[16])
+{
+    const __m128i k_128(_mm_set_epi64x(static_cast<long long>(_constants.k_128_lower_),
+                                       static_cast<long long>(_constants.k_128_upper_)));
+    const __m128i k_512(_mm_set_epi64x(static_cast<long long>(_constants.k_512_lower_),
+                                       static_cast<long long>(_constants.k_512_upper_)));
+    const uint8_t* its_data(_data);
+
+    __m128i x0 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(its_data)),
+                               _mm_set_epi64x(0, static_cast<long long>(_crc)));
+    __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(its_data + 16));
+    __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(its_data + 32));
+    __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(its_data + 48));
+    its_data += 64;
+
+    for (; _data + _length - its_data >= 64; its_data += 64)
+    {
+        x0 = _mm_xor_si128(fold(x0, k_512),
+                           _mm_loadu_si128(reinterpret_cast<const __m128i*>(its_data)));
+        x1 = _mm_xor_si128(fold(x1, k_512),
+                           _mm_loadu_si128(reinterpret_cast<const __m128i*>(its_data + 16)));
+        x2 = _mm_xor_si128(fold(x2, k_512),
+                           _mm_loadu_si128(reinterpret_cast<const __m128i*>(its_data + 32)));
+        x3 = _mm_xor_si128(fold(x3, k_512),
+                           _mm_loadu_si128(reinterpret_cast<const __m128i*>(its_data + 48)));
+    }
+
+    x1 = _mm_xor_si128(fold(x0, k_128), x1);
+    x2 = _mm_xor_si128(fold(x1, k_128), x2);
+    x3 = _mm_xor_si128(fold(x2, k_128), x3);
+    for (; _data + _length - its_data >= 16; its_data += 16)
+        x3 = _mm_xor_si128(fold(x3, k_128),
+                           _mm_loadu_si128(reinterpret_cast<const __m128i*>(its_data)));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(_block), x3);
+    return static_cast<size_t>(its_data - _data);
+}
+#elif defined(VSOMEIP_E2E_CRC_PMULL)
+bool has_clmul()
+{
+    return true;
+}
+
+inline uint8x16_t fold(uint8x16_t _block, uint64_t _upper, uint64_t _lower)
+{
+    const uint64x2_t its_block(vreinterpretq_u64_u8(_block));
+    return veorq_u8(
+        vreinterpretq_u8_p128(vmull_p64(vgetq_lane_u64(its_block, 0), _upper)),
+        vreinterpretq_u8_p128(vmull_p64(vgetq_lane_u64(its_block, 1), _lower)));
+}
+
+size_t fold_blocks(const uint8_t* _data, size_t _length, uint64_t _crc,
+                   const fold_constants& _constants, uint8_t (&_block)[16])
+{
+    const uint8_t* its_data(_data);
+
+    uint8x16_t x0 = veorq_u8(vld1q_u8(its_data),
+                             vreinterpretq_u8_u64(vcombine_u64(vcreate_u64(_crc), vcreate_u64(0))));
+    uint8x16_t x1 = vld1q_u8(its_data + 16);
+    uint8x16_t x2 = vld1q_u8(its_data + 32);
+    uint8x16_t x3 = vld1q_u8(its_data + 48);
+    its_data += 64;
+
+    for (; _data + _length - its_data >= 64; its_data += 64)
+    {
+        x0 = veorq_u8(fold(x0, _constants.k_512_upper_, _constants.k_512_lower_),
+                      vld1q_u8(its_data));
+        x1 = veorq_u8(fold(x1, _constants.k_512_upper_, _constants.k_512_lower_),
+                      vld1q_u8(its_data + 16));
+        x2 = veorq_u8(fold(x2, _constants.k_512_upper_, _constants.k_512_lower_),
+                      vld1q_u8(its_data + 32));
+        x3 = veorq_u8(fold(x3, _constants.k_512_upper_, _constants.k_512_lower_),
+                      vld1q_u8(its_data + 48));
+    }
+
+    x1 = veorq_u8(fold(x0, _constants.k_128_upper_, _constants.k_128_lower_), x1);
+    x2 = veorq_u8(fold(x1, _constants.k_128_upper_, _constants.k_128_lower_), x2);
+    x3 = veorq_u8(fold(x2, _constants.k_128_upper_, _constants.k_128_lower_), x3);
+    for (; _data + _length - its_data >= 16; its_data += 16)
+        x3 = veorq_u8(fold(x3, _constants.k_128_upper_, _constants.k_128_lower_),
+                      vld1q_u8(its_data));
+
+    vst1q_u8(_block, x3);
+    return static_cast<size_t>(its_data - _data);
+}
+#endif
+
+/**
+ * Calculates a reflected CRC without final XOR. Large buffers are folded
+ * into a single block if the CPU supports carry-less multiplication, the
+ * rest is processed with slice-by-8 tables.
+ */
+template<typename crc_t_>
+crc_t_ calculate_reflected(const reflected_slices<crc_t_>& _slices,
+                           const fold_constants& _constants, crc_t_ _crc, const uint8_t* _data,
+                           size_t _length)
+{
+#if defined(VSOMEIP_E2E_CRC_CLMUL) || defined(VSOMEIP_E2E_CRC_PMULL)
+    if (_length >= fold_threshold && has_clmul())
+    {
+        uint8_t      its_block[16];
+        const size_t its_folded = fold_blocks(_data, _length, _crc, _constants, its_block);
+        _crc                    = _slices.update(0, its_block, sizeof(its_block));
+        _data += its_folded;
+        _length -= its_folded;
+    }
+#else
+    (void)_constants;
+#endif
+    return _slices.update(_crc, _data, _length);
+}
+
+} // namespace
+
 /**
  * Calculates the crc over the provided range.
  *
@@ -83,10 +353,11 @@ const uint8_t e2e_crc::lookup_table_profile_01_[256] = {
  */
 uint32_t e2e_crc::calculate_profile_04(buffer_view _buffer_view, const uint32_t _start_value)
 {
-    uint32_t crc = (_start_value ^ 0xFFFFFFFFU);
+    static const reflected_slices<uint32_t> slices(lookup_table_profile_04_);
+    static const fold_constants             constants(0xF4ACFB13U, 32);
 
-    for (uint8_t byte : _buffer_view)
-        crc = lookup_table_profile_04_[static_cast<uint8_t>(byte ^ crc)] ^ (crc >> 8U);
+    uint32_t crc = calculate_reflected(slices, constants, (_start_value ^ 0xFFFFFFFFU),
+                                       _buffer_view.begin(), _buffer_view.data_length());
 
     return (crc ^ 0xFFFFFFFFU);
 }
@@ -135,17 +406,10 @@ const uint32_t e2e_crc::lookup_table_profile_04_[256] = {
  */
 uint16_t e2e_crc::calculate_profile_05(buffer_view _buffer_view, const uint16_t _start_value)
 {
-    const uint8_t* buffer        = _buffer_view.begin();
-    uint32_t       buffer_length = (uint32_t)_buffer_view.data_length();
-    uint16_t       crc           = _start_value;
+    static const slices_16 slices(lookup_table_profile_05_);
 
-    /* Process all data (byte wise) */
-    for (uint32_t i = 0; i < buffer_length; ++i)
-    {
-        /* Process one byte of data */
-        crc =
-            lookup_table_profile_05_[((uint8_t)(crc >> 8U)) ^ buffer[i]] ^ ((uint16_t)(crc << 8U));
-    }
+    /* Process all data (eight bytes at once) */
+    uint16_t crc = slices.update(_start_value, _buffer_view.begin(), _buffer_view.data_length());
 
     /* Specified final XOR value for CRC16 is 0, no need to actually xor anything here */
     return crc;
@@ -197,13 +461,12 @@ const uint16_t e2e_crc::lookup_table_profile_05_[256] = {
  */
 uint32_t e2e_crc::calculate_profile_custom(buffer_view _buffer_view)
 {
-    // InitValue
-    uint32_t crc = 0xFFFFFFFFU;
+    static const reflected_slices<uint32_t> slices(lookup_table_profile_custom_);
+    static const fold_constants             constants(0x04C11DB7U, 32);
 
-    for (uint8_t byte : _buffer_view)
-    {
-        crc = lookup_table_profile_custom_[static_cast<uint8_t>(byte ^ crc)] ^ (crc >> 8U);
-    }
+    // InitValue
+    uint32_t crc = calculate_reflected(slices, constants, 0xFFFFFFFFU, _buffer_view.begin(),
+                                       _buffer_view.data_length());
 
     // XorOut
     crc = crc ^ 0xFFFFFFFFU;
@@ -267,10 +530,11 @@ const uint32_t e2e_crc::lookup_table_profile_custom_[256] = {
  */
 uint64_t e2e_crc::calculate_profile_07(buffer_view _buffer_view, const uint64_t _start_value)
 {
-    uint64_t crc = (_start_value ^ 0xFFFFFFFFFFFFFFFFU);
+    static const reflected_slices<uint64_t> slices(lookup_table_profile_07_);
+    static const fold_constants             constants(0x42F0E1EBA9EA3693U, 64);
 
-    for (uint8_t byte : _buffer_view)
-        crc = lookup_table_profile_07_[static_cast<uint8_t>(byte ^ crc)] ^ (crc >> 8U);
+    uint64_t crc = calculate_reflected(slices, constants, (_start_value ^ 0xFFFFFFFFFFFFFFFFU),
+                                       _buffer_view.begin(), _buffer_view.data_length());
 
     return (crc ^ 0xFFFFFFFFFFFFFFFFU);
 }
@@ -129,7 +129,7 @@ std::size_t e2e_provider_impl::get_protection_base(e2exf::data_identifier_t id)
     return 0;
 }
 
-void e2e_provider_impl::protect(e2exf::data_identifier_t id, e2e_buffer& _buffer,
+void e2e_provider_impl::protect(e2exf::data_identifier_t id, const buffer_span& _buffer,
                                 instance_t _instance)
 {
     auto protector = custom_protectors_.find(id);
@@ -139,7 +139,7 @@ void e2e_provider_impl::protect(e2exf::data_identifier_t id, e2e_buffer& _buffer
     }
 }
 
-void e2e_provider_impl::check(e2exf::data_identifier_t id, const e2e_buffer& _buffer,
+void e2e_provider_impl::check(e2exf::data_identifier_t id, const buffer_view& _buffer,
                               instance_t                         _instance,
                               profile_interface::check_status_t& _generic_check_status)
 {
@@ -11,16 +11,15 @@
 namespace vsomeip_v3 { namespace e2e { namespace profile01 {
 
 /** @req [SWS_E2E_00195] */
-void protector::protect(e2e_buffer& _buffer, instance_t _instance)
+void protector::protect(const buffer_span& _buffer, instance_t _instance)
 {
     (void)_instance;
 
-    std::lock_guard<std::mutex> lock(protect_mutex_);
-
     if (profile_01::is_buffer_length_valid(config_, _buffer))
     {
-        // write the current Counter value in Data
-        write_counter(_buffer);
+        // write the current Counter value in Data and increment it (new value will be
+        // used in the next invocation of E2E_P01Protect())
+        write_counter(_buffer, next_counter());
 
         // write DataID nibble in Data (E2E_P01_DATAID_NIBBLE) in Data
         write_data_id(_buffer);
@@ -29,32 +28,28 @@ void protector::protect(e2e_buffer& _buffer, instance_t _instance)
         uint8_t computed_crc = profile_01::compute_crc(config_, _buffer);
         // write CRC in Data
         write_crc(_buffer, computed_crc);
-
-        // increment the Counter (new value will be used in the next invocation of
-        // E2E_P01Protect()),
-        increment_counter();
     }
 }
 
 /** @req [SRS_E2E_08528] */
-void protector::write_counter(e2e_buffer& _buffer)
+void protector::write_counter(const buffer_span& _buffer, uint8_t _counter)
 {
     if (config_.counter_offset_ % 8 == 0)
     {
         // write write counter value into low nibble
         _buffer[config_.counter_offset_ / 8] =
-            static_cast<uint8_t>((_buffer[config_.counter_offset_ / 8] & 0xF0) | (counter_ & 0x0F));
+            static_cast<uint8_t>((_buffer[config_.counter_offset_ / 8] & 0xF0) | (_counter & 0x0F));
     }
     else
     {
         // write counter into high nibble
         _buffer[config_.counter_offset_ / 8] = static_cast<uint8_t>(
-            (_buffer[config_.counter_offset_ / 8] & 0x0F) | ((counter_ << 4) & 0xF0));
+            (_buffer[config_.counter_offset_ / 8] & 0x0F) | ((_counter << 4) & 0xF0));
     }
 }
 
 /** @req [SRS_E2E_08528] */
-void protector::write_data_id(e2e_buffer& _buffer)
+void protector::write_data_id(const buffer_span& _buffer)
 {
     if (config_.data_id_mode_ == p01_data_id_mode::E2E_P01_DATAID_NIBBLE)
     {
@@ -76,15 +71,20 @@ void protector::write_data_id(e2e_buffer& _buffer)
 }
 
 /** @req [SRS_E2E_08528] */
-void protector::write_crc(e2e_buffer& _buffer, uint8_t _computed_crc)
+void protector::write_crc(const buffer_span& _buffer, uint8_t _computed_crc)
 {
     _buffer[config_.crc_offset_] = _computed_crc;
 }
 
 /** @req [SWS_E2E_00075] */
-void protector::increment_counter(void)
+uint8_t protector::next_counter(void)
 {
-    counter_ = static_cast<uint8_t>((counter_ + 1U) % 15);
+    uint8_t its_counter = counter_.load(std::memory_order_relaxed);
+    while (!counter_.compare_exchange_weak(its_counter,
+                                           static_cast<uint8_t>((its_counter + 1U) % 15),
+                                           std::memory_order_relaxed))
+        ;
+    return its_counter;
 }
 
 }}} // namespace vsomeip_v3::e2e::profile01
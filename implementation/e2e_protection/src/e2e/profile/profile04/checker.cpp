@@ -13,10 +13,9 @@
 namespace vsomeip_v3 { namespace e2e { namespace profile04 {
 
 // [SWS_E2E_00355]
-void profile_04_checker::check(const e2e_buffer& _buffer, instance_t _instance,
+void profile_04_checker::check(const buffer_view& _buffer, instance_t _instance,
                                e2e::profile_interface::check_status_t& _generic_check_status)
 {
-    std::lock_guard<std::mutex> lock(check_mutex_);
     _generic_check_status = e2e::profile_interface::generic_check_status::E2E_ERROR;
 
     if (_instance > VSOMEIP_E2E_PROFILE04_MAX_INSTANCE)
@@ -73,7 +72,7 @@ void profile_04_checker::check(const e2e_buffer& _buffer, instance_t _instance,
     }
 }
 
-bool profile_04_checker::verify_input(const e2e_buffer& _buffer) const
+bool profile_04_checker::verify_input(const buffer_view& _buffer) const
 {
     auto its_length = _buffer.size();
     return (its_length >= config_.min_data_length_ && its_length <= config_.max_data_length_);
@@ -83,30 +82,27 @@ bool profile_04_checker::verify_counter(instance_t _instance, uint16_t _received
 {
     uint16_t its_delta(0);
 
-    auto find_counter = counter_.find(_instance);
-    if (find_counter != counter_.end())
+    bool is_inserted;
+    auto its_stored_counter = counter_.get(_instance, _received_counter, is_inserted);
+    if (its_stored_counter && !is_inserted)
     {
-        uint16_t its_counter = find_counter->second;
+        uint16_t its_counter = its_stored_counter->load(std::memory_order_relaxed);
         if (its_counter < _received_counter)
             its_delta = uint16_t(_received_counter - its_counter);
         else
             its_delta = uint16_t(uint16_t(0xffff) - its_counter + _received_counter);
     }
-    else
-    {
-        counter_[_instance] = _received_counter;
-    }
 
     return (its_delta <= config_.max_delta_counter_);
 }
 
-bool profile_04_checker::read_16(const e2e_buffer& _buffer, uint16_t& _data, size_t _index) const
+bool profile_04_checker::read_16(const buffer_view& _buffer, uint16_t& _data, size_t _index) const
 {
     _data = bithelper::read_uint16_be(&_buffer[config_.offset_ + _index]);
     return true;
 }
 
-bool profile_04_checker::read_32(const e2e_buffer& _buffer, uint32_t& _data, size_t _index) const
+bool profile_04_checker::read_32(const buffer_view& _buffer, uint32_t& _data, size_t _index) const
 {
     _data = bithelper::read_uint32_be(&_buffer[config_.offset_ + _index]);
     return true;
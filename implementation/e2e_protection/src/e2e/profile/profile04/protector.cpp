@@ -12,10 +12,8 @@
 namespace vsomeip_v3 { namespace e2e { namespace profile04 {
 
 /** @req [SWS_E2E_00195] */
-void protector::protect(e2e_buffer& _buffer, instance_t _instance)
+void protector::protect(const buffer_span& _buffer, instance_t _instance)
 {
-    std::lock_guard<std::mutex> lock(protect_mutex_);
-
     if (_instance > VSOMEIP_E2E_PROFILE04_MAX_INSTANCE)
     {
         VSOMEIP_ERROR << "E2E Profile 4 can only be used for instances [1-255]";
@@ -29,8 +27,8 @@ void protector::protect(e2e_buffer& _buffer, instance_t _instance)
         bithelper::write_uint16_be(static_cast<uint16_t>(_buffer.size()),
                                    &_buffer[config_.offset_]);
 
-        /** @req [SWS_E2E_00365] */
-        bithelper::write_uint16_be(get_counter(_instance), &_buffer[config_.offset_ + 2]);
+        /** @req [SWS_E2E_00365] [SWS_E2E_00369] */
+        bithelper::write_uint16_be(next_counter(_instance), &_buffer[config_.offset_ + 2]);
 
         /** @req [SWS_E2E_00366] */
         uint32_t its_data_id(uint32_t(_instance) << 24 | config_.data_id_);
@@ -41,36 +39,25 @@ void protector::protect(e2e_buffer& _buffer, instance_t _instance)
 
         /** @req [SWS_E2E_0368] */
         bithelper::write_uint32_be(its_crc, &_buffer[config_.offset_ + 8]);
-
-        /** @req [SWS_E2E_00369] */
-        increment_counter(_instance);
     }
 }
 
-bool protector::verify_inputs(e2e_buffer& _buffer)
+bool protector::verify_inputs(const buffer_span& _buffer)
 {
     return (_buffer.size() >= config_.min_data_length_
             && _buffer.size() <= config_.max_data_length_);
 }
 
-uint16_t protector::get_counter(instance_t _instance) const
+// Returns the current counter value, the incremented value is used next time
+uint16_t protector::next_counter(instance_t _instance)
 {
-    uint16_t its_counter(0);
-
-    auto find_counter = counter_.find(_instance);
-    if (find_counter != counter_.end())
-        its_counter = find_counter->second;
+    auto its_counter = counter_.get(_instance);
+    if (its_counter)
+        return its_counter->fetch_add(1, std::memory_order_relaxed);
 
-    return its_counter;
-}
-
-void protector::increment_counter(instance_t _instance)
-{
-    auto find_counter = counter_.find(_instance);
-    if (find_counter != counter_.end())
-        find_counter->second++;
-    else
-        counter_[_instance] = 1;
+    VSOMEIP_ERROR << "E2E P04 protection: No counter left for instance " << std::hex
+                  << _instance;
+    return 0;
 }
 
 }}} // namespace vsomeip_v3::e2e::profile04
@@ -12,12 +12,11 @@
 
 namespace vsomeip_v3 { namespace e2e { namespace profile05 {
 
-void profile_05_checker::check(const e2e_buffer& _buffer, instance_t _instance,
+void profile_05_checker::check(const buffer_view& _buffer, instance_t _instance,
                                e2e::profile_interface::check_status_t& _generic_check_status)
 {
     (void)_instance;
 
-    std::lock_guard<std::mutex> lock(check_mutex_);
     _generic_check_status = e2e::profile_interface::generic_check_status::E2E_ERROR;
 
     if (_instance > VSOMEIP_E2E_PROFILE05_MAX_INSTANCE)
@@ -60,30 +59,27 @@ bool profile_05_checker::verify_counter(instance_t _instance, uint8_t _received_
 {
     uint8_t its_delta(0);
 
-    auto find_counter = counter_.find(_instance);
-    if (find_counter != counter_.end())
+    bool is_inserted;
+    auto its_stored_counter = counter_.get(_instance, _received_counter, is_inserted);
+    if (its_stored_counter && !is_inserted)
     {
-        uint8_t its_counter = find_counter->second;
+        uint8_t its_counter = its_stored_counter->load(std::memory_order_relaxed);
         if (its_counter < _received_counter)
             its_delta = uint8_t(_received_counter - its_counter);
         else
             its_delta = uint8_t(uint8_t(0xff) - its_counter + _received_counter);
     }
-    else
-    {
-        counter_[_instance] = _received_counter;
-    }
 
     return (its_delta <= config_.max_delta_counter_);
 }
 
-bool profile_05_checker::read_8(const e2e_buffer& _buffer, uint8_t& _data, size_t _index) const
+bool profile_05_checker::read_8(const buffer_view& _buffer, uint8_t& _data, size_t _index) const
 {
     _data = _buffer[config_.offset_ + _index];
     return true;
 }
 
-bool profile_05_checker::read_16(const e2e_buffer& _buffer, uint16_t& _data, size_t _index) const
+bool profile_05_checker::read_16(const buffer_view& _buffer, uint16_t& _data, size_t _index) const
 {
     _data = bithelper::read_uint16_be(&_buffer[config_.offset_ + _index]);
     return true;
@@ -8,7 +8,7 @@
 
 namespace vsomeip_v3 { namespace e2e { namespace profile05 {
 
-uint16_t profile_05::compute_crc(const profile_config& _config, const e2e_buffer& _buffer)
+uint16_t profile_05::compute_crc(const profile_config& _config, const buffer_view& _buffer)
 {
     static const int crcSize = sizeof(uint16_t);
 
@@ -31,7 +31,7 @@ uint16_t profile_05::compute_crc(const profile_config& _config, const e2e_buffer
     return computed_crc;
 }
 
-bool profile_05::is_buffer_length_valid(const profile_config& _config, const e2e_buffer& _buffer)
+bool profile_05::is_buffer_length_valid(const profile_config& _config, const buffer_view& _buffer)
 {
     return ((_config.data_length_ / 8) + 1U <= _buffer.size());
 }
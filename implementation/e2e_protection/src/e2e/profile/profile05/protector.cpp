@@ -11,12 +11,10 @@
 
 namespace vsomeip_v3 { namespace e2e { namespace profile05 {
 
-void protector::protect(e2e_buffer& _buffer, instance_t _instance)
+void protector::protect(const buffer_span& _buffer, instance_t _instance)
 {
     (void)_instance;
 
-    std::lock_guard<std::mutex> lock(protect_mutex_);
-
     if (_instance > VSOMEIP_E2E_PROFILE05_MAX_INSTANCE)
     {
         VSOMEIP_ERROR << "E2E Profile 5 can only be used for instances [1-255]";
@@ -25,42 +23,30 @@ void protector::protect(e2e_buffer& _buffer, instance_t _instance)
 
     if (profile_05::is_buffer_length_valid(config_, _buffer))
     {
-        // write the current Counter value in Data
-        write_counter(_buffer, get_counter(_instance), 2);
+        // write the current Counter value in Data and increment it
+        write_counter(_buffer, next_counter(_instance), 2);
 
         // compute the CRC
         uint16_t its_crc = profile_05::compute_crc(config_, _buffer);
         bithelper::write_uint16_be(its_crc, &_buffer[config_.offset_]);
-
-        // increment the Counter (new value will be used in the next invocation of
-        // E2E_P05Protect()),
-        increment_counter(_instance);
     }
 }
 
-void protector::write_counter(e2e_buffer& _buffer, uint8_t _data, size_t _index)
+void protector::write_counter(const buffer_span& _buffer, uint8_t _data, size_t _index)
 {
     _buffer[config_.offset_ + _index] = _data;
 }
 
-uint8_t protector::get_counter(instance_t _instance) const
+// Returns the current counter value, the incremented value is used next time
+uint8_t protector::next_counter(instance_t _instance)
 {
-    uint8_t its_counter(0);
-
-    auto find_counter = counter_.find(_instance);
-    if (find_counter != counter_.end())
-        its_counter = find_counter->second;
+    auto its_counter = counter_.get(_instance);
+    if (its_counter)
+        return its_counter->fetch_add(1, std::memory_order_relaxed);
 
-    return its_counter;
-}
-
-void protector::increment_counter(instance_t _instance)
-{
-    auto find_counter = counter_.find(_instance);
-    if (find_counter != counter_.end())
-        find_counter->second++;
-    else
-        counter_[_instance] = 1;
+    VSOMEIP_ERROR << "E2E P05 protection: No counter left for instance " << std::hex
+                  << _instance;
+    return 0;
 }
 
 }}} // namespace vsomeip_v3::e2e::profile05
@@ -13,10 +13,9 @@
 namespace vsomeip_v3 { namespace e2e { namespace profile07 {
 
 // [SWS_E2E_00495]
-void profile_07_checker::check(const e2e_buffer& _buffer, instance_t _instance,
+void profile_07_checker::check(const buffer_view& _buffer, instance_t _instance,
                                e2e::profile_interface::check_status_t& _generic_check_status)
 {
-    std::lock_guard<std::mutex> lock(check_mutex_);
     _generic_check_status = e2e::profile_interface::generic_check_status::E2E_ERROR;
 
     /** @req [SWS_E2E_00496] */
@@ -66,7 +65,7 @@ void profile_07_checker::check(const e2e_buffer& _buffer, instance_t _instance,
     }
 }
 
-bool profile_07_checker::verify_input(const e2e_buffer& _buffer) const
+bool profile_07_checker::verify_input(const buffer_view& _buffer) const
 {
     auto its_length = _buffer.size();
     return (its_length >= config_.min_data_length_ && its_length <= config_.max_data_length_);
@@ -76,32 +75,29 @@ bool profile_07_checker::verify_counter(instance_t _instance, uint32_t _received
 {
     uint32_t its_delta(0);
 
-    auto find_counter = counter_.find(_instance);
-    if (find_counter != counter_.end())
+    bool is_inserted;
+    auto its_stored_counter = counter_.get(_instance, _received_counter, is_inserted);
+    if (its_stored_counter && !is_inserted)
     {
-        uint32_t its_counter = find_counter->second;
+        uint32_t its_counter = its_stored_counter->load(std::memory_order_relaxed);
         if (its_counter < _received_counter)
             its_delta = uint32_t(_received_counter - its_counter);
         else
             its_delta = uint32_t(uint32_t(0xffffffff) - its_counter + _received_counter);
     }
-    else
-    {
-        counter_[_instance] = _received_counter;
-    }
 
     return (its_delta <= config_.max_delta_counter_);
 }
 
 // Read uint32_t as big-endian
-bool profile_07_checker::read_32(const e2e_buffer& _buffer, uint32_t& _data, size_t _index) const
+bool profile_07_checker::read_32(const buffer_view& _buffer, uint32_t& _data, size_t _index) const
 {
     _data = bithelper::read_uint32_be(&_buffer[config_.offset_ + _index]);
     return true;
 }
 
 // Read uint64_t as big-endian
-bool profile_07_checker::read_64(const e2e_buffer& _buffer, uint64_t& _data, size_t _index) const
+bool profile_07_checker::read_64(const buffer_view& _buffer, uint64_t& _data, size_t _index) const
 {
     _data = bithelper::read_uint64_be(&_buffer[config_.offset_ + _index]);
     return true;
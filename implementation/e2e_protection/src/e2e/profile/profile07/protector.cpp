@@ -12,10 +12,8 @@
 namespace vsomeip_v3 { namespace e2e { namespace profile07 {
 
 /** @req [SWS_E2E_00486] */
-void protector::protect(e2e_buffer& _buffer, instance_t _instance)
+void protector::protect(const buffer_span& _buffer, instance_t _instance)
 {
-    std::lock_guard<std::mutex> lock(protect_mutex_);
-
     /** @req: [SWS_E2E_00487] */
     if (verify_inputs(_buffer))
     {
@@ -23,8 +21,8 @@ void protector::protect(e2e_buffer& _buffer, instance_t _instance)
         bithelper::write_uint32_be(static_cast<uint16_t>(_buffer.size()),
                                    &_buffer[config_.offset_ + PROFILE_07_SIZE_OFFSET]);
 
-        /** @req [SWS_E2E_00490] */
-        bithelper::write_uint32_be(get_counter(_instance),
+        /** @req [SWS_E2E_00490] [SWS_E2E_00494] */
+        bithelper::write_uint32_be(next_counter(_instance),
                                    &_buffer[config_.offset_ + PROFILE_07_COUNTER_OFFSET]);
 
         /** @req [SWS_E2E_00491] */
@@ -36,36 +34,25 @@ void protector::protect(e2e_buffer& _buffer, instance_t _instance)
 
         /** @req [SWS_E2E_00493] */
         bithelper::write_uint64_be(its_crc, &_buffer[config_.offset_ + PROFILE_07_CRC_OFFSET]);
-
-        /** @req [SWS_E2E_00494] */
-        increment_counter(_instance);
     }
 }
 
-bool protector::verify_inputs(e2e_buffer& _buffer)
+bool protector::verify_inputs(const buffer_span& _buffer)
 {
     return (_buffer.size() >= config_.min_data_length_
             && _buffer.size() <= config_.max_data_length_);
 }
 
-uint32_t protector::get_counter(instance_t _instance) const
+// Returns the current counter value, the incremented value is used next time
+uint32_t protector::next_counter(instance_t _instance)
 {
-    uint32_t its_counter(0);
-
-    auto find_counter = counter_.find(_instance);
-    if (find_counter != counter_.end())
-        its_counter = find_counter->second;
+    auto its_counter = counter_.get(_instance);
+    if (its_counter)
+        return its_counter->fetch_add(1, std::memory_order_relaxed);
 
-    return its_counter;
-}
-
-void protector::increment_counter(instance_t _instance)
-{
-    auto find_counter = counter_.find(_instance);
-    if (find_counter != counter_.end())
-        find_counter->second++;
-    else
-        counter_[_instance] = 1;
+    VSOMEIP_ERROR << "E2E P07 protection: No counter left for instance " << std::hex
+                  << _instance;
+    return 0;
 }
 
 }}} // namespace vsomeip_v3::e2e::profile07
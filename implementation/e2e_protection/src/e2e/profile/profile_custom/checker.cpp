@@ -11,12 +11,11 @@
 
 namespace vsomeip_v3 { namespace e2e { namespace profile_custom {
 
-void profile_custom_checker::check(const e2e_buffer& _buffer, instance_t _instance,
+void profile_custom_checker::check(const buffer_view& _buffer, instance_t _instance,
                                    e2e::profile_interface::check_status_t& _generic_check_status)
 {
     (void)_instance;
 
-    std::lock_guard<std::mutex> lock(check_mutex_);
     _generic_check_status = e2e::profile_interface::generic_check_status::E2E_ERROR;
 
     if (profile_custom::is_buffer_length_valid(config_, _buffer))
@@ -39,7 +38,7 @@ void profile_custom_checker::check(const e2e_buffer& _buffer, instance_t _instan
     }
 }
 
-uint32_t profile_custom_checker::read_crc(const e2e_buffer& _buffer) const
+uint32_t profile_custom_checker::read_crc(const buffer_view& _buffer) const
 {
     return (static_cast<uint32_t>(_buffer[config_.crc_offset_]) << 24U)
            | (static_cast<uint32_t>(_buffer[config_.crc_offset_ + 1U]) << 16U)
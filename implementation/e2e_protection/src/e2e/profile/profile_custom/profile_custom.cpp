@@ -8,7 +8,7 @@
 
 namespace vsomeip_v3 { namespace e2e { namespace profile_custom {
 
-uint32_t profile_custom::compute_crc(const profile_config& _config, const e2e_buffer& _buffer)
+uint32_t profile_custom::compute_crc(const profile_config& _config, const buffer_view& _buffer)
 {
     uint32_t computed_crc = e2e_crc::calculate_profile_custom(
         buffer_view(_buffer, static_cast<size_t>(_config.crc_offset_ + 4), _buffer.size()));
@@ -16,7 +16,7 @@ uint32_t profile_custom::compute_crc(const profile_config& _config, const e2e_bu
 }
 
 bool profile_custom::is_buffer_length_valid(const profile_config& _config,
-                                            const e2e_buffer&     _buffer)
+                                            const buffer_view&    _buffer)
 {
     return ((_config.crc_offset_ + 4U) <= _buffer.size());
 }
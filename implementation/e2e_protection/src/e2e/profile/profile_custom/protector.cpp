@@ -7,12 +7,10 @@
 
 namespace vsomeip_v3 { namespace e2e { namespace profile_custom {
 
-void protector::protect(e2e_buffer& _buffer, instance_t _instance)
+void protector::protect(const buffer_span& _buffer, instance_t _instance)
 {
     (void)_instance;
 
-    std::lock_guard<std::mutex> lock(protect_mutex_);
-
     if (profile_custom::is_buffer_length_valid(config_, _buffer))
     {
         // compute the CRC over DataID and Data
@@ -22,7 +20,7 @@ void protector::protect(e2e_buffer& _buffer, instance_t _instance)
     }
 }
 
-void protector::write_crc(e2e_buffer& _buffer, uint32_t _computed_crc)
+void protector::write_crc(const buffer_span& _buffer, uint32_t _computed_crc)
 {
     _buffer[config_.crc_offset_]      = static_cast<uint8_t>(_computed_crc >> 24U);
     _buffer[config_.crc_offset_ + 1U] = static_cast<uint8_t>(_computed_crc >> 16U);
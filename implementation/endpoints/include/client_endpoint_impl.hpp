@@ -108,6 +108,11 @@ protected:
     bool check_queue_limit(const uint8_t *_data, std::uint32_t _size) const;
     void queue_train(const std::shared_ptr<train> &_train);
     void update_last_departure();
+    // Returns the segment to be sent next if _buffer is a SOME/IP-TP
+    // message, nullptr otherwise. Must be called with mutex_ being hold.
+    tp::tp_segment *get_segment(const message_buffer_ptr_t &_buffer);
+    // Moves _segment to the first segment of _buffer if it is a SOME/IP-TP message
+    bool start_segment(const message_buffer_ptr_t &_buffer, tp::tp_segment &_segment);
 
 protected:
     mutable std::mutex socket_mutex_;
@@ -137,6 +142,8 @@ protected:
 
     std::deque<std::pair<message_buffer_ptr_t, uint32_t> > queue_;
     std::size_t queue_size_;
+    // Segment that is sent if the front entry of queue_ is a SOME/IP-TP message
+    tp::tp_segment segment_;
 
     mutable std::recursive_mutex mutex_;
 
@@ -154,7 +161,10 @@ private:
                                          method_t _method) const;
     virtual std::uint32_t get_max_allowed_reconnects() const = 0;
     virtual void max_allowed_reconnects_reached() = 0;
-    void send_segments(const tp::tp_split_messages_t &_segments,
+    bool get_tp_configuration(const byte_t *_data,
+            std::uint16_t &_max_segment_length, std::uint32_t &_separation_time);
+    // Queues a message that is sent as SOME/IP-TP segments
+    void send_segments(const byte_t *_data, std::uint32_t _size,
             std::uint32_t _separation_time);
 
     void schedule_train();
@@ -13,6 +13,8 @@
 
 #include <vector>
 
+#include "buffer.hpp"
+
 namespace vsomeip_v3 {
 
 class endpoint_definition;
@@ -35,6 +37,9 @@ public:
     virtual bool is_established_or_connected() const = 0;
 
     virtual bool send(const byte_t *_data, uint32_t _size) = 0;
+    // Sends an already serialized buffer that may be shared between
+    // several endpoints. The buffer must not be modified afterwards.
+    virtual bool send_shared(const message_buffer_ptr_t &_buffer) = 0;
     virtual bool send_to(const std::shared_ptr<endpoint_definition> _target,
             const byte_t *_data, uint32_t _size) = 0;
     virtual bool send_error(const std::shared_ptr<endpoint_definition> _target,
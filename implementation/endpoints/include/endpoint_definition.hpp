@@ -6,10 +6,8 @@
 #ifndef VSOMEIP_V3_ENDPOINT_DEFINITION_HPP_
 #define VSOMEIP_V3_ENDPOINT_DEFINITION_HPP_
 
-#include <map>
 #include <memory>
 #include <atomic>
-#include <mutex>
 
 #include <boost/asio/ip/address.hpp>
 #include <vsomeip/primitive_types.hpp>
@@ -20,10 +18,23 @@ namespace vsomeip_v3 {
 
 class endpoint_definition {
 public:
+    struct statistics_t {
+        // Interned definitions, including those that are no longer
+        // referenced but not yet reclaimed.
+        std::size_t size_;
+        std::uint64_t hits_;
+        std::uint64_t misses_;
+        std::uint64_t reclaimed_;
+    };
+
+    // Returns the interned definition for the given key. Definitions are
+    // only kept as long as they are referenced outside of the registry.
     VSOMEIP_EXPORT static std::shared_ptr<endpoint_definition> get(
             const boost::asio::ip::address &_address,
             uint16_t _port, bool _is_reliable, service_t _service, instance_t _instance);
 
+    VSOMEIP_EXPORT static statistics_t get_statistics();
+
     VSOMEIP_EXPORT const boost::asio::ip::address &get_address() const;
 
     VSOMEIP_EXPORT uint16_t get_port() const;
@@ -41,11 +52,6 @@ private:
     uint16_t port_;
     std::atomic<uint16_t> remote_port_;
     bool is_reliable_;
-
-    static std::mutex definitions_mutex_;
-    static std::map<
-        std::tuple<service_t, instance_t, boost::asio::ip::address, uint16_t, bool>,
-        std::shared_ptr<endpoint_definition> > definitions_;
 };
 
 } // namespace vsomeip_v3
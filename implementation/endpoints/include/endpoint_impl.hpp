@@ -36,6 +36,8 @@ public:
 
     void enable_magic_cookies();
 
+    virtual bool send_shared(const message_buffer_ptr_t &_buffer);
+
     void add_default_target(service_t, const std::string &, uint16_t);
     void remove_default_target(service_t);
     void remove_stop_handler(service_t);
@@ -17,6 +17,8 @@
 
 #include "endpoint.hpp"
 #include "endpoint_host.hpp"
+#include "../../utility/include/epoch_snapshot.hpp"
+#include "../../utility/include/flat_index.hpp"
 
 namespace vsomeip_v3 {
 
@@ -77,6 +79,12 @@ private:
     std::shared_ptr<endpoint> create_local_unlocked(client_t _client);
     std::shared_ptr<endpoint> find_local_unlocked(client_t _client);
 
+    typedef flat_index<client_t, std::shared_ptr<endpoint> > local_endpoints_index_t;
+
+    // Must be called with local_endpoint_mutex_ being hold. Builds and
+    // publishes the snapshot if it was reset by a change.
+    const local_endpoints_index_t *get_local_endpoints_index_unlocked() const;
+
     bool get_local_server_port(port_t &_port, const std::set<port_t> &_used_ports) const;
 
 protected:
@@ -91,6 +99,10 @@ protected:
 private:
     mutable std::mutex local_endpoint_mutex_;
     std::map<client_t, std::shared_ptr<endpoint> > local_endpoints_;
+    // Snapshot of local_endpoints_ for find_local, which is called for each
+    // message that is routed locally. It is reset whenever local_endpoints_
+    // changes and rebuilt by the next lookup.
+    mutable epoch_snapshot<local_endpoints_index_t> local_endpoints_index_;
 
     mutable std::mutex create_local_server_endpoint_mutex_;
 
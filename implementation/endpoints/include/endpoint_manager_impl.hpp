@@ -11,6 +11,8 @@
 #include <thread>
 
 #include "../include/endpoint_manager_base.hpp"
+#include "../../utility/include/epoch_snapshot.hpp"
+#include "../../utility/include/flat_index.hpp"
 
 namespace vsomeip_v3 {
 
@@ -108,6 +110,8 @@ public:
     // Statistics
     void log_client_states() const;
     void log_server_states() const;
+    // Queue sizes of the server endpoints per port and reliability
+    std::vector<std::pair<std::pair<uint16_t, bool>, size_t>> get_server_queue_sizes() const;
 
     // add join/leave options
     void add_multicast_option(const multicast_option_t &_option);
@@ -132,6 +136,33 @@ private:
     bool is_used_endpoint(endpoint* const _endpoint) const;
 
 private:
+    struct service_endpoint_t {
+        bool operator==(const service_endpoint_t &_other) const {
+            return (service_ == _other.service_ && endpoint_ == _other.endpoint_);
+        }
+
+        service_t service_;
+        endpoint *endpoint_;
+    };
+
+    struct service_endpoint_hash_t {
+        std::size_t operator()(const service_endpoint_t &_key) const {
+            return (std::hash<endpoint *>()(_key.endpoint_)
+                    ^ (std::size_t(_key.service_) << 16));
+        }
+    };
+
+    typedef flat_index<service_endpoint_t, instance_t, service_endpoint_hash_t>
+            service_instances_index_t;
+
+    // Must be called with endpoint_mutex_ being hold. Builds and publishes
+    // the snapshot if it was reset by a change.
+    const service_instances_index_t *get_service_instances_index_unlocked() const;
+
+    // Selects the I/O shard of a network endpoint
+    static std::size_t get_endpoint_hash(const boost::asio::ip::address &_address,
+                                         uint16_t _port, bool _reliable);
+
     mutable std::recursive_mutex endpoint_mutex_;
     // Client endpoints for remote services
     std::map<service_t, std::map<instance_t,
@@ -148,6 +179,10 @@ private:
     client_endpoints_t client_endpoints_;
 
     std::map<service_t, std::map<endpoint *, instance_t> > service_instances_;
+    // Snapshot of service_instances_ for find_instance, which is called for
+    // each received message. It is reset whenever service_instances_ changes
+    // and rebuilt by the next lookup.
+    mutable epoch_snapshot<service_instances_index_t> service_instances_index_;
     std::map<service_t, std::map<boost::asio::ip::address, instance_t> > service_instances_multicast_;
 
     std::map<boost::asio::ip::address,
@@ -0,0 +1,102 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_LOCAL_SHM_SEGMENT_HPP_
+#define VSOMEIP_V3_LOCAL_SHM_SEGMENT_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <vsomeip/export.hpp>
+#include <vsomeip/primitive_types.hpp>
+
+namespace vsomeip_v3 {
+
+//
+// A ring of fixed size slots in a POSIX shared memory object. The writer
+// copies a message into a free slot and hands out the slot together with
+// its sequence number. Each receiver copies the message out of the slot and
+// releases its reference; the slot becomes free when the last reference is
+// gone. State, sequence number and reference count of a slot share one
+// atomic word, so claiming and releasing are lock-free and a release that
+// refers to an older sequence number has no effect. Slots that are still
+// referenced after the reclaim time (e.g. because a receiver died) are
+// reclaimed when the ring is full. Receivers map the slot data read-only.
+//
+class VSOMEIP_IMPORT_EXPORT local_shm_segment {
+public:
+    // Creates a new shared memory object named _name (replacing an old
+    // object of the same name). Returns nullptr on failure.
+    static std::shared_ptr<local_shm_segment>
+    create(const std::string& _name, std::uint32_t _slot_count, std::uint32_t _slot_size,
+           std::uint32_t _permissions, std::chrono::milliseconds _reclaim_time);
+
+    // Maps the existing shared memory object _name. Returns nullptr on failure.
+    static std::shared_ptr<local_shm_segment> open(const std::string& _name);
+
+    // Unlinks the shared memory objects named _prefix<pid> whose process
+    // does not exist anymore, e.g. because it crashed. Returns the number of
+    // unlinked objects.
+    static std::size_t remove_stale(const std::string& _prefix);
+
+    ~local_shm_segment();
+
+    local_shm_segment(const local_shm_segment&)            = delete;
+    local_shm_segment& operator=(const local_shm_segment&) = delete;
+
+    const std::string& get_name() const { return name_; }
+    std::uint32_t get_slot_count() const { return slot_count_; }
+    std::uint32_t get_slot_size() const { return slot_size_; }
+
+    // Copies _data into a free slot that is released by _references calls
+    // to release. Returns false if the message does not fit into a slot or
+    // no slot is free.
+    bool write(const byte_t* _data, std::uint32_t _size, std::uint16_t _references,
+               std::uint32_t& _slot, std::uint64_t& _sequence);
+
+    // Copies the message of the given slot to _target. Returns false if the
+    // slot was meanwhile reclaimed or the size does not match.
+    bool read(std::uint32_t _slot, std::uint64_t _sequence, std::uint32_t _size,
+              byte_t* _target) const;
+
+    void release(std::uint32_t _slot, std::uint64_t _sequence);
+
+    // Number of slots that are currently referenced
+    std::uint32_t get_used() const;
+
+private:
+    struct header;
+    struct slot;
+
+    local_shm_segment(const std::string& _name, void* _control, std::size_t _control_size,
+                      void* _data, std::size_t _data_size, bool _is_owner,
+                      std::chrono::milliseconds _reclaim_time);
+
+    slot* get_slot(std::uint32_t _slot) const;
+    bool claim(std::uint32_t _slot, std::uint16_t _references, bool _is_reclaim,
+               std::uint64_t& _sequence);
+
+    static std::int64_t now();
+
+    const std::string name_;
+    void* const control_;
+    const std::size_t control_size_;
+    void* const data_;
+    const std::size_t data_size_;
+    const bool is_owner_;
+    std::uint32_t slot_count_;
+    std::uint32_t slot_size_;
+    const std::int64_t reclaim_time_;
+
+    // Writer only: where to start looking for a free slot
+    std::atomic<std::uint32_t> next_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_LOCAL_SHM_SEGMENT_HPP_
@@ -0,0 +1,76 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_LOCAL_SHM_TRANSPORT_HPP_
+#define VSOMEIP_V3_LOCAL_SHM_TRANSPORT_HPP_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <vsomeip/export.hpp>
+#include <vsomeip/primitive_types.hpp>
+
+#include "buffer.hpp"
+
+namespace vsomeip_v3 {
+
+class configuration;
+class local_shm_segment;
+
+//
+// Passes large messages between local applications via shared memory. The
+// sender writes the message into its local_shm_segment and sends a
+// SEND_SHM command that describes the slot over the existing local
+// connection. The receiver maps the segment of the sender, copies the message
+// into a SEND command that is equivalent to the one the sender would have
+// sent otherwise and releases the slot. Thus, the receive path (including
+// the security checks) is the same for both kinds of commands.
+//
+class VSOMEIP_IMPORT_EXPORT local_shm_transport {
+public:
+    explicit local_shm_transport(const std::shared_ptr<configuration>& _configuration);
+    ~local_shm_transport();
+
+    // Minimum size of messages that are sent via shared memory (0 = never)
+    std::uint32_t get_threshold() const { return threshold_; }
+
+    // Writes the message into the shared memory segment of _client and returns
+    // the SEND_SHM command to be sent to _references receivers. As for local
+    // notifications, the target field contains the sending client. Returns
+    // nullptr if the message cannot be passed via shared memory.
+    message_buffer_ptr_t serialize(client_t _client, const byte_t* _data, uint32_t _size,
+                                   instance_t _instance, bool _reliable, uint8_t _status_check,
+                                   std::uint16_t _references);
+
+    // Releases the reference of a receiver the SEND_SHM command could not
+    // be sent to.
+    void release(const message_buffer_t& _command);
+
+    // Converts the received SEND_SHM command into the corresponding SEND
+    // command. Returns false if the message is no longer available.
+    bool deserialize(const byte_t* _data, std::size_t _size, std::vector<byte_t>& _command);
+
+private:
+    std::shared_ptr<local_shm_segment> get_segment(client_t _client);
+    std::shared_ptr<local_shm_segment> find_segment(client_t _client, const std::string& _name);
+
+    const std::shared_ptr<configuration> configuration_;
+    const std::uint32_t threshold_;
+    const std::string prefix_;
+
+    std::mutex mutex_;
+    // Sending: the own segment
+    std::shared_ptr<local_shm_segment> segment_;
+    bool has_failed_;
+    // Receiving: the segments of the senders
+    std::map<client_t, std::shared_ptr<local_shm_segment>> segments_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_LOCAL_SHM_TRANSPORT_HPP_
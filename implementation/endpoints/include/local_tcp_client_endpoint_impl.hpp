@@ -43,6 +43,8 @@ public:
     // this overrides client_endpoint_impl::send to disable the pull method
     // for local communication
     bool send(const uint8_t *_data, uint32_t _size);
+    // queues the buffer itself instead of copying it into a train
+    bool send_shared(const message_buffer_ptr_t &_buffer);
     void get_configured_times_from_endpoint(
             service_t _service, method_t _method,
             std::chrono::nanoseconds *_debouncing,
@@ -44,6 +44,7 @@ public:
     // this overrides server_endpoint_impl::send to disable the nPDU feature
     // for local communication
     bool send(const uint8_t *_data, uint32_t _size);
+    bool send_shared(const message_buffer_ptr_t &_buffer);
     bool send_to(const std::shared_ptr<endpoint_definition>,
                  const byte_t *_data, uint32_t _size);
     bool send_error(const std::shared_ptr<endpoint_definition> _target,
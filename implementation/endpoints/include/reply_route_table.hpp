@@ -0,0 +1,265 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_REPLY_ROUTE_TABLE_HPP_
+#define VSOMEIP_V3_REPLY_ROUTE_TABLE_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include <vsomeip/primitive_types.hpp>
+
+namespace vsomeip_v3 {
+
+//
+// Remembers the sender of each received request until its response is sent.
+// The table has a fixed number of buckets with four routes each. A bucket is
+// selected by client and session identifier and is claimed with an atomic
+// flag for the few stores needed to add or take a route, so receiving and
+// sending only meet if they touch the same bucket. A contended flag is
+// polled with a pause hint first and then by yielding the thread. Routes
+// older than the maximum age count as expired, but stay available until
+// their slot is reused. If a bucket holds four live routes, the route is
+// added to the overflow area instead, which has the same size as the table
+// but selects its buckets by a different hash, so a busy bucket does not
+// lose routes while the table has room. Only if the overflow bucket is full
+// as well, its oldest route is evicted. Neither adding nor taking a route
+// allocates memory.
+//
+template<typename Endpoint_>
+class reply_route_table {
+public:
+    struct statistics_t {
+        std::uint64_t inserts_;
+        std::uint64_t hits_;
+        std::uint64_t misses_;
+        std::uint64_t evictions_;
+        std::uint64_t expirations_;
+    };
+
+    reply_route_table(std::size_t _size, std::chrono::milliseconds _max_age)
+        : mask_(round_up((_size + ways - 1) / ways) - 1), buckets_(new bucket_t[mask_ + 1]),
+          overflow_buckets_(new bucket_t[mask_ + 1]),
+          max_age_(static_cast<std::uint32_t>(_max_age.count())), overflow_size_(0), inserts_(0),
+          hits_(0), misses_(0), evictions_(0), expirations_(0)
+    {}
+
+    reply_route_table(const reply_route_table&)            = delete;
+    reply_route_table& operator=(const reply_route_table&) = delete;
+
+    std::size_t capacity() const { return (mask_ + 1) * ways; }
+
+    void insert(client_t _client, session_t _session, const Endpoint_& _remote)
+    {
+        const std::uint32_t its_key(get_key(_client, _session));
+        const std::uint32_t its_now(now());
+
+        bucket_t&  its_bucket = lock(buckets_[get_bucket(its_key)]);
+        route_t&   its_route  = select(its_bucket, its_key, its_now);
+        const bool is_overflow(its_route.is_used_ && its_route.key_ != its_key
+                               && its_now - its_route.time_ <= max_age_);
+        if (!is_overflow)
+            store(its_route, its_key, its_now, _remote);
+        unlock(its_bucket);
+
+        if (is_overflow)
+            insert_overflow(its_key, its_now, _remote);
+        else if (overflow_size_.load(std::memory_order_acquire) > 0)
+            (void)take_overflow(its_key, nullptr);
+        inserts_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Removes the route of the given request and returns its sender.
+    bool take(client_t _client, session_t _session, Endpoint_& _remote)
+    {
+        const std::uint32_t its_key(get_key(_client, _session));
+
+        bucket_t&  its_bucket = lock(buckets_[get_bucket(its_key)]);
+        const bool is_found(take(its_bucket, its_key, &_remote));
+        unlock(its_bucket);
+
+        const bool is_overflow_found(!is_found && overflow_size_.load(std::memory_order_acquire) > 0
+                                     && take_overflow(its_key, &_remote));
+
+        (is_found || is_overflow_found ? hits_ : misses_).fetch_add(1, std::memory_order_relaxed);
+        return is_found || is_overflow_found;
+    }
+
+    statistics_t get_statistics() const
+    {
+        return {inserts_.load(std::memory_order_relaxed), hits_.load(std::memory_order_relaxed),
+                misses_.load(std::memory_order_relaxed), evictions_.load(std::memory_order_relaxed),
+                expirations_.load(std::memory_order_relaxed)};
+    }
+
+private:
+    static constexpr std::size_t ways = 4;
+    // Number of pause hints before a waiting thread yields
+    static constexpr unsigned spins = 64;
+
+    struct route_t {
+        route_t() : key_(0), time_(0), is_used_(false) {}
+
+        std::uint32_t key_;
+        std::uint32_t time_;
+        bool          is_used_;
+        Endpoint_     remote_;
+    };
+
+    struct bucket_t {
+        bucket_t() { flag_.clear(); }
+
+        std::atomic_flag flag_;
+        route_t          routes_[ways];
+    };
+
+    static std::uint32_t get_key(client_t _client, session_t _session)
+    {
+        return (std::uint32_t(_client) << 16) | _session;
+    }
+
+    // Both hashes use a different part of the same product, thus keys that
+    // share a bucket are spread over the overflow buckets.
+    std::size_t get_bucket(std::uint32_t _key) const
+    {
+        return static_cast<std::size_t>((_key * 0x9E3779B97F4A7C15ULL) >> 32) & mask_;
+    }
+
+    std::size_t get_overflow_bucket(std::uint32_t _key) const
+    {
+        return static_cast<std::size_t>((_key * 0x9E3779B97F4A7C15ULL) >> 48) & mask_;
+    }
+
+    static std::size_t round_up(std::size_t _value)
+    {
+        std::size_t its_value(1);
+        while (its_value < _value)
+            its_value <<= 1;
+        return its_value;
+    }
+
+    static std::uint32_t now()
+    {
+        return static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                              std::chrono::steady_clock::now().time_since_epoch())
+                                              .count());
+    }
+
+    // Returns the route of the given key, otherwise a free route or the
+    // oldest one.
+    static route_t& select(bucket_t& _bucket, std::uint32_t _key, std::uint32_t _now)
+    {
+        route_t* its_route(nullptr);
+        for (auto& r : _bucket.routes_)
+        {
+            if (r.is_used_ && r.key_ == _key)
+                return r;
+            if (!its_route
+                || (its_route->is_used_
+                    && (!r.is_used_ || _now - r.time_ > _now - its_route->time_)))
+                its_route = &r;
+        }
+        return *its_route;
+    }
+
+    void store(route_t& _route, std::uint32_t _key, std::uint32_t _now, const Endpoint_& _remote)
+    {
+        if (_route.is_used_ && _route.key_ != _key)
+            expirations_.fetch_add(1, std::memory_order_relaxed);
+        _route.key_     = _key;
+        _route.time_    = _now;
+        _route.is_used_ = true;
+        _route.remote_  = _remote;
+    }
+
+    static bool take(bucket_t& _bucket, std::uint32_t _key, Endpoint_* _remote)
+    {
+        for (auto& r : _bucket.routes_)
+        {
+            if (r.is_used_ && r.key_ == _key)
+            {
+                if (_remote)
+                    *_remote = r.remote_;
+                r.is_used_ = false;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Adds a route that did not fit into its bucket. If the overflow bucket
+    // is full of live routes, the oldest one is evicted.
+    void insert_overflow(std::uint32_t _key, std::uint32_t _now, const Endpoint_& _remote)
+    {
+        bucket_t& its_bucket = lock(overflow_buckets_[get_overflow_bucket(_key)]);
+        route_t&  its_route  = select(its_bucket, _key, _now);
+        if (!its_route.is_used_)
+            overflow_size_.fetch_add(1, std::memory_order_release);
+        else if (its_route.key_ != _key && _now - its_route.time_ <= max_age_)
+            evictions_.fetch_add(1, std::memory_order_relaxed);
+        else if (its_route.key_ != _key)
+            expirations_.fetch_add(1, std::memory_order_relaxed);
+        its_route.key_     = _key;
+        its_route.time_    = _now;
+        its_route.is_used_ = true;
+        its_route.remote_  = _remote;
+        unlock(its_bucket);
+    }
+
+    bool take_overflow(std::uint32_t _key, Endpoint_* _remote)
+    {
+        bucket_t&  its_bucket = lock(overflow_buckets_[get_overflow_bucket(_key)]);
+        const bool is_found(take(its_bucket, _key, _remote));
+        if (is_found)
+            overflow_size_.fetch_sub(1, std::memory_order_release);
+        unlock(its_bucket);
+        return is_found;
+    }
+
+    static void pause()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+
+    static bucket_t& lock(bucket_t& _bucket)
+    {
+        for (unsigned its_spins(0); _bucket.flag_.test_and_set(std::memory_order_acquire);
+             its_spins++)
+        {
+            if (its_spins < spins)
+                pause();
+            else
+                std::this_thread::yield();
+        }
+        return _bucket;
+    }
+
+    static void unlock(bucket_t& _bucket) { _bucket.flag_.clear(std::memory_order_release); }
+
+    const std::size_t           mask_;
+    std::unique_ptr<bucket_t[]> buckets_;
+    std::unique_ptr<bucket_t[]> overflow_buckets_;
+    const std::uint32_t         max_age_;
+
+    // Live routes in the overflow area, lookups skip it while it is empty
+    std::atomic<std::size_t> overflow_size_;
+
+    std::atomic<std::uint64_t> inserts_;
+    std::atomic<std::uint64_t> hits_;
+    std::atomic<std::uint64_t> misses_;
+    std::atomic<std::uint64_t> evictions_;
+    std::atomic<std::uint64_t> expirations_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_REPLY_ROUTE_TABLE_HPP_
@@ -17,6 +17,7 @@
 
 #include "buffer.hpp"
 #include "endpoint_impl.hpp"
+#include "reply_route_table.hpp"
 #include "tp.hpp"
 #if defined(__QNX__)
 #include "../../utility/include/qnx_helper.hpp"
@@ -47,6 +48,7 @@ public:
               has_last_departure_(_source.has_last_departure_),
               queue_(_source.queue_),
               queue_size_(_source.queue_size_),
+              segment_(_source.segment_),
               is_sending_(_source.is_sending_),
               sent_timer_(_source.io_),
               io_(_source.io_) {
@@ -61,6 +63,8 @@ public:
 
         std::deque<std::pair<message_buffer_ptr_t, uint32_t> > queue_;
         std::size_t queue_size_;
+        // Segment that is sent if the front entry of queue_ is a SOME/IP-TP message
+        tp::tp_segment segment_;
 
         bool is_sending_;
         boost::asio::steady_timer sent_timer_;
@@ -130,14 +134,25 @@ protected:
     bool queue_train(const target_data_iterator_type _it,
             const std::shared_ptr<train> &_train);
 
-    void send_segments(const tp::tp_split_messages_t &_segments,
+    // Queues a message that is sent as SOME/IP-TP segments
+    void send_segments(const byte_t *_data, std::uint32_t _size,
             std::uint32_t _separation_time, const endpoint_type &_target);
+    // Returns the segment to be sent next if the front entry of the queue
+    // is a SOME/IP-TP message, nullptr otherwise
+    tp::tp_segment *get_segment(endpoint_data_type &_data);
+    // Moves _segment to the first segment of _buffer if it is a SOME/IP-TP message
+    bool start_segment(const message_buffer_ptr_t &_buffer, tp::tp_segment &_segment);
 
     target_data_iterator_type find_or_create_target_unlocked(endpoint_type _target);
 
+    // Remembers the sender of a request that expects a response
+    void add_reply_route(const byte_t *_data, const endpoint_type &_remote);
+
+    // Removes the front entry of a queue that was sent without send_cbk
+    void pop_sent_unlocked(endpoint_data_type &_data);
+
 protected:
-    std::mutex clients_mutex_;
-    std::map<client_t, std::map<session_t, endpoint_type> > clients_;
+    reply_route_table<endpoint_type> reply_routes_;
 
     target_data_type targets_;
 
@@ -153,6 +168,8 @@ private:
     virtual bool tp_segmentation_enabled(service_t _service,
                                          instance_t _instance,
                                          method_t _method) const;
+    bool get_tp_configuration(const byte_t *_data,
+            std::uint16_t &_max_segment_length, std::uint32_t &_separation_time);
 
     void schedule_train(endpoint_data_type &_target);
     void update_last_departure(endpoint_data_type &_data);
@@ -13,6 +13,7 @@
 
 #include <vsomeip/defines.hpp>
 #include "client_endpoint_impl.hpp"
+#include "tcp_receive_buffer.hpp"
 #if defined(__QNX__)
 #include "../../utility/include/qnx_helper.hpp"
 #endif
@@ -54,26 +55,26 @@ private:
             service_t _service, method_t _method,
             std::chrono::nanoseconds *_debouncing,
             std::chrono::nanoseconds *_maximum_retention) const;
-    bool is_magic_cookie(const message_buffer_ptr_t& _recv_buffer,
+    bool is_magic_cookie(const tcp_receive_buffer_ptr_t& _recv_buffer,
                          size_t _offset) const;
     void send_magic_cookie(message_buffer_ptr_t &_buffer);
 
     void receive_cbk(boost::system::error_code const &_error,
                      std::size_t _bytes,
-                     const message_buffer_ptr_t&  _recv_buffer,
+                     const tcp_receive_buffer_ptr_t& _recv_buffer,
                      std::size_t _recv_buffer_size);
 
     void connect();
     void receive();
-    void receive(message_buffer_ptr_t  _recv_buffer,
+    void receive(tcp_receive_buffer_ptr_t _recv_buffer,
                  std::size_t _recv_buffer_size,
                  std::size_t _missing_capacity);
-    void calculate_shrink_count(const message_buffer_ptr_t& _recv_buffer,
+    void calculate_shrink_count(const tcp_receive_buffer_ptr_t& _recv_buffer,
                                 std::size_t _recv_buffer_size);
     std::string get_address_port_remote() const;
     std::string get_address_port_local() const;
     void handle_recv_buffer_exception(const std::exception &_e,
-                                      const message_buffer_ptr_t& _recv_buffer,
+                                      const tcp_receive_buffer_ptr_t& _recv_buffer,
                                       std::size_t _recv_buffer_size);
     void set_local_port();
     std::size_t write_completion_condition(
@@ -90,7 +91,7 @@ private:
     void wait_until_sent(const boost::system::error_code &_error);
 
     const std::uint32_t recv_buffer_size_initial_;
-    message_buffer_ptr_t recv_buffer_;
+    tcp_receive_buffer_ptr_t recv_buffer_;
     std::uint32_t shrink_count_;
     const std::uint32_t buffer_shrink_threshold_;
 
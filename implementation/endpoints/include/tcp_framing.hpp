@@ -0,0 +1,44 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_TCP_FRAMING_HPP_
+#define VSOMEIP_V3_TCP_FRAMING_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <vsomeip/export.hpp>
+#include <vsomeip/primitive_types.hpp>
+
+namespace vsomeip_v3 {
+
+//
+// Locates SOME/IP messages and magic cookies within the receive buffer of a
+// TCP connection. _cookie is the magic cookie that is expected from the
+// remote side (CLIENT_COOKIE on server side, SERVICE_COOKIE on client side).
+//
+class VSOMEIP_IMPORT_EXPORT tcp_framing {
+public:
+    // Maximum number of messages that are framed by one call of scan
+    static const std::size_t max_frames_ = 32;
+
+    // Returns the offset of the first magic cookie that lies completely
+    // within _data[0, _size) or _size if there is none.
+    static std::size_t find_magic_cookie(const byte_t* _data, std::size_t _size,
+                                         const byte_t* _cookie);
+
+    // Frames the complete messages at the start of _data and writes their
+    // sizes to _sizes. Stops in front of the first message that
+    //  - is incomplete,
+    //  - has an invalid protocol version, message type or return code,
+    //  - is a magic cookie or, if _has_cookies is set, contains one.
+    // Such messages are left to the caller. Returns the number of messages.
+    static std::size_t scan(const byte_t* _data, std::size_t _size, const byte_t* _cookie,
+                            bool _has_cookies, std::uint32_t* _sizes, std::size_t _max);
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_TCP_FRAMING_HPP_
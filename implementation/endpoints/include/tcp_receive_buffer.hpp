@@ -0,0 +1,74 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_TCP_RECEIVE_BUFFER_HPP_
+#define VSOMEIP_V3_TCP_RECEIVE_BUFFER_HPP_
+
+#include <cstddef>
+#include <memory>
+
+#include <vsomeip/export.hpp>
+#include <vsomeip/primitive_types.hpp>
+
+namespace vsomeip_v3 {
+
+//
+// Receive buffer of a TCP connection. Data is received behind the bytes that
+// were not processed yet and processed messages are released from the front,
+// so complete messages are always contiguous. The unprocessed bytes are only
+// moved to the start of the storage if the next receive does not fit behind
+// them anymore. The storage is never initialized, neither when the buffer is
+// created nor when it grows.
+//
+// The "_size" arguments denote the number of unprocessed bytes, which is
+// tracked by the endpoints.
+//
+class VSOMEIP_IMPORT_EXPORT tcp_receive_buffer {
+public:
+    explicit tcp_receive_buffer(std::size_t _capacity);
+
+    tcp_receive_buffer(const tcp_receive_buffer&) = delete;
+    tcp_receive_buffer& operator=(const tcp_receive_buffer&) = delete;
+
+    // Access relative to the first unprocessed byte
+    inline byte_t& operator[](std::size_t _index) { return data_[begin_ + _index]; }
+    inline const byte_t& operator[](std::size_t _index) const { return data_[begin_ + _index]; }
+
+    inline std::size_t capacity() const { return capacity_; }
+
+    // Number of bytes that can be accessed by operator[]
+    inline std::size_t size() const { return capacity_ - begin_; }
+
+    // Free space behind the unprocessed bytes, where the next receive goes to
+    inline byte_t* get_free(std::size_t _size) { return &data_[begin_ + _size]; }
+    inline std::size_t get_free_size(std::size_t _size) const { return capacity_ - begin_ - _size; }
+
+    // Ensures that at least _required bytes can be received behind the
+    // unprocessed bytes. Moves them to the start of the storage or, if the
+    // capacity does not suffice, moves them to a larger storage, which is not
+    // larger than _max_capacity unless _required demands it. Returns whether
+    // the buffer had to grow.
+    bool prepare(std::size_t _size, std::size_t _required, std::size_t _max_capacity);
+
+    // Releases _processed bytes from the front, _size bytes remain.
+    void consume(std::size_t _processed, std::size_t _size);
+
+    // Drops all data and replaces the storage if its capacity differs.
+    void reset(std::size_t _capacity);
+
+    // Drops all data.
+    inline void clear() { begin_ = 0; }
+
+private:
+    std::unique_ptr<byte_t[]> data_;
+    std::size_t capacity_;
+    std::size_t begin_;
+};
+
+typedef std::shared_ptr<tcp_receive_buffer> tcp_receive_buffer_ptr_t;
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_TCP_RECEIVE_BUFFER_HPP_
@@ -14,6 +14,7 @@
 #include <vsomeip/defines.hpp>
 #include <vsomeip/export.hpp>
 #include "server_endpoint_impl.hpp"
+#include "tcp_receive_buffer.hpp"
 
 #include <chrono>
 
@@ -123,7 +124,7 @@ private:
         const uint32_t max_message_size_;
         const uint32_t recv_buffer_size_initial_;
 
-        message_buffer_t recv_buffer_;
+        tcp_receive_buffer recv_buffer_;
         size_t recv_buffer_size_;
         std::uint32_t missing_capacity_;
         std::uint32_t shrink_count_;
@@ -6,12 +6,14 @@
 #ifndef VSOMEIP_V3_TP_HPP_
 #define VSOMEIP_V3_TP_HPP_
 
+#include <array>
 #include <cstdint>
 #include <vector>
 #include <utility>
 #include <memory>
 
 #include <vsomeip/enumeration_types.hpp>
+#include <vsomeip/export.hpp>
 
 #include "buffer.hpp"
 
@@ -55,6 +57,50 @@ public:
     static const std::uint16_t tp_max_segment_length_ = 1392;
 };
 
+//
+// View on a segment of an unsegmented SOME/IP message. Only the SOME/IP
+// header and the TP header of the segment are stored, the payload is
+// referenced within the message buffer. A segment is sent as two buffers
+// (header, payload) by scatter-gather I/O. Thus, no buffer is allocated
+// and no payload is copied to segment a message.
+//
+class VSOMEIP_IMPORT_EXPORT tp_segment {
+public:
+    tp_segment();
+
+    // Moves to the first segment of _message
+    void first(const message_buffer_ptr_t &_message,
+            std::uint16_t _max_segment_length);
+    // Moves to the next segment. Returns false if the current segment
+    // is the last one.
+    bool next();
+    void reset();
+
+    bool is_segment_of(const message_buffer_ptr_t &_message) const {
+        return (message_ && message_ == _message);
+    }
+    bool is_last() const { return is_last_; }
+
+    const message_buffer_ptr_t &get_message() const { return message_; }
+    std::uint32_t get_offset() const { return offset_; }
+
+    const byte_t *get_header() const { return header_.data(); }
+    std::size_t get_header_size() const { return header_.size(); }
+    const byte_t *get_payload() const;
+    std::size_t get_payload_size() const { return length_; }
+    std::size_t get_size() const { return header_.size() + length_; }
+
+private:
+    void update();
+
+    message_buffer_ptr_t message_;
+    std::array<byte_t, VSOMEIP_TP_PAYLOAD_POS> header_;
+    std::uint32_t offset_;
+    std::uint32_t length_;
+    std::uint16_t max_segment_length_;
+    bool is_last_;
+};
+
 } // namespace tp
 } // namespace vsomeip_v3
 
@@ -15,6 +15,7 @@
 
 #include "client_endpoint_impl.hpp"
 #include "tp_reassembler.hpp"
+#include "udp_send_batch.hpp"
 
 namespace vsomeip_v3 {
 
@@ -55,6 +56,9 @@ public:
                           std::size_t _bytes, const message_buffer_ptr_t &_sent_msg);
 private:
     void send_queued(std::pair<message_buffer_ptr_t, uint32_t> &_entry);
+#if defined(__linux__)
+    bool send_queued_batched();
+#endif
     void get_configured_times_from_endpoint(
             service_t _service, method_t _method,
             std::chrono::nanoseconds *_debouncing,
@@ -80,6 +84,12 @@ private:
 
     std::mutex last_sent_mutex_;
     std::chrono::steady_clock::time_point last_sent_;
+
+#if defined(__linux__)
+    std::unique_ptr<udp_send_batch> transmit_batch_;
+    // Segments of the datagrams of the current batch (empty if not segmented)
+    std::vector<tp::tp_segment> segments_;
+#endif
 };
 
 } // namespace vsomeip_v3
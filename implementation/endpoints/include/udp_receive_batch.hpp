@@ -0,0 +1,159 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_UDP_RECEIVE_BATCH_HPP_
+#define VSOMEIP_V3_UDP_RECEIVE_BATCH_HPP_
+
+#if defined(__linux__)
+
+#include <cerrno>
+#include <vector>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include <boost/asio/ip/udp.hpp>
+
+#include <vsomeip/primitive_types.hpp>
+
+namespace vsomeip_v3 {
+
+//
+// Set of preallocated receive slots that allows to read several datagrams
+// with a single recvmmsg call. For each datagram, the sender and, if
+// IP_PKTINFO / IPV6_RECVPKTINFO is enabled on the socket, the destination
+// address are kept.
+//
+class udp_receive_batch {
+public:
+    typedef boost::asio::ip::udp::endpoint endpoint_type;
+
+    udp_receive_batch(std::size_t _count, std::size_t _length)
+        : length_(_length), count_(0), buffer_(_count * _length), headers_(_count),
+          vecs_(_count), names_(_count), controls_(_count)
+    {
+        for (std::size_t i = 0; i < _count; ++i)
+        {
+            vecs_[i].iov_base = &buffer_[i * length_];
+            vecs_[i].iov_len  = length_;
+
+            headers_[i].msg_hdr.msg_iov    = &vecs_[i];
+            headers_[i].msg_hdr.msg_iovlen = 1;
+        }
+    }
+
+    udp_receive_batch(const udp_receive_batch&)            = delete;
+    udp_receive_batch& operator=(const udp_receive_batch&) = delete;
+
+    std::size_t capacity() const { return headers_.size(); }
+
+    std::size_t size() const { return count_; }
+
+    // Reads up to capacity() datagrams without blocking and returns
+    // the number of datagrams that were read.
+    std::size_t receive(int _socket, boost::system::error_code& _error)
+    {
+        for (std::size_t i = 0; i < headers_.size(); ++i)
+        {
+            auto& its_header          = headers_[i].msg_hdr;
+            its_header.msg_name       = &names_[i];
+            its_header.msg_namelen    = sizeof(names_[i]);
+            its_header.msg_control    = controls_[i].buffer_;
+            its_header.msg_controllen = sizeof(controls_[i].buffer_);
+            its_header.msg_flags      = 0;
+            headers_[i].msg_len       = 0;
+        }
+
+        int its_result;
+        do
+        {
+            its_result = ::recvmmsg(_socket, headers_.data(),
+                                    static_cast<unsigned int>(headers_.size()), MSG_DONTWAIT,
+                                    nullptr);
+        } while (its_result < 0 && errno == EINTR);
+
+        if (its_result < 0)
+        {
+            _error = boost::system::error_code(errno, boost::asio::error::get_system_category());
+            count_ = 0;
+        }
+        else
+        {
+            _error = boost::system::error_code();
+            count_ = static_cast<std::size_t>(its_result);
+        }
+
+        return count_;
+    }
+
+    const byte_t* data(std::size_t _index) const { return &buffer_[_index * length_]; }
+
+    std::size_t bytes(std::size_t _index) const { return headers_[_index].msg_len; }
+
+    endpoint_type sender(std::size_t _index) const
+    {
+        const auto& its_name = names_[_index];
+        if (its_name.ss_family == AF_INET)
+        {
+            const auto its_v4 = reinterpret_cast<const sockaddr_in*>(&its_name);
+            return endpoint_type(boost::asio::ip::address_v4(ntohl(its_v4->sin_addr.s_addr)),
+                                 ntohs(its_v4->sin_port));
+        }
+
+        const auto its_v6 = reinterpret_cast<const sockaddr_in6*>(&its_name);
+        boost::asio::ip::address_v6::bytes_type its_bytes;
+        for (std::size_t i = 0; i < its_bytes.size(); i++)
+            its_bytes[i] = its_v6->sin6_addr.s6_addr[i];
+        return endpoint_type(boost::asio::ip::address_v6(its_bytes), ntohs(its_v6->sin6_port));
+    }
+
+    boost::asio::ip::address destination(std::size_t _index) const
+    {
+        auto its_header = &headers_[_index].msg_hdr;
+        for (const struct cmsghdr* cmsg = CMSG_FIRSTHDR(its_header); cmsg != NULL;
+             cmsg                       = CMSG_NXTHDR(const_cast<msghdr*>(its_header),
+                                                      const_cast<cmsghdr*>(cmsg)))
+        {
+            if (cmsg->cmsg_level == IPPROTO_IP && cmsg->cmsg_type == IP_PKTINFO
+                && cmsg->cmsg_len == CMSG_LEN(sizeof(struct in_pktinfo)))
+            {
+                auto its_pktinfo_v4 = reinterpret_cast<const struct in_pktinfo*>(CMSG_DATA(cmsg));
+                return boost::asio::ip::address_v4(ntohl(its_pktinfo_v4->ipi_addr.s_addr));
+            }
+            if (cmsg->cmsg_level == IPPROTO_IPV6 && cmsg->cmsg_type == IPV6_PKTINFO
+                && cmsg->cmsg_len == CMSG_LEN(sizeof(struct in6_pktinfo)))
+            {
+                auto its_pktinfo_v6 =
+                    reinterpret_cast<const struct in6_pktinfo*>(CMSG_DATA(cmsg));
+                boost::asio::ip::address_v6::bytes_type its_bytes;
+                for (std::size_t i = 0; i < its_bytes.size(); i++)
+                    its_bytes[i] = its_pktinfo_v6->ipi6_addr.s6_addr[i];
+                return boost::asio::ip::address_v6(its_bytes);
+            }
+        }
+        return boost::asio::ip::address();
+    }
+
+private:
+    union control_t {
+        struct cmsghdr cmh_;
+        char           buffer_[CMSG_SPACE(sizeof(struct in6_pktinfo))];
+    };
+
+    const std::size_t length_;
+    std::size_t       count_;
+
+    std::vector<byte_t>                  buffer_;
+    std::vector<struct mmsghdr>          headers_;
+    std::vector<struct iovec>            vecs_;
+    std::vector<struct sockaddr_storage> names_;
+    std::vector<control_t>               controls_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // __linux__
+
+#endif // VSOMEIP_V3_UDP_RECEIVE_BATCH_HPP_
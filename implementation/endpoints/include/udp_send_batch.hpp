@@ -0,0 +1,285 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_UDP_SEND_BATCH_HPP_
+#define VSOMEIP_V3_UDP_SEND_BATCH_HPP_
+
+#if defined(__linux__)
+
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <sys/socket.h>
+
+#include <boost/asio/ip/udp.hpp>
+
+#include "buffer.hpp"
+#include "tp.hpp"
+
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+
+namespace vsomeip_v3 {
+
+//
+// Collects datagrams to be sent with a single sendmmsg call. If generic
+// segmentation offload is enabled, datagrams of equal size that directly
+// follow each other and go to the same target are merged into a single
+// message that is split by the kernel (UDP_SEGMENT). Only the last of the
+// merged datagrams may be shorter. SOME/IP-TP segments are added as views
+// and sent from their header and the payload of the unsegmented message.
+//
+class udp_send_batch {
+public:
+    typedef boost::asio::ip::udp::endpoint endpoint_type;
+
+    udp_send_batch(std::size_t _capacity, bool _use_gso)
+        : capacity_(_capacity), use_gso_(_use_gso), has_gso_failed_(false), buffers_(0),
+          vecs_(2 * _capacity), headers_(_capacity), controls_(_capacity)
+    {
+        datagrams_.reserve(_capacity);
+        messages_.reserve(_capacity);
+    }
+
+    udp_send_batch(const udp_send_batch&)            = delete;
+    udp_send_batch& operator=(const udp_send_batch&) = delete;
+
+    void clear()
+    {
+        datagrams_.clear();
+        messages_.clear();
+        buffers_ = 0;
+        has_gso_failed_ = false;
+    }
+
+    bool is_full() const { return datagrams_.size() >= capacity_; }
+
+    std::size_t size() const { return datagrams_.size(); }
+
+    bool is_using_gso() const { return use_gso_; }
+
+    // Set if the kernel refused a segmented message. GSO is switched off
+    // in this case, the datagrams that were not sent must be added again.
+    bool has_gso_failed() const { return has_gso_failed_; }
+
+    // Adds a datagram. A null target is used for connected sockets.
+    // _may_segment marks datagrams that may be merged (SOME/IP-TP segments).
+    void add(const endpoint_type* _target, const message_buffer_ptr_t& _buffer, bool _may_segment)
+    {
+        datagram_t its_datagram;
+        its_datagram.buffer_ = _buffer;
+        add(_target, std::move(its_datagram), _buffer->size(), 1, _may_segment);
+    }
+
+    // Adds a segment of a SOME/IP-TP message
+    void add(const endpoint_type* _target, const tp::tp_segment& _segment)
+    {
+        datagram_t its_datagram;
+        its_datagram.segment_ = _segment;
+        add(_target, std::move(its_datagram), _segment.get_size(), 2, true);
+    }
+
+    // Sends all collected datagrams without blocking and returns the
+    // number of datagrams (not messages) that were sent. Datagrams are
+    // sent in the order they were added.
+    std::size_t send(int _socket, boost::system::error_code& _error)
+    {
+        _error = boost::system::error_code();
+        if (messages_.empty())
+            return 0;
+
+        // The send buffers are sized to the capacity and only grow if more
+        // datagrams were added than the batch can hold.
+        if (vecs_.size() < buffers_)
+            vecs_.resize(buffers_);
+        if (headers_.size() < messages_.size())
+        {
+            headers_.resize(messages_.size());
+            controls_.resize(messages_.size());
+        }
+        std::memset(headers_.data(), 0, messages_.size() * sizeof(struct mmsghdr));
+
+        std::size_t its_vec(0);
+        for (const auto& its_datagram : datagrams_)
+        {
+            if (its_datagram.buffer_)
+            {
+                vecs_[its_vec].iov_base = its_datagram.buffer_->data();
+                vecs_[its_vec++].iov_len = its_datagram.buffer_->size();
+            }
+            else
+            {
+                const auto& its_segment = its_datagram.segment_;
+                vecs_[its_vec].iov_base = const_cast<byte_t*>(its_segment.get_header());
+                vecs_[its_vec++].iov_len = its_segment.get_header_size();
+                vecs_[its_vec].iov_base = const_cast<byte_t*>(its_segment.get_payload());
+                vecs_[its_vec++].iov_len = its_segment.get_payload_size();
+            }
+        }
+
+        for (std::size_t i = 0; i < messages_.size(); ++i)
+        {
+            auto& its_message = messages_[i];
+            auto& its_header  = headers_[i].msg_hdr;
+
+            if (its_message.name_length_ > 0)
+            {
+                its_header.msg_name    = &its_message.name_;
+                its_header.msg_namelen = its_message.name_length_;
+            }
+            its_header.msg_iov    = &vecs_[its_message.first_buffer_];
+            its_header.msg_iovlen = its_message.buffers_;
+
+            if (its_message.count_ > 1)
+            {
+                its_header.msg_control    = controls_[i].buffer_;
+                its_header.msg_controllen = sizeof(controls_[i].buffer_);
+
+                struct cmsghdr* its_cmsg = CMSG_FIRSTHDR(&its_header);
+                its_cmsg->cmsg_level     = SOL_UDP;
+                its_cmsg->cmsg_type      = UDP_SEGMENT;
+                its_cmsg->cmsg_len       = CMSG_LEN(sizeof(uint16_t));
+                const auto its_segment_size =
+                    static_cast<uint16_t>(its_message.segment_size_);
+                std::memcpy(CMSG_DATA(its_cmsg), &its_segment_size, sizeof(its_segment_size));
+            }
+        }
+
+        std::size_t its_sent_messages(0);
+        std::size_t its_sent_datagrams(0);
+        while (its_sent_messages < messages_.size())
+        {
+            const int its_result = ::sendmmsg(
+                _socket, &headers_[its_sent_messages],
+                static_cast<unsigned int>(messages_.size() - its_sent_messages), MSG_DONTWAIT);
+            if (its_result < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+
+                _error =
+                    boost::system::error_code(errno, boost::asio::error::get_system_category());
+                if (messages_[its_sent_messages].count_ > 1
+                    && _error != boost::asio::error::would_block
+                    && _error != boost::asio::error::try_again)
+                {
+                    use_gso_        = false;
+                    has_gso_failed_ = true;
+                }
+                break;
+            }
+
+            for (int i = 0; i < its_result; ++i)
+                its_sent_datagrams += messages_[its_sent_messages + std::size_t(i)].count_;
+            its_sent_messages += static_cast<std::size_t>(its_result);
+        }
+
+        return its_sent_datagrams;
+    }
+
+private:
+    // Either a complete datagram (buffer_) or a SOME/IP-TP segment (segment_)
+    struct datagram_t {
+        message_buffer_ptr_t buffer_;
+        tp::tp_segment       segment_;
+    };
+
+    struct message_t {
+        struct sockaddr_storage name_;
+        socklen_t               name_length_;
+        std::size_t             first_;
+        std::size_t             count_;
+        std::size_t             first_buffer_;
+        std::size_t             buffers_;
+        std::size_t             bytes_;
+        std::size_t             segment_size_;
+        bool                    may_segment_;
+        bool                    is_closed_;
+    };
+
+    union control_t {
+        struct cmsghdr cmh_;
+        char           buffer_[CMSG_SPACE(sizeof(uint16_t))];
+    };
+
+    void add(const endpoint_type* _target, datagram_t&& _datagram, std::size_t _size,
+             std::size_t _buffers, bool _may_segment)
+    {
+        const std::size_t its_size(_size);
+        if (use_gso_ && _may_segment && !messages_.empty())
+        {
+            auto& its_last = messages_.back();
+            if (its_last.may_segment_ && !its_last.is_closed_
+                && its_size <= its_last.segment_size_
+                && its_last.count_ < max_segments_
+                && its_last.bytes_ + its_size <= max_segmented_bytes_
+                && is_same_target(its_last, _target))
+            {
+                its_last.count_++;
+                its_last.bytes_ += its_size;
+                its_last.is_closed_ = (its_size < its_last.segment_size_);
+                its_last.buffers_ += _buffers;
+                buffers_ += _buffers;
+                datagrams_.push_back(std::move(_datagram));
+                return;
+            }
+        }
+
+        message_t its_message;
+        std::memset(&its_message.name_, 0, sizeof(its_message.name_));
+        its_message.name_length_ = 0;
+        if (_target)
+        {
+            its_message.name_length_ = static_cast<socklen_t>(_target->size());
+            std::memcpy(&its_message.name_, _target->data(), _target->size());
+        }
+        its_message.first_        = datagrams_.size();
+        its_message.count_        = 1;
+        its_message.bytes_        = its_size;
+        its_message.segment_size_ = its_size;
+        its_message.may_segment_  = _may_segment;
+        its_message.is_closed_    = false;
+        its_message.first_buffer_ = buffers_;
+        its_message.buffers_      = _buffers;
+        messages_.push_back(its_message);
+
+        buffers_ += _buffers;
+        datagrams_.push_back(std::move(_datagram));
+    }
+
+    bool is_same_target(const message_t& _message, const endpoint_type* _target) const
+    {
+        if (!_target)
+            return _message.name_length_ == 0;
+        return _message.name_length_ == static_cast<socklen_t>(_target->size())
+            && std::memcmp(&_message.name_, _target->data(), _target->size()) == 0;
+    }
+
+    // Limits of the Linux UDP GSO implementation
+    static constexpr std::size_t max_segments_        = 64;
+    static constexpr std::size_t max_segmented_bytes_ = 65507;
+
+    const std::size_t capacity_;
+    bool              use_gso_;
+    bool              has_gso_failed_;
+
+    std::vector<datagram_t> datagrams_;
+    std::vector<message_t>  messages_;
+    std::size_t             buffers_;
+
+    std::vector<struct iovec>   vecs_;
+    std::vector<struct mmsghdr> headers_;
+    std::vector<control_t>      controls_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // __linux__
+
+#endif // VSOMEIP_V3_UDP_SEND_BATCH_HPP_
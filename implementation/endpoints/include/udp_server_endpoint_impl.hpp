@@ -11,6 +11,8 @@
 
 #include "server_endpoint_impl.hpp"
 #include "tp_reassembler.hpp"
+#include "udp_receive_batch.hpp"
+#include "udp_send_batch.hpp"
 
 namespace vsomeip_v3 {
 typedef server_endpoint_impl<boost::asio::ip::udp> udp_server_endpoint_base_impl;
@@ -72,6 +74,10 @@ public:
     bool is_joining() const;
 
 private:
+    bool        send_queued_unbatched(const target_data_iterator_type _it);
+#if defined(__linux__)
+    void        send_queued_batched();
+#endif
     void        leave_unlocked(const std::string& _address);
     void        set_broadcast();
     void        receive_unicast();
@@ -89,9 +95,21 @@ private:
     void on_multicast_received(boost::system::error_code const& _error, std::size_t _bytes,
                                uint8_t _multicast_id, const boost::asio::ip::address& _destination);
 
+#if defined(__linux__)
+    void receive_unicast_batch();
+    void on_unicast_batch_received(boost::system::error_code const& _error);
+    void on_multicast_batch_received(boost::system::error_code const& _error, std::size_t _count,
+                                     uint8_t _multicast_id);
+#endif
+
+    void on_multicast_message_received(boost::system::error_code const& _error, std::size_t _bytes,
+                                       endpoint_type const&            _remote,
+                                       const boost::asio::ip::address& _destination,
+                                       const byte_t*                   _buffer);
+
     void on_message_received(boost::system::error_code const& _error, std::size_t _bytes,
                              bool _is_multicast, endpoint_type const& _remote,
-                             message_buffer_t const& _buffer);
+                             const byte_t* _buffer);
 
     bool is_same_subnet(const boost::asio::ip::address& _address) const;
 
@@ -132,6 +150,20 @@ private:
 
     std::atomic<bool> is_stopped_;
 
+    // Number of datagrams read per wakeup (1 = batched receive disabled)
+    std::uint32_t receive_batch_size_;
+#if defined(__linux__)
+    std::shared_ptr<udp_receive_batch> unicast_batch_;
+    std::shared_ptr<udp_receive_batch> multicast_batch_;
+
+    // Transmit batching: queue entries of all targets in transmit_targets_
+    // are sent with a single sendmmsg call.
+    std::unique_ptr<udp_send_batch> transmit_batch_;
+#endif
+    std::mutex                 transmit_mutex_;
+    std::vector<endpoint_type> transmit_targets_; // guarded by mutex_
+    bool                       is_transmit_scheduled_; // guarded by mutex_
+
     // to tracking sent messages
     on_unicast_sent_cbk_t on_unicast_sent_;
 
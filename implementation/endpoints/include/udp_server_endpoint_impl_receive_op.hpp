@@ -17,6 +17,8 @@
 
 #include <vsomeip/internal/logger.hpp>
 
+#include "udp_receive_batch.hpp"
+
 #if defined(__QNX__)
 #include <netinet/in.h>
 #include <sys/socket.h>
@@ -363,6 +365,71 @@ receive_cb (std::shared_ptr<storage> _data) {
     };
 }
 
+#if defined(__linux__)
+typedef std::function<
+    void (boost::system::error_code const &_error, size_t _count,
+          std::uint8_t)> batch_receive_handler_t;
+
+struct batch_storage
+{
+    std::recursive_mutex &multicast_mutex_;
+    std::weak_ptr<socket_type_t> socket_;
+    batch_receive_handler_t handler_;
+    std::shared_ptr<udp_receive_batch> batch_;
+    std::uint8_t multicast_id_;
+
+    batch_storage(
+        std::recursive_mutex &_multicast_mutex,
+        std::weak_ptr<socket_type_t> _socket,
+        batch_receive_handler_t _handler,
+        std::shared_ptr<udp_receive_batch> _batch,
+        std::uint8_t _multicast_id
+    ) : multicast_mutex_(_multicast_mutex),
+        socket_(_socket),
+        handler_(_handler),
+        batch_(_batch),
+        multicast_id_(_multicast_id)
+    {}
+};
+
+//
+// Batched variant of receive_cb: reads all datagrams that fit into the
+// batch with a single recvmmsg call. The handler is called with the
+// multicast mutex being hold, as the batch is shared by all receive
+// operations of the endpoint.
+//
+std::function<void(boost::system::error_code _error)>
+receive_batch_cb (std::shared_ptr<batch_storage> _data) {
+    return [_data](boost::system::error_code _error) {
+        std::lock_guard<std::recursive_mutex> its_lock(_data->multicast_mutex_);
+
+        size_t its_count(0);
+        if (!_error) {
+            auto multicast_socket = _data->socket_.lock();
+            if (!multicast_socket) {
+                VSOMEIP_WARNING << "udp_endpoint_receive_op::receive_batch_cb: "
+                        "multicast_socket with id " << int{_data->multicast_id_}
+                        << " has expired!";
+                return;
+            }
+
+            its_count = _data->batch_->receive(multicast_socket->native_handle(), _error);
+            if (_error == boost::asio::error::would_block
+                    || _error == boost::asio::error::try_again) {
+                multicast_socket->async_wait(
+                    socket_type_t::wait_read,
+                    receive_batch_cb(_data)
+                );
+                return;
+            }
+        }
+
+        // Call the handler
+        _data->handler_(_error, its_count, _data->multicast_id_);
+    };
+}
+#endif // __linux__
+
 } // namespace udp_endpoint_receive_op
 } // namespace vsomeip_v3
 
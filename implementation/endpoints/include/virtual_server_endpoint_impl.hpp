@@ -33,6 +33,7 @@ public:
     void set_connected(bool _connected);
 
     bool send(const byte_t *_data, uint32_t _size);
+    bool send_shared(const message_buffer_ptr_t &_buffer);
     bool send_to(const std::shared_ptr<endpoint_definition> _target,
             const byte_t *_data, uint32_t _size);
     bool send_error(const std::shared_ptr<endpoint_definition> _target,
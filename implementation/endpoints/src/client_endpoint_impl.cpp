@@ -135,6 +135,7 @@ void client_endpoint_impl<Protocol>::stop()
         // delete unsent messages
         queue_.clear();
         queue_size_ = 0;
+        segment_.reset();
     }
     {
         std::lock_guard<std::mutex> its_lock(connect_timer_mutex_);
@@ -323,20 +324,13 @@ bool client_endpoint_impl<Protocol>::tp_segmentation_enabled(service_t /*_servic
 }
 
 template <typename Protocol>
-void client_endpoint_impl<Protocol>::send_segments(const tp::tp_split_messages_t& _segments,
-                                                   std::uint32_t                  _separation_time)
+void client_endpoint_impl<Protocol>::send_segments(const byte_t* _data, std::uint32_t _size,
+                                                   std::uint32_t _separation_time)
 {
     auto its_now(std::chrono::steady_clock::now());
 
-    if (_segments.size() == 0)
-    {
-        return;
-    }
-
-    const service_t its_service =
-        bithelper::read_uint16_be(&(*(_segments[0]))[VSOMEIP_SERVICE_POS_MIN]);
-    const service_t its_method =
-        bithelper::read_uint16_be(&(*(_segments[0]))[VSOMEIP_METHOD_POS_MIN]);
+    const service_t its_service = bithelper::read_uint16_be(&_data[VSOMEIP_SERVICE_POS_MIN]);
+    const method_t  its_method  = bithelper::read_uint16_be(&_data[VSOMEIP_METHOD_POS_MIN]);
 
     std::chrono::nanoseconds its_debouncing(0), its_retention(0);
     get_configured_times_from_endpoint(its_service, its_method, &its_debouncing, &its_retention);
@@ -360,13 +354,12 @@ void client_endpoint_impl<Protocol>::send_segments(const tp::tp_split_messages_t
         train_->departure_ = its_now + its_retention;
     }
 
-    for (const auto& s : _segments)
-    {
-        queue_.emplace_back(std::make_pair(s, _separation_time));
-        queue_size_ += s->size();
-    }
+    // The message is queued as a whole, its segments are created while sending
+    queue_.emplace_back(
+        std::make_pair(std::make_shared<message_buffer_t>(_data, _data + _size), _separation_time));
+    queue_size_ += _size;
 
-    if (!is_sending_ && !queue_.empty())
+    if (!is_sending_)
     { // no writing in progress
         // ignore retention time and send immediately as the train is full anyway
         auto its_entry = get_front();
@@ -598,6 +591,15 @@ void client_endpoint_impl<Protocol>::send_cbk(boost::system::error_code const& _
         std::lock_guard<std::recursive_mutex> its_lock(mutex_);
         if (queue_.size() > 0)
         {
+            // A SOME/IP-TP message is removed after its last segment was sent
+            if (segment_.is_segment_of(queue_.front().first) && segment_.next())
+            {
+                auto its_entry = get_front();
+                send_queued(its_entry);
+                return;
+            }
+            segment_.reset();
+
             queue_size_ -= queue_.front().first->size();
             queue_.pop_front();
 
@@ -849,27 +851,13 @@ client_endpoint_impl<Protocol>::check_message_size(const std::uint8_t* const _da
     if (endpoint_impl<Protocol>::max_message_size_ != MESSAGE_SIZE_UNLIMITED
         && _size > endpoint_impl<Protocol>::max_message_size_)
     {
-        if (endpoint_impl<Protocol>::is_supporting_someip_tp_ && _data != nullptr)
+        std::uint16_t its_max_segment_length;
+        std::uint32_t its_separation_time;
+        if (_data != nullptr
+            && get_tp_configuration(_data, its_max_segment_length, its_separation_time))
         {
-            const service_t its_service =
-                bithelper::read_uint16_be(&_data[VSOMEIP_SERVICE_POS_MIN]);
-            const method_t its_method   = bithelper::read_uint16_be(&_data[VSOMEIP_METHOD_POS_MIN]);
-            instance_t     its_instance = this->get_instance(its_service);
-
-            if (its_instance != ANY_INSTANCE)
-            {
-                if (tp_segmentation_enabled(its_service, its_instance, its_method))
-                {
-                    std::uint16_t its_max_segment_length;
-                    std::uint32_t its_separation_time;
-                    this->configuration_->get_tp_configuration(
-                        its_service, its_instance, its_method, true, its_max_segment_length,
-                        its_separation_time);
-                    send_segments(tp::tp::tp_split_message(_data, _size, its_max_segment_length),
-                                  its_separation_time);
-                    return endpoint_impl<Protocol>::cms_ret_e::MSG_WAS_SPLIT;
-                }
-            }
+            send_segments(_data, _size, its_separation_time);
+            return endpoint_impl<Protocol>::cms_ret_e::MSG_WAS_SPLIT;
         }
         VSOMEIP_ERROR << "cei::check_message_size: Dropping to big message (" << std::dec << _size
                       << " Bytes). Maximum allowed message size is: "
@@ -879,6 +867,54 @@ client_endpoint_impl<Protocol>::check_message_size(const std::uint8_t* const _da
     return ret;
 }
 
+template <typename Protocol>
+bool client_endpoint_impl<Protocol>::get_tp_configuration(const byte_t*  _data,
+                                                          std::uint16_t& _max_segment_length,
+                                                          std::uint32_t& _separation_time)
+{
+    if (!endpoint_impl<Protocol>::is_supporting_someip_tp_)
+        return false;
+
+    const service_t  its_service  = bithelper::read_uint16_be(&_data[VSOMEIP_SERVICE_POS_MIN]);
+    const method_t   its_method   = bithelper::read_uint16_be(&_data[VSOMEIP_METHOD_POS_MIN]);
+    const instance_t its_instance = this->get_instance(its_service);
+    if (its_instance == ANY_INSTANCE
+        || !tp_segmentation_enabled(its_service, its_instance, its_method))
+        return false;
+
+    this->configuration_->get_tp_configuration(its_service, its_instance, its_method, true,
+                                               _max_segment_length, _separation_time);
+    return true;
+}
+
+template <typename Protocol>
+tp::tp_segment* client_endpoint_impl<Protocol>::get_segment(const message_buffer_ptr_t& _buffer)
+{
+    if (!segment_.is_segment_of(_buffer) && !start_segment(_buffer, segment_))
+        return nullptr;
+
+    return &segment_;
+}
+
+template <typename Protocol>
+bool client_endpoint_impl<Protocol>::start_segment(const message_buffer_ptr_t& _buffer,
+                                                   tp::tp_segment&             _segment)
+{
+    // Only SOME/IP-TP messages are queued if they exceed the maximum message size
+    if (endpoint_impl<Protocol>::max_message_size_ == MESSAGE_SIZE_UNLIMITED
+        || _buffer->size() <= endpoint_impl<Protocol>::max_message_size_)
+    {
+        return false;
+    }
+
+    // The configuration might have been removed meanwhile, use the default then
+    std::uint16_t its_max_segment_length(tp::tp::tp_max_segment_length_);
+    std::uint32_t its_separation_time;
+    (void)get_tp_configuration(_buffer->data(), its_max_segment_length, its_separation_time);
+    _segment.first(_buffer, its_max_segment_length);
+    return true;
+}
+
 template <typename Protocol>
 bool client_endpoint_impl<Protocol>::check_queue_limit(const uint8_t* _data,
                                                        std::uint32_t  _size) const
@@ -3,41 +3,388 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <array>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
 #include <vsomeip/constants.hpp>
 
 #include "../include/endpoint_definition.hpp"
 
 namespace vsomeip_v3 {
 
-std::map<std::tuple<service_t, instance_t, boost::asio::ip::address, uint16_t, bool>,
-         std::shared_ptr<endpoint_definition>>
-    endpoint_definition::definitions_;
+namespace {
+struct definition_key {
+    definition_key(const boost::asio::ip::address& _address, uint16_t _port, bool _is_reliable,
+                   service_t _service, instance_t _instance)
+        : address_(_address), port_(_port), is_reliable_(_is_reliable), service_(_service),
+          instance_(_instance)
+    {
+        // IPv4 addresses are hashed from their integer value, IPv6 addresses
+        // from their two halves. The remaining fields fit into one word.
+        std::uint64_t its_address;
+        if (_address.is_v4())
+        {
+            its_address = _address.to_v4().to_uint();
+        }
+        else
+        {
+            const auto    its_bytes = _address.to_v6().to_bytes();
+            std::uint64_t its_high, its_low;
+            std::memcpy(&its_high, &its_bytes[0], sizeof(its_high));
+            std::memcpy(&its_low, &its_bytes[8], sizeof(its_low));
+            its_address = its_high ^ (its_low * 0x9e3779b97f4a7c15ULL);
+        }
+        std::uint64_t its_hash = its_address
+            ^ ((std::uint64_t(_service) << 48) | (std::uint64_t(_instance) << 32)
+               | (std::uint64_t(_port) << 16) | std::uint64_t(_is_reliable))
+                * 0xc2b2ae3d27d4eb4fULL;
+        its_hash ^= its_hash >> 33;
+        its_hash *= 0xff51afd7ed558ccdULL;
+        its_hash ^= its_hash >> 33;
+        hash_ = its_hash;
+    }
+
+    bool operator==(const definition_key& _other) const
+    {
+        return (port_ == _other.port_ && service_ == _other.service_
+                && instance_ == _other.instance_ && is_reliable_ == _other.is_reliable_
+                && address_ == _other.address_);
+    }
+
+    boost::asio::ip::address address_;
+    uint16_t                 port_;
+    bool                     is_reliable_;
+    service_t                service_;
+    instance_t               instance_;
+    std::uint64_t            hash_;
+};
+
+// Interned definition. Entries are immutable once they were published.
+struct definition_entry {
+    definition_entry(const definition_key&                       _key,
+                     const std::shared_ptr<endpoint_definition>& _definition)
+        : key_(_key), definition_(_definition)
+    {}
+
+    const definition_key                     key_;
+    const std::weak_ptr<endpoint_definition> definition_;
+};
+
+// Marks a slot whose entry was reclaimed. It is skipped by lookups and
+// reused by insertions.
+const definition_entry
+    definition_tombstone(definition_key(boost::asio::ip::address(), 0, false, 0, 0), nullptr);
+
+// Open addressing table with linear probing. Slots are never cleared, so
+// probe sequences stay intact: expired entries are replaced by the next
+// insertion that probes them or by a tombstone, and the table is only
+// rebuilt once its slots are used up.
+struct definition_table {
+    explicit definition_table(std::size_t _capacity)
+        : mask_(_capacity - 1), slots_(new std::atomic<const definition_entry*>[_capacity])
+    {
+        for (std::size_t i = 0; i < _capacity; ++i)
+            slots_[i].store(nullptr, std::memory_order_relaxed);
+    }
+
+    std::size_t get_capacity() const { return mask_ + 1; }
+
+    const std::size_t                                       mask_;
+    std::unique_ptr<std::atomic<const definition_entry*>[]> slots_;
+
+    // Writers only
+    std::size_t used_{0};  // slots that are not empty
+    std::size_t size_{0};  // slots that hold an entry
+    std::size_t sweep_{0}; // next slot to check for an expired entry
+};
+
+const std::size_t definition_table_min_capacity = 16;
+
+// Number of slots each insertion checks for expired entries
+const std::size_t definition_table_sweep = 4;
+
+// The definitions of a shard are read without locking. Writers are
+// serialized by the shard mutex and publish new entries into free or reused
+// slots. Replaced entries and tables are retired instead of being deleted:
+// readers announce themselves in the counter of the current epoch, and the
+// retired objects are deleted by a later writer once no reader of the epoch
+// they were retired in is left. Writers therefore never wait for readers.
+struct alignas(64) definition_shard {
+    ~definition_shard()
+    {
+        const definition_table* its_table = table_.load();
+        if (its_table)
+        {
+            for (std::size_t i = 0; i < its_table->get_capacity(); ++i)
+            {
+                const definition_entry* its_entry = its_table->slots_[i].load();
+                if (its_entry != &definition_tombstone)
+                    delete its_entry;
+            }
+            delete its_table;
+        }
+        reclaim(0);
+        reclaim(1);
+    }
+
+    // Returns the epoch the calling reader was counted for
+    unsigned enter()
+    {
+        while (true)
+        {
+            const unsigned its_epoch = epoch_.load();
+            readers_[its_epoch].fetch_add(1);
+            if (epoch_.load() == its_epoch)
+                return its_epoch;
+            readers_[its_epoch].fetch_sub(1);
+        }
+    }
+
+    void leave(unsigned _epoch)
+    {
+        readers_[_epoch].fetch_sub(1, std::memory_order_release);
+    }
+
+    // Must be called with mutex_ being hold, after the objects were unlinked
+    void retire(const definition_entry* _entry)
+    {
+        retired_entries_[epoch_.load(std::memory_order_relaxed)].push_back(_entry);
+    }
+
+    void retire(const definition_table* _table)
+    {
+        retired_tables_[epoch_.load(std::memory_order_relaxed)].push_back(_table);
+    }
+
+    // Must be called with mutex_ being hold. Deletes the objects retired in
+    // the previous epoch if none of its readers is left and switches the
+    // epoch, so that the objects retired in the current one follow later.
+    void advance()
+    {
+        const unsigned its_epoch = epoch_.load(std::memory_order_relaxed);
+        if (readers_[its_epoch ^ 1].load() != 0)
+            return;
+        reclaim(its_epoch ^ 1);
+        if (!retired_entries_[its_epoch].empty() || !retired_tables_[its_epoch].empty())
+            epoch_.store(its_epoch ^ 1);
+    }
+
+    void reclaim(unsigned _epoch)
+    {
+        for (auto e : retired_entries_[_epoch])
+            delete e;
+        retired_entries_[_epoch].clear();
+        for (auto t : retired_tables_[_epoch])
+            delete t;
+        retired_tables_[_epoch].clear();
+    }
+
+    std::atomic<definition_table*> table_{nullptr};
+    std::atomic<unsigned>          epoch_{0};
+    std::atomic<std::uint32_t>     readers_[2]{{0}, {0}};
+
+    std::mutex                           mutex_;
+    std::vector<const definition_entry*> retired_entries_[2];
+    std::vector<const definition_table*> retired_tables_[2];
+
+    std::atomic<std::uint64_t> hits_{0};
+    std::atomic<std::uint64_t> misses_{0};
+    std::atomic<std::uint64_t> reclaimed_{0};
+};
+
+const unsigned definition_shard_bits = 6;
+std::array<definition_shard, 1 << definition_shard_bits> definition_shards;
+
+std::shared_ptr<endpoint_definition> find_definition(const definition_table* _table,
+                                                     const definition_key&   _key)
+{
+    if (_table)
+    {
+        for (std::size_t i = _key.hash_ & _table->mask_;; i = (i + 1) & _table->mask_)
+        {
+            const definition_entry* its_entry = _table->slots_[i].load(std::memory_order_acquire);
+            if (!its_entry)
+                break;
+            if (its_entry != &definition_tombstone && its_entry->key_ == _key)
+                return its_entry->definition_.lock();
+        }
+    }
+    return nullptr;
+}
 
-std::mutex endpoint_definition::definitions_mutex_;
+// Writers only: inserts the entry into the first empty slot of its sequence
+void insert_entry(definition_table* _table, const definition_entry* _entry)
+{
+    std::size_t i = _entry->key_.hash_ & _table->mask_;
+    while (_table->slots_[i].load(std::memory_order_relaxed))
+        i = (i + 1) & _table->mask_;
+    _table->slots_[i].store(_entry, std::memory_order_release);
+    _table->used_++;
+    _table->size_++;
+}
+
+// Writers only: replaces the expired entries of the next slots by tombstones
+std::uint64_t sweep_entries(definition_shard& _shard, definition_table* _table)
+{
+    std::uint64_t its_reclaimed(0);
+    for (std::size_t n = 0; n < definition_table_sweep; ++n)
+    {
+        auto& its_slot = _table->slots_[_table->sweep_];
+        _table->sweep_ = (_table->sweep_ + 1) & _table->mask_;
+
+        const definition_entry* its_entry = its_slot.load(std::memory_order_relaxed);
+        if (its_entry && its_entry != &definition_tombstone && its_entry->definition_.expired())
+        {
+            its_slot.store(&definition_tombstone, std::memory_order_release);
+            _shard.retire(its_entry);
+            _table->size_--;
+            its_reclaimed++;
+        }
+    }
+    return its_reclaimed;
+}
+} // namespace
 
 std::shared_ptr<endpoint_definition>
 endpoint_definition::get(const boost::asio::ip::address& _address, uint16_t _port,
                          bool _is_reliable, service_t _service, instance_t _instance)
 {
-    auto key = std::make_tuple(_service, _instance, _address, _port, _is_reliable);
-    std::lock_guard<std::mutex>          its_lock(definitions_mutex_);
-    std::shared_ptr<endpoint_definition> its_result;
+    const definition_key its_key(_address, _port, _is_reliable, _service, _instance);
+    auto& its_shard = definition_shards[its_key.hash_ >> (64 - definition_shard_bits)];
 
-    auto found_endpoint = definitions_.find(key);
-    if (found_endpoint != definitions_.end())
+    const unsigned its_epoch  = its_shard.enter();
+    auto           its_result = find_definition(its_shard.table_.load(), its_key);
+    its_shard.leave(its_epoch);
+    if (its_result)
     {
-        its_result = found_endpoint->second;
+        its_shard.hits_.fetch_add(1, std::memory_order_relaxed);
+        return its_result;
     }
 
-    if (!its_result)
+    std::lock_guard<std::mutex> its_lock(its_shard.mutex_);
+    // Another writer might have added the definition in the meantime. The
+    // first slot of the sequence that holds a tombstone or an expired entry
+    // (if any) is reused for the new one.
+    auto                                  its_table = its_shard.table_.load();
+    std::atomic<const definition_entry*>* its_reusable(nullptr);
+    if (its_table)
     {
-        its_result        = std::make_shared<endpoint_definition>(_address, _port, _is_reliable);
-        definitions_[key] = its_result;
+        for (std::size_t i = its_key.hash_ & its_table->mask_;; i = (i + 1) & its_table->mask_)
+        {
+            const definition_entry* its_entry =
+                its_table->slots_[i].load(std::memory_order_relaxed);
+            if (!its_entry)
+                break;
+            if (its_entry == &definition_tombstone)
+            {
+                if (!its_reusable)
+                    its_reusable = &its_table->slots_[i];
+                continue;
+            }
+            if (its_entry->key_ == its_key)
+            {
+                its_result = its_entry->definition_.lock();
+                if (its_result)
+                {
+                    its_shard.hits_.fetch_add(1, std::memory_order_relaxed);
+                    return its_result;
+                }
+                if (!its_reusable)
+                    its_reusable = &its_table->slots_[i];
+                break;
+            }
+            if (!its_reusable && its_entry->definition_.expired())
+                its_reusable = &its_table->slots_[i];
+        }
     }
+    its_shard.misses_.fetch_add(1, std::memory_order_relaxed);
+
+    its_result     = std::make_shared<endpoint_definition>(_address, _port, _is_reliable);
+    auto its_entry = new definition_entry(its_key, its_result);
+
+    std::uint64_t its_reclaimed(0);
+    if (its_reusable)
+    {
+        const definition_entry* its_replaced =
+            its_reusable->exchange(its_entry, std::memory_order_acq_rel);
+        if (its_replaced == &definition_tombstone)
+        {
+            its_table->size_++;
+        }
+        else
+        {
+            its_shard.retire(its_replaced);
+            its_reclaimed++;
+        }
+        its_reclaimed += sweep_entries(its_shard, its_table);
+    }
+    else if (its_table && (its_table->used_ + 1) * 4 <= its_table->get_capacity() * 3)
+    {
+        insert_entry(its_table, its_entry);
+        its_reclaimed += sweep_entries(its_shard, its_table);
+    }
+    else
+    {
+        // Rebuild with the entries that are still referenced. The entries are
+        // moved, not copied, and the new table is at most half full, so this
+        // happens at most once per (capacity / 4) insertions.
+        std::vector<const definition_entry*> its_entries;
+        if (its_table)
+        {
+            for (std::size_t i = 0; i < its_table->get_capacity(); ++i)
+            {
+                const definition_entry* e = its_table->slots_[i].load(std::memory_order_relaxed);
+                if (!e || e == &definition_tombstone)
+                    continue;
+                if (e->definition_.expired())
+                {
+                    its_shard.retire(e);
+                    its_reclaimed++;
+                }
+                else
+                {
+                    its_entries.push_back(e);
+                }
+            }
+        }
+        std::size_t its_capacity(definition_table_min_capacity);
+        while (its_capacity < (its_entries.size() + 1) * 2)
+            its_capacity <<= 1;
+
+        auto its_new_table = new definition_table(its_capacity);
+        for (auto e : its_entries)
+            insert_entry(its_new_table, e);
+        insert_entry(its_new_table, its_entry);
+        its_shard.table_.store(its_new_table);
+        if (its_table)
+            its_shard.retire(its_table);
+    }
+    its_shard.reclaimed_.fetch_add(its_reclaimed, std::memory_order_relaxed);
+    its_shard.advance();
 
     return its_result;
 }
 
+endpoint_definition::statistics_t endpoint_definition::get_statistics()
+{
+    statistics_t its_statistics{0, 0, 0, 0};
+    for (auto& its_shard : definition_shards)
+    {
+        {
+            std::lock_guard<std::mutex> its_lock(its_shard.mutex_);
+            const definition_table*     its_table = its_shard.table_.load();
+            if (its_table)
+                its_statistics.size_ += its_table->size_;
+        }
+        its_statistics.hits_ += its_shard.hits_.load(std::memory_order_relaxed);
+        its_statistics.misses_ += its_shard.misses_.load(std::memory_order_relaxed);
+        its_statistics.reclaimed_ += its_shard.reclaimed_.load(std::memory_order_relaxed);
+    }
+    return its_statistics;
+}
+
 endpoint_definition::endpoint_definition(const boost::asio::ip::address& _address, uint16_t _port,
                                          bool _is_reliable)
     : address_(_address), port_(_port), remote_port_(_port), is_reliable_(_is_reliable)
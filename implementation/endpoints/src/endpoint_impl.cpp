@@ -14,6 +14,7 @@
 #include "../include/endpoint_host.hpp"
 #include "../../routing/include/routing_host.hpp"
 #include "../include/endpoint_impl.hpp"
+#include "../include/tcp_framing.hpp"
 
 namespace vsomeip_v3 {
 
@@ -42,46 +43,13 @@ void endpoint_impl<Protocol>::enable_magic_cookies()
 template <typename Protocol>
 uint32_t endpoint_impl<Protocol>::find_magic_cookie(byte_t* _buffer, size_t _size)
 {
-    bool     is_found(false);
-    uint32_t its_offset = 0xFFFFFFFF;
-
-    uint8_t its_cookie_identifier, its_cookie_type;
-
-    if (is_client())
-    {
-        its_cookie_identifier = static_cast<uint8_t>(MAGIC_COOKIE_SERVICE_MESSAGE);
-        its_cookie_type       = static_cast<uint8_t>(MAGIC_COOKIE_SERVICE_MESSAGE_TYPE);
-    }
-    else
-    {
-        its_cookie_identifier = static_cast<uint8_t>(MAGIC_COOKIE_CLIENT_MESSAGE);
-        its_cookie_type       = static_cast<uint8_t>(MAGIC_COOKIE_CLIENT_MESSAGE_TYPE);
-    }
-
-    do
-    {
-        its_offset++; // --> first loop has "its_offset = 0"
-        if (_size > its_offset + 16)
-        {
-            is_found =
-                (_buffer[its_offset] == 0xFF && _buffer[its_offset + 1] == 0xFF
-                 && _buffer[its_offset + 2] == its_cookie_identifier
-                 && _buffer[its_offset + 3] == 0x00 && _buffer[its_offset + 4] == 0x00
-                 && _buffer[its_offset + 5] == 0x00 && _buffer[its_offset + 6] == 0x00
-                 && _buffer[its_offset + 7] == 0x08 && _buffer[its_offset + 8] == 0xDE
-                 && _buffer[its_offset + 9] == 0xAD && _buffer[its_offset + 10] == 0xBE
-                 && _buffer[its_offset + 11] == 0xEF && _buffer[its_offset + 12] == 0x01
-                 && _buffer[its_offset + 13] == 0x01 && _buffer[its_offset + 14] == its_cookie_type
-                 && _buffer[its_offset + 15] == 0x00);
-        }
-        else
-        {
-            break;
-        }
-
-    } while (!is_found);
-
-    return (is_found ? its_offset : 0xFFFFFFFF);
+    // A cookie is only reported if at least one byte follows it
+    if (_size <= sizeof(CLIENT_COOKIE))
+        return 0xFFFFFFFF;
+
+    const std::size_t its_offset = tcp_framing::find_magic_cookie(
+        _buffer, _size - 1, is_client() ? SERVICE_COOKIE : CLIENT_COOKIE);
+    return (its_offset < _size - 1 ? static_cast<uint32_t>(its_offset) : 0xFFFFFFFF);
 }
 
 template <typename Protocol>
@@ -96,6 +64,13 @@ template <typename Protocol>
 void endpoint_impl<Protocol>::remove_stop_handler(service_t)
 {}
 
+template <typename Protocol>
+bool endpoint_impl<Protocol>::send_shared(const message_buffer_ptr_t& _buffer)
+{
+    // Endpoints that cannot queue a shared buffer fall back to copying
+    return send(_buffer->data(), static_cast<uint32_t>(_buffer->size()));
+}
+
 template <typename Protocol>
 void endpoint_impl<Protocol>::register_error_handler(const error_handler_t& _error_handler)
 {
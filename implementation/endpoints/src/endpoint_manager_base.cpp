@@ -47,7 +47,8 @@ void endpoint_manager_base::remove_local(const client_t _client)
                      << "] is closing connection to [" << std::hex << _client << "]"
                      << " endpoint > " << its_endpoint;
         std::lock_guard<std::mutex> its_lock(local_endpoint_mutex_);
-        local_endpoints_.erase(_client);
+        if (local_endpoints_.erase(_client))
+            local_endpoints_index_.publish(nullptr);
     }
 }
 
@@ -75,8 +76,18 @@ std::shared_ptr<endpoint> endpoint_manager_base::find_or_create_local(client_t _
 
 std::shared_ptr<endpoint> endpoint_manager_base::find_local(client_t _client)
 {
+    {
+        epoch_snapshot<local_endpoints_index_t>::reader_t its_reader(local_endpoints_index_);
+        if (its_reader.get())
+        {
+            const auto its_endpoint = its_reader.get()->find(_client);
+            return (its_endpoint ? *its_endpoint : nullptr);
+        }
+    }
+
     std::lock_guard<std::mutex> its_lock(local_endpoint_mutex_);
-    return find_local_unlocked(_client);
+    const auto                  its_endpoint = get_local_endpoints_index_unlocked()->find(_client);
+    return (its_endpoint ? *its_endpoint : nullptr);
 }
 
 std::shared_ptr<endpoint> endpoint_manager_base::find_local(service_t  _service,
@@ -385,6 +396,7 @@ std::shared_ptr<endpoint> endpoint_manager_base::create_local_unlocked(client_t
         if (_client != VSOMEIP_ROUTING_CLIENT)
         {
             local_endpoints_[_client] = its_endpoint;
+            local_endpoints_index_.publish(nullptr);
         }
         rm_->register_client_error_handler(_client, its_endpoint);
     }
@@ -407,6 +419,22 @@ std::shared_ptr<endpoint> endpoint_manager_base::find_local_unlocked(client_t _c
     return its_endpoint;
 }
 
+const endpoint_manager_base::local_endpoints_index_t*
+endpoint_manager_base::get_local_endpoints_index_unlocked() const
+{
+    auto its_index = local_endpoints_index_.get_published();
+    if (!its_index)
+    {
+        auto its_new_index = new local_endpoints_index_t(local_endpoints_.size());
+        for (const auto& its_endpoint : local_endpoints_)
+            its_new_index->insert(its_endpoint.first, its_endpoint.second);
+
+        local_endpoints_index_.publish(its_new_index);
+        its_index = its_new_index;
+    }
+    return its_index;
+}
+
 instance_t endpoint_manager_base::find_instance(service_t _service, endpoint* const _endpoint) const
 {
     (void)_service;
@@ -273,10 +273,11 @@ std::shared_ptr<endpoint> endpoint_manager_impl::create_server_endpoint(uint16_t
     std::lock_guard<std::recursive_mutex> its_lock(endpoint_mutex_);
     if (_start)
     {
+        auto& its_io = rm_->get_endpoint_io(get_endpoint_hash(its_unicast, _port, _reliable));
         if (_reliable)
         {
             auto its_tmp{std::make_shared<tcp_server_endpoint_impl>(
-                shared_from_this(), rm_->shared_from_this(), io_, configuration_)};
+                shared_from_this(), rm_->shared_from_this(), its_io, configuration_)};
             if (its_tmp)
             {
                 boost::asio::ip::tcp::endpoint its_reliable(its_unicast, _port);
@@ -295,7 +296,7 @@ std::shared_ptr<endpoint> endpoint_manager_impl::create_server_endpoint(uint16_t
         else
         {
             auto its_tmp{std::make_shared<udp_server_endpoint_impl>(
-                shared_from_this(), rm_->shared_from_this(), io_, configuration_)};
+                shared_from_this(), rm_->shared_from_this(), its_io, configuration_)};
             if (its_tmp)
             {
                 boost::asio::ip::udp::endpoint its_unreliable(its_unicast, _port);
@@ -366,6 +367,7 @@ endpoint_manager_impl::find_or_create_server_endpoint(uint16_t _port, bool _reli
         if (!_is_multicast)
         {
             service_instances_[_service][its_endpoint.get()] = _instance;
+            service_instances_index_.publish(nullptr);
         }
     }
     return its_endpoint;
@@ -431,6 +433,7 @@ void endpoint_manager_impl::clear_client_endpoints(service_t _service, instance_
                 if (found_reliability != found_instance->second.end())
                 {
                     service_instances_[_service].erase(found_reliability->second.get());
+                    service_instances_index_.publish(nullptr);
                     its_endpoint = found_reliability->second;
                     found_instance->second.erase(found_reliability);
                     if (found_instance->second.empty())
@@ -931,18 +934,41 @@ bool endpoint_manager_impl::create_routing_root(std::shared_ptr<endpoint>& _root
 
 instance_t endpoint_manager_impl::find_instance(service_t _service, endpoint* const _endpoint) const
 {
-    instance_t                            its_instance(0xFFFF);
-    std::lock_guard<std::recursive_mutex> its_lock(endpoint_mutex_);
-    auto                                  found_service = service_instances_.find(_service);
-    if (found_service != service_instances_.end())
+    const service_endpoint_t its_key{_service, _endpoint};
     {
-        auto found_endpoint = found_service->second.find(_endpoint);
-        if (found_endpoint != found_service->second.end())
+        epoch_snapshot<service_instances_index_t>::reader_t its_reader(service_instances_index_);
+        if (its_reader.get())
         {
-            its_instance = found_endpoint->second;
+            const auto its_instance = its_reader.get()->find(its_key);
+            return (its_instance ? *its_instance : 0xFFFF);
         }
     }
-    return its_instance;
+
+    std::lock_guard<std::recursive_mutex> its_lock(endpoint_mutex_);
+    const auto its_instance = get_service_instances_index_unlocked()->find(its_key);
+    return (its_instance ? *its_instance : 0xFFFF);
+}
+
+const endpoint_manager_impl::service_instances_index_t*
+endpoint_manager_impl::get_service_instances_index_unlocked() const
+{
+    auto its_index = service_instances_index_.get_published();
+    if (!its_index)
+    {
+        std::size_t its_count(0);
+        for (const auto& its_service : service_instances_)
+            its_count += its_service.second.size();
+
+        auto its_new_index = new service_instances_index_t(its_count);
+        for (const auto& its_service : service_instances_)
+            for (const auto& its_endpoint : its_service.second)
+                its_new_index->insert(service_endpoint_t{its_service.first, its_endpoint.first},
+                                      its_endpoint.second);
+
+        service_instances_index_.publish(its_new_index);
+        its_index = its_new_index;
+    }
+    return its_index;
 }
 
 instance_t
@@ -972,6 +998,7 @@ bool endpoint_manager_impl::remove_instance(service_t _service, endpoint* const
         {
             if (found_service->second.erase(_endpoint))
             {
+                service_instances_index_.publish(nullptr);
                 if (!found_service->second.size())
                 {
                     service_instances_.erase(found_service);
@@ -1262,6 +1289,7 @@ endpoint_manager_impl::find_remote_client(service_t _service, instance_t _instan
                                 // as well - needed for later cleanup
                                 remote_services_[_service][_instance][_reliable] = its_endpoint;
                                 service_instances_[_service][its_endpoint.get()] = _instance;
+                                service_instances_index_.publish(nullptr);
 
                                 // add endpoint to serviceinfo object
                                 auto found_service_info = rm_->find_service(_service, _instance);
@@ -1332,6 +1360,7 @@ std::shared_ptr<endpoint> endpoint_manager_impl::create_remote_client(service_t
 
                 service_instances_[_service][its_endpoint.get()] = _instance;
                 remote_services_[_service][_instance][_reliable] = its_endpoint;
+                service_instances_index_.publish(nullptr);
 
                 partition_id_t its_partition =
                     configuration_->get_partition_id(_service, _instance);
@@ -1354,6 +1383,14 @@ std::shared_ptr<endpoint> endpoint_manager_impl::create_remote_client(service_t
     return its_endpoint;
 }
 
+std::size_t endpoint_manager_impl::get_endpoint_hash(const boost::asio::ip::address& _address,
+                                                     uint16_t _port, bool _reliable)
+{
+    std::size_t its_hash(std::hash<std::string>()(_address.to_string()));
+    its_hash ^= (std::size_t(_port) << 1) | (_reliable ? 1 : 0);
+    return its_hash * 0x9E3779B97F4A7C15ULL >> 32;
+}
+
 std::shared_ptr<endpoint>
 endpoint_manager_impl::create_client_endpoint(const boost::asio::ip::address& _address,
                                               uint16_t _local_port, uint16_t _remote_port,
@@ -1361,6 +1398,7 @@ endpoint_manager_impl::create_client_endpoint(const boost::asio::ip::address& _a
 {
     std::shared_ptr<endpoint> its_endpoint;
     boost::asio::ip::address  its_unicast = configuration_->get_unicast_address();
+    auto& its_io = rm_->get_endpoint_io(get_endpoint_hash(_address, _remote_port, _reliable));
 
     try
     {
@@ -1369,7 +1407,7 @@ endpoint_manager_impl::create_client_endpoint(const boost::asio::ip::address& _a
             its_endpoint = std::make_shared<tcp_client_endpoint_impl>(
                 shared_from_this(), rm_->shared_from_this(),
                 boost::asio::ip::tcp::endpoint(its_unicast, _local_port),
-                boost::asio::ip::tcp::endpoint(_address, _remote_port), io_, configuration_);
+                boost::asio::ip::tcp::endpoint(_address, _remote_port), its_io, configuration_);
 
             if (configuration_->has_enabled_magic_cookies(_address.to_string(), _remote_port))
             {
@@ -1381,7 +1419,7 @@ endpoint_manager_impl::create_client_endpoint(const boost::asio::ip::address& _a
             its_endpoint = std::make_shared<udp_client_endpoint_impl>(
                 shared_from_this(), rm_->shared_from_this(),
                 boost::asio::ip::udp::endpoint(its_unicast, _local_port),
-                boost::asio::ip::udp::endpoint(_address, _remote_port), io_, configuration_);
+                boost::asio::ip::udp::endpoint(_address, _remote_port), its_io, configuration_);
         }
     } catch (...)
     {
@@ -1445,11 +1483,11 @@ void endpoint_manager_impl::log_client_states() const
         VSOMEIP_INFO << "ECQ: [" << its_log.str() << "]";
 }
 
-void endpoint_manager_impl::log_server_states() const
+std::vector<std::pair<std::pair<uint16_t, bool>, size_t>>
+endpoint_manager_impl::get_server_queue_sizes() const
 {
-    std::stringstream                                         its_log;
     server_endpoints_t                                        its_server_endpoints;
-    std::vector<std::pair<std::pair<uint16_t, bool>, size_t>> its_client_queue_sizes;
+    std::vector<std::pair<std::pair<uint16_t, bool>, size_t>> its_queue_sizes;
 
     {
         std::scoped_lock its_lock{endpoint_mutex_};
@@ -1460,12 +1498,24 @@ void endpoint_manager_impl::log_server_states() const
     {
         for (const auto& its_reliability : its_port.second)
         {
-            size_t its_queue_size = its_reliability.second->get_queue_size();
-            if (its_queue_size > VSOMEIP_DEFAULT_QUEUE_WARN_SIZE)
-                its_client_queue_sizes.push_back(std::make_pair(
-                    std::make_pair(its_port.first, its_reliability.first), its_queue_size));
+            its_queue_sizes.push_back(
+                std::make_pair(std::make_pair(its_port.first, its_reliability.first),
+                               its_reliability.second->get_queue_size()));
         }
     }
+    return its_queue_sizes;
+}
+
+void endpoint_manager_impl::log_server_states() const
+{
+    std::stringstream                                         its_log;
+    std::vector<std::pair<std::pair<uint16_t, bool>, size_t>> its_client_queue_sizes;
+
+    for (const auto& its_queue_size : get_server_queue_sizes())
+    {
+        if (its_queue_size.second > VSOMEIP_DEFAULT_QUEUE_WARN_SIZE)
+            its_client_queue_sizes.push_back(its_queue_size);
+    }
 
     std::sort(its_client_queue_sizes.begin(), its_client_queue_sizes.end(),
               [](const std::pair<std::pair<uint16_t, bool>, size_t>& _a,
@@ -0,0 +1,369 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
+#include <dirent.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define VSOMEIP_HAS_SHM
+#endif
+
+#include "../include/local_shm_segment.hpp"
+
+namespace vsomeip_v3 {
+
+namespace {
+
+const std::uint32_t SHM_MAGIC   = 0x76534d31; // "vSM1"
+const std::uint32_t SHM_VERSION = 1;
+
+const std::uint64_t REFERENCES_MASK = 0xFFFF;
+const unsigned      SEQUENCE_SHIFT  = 16;
+const std::uint64_t SEQUENCE_MASK   = 0xFFFFFFFFFFFF;
+
+#ifdef VSOMEIP_HAS_SHM
+#ifdef __QNX__
+const char* const SHM_DIRECTORY = "/dev/shmem";
+#else
+const char* const SHM_DIRECTORY = "/dev/shm";
+#endif
+
+std::size_t round_up(std::size_t _size)
+{
+    const auto its_page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    return (_size + its_page - 1) / its_page * its_page;
+}
+#endif
+
+} // namespace
+
+struct local_shm_segment::header {
+    std::uint32_t              magic_;
+    std::uint32_t              version_;
+    std::uint32_t              slot_count_;
+    std::uint32_t              slot_size_;
+    std::uint64_t              control_size_;
+    std::atomic<std::uint64_t> sequence_;
+};
+
+struct alignas(64) local_shm_segment::slot {
+    // sequence number << 16 | references
+    std::atomic<std::uint64_t> state_;
+    std::atomic<std::int64_t>  claimed_;
+    std::atomic<std::uint32_t> size_;
+};
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+              "shared memory slots need lock-free 64 bit atomics");
+
+std::shared_ptr<local_shm_segment>
+local_shm_segment::create(const std::string& _name, std::uint32_t _slot_count,
+                          std::uint32_t _slot_size, std::uint32_t _permissions,
+                          std::chrono::milliseconds _reclaim_time)
+{
+#ifdef VSOMEIP_HAS_SHM
+    if (_slot_count == 0 || _slot_size == 0)
+        return nullptr;
+
+    const std::size_t its_control_size =
+        round_up(sizeof(header) + alignof(slot) + std::size_t(_slot_count) * sizeof(slot));
+    const std::size_t its_data_size = round_up(std::size_t(_slot_count) * _slot_size);
+
+    // Replace the object of a previous instance (if existing)
+    shm_unlink(_name.c_str());
+    int its_descriptor = shm_open(_name.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC,
+                                  static_cast<mode_t>(_permissions));
+    if (its_descriptor < 0)
+        return nullptr;
+
+    void* its_map(MAP_FAILED);
+    if (fchmod(its_descriptor, static_cast<mode_t>(_permissions)) == 0
+        && ftruncate(its_descriptor, static_cast<off_t>(its_control_size + its_data_size)) == 0)
+    {
+        its_map = mmap(nullptr, its_control_size + its_data_size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED, its_descriptor, 0);
+    }
+    close(its_descriptor);
+    if (its_map == MAP_FAILED)
+    {
+        shm_unlink(_name.c_str());
+        return nullptr;
+    }
+
+    auto its_header           = new (its_map) header;
+    its_header->magic_        = SHM_MAGIC;
+    its_header->version_      = SHM_VERSION;
+    its_header->slot_count_   = _slot_count;
+    its_header->slot_size_    = _slot_size;
+    its_header->control_size_ = its_control_size;
+    its_header->sequence_.store(0, std::memory_order_relaxed);
+
+    std::shared_ptr<local_shm_segment> its_segment(new local_shm_segment(
+        _name, its_map, its_control_size, static_cast<byte_t*>(its_map) + its_control_size,
+        its_data_size, true, _reclaim_time));
+    for (std::uint32_t i = 0; i < _slot_count; ++i)
+    {
+        auto its_slot = new (its_segment->get_slot(i)) slot;
+        its_slot->state_.store(0, std::memory_order_relaxed);
+        its_slot->claimed_.store(0, std::memory_order_relaxed);
+        its_slot->size_.store(0, std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    return its_segment;
+#else
+    (void)_name;
+    (void)_slot_count;
+    (void)_slot_size;
+    (void)_permissions;
+    (void)_reclaim_time;
+    return nullptr;
+#endif
+}
+
+std::shared_ptr<local_shm_segment> local_shm_segment::open(const std::string& _name)
+{
+#ifdef VSOMEIP_HAS_SHM
+    int its_descriptor = shm_open(_name.c_str(), O_RDWR | O_CLOEXEC, 0);
+    if (its_descriptor < 0)
+        return nullptr;
+
+    std::shared_ptr<local_shm_segment> its_segment;
+    struct stat                        its_status;
+    if (fstat(its_descriptor, &its_status) == 0
+        && static_cast<std::size_t>(its_status.st_size) >= sizeof(header))
+    {
+        const auto its_size = static_cast<std::size_t>(its_status.st_size);
+
+        std::uint32_t its_magic(0), its_version(0), its_slot_count(0), its_slot_size(0);
+        std::size_t   its_control_size(0);
+        void* its_map = mmap(nullptr, sizeof(header), PROT_READ, MAP_SHARED, its_descriptor, 0);
+        if (its_map != MAP_FAILED)
+        {
+            auto its_header  = static_cast<const header*>(its_map);
+            its_magic        = its_header->magic_;
+            its_version      = its_header->version_;
+            its_slot_count   = its_header->slot_count_;
+            its_slot_size    = its_header->slot_size_;
+            its_control_size = static_cast<std::size_t>(its_header->control_size_);
+            munmap(its_map, sizeof(header));
+        }
+
+        const std::size_t its_data_size = round_up(std::size_t(its_slot_count) * its_slot_size);
+        if (its_magic == SHM_MAGIC && its_version == SHM_VERSION && its_control_size > 0
+            && its_control_size <= its_size
+            && its_data_size <= its_size - its_control_size)
+        {
+            // The slot states are shared, the data is read-only for receivers
+            void* its_control = mmap(nullptr, its_control_size, PROT_READ | PROT_WRITE,
+                                     MAP_SHARED, its_descriptor, 0);
+            void* its_data    = mmap(nullptr, its_data_size, PROT_READ, MAP_SHARED, its_descriptor,
+                                     static_cast<off_t>(its_control_size));
+            if (its_control != MAP_FAILED && its_data != MAP_FAILED)
+            {
+                its_segment.reset(new local_shm_segment(_name, its_control, its_control_size,
+                                                        its_data, its_data_size, false,
+                                                        std::chrono::milliseconds(0)));
+            }
+            else
+            {
+                if (its_control != MAP_FAILED)
+                    munmap(its_control, its_control_size);
+                if (its_data != MAP_FAILED)
+                    munmap(its_data, its_data_size);
+            }
+        }
+    }
+    close(its_descriptor);
+    return its_segment;
+#else
+    (void)_name;
+    return nullptr;
+#endif
+}
+
+std::size_t local_shm_segment::remove_stale(const std::string& _prefix)
+{
+    std::size_t its_count(0);
+#ifdef VSOMEIP_HAS_SHM
+    // The directory lists the objects without the leading slash
+    const auto        its_offset = static_cast<std::size_t>(!_prefix.empty() && _prefix[0] == '/');
+    const std::string its_prefix(_prefix.substr(its_offset));
+
+    DIR* its_directory = opendir(SHM_DIRECTORY);
+    if (!its_directory)
+        return its_count;
+
+    while (const struct dirent* its_entry = readdir(its_directory))
+    {
+        const std::string its_name(its_entry->d_name);
+        if (its_name.size() <= its_prefix.size()
+            || its_name.compare(0, its_prefix.size(), its_prefix) != 0
+            || its_name.find_first_not_of("0123456789", its_prefix.size()) != std::string::npos)
+            continue;
+
+        errno              = 0;
+        const auto its_pid = std::strtol(its_name.c_str() + its_prefix.size(), nullptr, 10);
+        if (errno != 0 || its_pid <= 0 || its_pid == getpid())
+            continue;
+
+        // Objects of running processes (or of processes of other users) are kept
+        if (kill(static_cast<pid_t>(its_pid), 0) != 0 && errno == ESRCH
+            && shm_unlink(("/" + its_name).c_str()) == 0)
+            its_count++;
+    }
+    closedir(its_directory);
+#else
+    (void)_prefix;
+#endif
+    return its_count;
+}
+
+local_shm_segment::local_shm_segment(const std::string& _name, void* _control,
+                                     std::size_t _control_size, void* _data,
+                                     std::size_t _data_size, bool _is_owner,
+                                     std::chrono::milliseconds _reclaim_time) :
+    name_(_name),
+    control_(_control), control_size_(_control_size), data_(_data), data_size_(_data_size),
+    is_owner_(_is_owner), reclaim_time_(std::chrono::nanoseconds(_reclaim_time).count()),
+    next_(0)
+{
+    auto its_header = static_cast<const header*>(control_);
+    slot_count_     = its_header->slot_count_;
+    slot_size_      = its_header->slot_size_;
+}
+
+local_shm_segment::~local_shm_segment()
+{
+#ifdef VSOMEIP_HAS_SHM
+    munmap(data_, data_size_);
+    munmap(control_, control_size_);
+    if (is_owner_)
+        shm_unlink(name_.c_str());
+#endif
+}
+
+bool local_shm_segment::write(const byte_t* _data, std::uint32_t _size,
+                              std::uint16_t _references, std::uint32_t& _slot,
+                              std::uint64_t& _sequence)
+{
+    if (!is_owner_ || _size > slot_size_ || _references == 0)
+        return false;
+
+    // Look for a free slot first, then for one that was not released in time
+    const std::uint32_t its_start = next_.load(std::memory_order_relaxed);
+    for (bool is_reclaim : {false, true})
+    {
+        for (std::uint32_t i = 0; i < slot_count_; ++i)
+        {
+            const std::uint32_t its_slot = (its_start + i) % slot_count_;
+            if (claim(its_slot, _references, is_reclaim, _sequence))
+            {
+                auto its_target = static_cast<byte_t*>(data_) + std::size_t(its_slot) * slot_size_;
+                std::memcpy(its_target, _data, _size);
+                get_slot(its_slot)->size_.store(_size, std::memory_order_release);
+
+                next_.store((its_slot + 1) % slot_count_, std::memory_order_relaxed);
+                _slot = its_slot;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool local_shm_segment::read(std::uint32_t _slot, std::uint64_t _sequence, std::uint32_t _size,
+                             byte_t* _target) const
+{
+    if (_slot >= slot_count_ || _size > slot_size_)
+        return false;
+
+    const slot*   its_slot  = get_slot(_slot);
+    std::uint64_t its_state = its_slot->state_.load(std::memory_order_acquire);
+    if ((its_state >> SEQUENCE_SHIFT) != _sequence || (its_state & REFERENCES_MASK) == 0
+        || its_slot->size_.load(std::memory_order_acquire) != _size)
+        return false;
+
+    std::memcpy(_target, static_cast<const byte_t*>(data_) + std::size_t(_slot) * slot_size_,
+                _size);
+
+    // The slot must not have been reclaimed while it was copied
+    std::atomic_thread_fence(std::memory_order_acquire);
+    its_state = its_slot->state_.load(std::memory_order_relaxed);
+    return ((its_state >> SEQUENCE_SHIFT) == _sequence);
+}
+
+void local_shm_segment::release(std::uint32_t _slot, std::uint64_t _sequence)
+{
+    if (_slot >= slot_count_)
+        return;
+
+    slot*         its_slot  = get_slot(_slot);
+    std::uint64_t its_state = its_slot->state_.load(std::memory_order_relaxed);
+    while ((its_state >> SEQUENCE_SHIFT) == _sequence && (its_state & REFERENCES_MASK) != 0)
+    {
+        if (its_slot->state_.compare_exchange_weak(its_state, its_state - 1,
+                                                   std::memory_order_release,
+                                                   std::memory_order_relaxed))
+            break;
+    }
+}
+
+std::uint32_t local_shm_segment::get_used() const
+{
+    std::uint32_t its_used(0);
+    for (std::uint32_t i = 0; i < slot_count_; ++i)
+    {
+        if (get_slot(i)->state_.load(std::memory_order_relaxed) & REFERENCES_MASK)
+            its_used++;
+    }
+    return its_used;
+}
+
+local_shm_segment::slot* local_shm_segment::get_slot(std::uint32_t _slot) const
+{
+    auto its_first = reinterpret_cast<std::uintptr_t>(control_) + sizeof(header);
+    its_first      = (its_first + alignof(slot) - 1) / alignof(slot) * alignof(slot);
+    return reinterpret_cast<slot*>(its_first) + _slot;
+}
+
+bool local_shm_segment::claim(std::uint32_t _slot, std::uint16_t _references, bool _is_reclaim,
+                              std::uint64_t& _sequence)
+{
+    slot*         its_slot  = get_slot(_slot);
+    std::uint64_t its_state = its_slot->state_.load(std::memory_order_acquire);
+    if (its_state & REFERENCES_MASK)
+    {
+        if (!_is_reclaim
+            || now() - its_slot->claimed_.load(std::memory_order_relaxed) < reclaim_time_)
+            return false;
+    }
+
+    auto                its_header = static_cast<header*>(control_);
+    const std::uint64_t its_sequence =
+        ((its_header->sequence_.fetch_add(1, std::memory_order_relaxed) + 1) & SEQUENCE_MASK);
+    if (!its_slot->state_.compare_exchange_strong(
+            its_state, (its_sequence << SEQUENCE_SHIFT) | _references, std::memory_order_acq_rel))
+        return false;
+
+    its_slot->claimed_.store(now(), std::memory_order_relaxed);
+    _sequence = its_sequence;
+    return true;
+}
+
+std::int64_t local_shm_segment::now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+} // namespace vsomeip_v3
@@ -0,0 +1,191 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <iomanip>
+#include <sstream>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#include <vsomeip/internal/logger.hpp>
+
+#include "../include/local_shm_segment.hpp"
+#include "../include/local_shm_transport.hpp"
+#include "../../configuration/include/configuration.hpp"
+#include "../../configuration/include/internal.hpp"
+#include "../../protocol/include/send_command.hpp"
+#include "../../protocol/include/shm_send_command.hpp"
+
+namespace vsomeip_v3 {
+
+local_shm_transport::local_shm_transport(const std::shared_ptr<configuration>& _configuration) :
+    configuration_(_configuration),
+    threshold_(_configuration->is_security_enabled() ? 0 : _configuration->get_shm_threshold()),
+    prefix_("/" + _configuration->get_network() + "-shm-"), has_failed_(false)
+{
+}
+
+local_shm_transport::~local_shm_transport() = default;
+
+message_buffer_ptr_t local_shm_transport::serialize(client_t _client, const byte_t* _data,
+                                                    uint32_t _size, instance_t _instance,
+                                                    bool _reliable, uint8_t _status_check,
+                                                    std::uint16_t _references)
+{
+    if (threshold_ == 0 || _size < threshold_ || _references == 0)
+        return nullptr;
+
+    auto its_segment = get_segment(_client);
+    if (!its_segment)
+        return nullptr;
+
+    protocol::shm_send_command its_command;
+    std::uint32_t              its_slot;
+    std::uint64_t              its_sequence;
+    if (!its_segment->write(_data, _size, _references, its_slot, its_sequence))
+        return nullptr;
+
+    its_command.set_client(_client);
+    its_command.set_instance(_instance);
+    its_command.set_reliable(_reliable);
+    its_command.set_status(_status_check);
+    its_command.set_target(_client);
+    its_command.set_slot(its_slot);
+    its_command.set_sequence(its_sequence);
+    its_command.set_length(_size);
+    its_command.set_name(its_segment->get_name());
+
+    auto              its_buffer = std::make_shared<message_buffer_t>();
+    protocol::error_e its_error;
+    its_command.serialize(*its_buffer, its_error);
+    if (its_error != protocol::error_e::ERROR_OK)
+    {
+        for (std::uint16_t i = 0; i < _references; ++i)
+            its_segment->release(its_slot, its_sequence);
+        return nullptr;
+    }
+    return its_buffer;
+}
+
+void local_shm_transport::release(const message_buffer_t& _command)
+{
+    protocol::shm_send_command its_command;
+    protocol::error_e          its_error;
+    its_command.deserialize(_command, its_error);
+    if (its_error != protocol::error_e::ERROR_OK)
+        return;
+
+    std::shared_ptr<local_shm_segment> its_segment;
+    {
+        std::lock_guard<std::mutex> its_lock(mutex_);
+        its_segment = segment_;
+    }
+    if (its_segment && its_segment->get_name() == its_command.get_name())
+        its_segment->release(its_command.get_slot(), its_command.get_sequence());
+}
+
+bool local_shm_transport::deserialize(const byte_t* _data, std::size_t _size,
+                                      std::vector<byte_t>& _command)
+{
+    protocol::shm_send_command its_command;
+    protocol::error_e          its_error;
+    its_command.deserialize(std::vector<byte_t>(_data, _data + _size), its_error);
+    if (its_error != protocol::error_e::ERROR_OK)
+        return false;
+
+    // Only accept shared memory if it is used locally and only map the
+    // segments of the same network
+    if (threshold_ == 0
+        || its_command.get_name().compare(0, prefix_.size(), prefix_) != 0)
+        return false;
+
+    protocol::send_command its_send_command(protocol::id_e::SEND_ID);
+    its_send_command.set_client(its_command.get_client());
+    its_send_command.set_instance(its_command.get_instance());
+    its_send_command.set_reliable(its_command.is_reliable());
+    its_send_command.set_status(its_command.get_status());
+    its_send_command.set_target(its_command.get_target());
+    // Reserve the space for the message only, it is copied from the slot
+    its_send_command.serialize(nullptr, its_command.get_length(), _command, its_error);
+    if (its_error != protocol::error_e::ERROR_OK)
+        return false;
+
+    auto its_segment = find_segment(its_command.get_client(), its_command.get_name());
+    if (!its_segment)
+        return false;
+
+    const bool is_read =
+        its_segment->read(its_command.get_slot(), its_command.get_sequence(),
+                          its_command.get_length(),
+                          &_command[_command.size() - its_command.get_length()]);
+    its_segment->release(its_command.get_slot(), its_command.get_sequence());
+    return is_read;
+}
+
+std::shared_ptr<local_shm_segment> local_shm_transport::get_segment(client_t _client)
+{
+    std::lock_guard<std::mutex> its_lock(mutex_);
+    if (!segment_ && !has_failed_)
+    {
+#ifndef _WIN32
+        std::stringstream its_name;
+        its_name << prefix_ << std::hex << std::setw(4) << std::setfill('0') << _client << "-";
+
+        // Objects of crashed predecessors are never unlinked otherwise
+        const auto its_stale = local_shm_segment::remove_stale(its_name.str());
+        if (its_stale > 0)
+        {
+            VSOMEIP_INFO << "local_shm_transport::" << __func__ << ": Removed " << its_stale
+                         << " stale shared memory object(s) " << its_name.str() << "*";
+        }
+
+        its_name << std::dec << getpid();
+        segment_ = local_shm_segment::create(
+            its_name.str(), configuration_->get_shm_slot_count(),
+            configuration_->get_shm_slot_size(), configuration_->get_permissions_uds(),
+            std::chrono::milliseconds(VSOMEIP_DEFAULT_SHM_RECLAIM_TIME));
+        if (!segment_)
+        {
+            VSOMEIP_WARNING << "local_shm_transport::" << __func__
+                            << ": Cannot create shared memory " << its_name.str()
+                            << ". Sending large messages via the local connections.";
+        }
+#else
+        (void)_client;
+#endif
+        has_failed_ = !segment_;
+    }
+    return segment_;
+}
+
+std::shared_ptr<local_shm_segment>
+local_shm_transport::find_segment(client_t _client, const std::string& _name)
+{
+    std::lock_guard<std::mutex> its_lock(mutex_);
+    auto                        found_segment = segments_.find(_client);
+    if (found_segment != segments_.end())
+    {
+        // The name changes if the sender was restarted
+        if (found_segment->second->get_name() == _name)
+            return found_segment->second;
+        segments_.erase(found_segment);
+    }
+
+    auto its_segment = local_shm_segment::open(_name);
+    if (its_segment)
+    {
+        segments_[_client] = its_segment;
+    }
+    else
+    {
+        VSOMEIP_WARNING << "local_shm_transport::" << __func__ << ": Cannot open shared memory "
+                        << _name << " of client 0x" << std::hex << std::setw(4)
+                        << std::setfill('0') << _client;
+    }
+    return its_segment;
+}
+
+} // namespace vsomeip_v3
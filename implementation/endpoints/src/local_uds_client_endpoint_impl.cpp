@@ -228,6 +228,28 @@ bool local_uds_client_endpoint_impl::send(const uint8_t* _data, uint32_t _size)
     return ret;
 }
 
+bool local_uds_client_endpoint_impl::send_shared(const message_buffer_ptr_t& _buffer)
+{
+    std::lock_guard<std::recursive_mutex> its_lock(mutex_);
+    const auto its_size = static_cast<std::uint32_t>(_buffer->size());
+    if (endpoint_impl::sending_blocked_
+        || check_message_size(nullptr, its_size) != cms_ret_e::MSG_OK
+        || !check_packetizer_space(its_size) || !check_queue_limit(_buffer->data(), its_size))
+    {
+        return false;
+    }
+
+    // Local trains never collect data (see send), thus the shared
+    // buffer can be queued as it is and the (empty) train buffer be
+    // reused afterwards.
+    auto its_empty_buffer = train_->buffer_;
+    train_->buffer_       = _buffer;
+    queue_train(train_);
+    train_->buffer_ = its_empty_buffer;
+
+    return true;
+}
+
 void local_uds_client_endpoint_impl::send_queued(std::pair<message_buffer_ptr_t, uint32_t>& _entry)
 {
     static const byte_t                    its_start_tag[] = {0x67, 0x37, 0x6D, 0x07};
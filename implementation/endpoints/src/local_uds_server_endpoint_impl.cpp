@@ -185,6 +185,35 @@ bool local_uds_server_endpoint_impl::send(const uint8_t* _data, uint32_t _size)
     return true;
 }
 
+bool local_uds_server_endpoint_impl::send_shared(const message_buffer_ptr_t& _buffer)
+{
+    std::lock_guard<std::mutex> its_lock(mutex_);
+    if (endpoint_impl::sending_blocked_
+        || _buffer->size() < protocol::COMMAND_HEADER_SIZE + sizeof(client_t))
+    {
+        return false;
+    }
+
+    client_t its_client;
+    std::memcpy(&its_client, &(*_buffer)[protocol::COMMAND_HEADER_SIZE], sizeof(its_client));
+
+    connection::ptr its_connection;
+    {
+        std::lock_guard<std::mutex> its_lock(connections_mutex_);
+        const auto                  its_iterator = connections_.find(its_client);
+        if (its_iterator == connections_.end())
+        {
+            return false;
+        }
+        its_connection = its_iterator->second;
+    }
+
+    // the connection keeps a reference until the buffer was written
+    its_connection->send_queued(_buffer);
+
+    return true;
+}
+
 bool local_uds_server_endpoint_impl::send_to(const std::shared_ptr<endpoint_definition> _target,
                                              const byte_t* _data, uint32_t _size)
 {
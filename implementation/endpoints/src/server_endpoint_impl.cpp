@@ -32,7 +32,9 @@ server_endpoint_impl<Protocol>::server_endpoint_impl(
     const std::shared_ptr<endpoint_host>& _endpoint_host,
     const std::shared_ptr<routing_host>& _routing_host, boost::asio::io_context& _io,
     const std::shared_ptr<configuration>& _configuration)
-    : endpoint_impl<Protocol>(_endpoint_host, _routing_host, _io, _configuration)
+    : endpoint_impl<Protocol>(_endpoint_host, _routing_host, _io, _configuration),
+      reply_routes_(VSOMEIP_REPLY_ROUTE_TABLE_SIZE,
+                    std::chrono::milliseconds(VSOMEIP_REPLY_ROUTE_MAX_AGE))
 {}
 
 template <typename Protocol>
@@ -199,38 +201,27 @@ bool server_endpoint_impl<Protocol>::send(const uint8_t* _data, uint32_t _size)
         const client_t  its_client  = bithelper::read_uint16_be(&_data[VSOMEIP_CLIENT_POS_MIN]);
         const session_t its_session = bithelper::read_uint16_be(&_data[VSOMEIP_SESSION_POS_MIN]);
 
-        clients_mutex_.lock();
-        auto found_client = clients_.find(its_client);
-        if (found_client != clients_.end())
+        const method_t  its_method  = bithelper::read_uint16_be(&_data[VSOMEIP_METHOD_POS_MIN]);
+
+        // Service Discovery messages never answer a request received here
+        if (its_service != VSOMEIP_SD_SERVICE || its_method != VSOMEIP_SD_METHOD)
+        {
+            is_valid_target = reply_routes_.take(its_client, its_session, its_target);
+        }
+        if (!is_valid_target)
         {
-            auto found_session = found_client->second.find(its_session);
-            if (found_session != found_client->second.end())
+            // Responses are only sent to the sender of the request
+            if (utility::is_response(_data[VSOMEIP_MESSAGE_TYPE_POS])
+                || utility::is_error(_data[VSOMEIP_MESSAGE_TYPE_POS]))
             {
-                its_target      = found_session->second;
-                is_valid_target = true;
-                found_client->second.erase(its_session);
+                VSOMEIP_WARNING << "server_endpoint::send: session_id 0x" << std::hex
+                                << its_session << " not found for client 0x" << its_client;
             }
             else
             {
-                VSOMEIP_WARNING << "server_endpoint::send: session_id 0x" << std::hex << its_session
-                                << " not found for client 0x" << its_client;
-                const method_t its_method =
-                    bithelper::read_uint16_be(&_data[VSOMEIP_METHOD_POS_MIN]);
-
-                if (its_service == VSOMEIP_SD_SERVICE && its_method == VSOMEIP_SD_METHOD)
-                {
-                    VSOMEIP_ERROR << "Clearing clients map as a request was "
-                                     "received on SD port";
-                    clients_.clear();
-                    is_valid_target = get_default_target(its_service, its_target);
-                }
+                is_valid_target = get_default_target(its_service, its_target);
             }
         }
-        else
-        {
-            is_valid_target = get_default_target(its_service, its_target);
-        }
-        clients_mutex_.unlock();
 
         if (is_valid_target)
         {
@@ -415,22 +406,17 @@ bool server_endpoint_impl<Protocol>::tp_segmentation_enabled(service_t /*_servic
 }
 
 template <typename Protocol>
-void server_endpoint_impl<Protocol>::send_segments(const tp::tp_split_messages_t& _segments,
-                                                   std::uint32_t                  _separation_time,
-                                                   const endpoint_type&           _target)
+void server_endpoint_impl<Protocol>::send_segments(const byte_t* _data, std::uint32_t _size,
+                                                   std::uint32_t        _separation_time,
+                                                   const endpoint_type& _target)
 {
-    if (_segments.size() == 0)
-        return;
-
     const auto its_target_iterator = find_or_create_target_unlocked(_target);
     auto&      its_data            = its_target_iterator->second;
 
     auto its_now(std::chrono::steady_clock::now());
 
-    const service_t its_service =
-        bithelper::read_uint16_be(&(*(_segments[0]))[VSOMEIP_SERVICE_POS_MIN]);
-    const method_t its_method =
-        bithelper::read_uint16_be(&(*(_segments[0]))[VSOMEIP_METHOD_POS_MIN]);
+    const service_t its_service = bithelper::read_uint16_be(&_data[VSOMEIP_SERVICE_POS_MIN]);
+    const method_t  its_method  = bithelper::read_uint16_be(&_data[VSOMEIP_METHOD_POS_MIN]);
 
     std::chrono::nanoseconds its_debouncing(0), its_retention(0);
     if (its_service != VSOMEIP_SD_SERVICE && its_method != VSOMEIP_SD_METHOD)
@@ -457,13 +443,12 @@ void server_endpoint_impl<Protocol>::send_segments(const tp::tp_split_messages_t
         its_data.train_->departure_ = its_now + its_retention;
     }
 
-    for (const auto& s : _segments)
-    {
-        its_data.queue_.emplace_back(s, _separation_time);
-        its_data.queue_size_ += s->size();
-    }
+    // The message is queued as a whole, its segments are created while sending
+    its_data.queue_.emplace_back(std::make_shared<message_buffer_t>(_data, _data + _size),
+                                 _separation_time);
+    its_data.queue_size_ += _size;
 
-    if (!its_data.is_sending_ && !its_data.queue_.empty())
+    if (!its_data.is_sending_)
     { // no writing in progress
         // ignore retention time and send immediately as the train is full anyway
         (void)send_queued(its_target_iterator);
@@ -484,6 +469,23 @@ server_endpoint_impl<Protocol>::find_or_create_target_unlocked(endpoint_type _ta
     return its_iterator;
 }
 
+template <typename Protocol>
+void server_endpoint_impl<Protocol>::add_reply_route(const byte_t*        _data,
+                                                     const endpoint_type& _remote)
+{
+    const byte_t its_type = _data[VSOMEIP_MESSAGE_TYPE_POS];
+    if (utility::is_request(its_type) && !utility::is_request_no_return(its_type))
+    {
+        const client_t its_client = bithelper::read_uint16_be(&_data[VSOMEIP_CLIENT_POS_MIN]);
+        if (its_client != MAGIC_COOKIE_CLIENT)
+        {
+            const session_t its_session =
+                bithelper::read_uint16_be(&_data[VSOMEIP_SESSION_POS_MIN]);
+            reply_routes_.insert(its_client, its_session, _remote);
+        }
+    }
+}
+
 template <typename Protocol>
 void server_endpoint_impl<Protocol>::schedule_train(endpoint_data_type& _data)
 {
@@ -506,28 +508,13 @@ typename endpoint_impl<Protocol>::cms_ret_e server_endpoint_impl<Protocol>::chec
     if (endpoint_impl<Protocol>::max_message_size_ != MESSAGE_SIZE_UNLIMITED
         && _size > endpoint_impl<Protocol>::max_message_size_)
     {
-        if (endpoint_impl<Protocol>::is_supporting_someip_tp_ && _data != nullptr)
+        std::uint16_t its_max_segment_length;
+        std::uint32_t its_separation_time;
+        if (_data != nullptr
+            && get_tp_configuration(_data, its_max_segment_length, its_separation_time))
         {
-            const service_t its_service =
-                bithelper::read_uint16_be(&_data[VSOMEIP_SERVICE_POS_MIN]);
-            const method_t its_method   = bithelper::read_uint16_be(&_data[VSOMEIP_METHOD_POS_MIN]);
-            instance_t     its_instance = this->get_instance(its_service);
-
-            if (its_instance != ANY_INSTANCE)
-            {
-                if (tp_segmentation_enabled(its_service, its_instance, its_method))
-                {
-                    std::uint16_t its_max_segment_length;
-                    std::uint32_t its_separation_time;
-
-                    this->configuration_->get_tp_configuration(
-                        its_service, its_instance, its_method, false, its_max_segment_length,
-                        its_separation_time);
-                    send_segments(tp::tp::tp_split_message(_data, _size, its_max_segment_length),
-                                  its_separation_time, _target);
-                    return endpoint_impl<Protocol>::cms_ret_e::MSG_WAS_SPLIT;
-                }
-            }
+            send_segments(_data, _size, its_separation_time, _target);
+            return endpoint_impl<Protocol>::cms_ret_e::MSG_WAS_SPLIT;
         }
         VSOMEIP_ERROR << "sei::send_intern: Dropping to big message (" << _size
                       << " Bytes). Maximum allowed message size is: "
@@ -537,6 +524,55 @@ typename endpoint_impl<Protocol>::cms_ret_e server_endpoint_impl<Protocol>::chec
     return ret;
 }
 
+template <typename Protocol>
+bool server_endpoint_impl<Protocol>::get_tp_configuration(const byte_t*  _data,
+                                                          std::uint16_t& _max_segment_length,
+                                                          std::uint32_t& _separation_time)
+{
+    if (!endpoint_impl<Protocol>::is_supporting_someip_tp_)
+        return false;
+
+    const service_t  its_service  = bithelper::read_uint16_be(&_data[VSOMEIP_SERVICE_POS_MIN]);
+    const method_t   its_method   = bithelper::read_uint16_be(&_data[VSOMEIP_METHOD_POS_MIN]);
+    const instance_t its_instance = this->get_instance(its_service);
+    if (its_instance == ANY_INSTANCE
+        || !tp_segmentation_enabled(its_service, its_instance, its_method))
+        return false;
+
+    this->configuration_->get_tp_configuration(its_service, its_instance, its_method, false,
+                                               _max_segment_length, _separation_time);
+    return true;
+}
+
+template <typename Protocol>
+tp::tp_segment* server_endpoint_impl<Protocol>::get_segment(endpoint_data_type& _data)
+{
+    const auto& its_buffer = _data.queue_.front().first;
+    if (!_data.segment_.is_segment_of(its_buffer) && !start_segment(its_buffer, _data.segment_))
+        return nullptr;
+
+    return &_data.segment_;
+}
+
+template <typename Protocol>
+bool server_endpoint_impl<Protocol>::start_segment(const message_buffer_ptr_t& _buffer,
+                                                   tp::tp_segment&             _segment)
+{
+    // Only SOME/IP-TP messages are queued if they exceed the maximum message size
+    if (endpoint_impl<Protocol>::max_message_size_ == MESSAGE_SIZE_UNLIMITED
+        || _buffer->size() <= endpoint_impl<Protocol>::max_message_size_)
+    {
+        return false;
+    }
+
+    // The configuration might have been removed meanwhile, use the default then
+    std::uint16_t its_max_segment_length(tp::tp::tp_max_segment_length_);
+    std::uint32_t its_separation_time;
+    (void)get_tp_configuration(_buffer->data(), its_max_segment_length, its_separation_time);
+    _segment.first(_buffer, its_max_segment_length);
+    return true;
+}
+
 template <typename Protocol>
 void server_endpoint_impl<Protocol>::recalculate_queue_size(endpoint_data_type& _data) const
 {
@@ -622,6 +658,20 @@ bool server_endpoint_impl<Protocol>::queue_train(target_data_iterator_type     _
     return must_erase;
 }
 
+template <typename Protocol>
+void server_endpoint_impl<Protocol>::pop_sent_unlocked(endpoint_data_type& _data)
+{
+    const std::size_t its_size = _data.queue_.front().first->size();
+    _data.queue_.pop_front();
+    _data.segment_.reset();
+    if (its_size <= _data.queue_size_)
+        _data.queue_size_ -= its_size;
+    else
+        recalculate_queue_size(_data);
+
+    update_last_departure(_data);
+}
+
 template <typename Protocol>
 bool server_endpoint_impl<Protocol>::flush(endpoint_type _key)
 {
@@ -810,6 +860,14 @@ void server_endpoint_impl<Protocol>::send_cbk(const endpoint_type              _
 
     if (!_error)
     {
+        // A SOME/IP-TP message is removed after its last segment was sent
+        if (its_data.segment_.is_segment_of(its_buffer) && its_data.segment_.next())
+        {
+            (void)send_queued(it);
+            return;
+        }
+        its_data.segment_.reset();
+
         const std::size_t payload_size = its_buffer->size();
         if (payload_size <= its_data.queue_size_)
         {
@@ -3,6 +3,8 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <iomanip>
 
@@ -15,6 +17,7 @@
 #include "../include/endpoint_host.hpp"
 #include "../../routing/include/routing_host.hpp"
 #include "../include/tcp_client_endpoint_impl.hpp"
+#include "../include/tcp_framing.hpp"
 #include "../../utility/include/utility.hpp"
 #include "../../utility/include/bithelper.hpp"
 
@@ -28,7 +31,7 @@ tcp_client_endpoint_impl::tcp_client_endpoint_impl(
     : tcp_client_endpoint_base_impl(_endpoint_host, _routing_host, _local, _remote, _io,
                                     _configuration),
       recv_buffer_size_initial_(VSOMEIP_SOMEIP_HEADER_SIZE),
-      recv_buffer_(std::make_shared<message_buffer_t>(recv_buffer_size_initial_, 0)),
+      recv_buffer_(std::make_shared<tcp_receive_buffer>(recv_buffer_size_initial_)),
       shrink_count_(0),
       buffer_shrink_threshold_(configuration_->get_buffer_shrink_threshold()),
       remote_address_(_remote.address()),
@@ -100,7 +103,7 @@ void tcp_client_endpoint_impl::restart(bool _force)
             address_port_local = self->get_address_port_local();
             self->shutdown_and_close_socket_unlocked(true);
             self->recv_buffer_ =
-                std::make_shared<message_buffer_t>(self->recv_buffer_size_initial_, 0);
+                std::make_shared<tcp_receive_buffer>(self->recv_buffer_size_initial_);
         }
         self->was_not_connected_ = true;
         self->reconnect_counter_ = 0;
@@ -289,7 +292,7 @@ void tcp_client_endpoint_impl::connect()
 
 void tcp_client_endpoint_impl::receive()
 {
-    message_buffer_ptr_t its_recv_buffer;
+    tcp_receive_buffer_ptr_t its_recv_buffer;
     {
         std::lock_guard<std::mutex> its_lock(socket_mutex_);
         its_recv_buffer = recv_buffer_;
@@ -300,14 +303,17 @@ void tcp_client_endpoint_impl::receive()
     });
 }
 
-void tcp_client_endpoint_impl::receive(message_buffer_ptr_t _recv_buffer,
+void tcp_client_endpoint_impl::receive(tcp_receive_buffer_ptr_t _recv_buffer,
                                        std::size_t _recv_buffer_size, std::size_t _missing_capacity)
 {
     std::lock_guard<std::mutex> its_lock(socket_mutex_);
     if (socket_->is_open())
     {
-        const std::size_t its_capacity(_recv_buffer->capacity());
-        size_t            buffer_size = its_capacity - _recv_buffer_size;
+        // Largest message that is accepted, plus the header of the next one
+        const std::size_t its_max_capacity =
+            (max_message_size_ == MESSAGE_SIZE_UNLIMITED ?
+                 MESSAGE_SIZE_UNLIMITED :
+                 std::size_t(max_message_size_) + VSOMEIP_SOMEIP_HEADER_SIZE);
         try
         {
             if (_missing_capacity)
@@ -317,28 +323,24 @@ void tcp_client_endpoint_impl::receive(message_buffer_ptr_t _recv_buffer,
                     VSOMEIP_ERROR << "Missing receive buffer capacity exceeds allowed maximum!";
                     return;
                 }
-                const std::size_t its_required_capacity(_recv_buffer_size + _missing_capacity);
-                if (its_capacity < its_required_capacity)
+                if (_recv_buffer->prepare(_recv_buffer_size, _missing_capacity, its_max_capacity)
+                    && _recv_buffer->capacity() > 1048576)
                 {
-                    _recv_buffer->reserve(its_required_capacity);
-                    _recv_buffer->resize(its_required_capacity, 0x0);
-                    if (_recv_buffer->size() > 1048576)
-                    {
-                        VSOMEIP_INFO << "tce: recv_buffer size is: " << _recv_buffer->size()
-                                     << " local: " << get_address_port_local()
-                                     << " remote: " << get_address_port_remote();
-                    }
+                    VSOMEIP_INFO << "tce: recv_buffer size is: " << _recv_buffer->capacity()
+                                 << " local: " << get_address_port_local()
+                                 << " remote: " << get_address_port_remote();
                 }
-                buffer_size = _missing_capacity;
             }
             else if (buffer_shrink_threshold_ && shrink_count_ > buffer_shrink_threshold_
                      && _recv_buffer_size == 0)
             {
-                _recv_buffer->resize(recv_buffer_size_initial_, 0x0);
-                _recv_buffer->shrink_to_fit();
-                buffer_size   = recv_buffer_size_initial_;
+                _recv_buffer->reset(recv_buffer_size_initial_);
                 shrink_count_ = 0;
             }
+            else
+            {
+                _recv_buffer->prepare(_recv_buffer_size, 1, its_max_capacity);
+            }
         } catch (const std::exception& e)
         {
             handle_recv_buffer_exception(e, _recv_buffer, _recv_buffer_size);
@@ -346,7 +348,8 @@ void tcp_client_endpoint_impl::receive(message_buffer_ptr_t _recv_buffer,
             return;
         }
         socket_->async_receive(
-            boost::asio::buffer(&(*_recv_buffer)[_recv_buffer_size], buffer_size),
+            boost::asio::buffer(_recv_buffer->get_free(_recv_buffer_size),
+                                _recv_buffer->get_free_size(_recv_buffer_size)),
             strand_.wrap(std::bind(
                 &tcp_client_endpoint_impl::receive_cbk,
                 std::dynamic_pointer_cast<tcp_client_endpoint_impl>(shared_from_this()),
@@ -546,7 +549,7 @@ bool tcp_client_endpoint_impl::is_reliable() const
     return true;
 }
 
-bool tcp_client_endpoint_impl::is_magic_cookie(const message_buffer_ptr_t& _recv_buffer,
+bool tcp_client_endpoint_impl::is_magic_cookie(const tcp_receive_buffer_ptr_t& _recv_buffer,
                                                size_t                      _offset) const
 {
     return (0 == std::memcmp(SERVICE_COOKIE, &(*_recv_buffer)[_offset], sizeof(SERVICE_COOKIE)));
@@ -569,7 +572,7 @@ void tcp_client_endpoint_impl::send_magic_cookie(message_buffer_ptr_t& _buffer)
 
 void tcp_client_endpoint_impl::receive_cbk(boost::system::error_code const& _error,
                                            std::size_t                      _bytes,
-                                           const message_buffer_ptr_t&      _recv_buffer,
+                                           const tcp_receive_buffer_ptr_t&  _recv_buffer,
                                            std::size_t                      _recv_buffer_size)
 {
     if (_error == boost::asio::error::operation_aborted)
@@ -603,6 +606,36 @@ void tcp_client_endpoint_impl::receive_cbk(boost::system::error_code const& _err
             bool   has_full_message(false);
             do
             {
+                // Complete messages with valid headers are forwarded in bursts,
+                // all others are handled one by one below.
+                std::array<std::uint32_t, tcp_framing::max_frames_> its_sizes;
+                const std::size_t its_frames = tcp_framing::scan(
+                    &(*_recv_buffer)[its_iteration_gap], _recv_buffer_size, SERVICE_COOKIE,
+                    has_enabled_magic_cookies_, its_sizes.data(), its_sizes.size());
+                if (its_frames)
+                {
+                    its_lock.unlock();
+                    std::size_t its_offset(its_iteration_gap);
+                    for (std::size_t f = 0; f < its_frames; ++f)
+                    {
+                        its_host->on_message(&(*_recv_buffer)[its_offset], its_sizes[f], this,
+                                             false, VSOMEIP_ROUTING_CLIENT, nullptr,
+                                             remote_address_, remote_port_);
+                        its_offset += its_sizes[f];
+                    }
+                    its_lock.lock();
+
+                    for (std::size_t f = 0; f < its_frames; ++f)
+                    {
+                        calculate_shrink_count(_recv_buffer, _recv_buffer_size);
+                        _recv_buffer_size -= its_sizes[f];
+                        its_iteration_gap += its_sizes[f];
+                    }
+                    its_missing_capacity = 0;
+                    if (!_recv_buffer_size)
+                        break;
+                }
+
                 uint64_t read_message_size = utility::get_message_size(
                     &(*_recv_buffer)[its_iteration_gap], _recv_buffer_size);
                 if (read_message_size > MESSAGE_SIZE_UNLIMITED)
@@ -624,8 +657,11 @@ void tcp_client_endpoint_impl::receive_cbk(boost::system::error_code const& _err
                     {
                         if (has_enabled_magic_cookies_)
                         {
+                            // Only cookies that start within the message matter
                             uint32_t its_offset = find_magic_cookie(
-                                &(*_recv_buffer)[its_iteration_gap], (uint32_t)_recv_buffer_size);
+                                &(*_recv_buffer)[its_iteration_gap],
+                                std::min(_recv_buffer_size, std::size_t(current_message_size)
+                                                                + sizeof(SERVICE_COOKIE)));
                             if (its_offset < current_message_size)
                             {
                                 VSOMEIP_ERROR << "Message includes Magic Cookie. Ignoring it.";
@@ -756,8 +792,7 @@ void tcp_client_endpoint_impl::receive_cbk(boost::system::error_code const& _err
                         && current_message_size > max_message_size_)
                     {
                         _recv_buffer_size = 0;
-                        _recv_buffer->resize(recv_buffer_size_initial_, 0x0);
-                        _recv_buffer->shrink_to_fit();
+                        _recv_buffer->reset(recv_buffer_size_initial_);
                         if (has_enabled_magic_cookies_)
                         {
                             VSOMEIP_ERROR
@@ -801,8 +836,7 @@ void tcp_client_endpoint_impl::receive_cbk(boost::system::error_code const& _err
                         // no need to check for magic cookie here again: has_full_message
                         // would have been set to true if there was one present in the data
                         _recv_buffer_size = 0;
-                        _recv_buffer->resize(recv_buffer_size_initial_, 0x0);
-                        _recv_buffer->shrink_to_fit();
+                        _recv_buffer->reset(recv_buffer_size_initial_);
                         its_missing_capacity = 0;
                         VSOMEIP_ERROR
                             << "tce::c<" << this
@@ -834,20 +868,8 @@ void tcp_client_endpoint_impl::receive_cbk(boost::system::error_code const& _err
                     }
                 }
             } while (has_full_message && _recv_buffer_size);
-            if (its_iteration_gap)
-            {
-                // Copy incomplete message to front for next receive_cbk iteration
-                for (size_t i = 0; i < _recv_buffer_size; ++i)
-                {
-                    (*_recv_buffer)[i] = (*_recv_buffer)[i + its_iteration_gap];
-                }
-                // Still more capacity needed after shifting everything to front?
-                if (its_missing_capacity
-                    && its_missing_capacity <= _recv_buffer->capacity() - _recv_buffer_size)
-                {
-                    its_missing_capacity = 0;
-                }
-            }
+            // Release the processed messages, the incomplete one stays in place
+            _recv_buffer->consume(its_iteration_gap, _recv_buffer_size);
             its_lock.unlock();
             auto self = std::dynamic_pointer_cast<tcp_client_endpoint_impl>(shared_from_this());
             strand_.dispatch([self, &_recv_buffer, _recv_buffer_size, its_missing_capacity]() {
@@ -893,7 +915,7 @@ void tcp_client_endpoint_impl::receive_cbk(boost::system::error_code const& _err
     }
 }
 
-void tcp_client_endpoint_impl::calculate_shrink_count(const message_buffer_ptr_t& _recv_buffer,
+void tcp_client_endpoint_impl::calculate_shrink_count(const tcp_receive_buffer_ptr_t& _recv_buffer,
                                                       std::size_t                 _recv_buffer_size)
 {
     if (buffer_shrink_threshold_)
@@ -950,7 +972,7 @@ std::string tcp_client_endpoint_impl::get_address_port_local() const
 }
 
 void tcp_client_endpoint_impl::handle_recv_buffer_exception(
-    const std::exception& _e, const message_buffer_ptr_t& _recv_buffer,
+    const std::exception& _e, const tcp_receive_buffer_ptr_t& _recv_buffer,
     std::size_t _recv_buffer_size)
 {
     std::stringstream its_message;
@@ -0,0 +1,141 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include <vsomeip/constants.hpp>
+#include <vsomeip/defines.hpp>
+
+#include "../include/tcp_framing.hpp"
+#include "../../utility/include/bithelper.hpp"
+#include "../../utility/include/utility.hpp"
+
+namespace vsomeip_v3 {
+
+namespace {
+const std::size_t cookie_size = sizeof(CLIENT_COOKIE);
+
+inline bool is_cookie(const byte_t* _data, const byte_t* _cookie)
+{
+    return (0 == std::memcmp(_data, _cookie, cookie_size));
+}
+} // namespace
+
+std::size_t tcp_framing::find_magic_cookie(const byte_t* _data, std::size_t _size,
+                                           const byte_t* _cookie)
+{
+    if (_size < cookie_size)
+        return _size;
+    const std::size_t its_last = _size - cookie_size;
+
+    // Candidates start with 0xFF 0xFF and the cookie identifier. The vector
+    // loops compare the three bytes at each position of a block at once and
+    // only check the candidates completely.
+    std::size_t i(0);
+#if defined(__AVX2__)
+    const __m256i its_ff_32 = _mm256_set1_epi8(static_cast<char>(0xFF));
+    const __m256i its_id_32 = _mm256_set1_epi8(static_cast<char>(_cookie[2]));
+    for (; i + 32 + 2 <= _size; i += 32)
+    {
+        const __m256i its_first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_data + i));
+        const __m256i its_second =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_data + i + 1));
+        const __m256i its_third =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_data + i + 2));
+        auto its_candidates = static_cast<std::uint32_t>(_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_and_si256(_mm256_cmpeq_epi8(its_first, its_ff_32),
+                                              _mm256_cmpeq_epi8(its_second, its_ff_32)),
+                             _mm256_cmpeq_epi8(its_third, its_id_32))));
+        while (its_candidates)
+        {
+            const std::size_t its_offset =
+                i + static_cast<std::size_t>(__builtin_ctz(its_candidates));
+            if (its_offset > its_last)
+                return _size;
+            if (is_cookie(_data + its_offset, _cookie))
+                return its_offset;
+            its_candidates &= its_candidates - 1;
+        }
+    }
+#endif
+#if defined(__SSE2__)
+    const __m128i its_ff = _mm_set1_epi8(static_cast<char>(0xFF));
+    const __m128i its_id = _mm_set1_epi8(static_cast<char>(_cookie[2]));
+    for (; i + 16 + 2 <= _size; i += 16)
+    {
+        const __m128i its_first  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_data + i));
+        const __m128i its_second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_data + i + 1));
+        const __m128i its_third  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_data + i + 2));
+        auto its_candidates = static_cast<std::uint32_t>(_mm_movemask_epi8(
+            _mm_and_si128(_mm_and_si128(_mm_cmpeq_epi8(its_first, its_ff),
+                                        _mm_cmpeq_epi8(its_second, its_ff)),
+                          _mm_cmpeq_epi8(its_third, its_id))));
+        while (its_candidates)
+        {
+            const std::size_t its_offset =
+                i + static_cast<std::size_t>(__builtin_ctz(its_candidates));
+            if (its_offset > its_last)
+                return _size;
+            if (is_cookie(_data + its_offset, _cookie))
+                return its_offset;
+            its_candidates &= its_candidates - 1;
+        }
+    }
+#endif
+    for (; i <= its_last; ++i)
+    {
+        if (_data[i] == 0xFF && is_cookie(_data + i, _cookie))
+            return i;
+    }
+    return _size;
+}
+
+std::size_t tcp_framing::scan(const byte_t* _data, std::size_t _size, const byte_t* _cookie,
+                              bool _has_cookies, std::uint32_t* _sizes, std::size_t _max)
+{
+    std::size_t its_count(0);
+    std::size_t its_offset(0);
+    while (its_count < _max && _size - its_offset >= VSOMEIP_FULL_HEADER_SIZE)
+    {
+        const byte_t*     its_message   = _data + its_offset;
+        const std::size_t its_remaining = _size - its_offset;
+
+        const std::uint64_t its_size = VSOMEIP_SOMEIP_HEADER_SIZE
+            + std::uint64_t(bithelper::read_uint32_be(&its_message[VSOMEIP_LENGTH_POS_MIN]));
+        if (its_size <= VSOMEIP_RETURN_CODE_POS || its_size > its_remaining)
+            break;
+
+        if (its_message[VSOMEIP_PROTOCOL_VERSION_POS] != VSOMEIP_PROTOCOL_VERSION
+            || !utility::is_valid_message_type(
+                static_cast<message_type_e>(its_message[VSOMEIP_MESSAGE_TYPE_POS]))
+            || !utility::is_valid_return_code(
+                static_cast<return_code_e>(its_message[VSOMEIP_RETURN_CODE_POS])))
+            break;
+
+        if (is_cookie(its_message, _cookie))
+            break;
+
+        if (_has_cookies)
+        {
+            // A cookie that starts within the message means the stream lost
+            // its synchronization.
+            const std::size_t its_scan_size = std::min(
+                its_remaining - 1, static_cast<std::size_t>(its_size) - 1 + cookie_size - 1);
+            if (find_magic_cookie(its_message + 1, its_scan_size, _cookie) < its_scan_size)
+                break;
+        }
+
+        _sizes[its_count++] = static_cast<std::uint32_t>(its_size);
+        its_offset += static_cast<std::size_t>(its_size);
+    }
+    return its_count;
+}
+
+} // namespace vsomeip_v3
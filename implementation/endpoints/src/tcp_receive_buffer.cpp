@@ -0,0 +1,59 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+#include <cstring>
+
+#include "../include/tcp_receive_buffer.hpp"
+
+namespace vsomeip_v3 {
+
+tcp_receive_buffer::tcp_receive_buffer(std::size_t _capacity)
+    : data_(new byte_t[_capacity]), capacity_(_capacity), begin_(0) { }
+
+bool tcp_receive_buffer::prepare(std::size_t _size, std::size_t _required,
+                                 std::size_t _max_capacity)
+{
+    if (get_free_size(_size) >= _required)
+        return false;
+
+    if (capacity_ - _size >= _required)
+    {
+        // Only the beginning of a message straddles the end of the storage
+        std::memmove(&data_[0], &data_[begin_], _size);
+        begin_ = 0;
+        return false;
+    }
+
+    // Grow at least by factor two to keep the number of copies of large
+    // messages, which are received in many parts, low. Doubling must not
+    // exceed the largest message the endpoint accepts, as the storage is
+    // kept until the shrink threshold is reached.
+    const std::size_t its_capacity =
+        std::max(_size + _required, std::min(capacity_ << 1, _max_capacity));
+    std::unique_ptr<byte_t[]> its_data(new byte_t[its_capacity]);
+    std::memcpy(&its_data[0], &data_[begin_], _size);
+    data_     = std::move(its_data);
+    capacity_ = its_capacity;
+    begin_    = 0;
+    return true;
+}
+
+void tcp_receive_buffer::consume(std::size_t _processed, std::size_t _size)
+{
+    begin_ = (_size ? begin_ + _processed : 0);
+}
+
+void tcp_receive_buffer::reset(std::size_t _capacity)
+{
+    if (capacity_ != _capacity)
+    {
+        data_.reset(new byte_t[_capacity]);
+        capacity_ = _capacity;
+    }
+    begin_ = 0;
+}
+
+} // namespace vsomeip_v3
@@ -4,6 +4,8 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
+#include <array>
 #include <iomanip>
 
 #include <boost/asio/write.hpp>
@@ -14,6 +16,7 @@
 #include "../include/endpoint_definition.hpp"
 #include "../include/endpoint_host.hpp"
 #include "../../routing/include/routing_host.hpp"
+#include "../include/tcp_framing.hpp"
 #include "../include/tcp_server_endpoint_impl.hpp"
 #include "../../utility/include/utility.hpp"
 #include "../../utility/include/bithelper.hpp"
@@ -366,7 +369,7 @@ tcp_server_endpoint_impl::connection::connection(
       server_(_server),
       max_message_size_(_max_message_size),
       recv_buffer_size_initial_(_recv_buffer_size_initial),
-      recv_buffer_(_recv_buffer_size_initial, 0),
+      recv_buffer_(_recv_buffer_size_initial),
       recv_buffer_size_(0),
       missing_capacity_(0),
       shrink_count_(0),
@@ -424,15 +427,18 @@ void tcp_server_endpoint_impl::connection::receive()
     std::lock_guard<std::mutex> its_lock(socket_mutex_);
     if (socket_.is_open())
     {
-        const std::size_t its_capacity(recv_buffer_.capacity());
-        if (recv_buffer_size_ > its_capacity)
+        if (recv_buffer_size_ > recv_buffer_.size())
         {
             VSOMEIP_ERROR << __func__ << "Received buffer size is greater than the buffer capacity!"
                           << " recv_buffer_size_: " << recv_buffer_size_
-                          << " its_capacity: " << its_capacity;
+                          << " its_capacity: " << recv_buffer_.capacity();
             return;
         }
-        size_t left_buffer_size = its_capacity - recv_buffer_size_;
+        // Largest message that is accepted, plus the header of the next one
+        const std::size_t its_max_capacity =
+            (max_message_size_ == MESSAGE_SIZE_UNLIMITED ?
+                 MESSAGE_SIZE_UNLIMITED :
+                 std::size_t(max_message_size_) + VSOMEIP_SOMEIP_HEADER_SIZE);
         try
         {
             if (missing_capacity_)
@@ -442,31 +448,24 @@ void tcp_server_endpoint_impl::connection::receive()
                     VSOMEIP_ERROR << "Missing receive buffer capacity exceeds allowed maximum!";
                     return;
                 }
-                const std::size_t its_required_capacity(recv_buffer_size_ + missing_capacity_);
-                if (its_capacity < its_required_capacity)
+                if (recv_buffer_.prepare(recv_buffer_size_, missing_capacity_, its_max_capacity)
+                    && recv_buffer_.capacity() > 1048576)
                 {
-                    // Make the resize to its_required_capacity
-                    recv_buffer_.reserve(its_required_capacity);
-                    recv_buffer_.resize(its_required_capacity, 0x0);
-                    if (recv_buffer_.size() > 1048576)
-                    {
-                        VSOMEIP_INFO << "tse: recv_buffer size is: " << recv_buffer_.size()
-                                     << " local: " << get_address_port_local()
-                                     << " remote: " << get_address_port_remote();
-                    }
+                    VSOMEIP_INFO << "tse: recv_buffer size is: " << recv_buffer_.capacity()
+                                 << " local: " << get_address_port_local()
+                                 << " remote: " << get_address_port_remote();
                 }
-                left_buffer_size  = missing_capacity_;
                 missing_capacity_ = 0;
             }
             else if (buffer_shrink_threshold_ && shrink_count_ > buffer_shrink_threshold_
                      && recv_buffer_size_ == 0)
             {
-                // In this case, make the resize to recv_buffer_size_initial_
-                recv_buffer_.resize(recv_buffer_size_initial_, 0x0);
-                recv_buffer_.shrink_to_fit();
-                // And set buffer_size to recv_buffer_size_initial_, the same of our resize
-                left_buffer_size = recv_buffer_size_initial_;
-                shrink_count_    = 0;
+                recv_buffer_.reset(recv_buffer_size_initial_);
+                shrink_count_ = 0;
+            }
+            else
+            {
+                recv_buffer_.prepare(recv_buffer_size_, 1, its_max_capacity);
             }
         } catch (const std::exception& e)
         {
@@ -475,7 +474,8 @@ void tcp_server_endpoint_impl::connection::receive()
             return;
         }
         socket_.async_receive(
-            boost::asio::buffer(&recv_buffer_[recv_buffer_size_], left_buffer_size),
+            boost::asio::buffer(recv_buffer_.get_free(recv_buffer_size_),
+                                recv_buffer_.get_free_size(recv_buffer_size_)),
             std::bind(&tcp_server_endpoint_impl::connection::receive_cbk, shared_from_this(),
                       std::placeholders::_1, std::placeholders::_2));
     }
@@ -618,6 +618,26 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
             bool   has_full_message;
             do
             {
+                // Complete messages with valid headers are forwarded in bursts,
+                // all others are handled one by one below.
+                std::array<std::uint32_t, tcp_framing::max_frames_> its_sizes;
+                const std::size_t its_frames = tcp_framing::scan(
+                    &recv_buffer_[its_iteration_gap], recv_buffer_size_, CLIENT_COOKIE,
+                    magic_cookies_enabled_, its_sizes.data(), its_sizes.size());
+                for (std::size_t f = 0; f < its_frames; ++f)
+                {
+                    its_server->add_reply_route(&recv_buffer_[its_iteration_gap], remote_);
+                    its_host->on_message(&recv_buffer_[its_iteration_gap], its_sizes[f],
+                                         its_server.get(), false, VSOMEIP_ROUTING_CLIENT, nullptr,
+                                         remote_address_, remote_port_);
+                    calculate_shrink_count();
+                    missing_capacity_ = 0;
+                    recv_buffer_size_ -= its_sizes[f];
+                    its_iteration_gap += its_sizes[f];
+                }
+                if (!recv_buffer_size_)
+                    break;
+
                 uint64_t read_message_size =
                     utility::get_message_size(&recv_buffer_[its_iteration_gap], recv_buffer_size_);
                 if (read_message_size > MESSAGE_SIZE_UNLIMITED)
@@ -639,8 +659,11 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
                     {
                         if (magic_cookies_enabled_)
                         {
+                            // Only cookies that start within the message matter
                             uint32_t its_offset = its_server->find_magic_cookie(
-                                &recv_buffer_[its_iteration_gap], recv_buffer_size_);
+                                &recv_buffer_[its_iteration_gap],
+                                std::min(recv_buffer_size_, std::size_t(current_message_size)
+                                                                + sizeof(CLIENT_COOKIE)));
                             if (its_offset < current_message_size)
                             {
                                 {
@@ -668,20 +691,7 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
                     }
                     if (needs_forwarding)
                     {
-                        if (utility::is_request(
-                                recv_buffer_[its_iteration_gap + VSOMEIP_MESSAGE_TYPE_POS]))
-                        {
-                            const client_t its_client = bithelper::read_uint16_be(
-                                &recv_buffer_[its_iteration_gap + VSOMEIP_CLIENT_POS_MIN]);
-                            if (its_client != MAGIC_COOKIE_CLIENT)
-                            {
-                                const session_t its_session = bithelper::read_uint16_be(
-                                    &recv_buffer_[its_iteration_gap + VSOMEIP_SESSION_POS_MIN]);
-                                its_server->clients_mutex_.lock();
-                                its_server->clients_[its_client][its_session] = remote_;
-                                its_server->clients_mutex_.unlock();
-                            }
-                        }
+                        its_server->add_reply_route(&recv_buffer_[its_iteration_gap], remote_);
                         if (!magic_cookies_enabled_)
                         {
                             its_host->on_message(&recv_buffer_[its_iteration_gap],
@@ -809,8 +819,7 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
                              && current_message_size > max_message_size_)
                     {
                         recv_buffer_size_ = 0;
-                        recv_buffer_.resize(recv_buffer_size_initial_, 0x0);
-                        recv_buffer_.shrink_to_fit();
+                        recv_buffer_.reset(recv_buffer_size_initial_);
                         if (magic_cookies_enabled_)
                         {
                             std::lock_guard<std::mutex> its_lock(socket_mutex_);
@@ -854,8 +863,7 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
                         // no need to check for magic cookie here again: has_full_message
                         // would have been set to true if there was one present in the data
                         recv_buffer_size_ = 0;
-                        recv_buffer_.resize(recv_buffer_size_initial_, 0x0);
-                        recv_buffer_.shrink_to_fit();
+                        recv_buffer_.reset(recv_buffer_size_initial_);
                         missing_capacity_ = 0;
                         std::lock_guard<std::mutex> its_lock(socket_mutex_);
                         VSOMEIP_ERROR << "Didn't find magic cookie in broken"
@@ -883,20 +891,8 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
                     }
                 }
             } while (has_full_message && recv_buffer_size_);
-            if (its_iteration_gap)
-            {
-                // Copy incomplete message to front for next receive_cbk iteration
-                for (size_t i = 0; i < recv_buffer_size_; ++i)
-                {
-                    recv_buffer_[i] = recv_buffer_[i + its_iteration_gap];
-                }
-                // Still more capacity needed after shifting everything to front?
-                if (missing_capacity_
-                    && missing_capacity_ <= recv_buffer_.capacity() - recv_buffer_size_)
-                {
-                    missing_capacity_ = 0;
-                }
-            }
+            // Release the processed messages, the incomplete one stays in place
+            recv_buffer_.consume(its_iteration_gap, recv_buffer_size_);
             receive();
         }
     }
@@ -1089,6 +1085,13 @@ void tcp_server_endpoint_impl::print_status()
 
     VSOMEIP_INFO << "status tse: " << std::dec << local_port_ << " connections: " << std::dec
                  << its_connections.size() << " targets: " << std::dec << targets_.size();
+
+    const auto its_routes = reply_routes_.get_statistics();
+    VSOMEIP_INFO << "status tse: " << std::dec << local_port_
+                 << " reply routes: " << reply_routes_.capacity()
+                 << " inserted: " << its_routes.inserts_ << " used: " << its_routes.hits_
+                 << " missed: " << its_routes.misses_ << " evicted: " << its_routes.evictions_
+                 << " expired: " << its_routes.expirations_;
     for (const auto& c : its_connections)
     {
         std::size_t its_data_size(0);
@@ -3,6 +3,8 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <cstring>
+
 #include <vsomeip/primitive_types.hpp>
 #include <vsomeip/defines.hpp>
 #include <vsomeip/internal/logger.hpp>
@@ -76,4 +78,67 @@ tp_split_messages_t tp::tp_split_message(const std::uint8_t* const _data, std::u
 
 const std::uint16_t tp::tp_max_segment_length_;
 
+tp_segment::tp_segment() : header_(), offset_(0), length_(0), max_segment_length_(0), is_last_(true)
+{
+}
+
+void tp_segment::first(const message_buffer_ptr_t& _message, std::uint16_t _max_segment_length)
+{
+    message_ = _message;
+    offset_  = 0;
+    max_segment_length_ =
+        (_max_segment_length > 0 ? _max_segment_length : tp::tp_max_segment_length_);
+
+    // copy the header and change the message type
+    std::memcpy(header_.data(), message_->data(), VSOMEIP_FULL_HEADER_SIZE);
+    header_[VSOMEIP_MESSAGE_TYPE_POS] =
+        static_cast<byte_t>(header_[VSOMEIP_MESSAGE_TYPE_POS] | TP_FLAG);
+
+    update();
+}
+
+bool tp_segment::next()
+{
+    if (!message_ || is_last_)
+        return false;
+
+    offset_ += length_;
+    update();
+    return true;
+}
+
+void tp_segment::reset()
+{
+    message_.reset();
+    offset_  = 0;
+    length_  = 0;
+    is_last_ = true;
+}
+
+const byte_t* tp_segment::get_payload() const
+{
+    return &(*message_)[VSOMEIP_FULL_HEADER_SIZE + offset_];
+}
+
+void tp_segment::update()
+{
+    const auto its_payload_size =
+        static_cast<std::uint32_t>(message_->size() - VSOMEIP_FULL_HEADER_SIZE);
+
+    length_  = its_payload_size - offset_;
+    is_last_ = (length_ <= max_segment_length_);
+    if (!is_last_)
+        length_ = max_segment_length_;
+
+    // update length
+    const length_t its_length =
+        htonl(static_cast<length_t>(VSOMEIP_TP_PAYLOAD_POS - VSOMEIP_SOMEIP_HEADER_SIZE + length_));
+    std::memcpy(&header_[VSOMEIP_LENGTH_POS_MIN], &its_length, sizeof(its_length));
+
+    // update tp_header
+    const tp_header_t its_tp_header =
+        htonl(offset_ | static_cast<tp_header_t>(is_last_ ? 0x0u : 0x1u));
+    std::memcpy(&header_[VSOMEIP_TP_HEADER_POS_MIN], &its_tp_header, sizeof(its_tp_header));
+}
+
 }} // namespace vsomeip_v3::tp
@@ -3,6 +3,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <array>
 #include <iomanip>
 #include <sstream>
 #include <thread>
@@ -37,6 +38,16 @@ udp_client_endpoint_impl::udp_client_endpoint_impl(
     this->max_message_size_ = VSOMEIP_MAX_UDP_MESSAGE_SIZE;
     this->queue_limit_ =
         _configuration->get_endpoint_queue_limit(_remote.address().to_string(), _remote.port());
+
+#if defined(__linux__)
+    const auto its_transmit_batch_size = _configuration->get_udp_transmit_batch_size();
+    if (its_transmit_batch_size > 1)
+    {
+        transmit_batch_ = std::make_unique<udp_send_batch>(
+            its_transmit_batch_size, _configuration->is_udp_transmit_gso_enabled());
+        segments_.reserve(its_transmit_batch_size);
+    }
+#endif
 }
 
 udp_client_endpoint_impl::~udp_client_endpoint_impl()
@@ -239,6 +250,10 @@ void udp_client_endpoint_impl::send_queued(std::pair<message_buffer_ptr_t, uint3
         msg << std::hex << std::setw(2) << std::setfill('0')
             << (int)(*_entry.first)[i] << " ";
     VSOMEIP_INFO << msg.str();
+#endif
+#if defined(__linux__)
+    if (transmit_batch_ && _entry.second == 0 && send_queued_batched())
+        return;
 #endif
     {
         std::lock_guard<std::mutex> its_last_sent_lock(last_sent_mutex_);
@@ -262,6 +277,25 @@ void udp_client_endpoint_impl::send_queued(std::pair<message_buffer_ptr_t, uint3
         {
             last_sent_ = std::chrono::steady_clock::time_point();
         }
+
+        tp::tp_segment* its_segment(nullptr);
+        {
+            std::lock_guard<std::recursive_mutex> its_lock(mutex_);
+            its_segment = get_segment(_entry.first);
+        }
+        if (its_segment)
+        {
+            // The message is kept alive by the queue until its last segment was sent
+            const std::array<boost::asio::const_buffer, 2> its_buffers{
+                boost::asio::buffer(its_segment->get_header(), its_segment->get_header_size()),
+                boost::asio::buffer(its_segment->get_payload(), its_segment->get_payload_size())};
+            socket_->async_send(its_buffers,
+                                std::bind(&udp_client_endpoint_base_impl::send_cbk,
+                                          shared_from_this(), std::placeholders::_1,
+                                          std::placeholders::_2, _entry.first));
+            return;
+        }
+
         // Send
         socket_->async_send(boost::asio::buffer(*_entry.first),
                             std::bind(&udp_client_endpoint_base_impl::send_cbk, shared_from_this(),
@@ -269,6 +303,103 @@ void udp_client_endpoint_impl::send_queued(std::pair<message_buffer_ptr_t, uint3
     }
 }
 
+#if defined(__linux__)
+//
+// Sends the entries at the front of the queue that have no separation time
+// with a single sendmmsg call. Returns false if nothing could be sent. In
+// this case, the caller falls back to the asynchronous send.
+//
+bool udp_client_endpoint_impl::send_queued_batched()
+{
+    std::lock_guard<std::recursive_mutex> its_lock(mutex_);
+
+    std::size_t its_sent(0);
+    {
+        std::lock_guard<std::mutex> its_last_sent_lock(last_sent_mutex_);
+        std::lock_guard<std::mutex> its_socket_lock(socket_mutex_);
+        if (!socket_->is_open())
+            return false;
+
+        last_sent_ = std::chrono::steady_clock::time_point();
+
+        transmit_batch_->clear();
+        segments_.clear();
+        for (const auto& its_entry : queue_)
+        {
+            if (its_entry.second > 0 || transmit_batch_->is_full())
+                break;
+
+            // SOME/IP-TP messages are added segment by segment, the
+            // segment is empty for other entries.
+            const auto&    its_buffer = its_entry.first;
+            tp::tp_segment its_segment;
+            if (segments_.empty())
+            {
+                const auto its_front_segment = get_segment(its_buffer);
+                if (its_front_segment)
+                    its_segment = *its_front_segment;
+            }
+            else
+            {
+                (void)start_segment(its_buffer, its_segment);
+            }
+
+            if (!its_segment.is_segment_of(its_buffer))
+            {
+                const bool is_segment = (its_buffer->size() > VSOMEIP_MESSAGE_TYPE_POS
+                                         && tp::tp::tp_flag_is_set(
+                                             (*its_buffer)[VSOMEIP_MESSAGE_TYPE_POS]));
+                transmit_batch_->add(nullptr, its_buffer, is_segment);
+                segments_.emplace_back();
+                continue;
+            }
+
+            do
+            {
+                transmit_batch_->add(nullptr, its_segment);
+                segments_.push_back(its_segment);
+            } while (!transmit_batch_->is_full() && its_segment.next());
+
+            // The remaining segments are sent with the next batch
+            if (!its_segment.is_last())
+                break;
+        }
+
+        boost::system::error_code its_error;
+        its_sent = transmit_batch_->send(socket_->native_handle(), its_error);
+        if (transmit_batch_->has_gso_failed())
+        {
+            VSOMEIP_WARNING << "ucei::" << __func__ << ": UDP_SEGMENT not supported ("
+                            << its_error.message() << "). Disabling GSO for "
+                            << get_address_port_remote();
+        }
+    }
+
+    if (its_sent == 0)
+        return false;
+
+    // All but the last sent entry are removed here, the last one is
+    // removed by send_cbk which also continues sending.
+    for (std::size_t i = 0; i + 1 < its_sent; ++i)
+    {
+        if (segments_[i].get_message() && !segments_[i].is_last())
+            continue;
+
+        queue_size_ -= queue_.front().first->size();
+        queue_.pop_front();
+        update_last_departure();
+    }
+    // send_cbk continues with the segment that follows
+    segment_ = segments_[its_sent - 1];
+    segments_.clear();
+
+    const auto its_last = queue_.front().first;
+    strand_.post(std::bind(&udp_client_endpoint_base_impl::send_cbk, shared_from_this(),
+                           boost::system::error_code(), its_last->size(), its_last));
+    return true;
+}
+#endif
+
 void udp_client_endpoint_impl::get_configured_times_from_endpoint(
     service_t _service, method_t _method, std::chrono::nanoseconds* _debouncing,
     std::chrono::nanoseconds* _maximum_retention) const
@@ -576,6 +707,15 @@ void udp_client_endpoint_impl::send_cbk(boost::system::error_code const& _error,
         std::lock_guard<std::recursive_mutex> its_lock(mutex_);
         if (queue_.size() > 0)
         {
+            // A SOME/IP-TP message is removed after its last segment was sent
+            if (segment_.is_segment_of(queue_.front().first) && segment_.next())
+            {
+                auto its_entry = get_front();
+                send_queued(its_entry);
+                return;
+            }
+            segment_.reset();
+
             queue_size_ -= queue_.front().first->size();
             queue_.pop_front();
 
@@ -3,6 +3,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <array>
 #include <iomanip>
 #include <sstream>
 #include <thread>
@@ -44,6 +45,8 @@ udp_server_endpoint_impl::udp_server_endpoint_impl(
           _configuration->get_max_message_size_unreliable(), _io)),
       tp_cleanup_timer_(_io),
       is_stopped_(true),
+      receive_batch_size_(1),
+      is_transmit_scheduled_(false),
       on_unicast_sent_{nullptr},
       receive_own_multicast_messages_(false),
       on_sent_multicast_received_{nullptr}
@@ -154,6 +157,19 @@ void udp_server_endpoint_impl::init(const endpoint_type& _local, boost::system::
     this->max_message_size_ = VSOMEIP_MAX_UDP_MESSAGE_SIZE;
     this->queue_limit_      = configuration_->get_endpoint_queue_limit(
         configuration_->get_unicast_address().to_string(), local_port_);
+
+    receive_batch_size_ = configuration_->get_udp_receive_batch_size(
+        configuration_->get_unicast_address().to_string(), local_port_);
+#if defined(__linux__)
+    if (receive_batch_size_ > 1 && !unicast_batch_)
+        unicast_batch_ =
+            std::make_shared<udp_receive_batch>(receive_batch_size_, max_message_size_);
+
+    const auto its_transmit_batch_size = configuration_->get_udp_transmit_batch_size();
+    if (its_transmit_batch_size > 1 && !transmit_batch_)
+        transmit_batch_ = std::make_unique<udp_send_batch>(
+            its_transmit_batch_size, configuration_->is_udp_transmit_gso_enabled());
+#endif
 }
 
 void udp_server_endpoint_impl::start()
@@ -230,6 +246,13 @@ void udp_server_endpoint_impl::receive()
 
 void udp_server_endpoint_impl::receive_unicast()
 {
+#if defined(__linux__)
+    if (unicast_batch_)
+    {
+        receive_unicast_batch();
+        return;
+    }
+#endif
     std::lock_guard<std::mutex> its_lock(unicast_mutex_);
 
     if (unicast_socket_->is_open())
@@ -249,6 +272,20 @@ void udp_server_endpoint_impl::receive_multicast(uint8_t _multicast_id)
 {
     if (_multicast_id == multicast_id_ && multicast_socket_ && multicast_socket_->is_open())
     {
+#if defined(__linux__)
+        if (multicast_batch_)
+        {
+            auto its_storage = std::make_shared<udp_endpoint_receive_op::batch_storage>(
+                multicast_mutex_, multicast_socket_,
+                std::bind(&udp_server_endpoint_impl::on_multicast_batch_received,
+                          std::dynamic_pointer_cast<udp_server_endpoint_impl>(shared_from_this()),
+                          std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
+                multicast_batch_, _multicast_id);
+            multicast_socket_->async_wait(socket_type::wait_read,
+                                          udp_endpoint_receive_op::receive_batch_cb(its_storage));
+            return;
+        }
+#endif
         auto its_storage = std::make_shared<udp_endpoint_receive_op::storage>(
             multicast_mutex_, multicast_socket_, multicast_remote_,
             std::bind(&udp_server_endpoint_impl::on_multicast_received,
@@ -295,7 +332,198 @@ bool udp_server_endpoint_impl::send_error(const std::shared_ptr<endpoint_definit
     return ret;
 }
 
+//
+// send_queued is called with mutex_ being hold
+//
 bool udp_server_endpoint_impl::send_queued(const target_data_iterator_type _it)
+{
+#if defined(__linux__)
+    // Entries without separation time are collected and sent together with
+    // the entries of all other targets that are ready at the time of sending.
+    if (transmit_batch_ && _it->second.queue_.front().second == 0)
+    {
+        _it->second.is_sending_ = true;
+        transmit_targets_.push_back(_it->first);
+        if (!is_transmit_scheduled_)
+        {
+            is_transmit_scheduled_ = true;
+            io_.post(std::bind(&udp_server_endpoint_impl::send_queued_batched,
+                               std::dynamic_pointer_cast<udp_server_endpoint_impl>(
+                                   shared_from_this())));
+        }
+        return false;
+    }
+#endif
+    return send_queued_unbatched(_it);
+}
+
+#if defined(__linux__)
+void udp_server_endpoint_impl::send_queued_batched()
+{
+    std::lock_guard<std::mutex> its_transmit_lock(transmit_mutex_);
+
+    // Collect the ready entries per target. The order of the entries of
+    // a target is kept, as each target is added at most once and only
+    // entries from the front of its queue are taken. SOME/IP-TP messages
+    // are added segment by segment, the segment is empty for other entries.
+    typedef std::pair<message_buffer_ptr_t, tp::tp_segment> datagram_type;
+    std::vector<std::pair<endpoint_type, std::vector<datagram_type>>> its_entries;
+    {
+        std::lock_guard<std::mutex> its_lock(mutex_);
+        is_transmit_scheduled_ = false;
+
+        std::vector<endpoint_type> its_targets;
+        its_targets.swap(transmit_targets_);
+
+        transmit_batch_->clear();
+        for (const auto& its_target : its_targets)
+        {
+            auto its_iterator = targets_.find(its_target);
+            if (its_iterator == targets_.end() || transmit_batch_->is_full())
+            {
+                if (its_iterator != targets_.end())
+                    transmit_targets_.push_back(its_target);
+                continue;
+            }
+
+            auto&                      its_data = its_iterator->second;
+            std::vector<datagram_type> its_datagrams;
+            for (const auto& its_entry : its_data.queue_)
+            {
+                if (its_entry.second > 0 || transmit_batch_->is_full())
+                    break;
+
+                const auto&    its_buffer = its_entry.first;
+                tp::tp_segment its_segment;
+                if (its_datagrams.empty())
+                {
+                    const auto its_front_segment = get_segment(its_data);
+                    if (its_front_segment)
+                        its_segment = *its_front_segment;
+                }
+                else
+                {
+                    (void)start_segment(its_buffer, its_segment);
+                }
+
+                if (!its_segment.is_segment_of(its_buffer))
+                {
+                    const bool is_segment = (its_buffer->size() > VSOMEIP_MESSAGE_TYPE_POS
+                                             && tp::tp::tp_flag_is_set(
+                                                 (*its_buffer)[VSOMEIP_MESSAGE_TYPE_POS]));
+                    transmit_batch_->add(&its_iterator->first, its_buffer, is_segment);
+                    its_datagrams.emplace_back(its_buffer, tp::tp_segment());
+                    continue;
+                }
+
+                do
+                {
+                    transmit_batch_->add(&its_iterator->first, its_segment);
+                    its_datagrams.emplace_back(its_buffer, its_segment);
+                } while (!transmit_batch_->is_full() && its_segment.next());
+
+                // The remaining segments are sent with the next batch
+                if (!its_segment.is_last())
+                    break;
+            }
+            its_entries.emplace_back(its_target, std::move(its_datagrams));
+        }
+
+        // Targets that did not fit into this batch are sent with the next one
+        if (!transmit_targets_.empty())
+        {
+            is_transmit_scheduled_ = true;
+            io_.post(std::bind(&udp_server_endpoint_impl::send_queued_batched,
+                               std::dynamic_pointer_cast<udp_server_endpoint_impl>(
+                                   shared_from_this())));
+        }
+    }
+
+    boost::system::error_code its_error;
+    std::size_t               its_sent(0);
+    {
+        std::lock_guard<std::mutex> its_last_sent_lock(last_sent_mutex_);
+        std::lock_guard<std::mutex> its_unicast_lock(unicast_mutex_);
+        last_sent_ = std::chrono::steady_clock::time_point();
+        if (unicast_socket_->is_open())
+            its_sent = transmit_batch_->send(unicast_socket_->native_handle(), its_error);
+        else
+            its_error = boost::asio::error::bad_descriptor;
+    }
+
+    if (transmit_batch_->has_gso_failed())
+    {
+        VSOMEIP_WARNING << "usei::" << __func__ << ": UDP_SEGMENT not supported ("
+                        << its_error.message() << "). Disabling GSO for "
+                        << get_address_port_local();
+    }
+
+    // Remove the sent entries (except the last one per target which is
+    // completed by send_cbk) and restart sending for the remaining ones.
+    // The sent segments of SOME/IP-TP messages are not reported by
+    // on_unicast_sent_, thus their buffer is empty here.
+    std::vector<std::pair<endpoint_type, message_buffer_ptr_t>> its_completed;
+    {
+        std::lock_guard<std::mutex> its_lock(mutex_);
+
+        std::size_t its_index(0);
+        for (const auto& its_entry : its_entries)
+        {
+            const auto& its_datagrams = its_entry.second;
+            const std::size_t its_count =
+                (its_sent > its_index ? std::min(its_sent - its_index, its_datagrams.size()) : 0);
+            its_index += its_datagrams.size();
+
+            auto its_iterator = targets_.find(its_entry.first);
+            if (its_iterator == targets_.end())
+                continue;
+
+            for (std::size_t i = 0; i < its_count; ++i)
+            {
+                const auto& its_segment = its_datagrams[i].second;
+                const bool  is_segment  = its_segment.is_segment_of(its_datagrams[i].first);
+                if (i + 1 < its_count)
+                {
+                    if (is_segment && !its_segment.is_last())
+                        continue;
+                    pop_sent_unlocked(its_iterator->second);
+                }
+                else
+                {
+                    // send_cbk continues with the segment that follows
+                    its_iterator->second.segment_ = its_segment;
+                }
+                its_completed.emplace_back(its_entry.first,
+                                           is_segment ? nullptr : its_datagrams[i].first);
+            }
+
+            if (its_count == 0 && !its_iterator->second.queue_.empty())
+            {
+                if (transmit_batch_->has_gso_failed())
+                    (void)send_queued(its_iterator);
+                else
+                    (void)send_queued_unbatched(its_iterator);
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < its_completed.size(); ++i)
+    {
+        const auto& its_target = its_completed[i].first;
+        const auto& its_buffer = its_completed[i].second;
+        if (its_buffer && on_unicast_sent_ && !its_target.address().is_multicast())
+        {
+            on_unicast_sent_(its_buffer->data(), static_cast<uint32_t>(its_buffer->size()),
+                             its_target.address());
+        }
+        // The last sent entry of a target
+        if (i + 1 == its_completed.size() || its_completed[i + 1].first != its_target)
+            send_cbk(its_target, boost::system::error_code(), its_buffer ? its_buffer->size() : 0);
+    }
+}
+#endif
+
+bool udp_server_endpoint_impl::send_queued_unbatched(const target_data_iterator_type _it)
 {
     std::lock_guard<std::mutex> its_last_sent_lock(last_sent_mutex_);
     std::lock_guard<std::mutex> its_unicast_lock(unicast_mutex_);
@@ -331,6 +559,22 @@ bool udp_server_endpoint_impl::send_queued(const target_data_iterator_type _it)
     }
 
     _it->second.is_sending_ = true;
+    const auto its_segment  = get_segment(_it->second);
+    if (its_segment)
+    {
+        // The payload is referenced within the message, which is held by the
+        // handler in case the queue entry is dropped while the send is pending
+        const std::array<boost::asio::const_buffer, 2> its_buffers{
+            boost::asio::buffer(its_segment->get_header(), its_segment->get_header_size()),
+            boost::asio::buffer(its_segment->get_payload(), its_segment->get_payload_size())};
+        const message_buffer_ptr_t its_buffer = its_entry.first;
+        unicast_socket_->async_send_to(
+            its_buffers, _it->first,
+            [this, _it, its_buffer](boost::system::error_code const& _error, std::size_t _bytes) {
+                send_cbk(_it->first, _error, _bytes);
+            });
+        return false;
+    }
     unicast_socket_->async_send_to(
         boost::asio::buffer(*its_entry.first), _it->first,
         [this, _it, its_entry](boost::system::error_code const& _error, std::size_t _bytes) {
@@ -510,7 +754,7 @@ void udp_server_endpoint_impl::on_unicast_received(boost::system::error_code con
             // & multicast messages are not processed in parallel. This aligns
             // the behavior of endpoints with one and two active sockets.
             std::lock_guard<std::recursive_mutex> its_lock(multicast_mutex_);
-            on_message_received(_error, _bytes, false, unicast_remote_, unicast_recv_buffer_);
+            on_message_received(_error, _bytes, false, unicast_remote_, &unicast_recv_buffer_[0]);
         }
         receive_unicast();
     }
@@ -528,32 +772,115 @@ void udp_server_endpoint_impl::on_multicast_received(boost::system::error_code c
     }
     else if (_error != boost::asio::error::operation_aborted)
     {
-        if (multicast_remote_.address() != local_.address())
+        on_multicast_message_received(_error, _bytes, multicast_remote_, _destination,
+                                      &multicast_recv_buffer_[0]);
+        receive_multicast(_multicast_id);
+    }
+}
+
+#if defined(__linux__)
+void udp_server_endpoint_impl::receive_unicast_batch()
+{
+    std::lock_guard<std::mutex> its_lock(unicast_mutex_);
+
+    if (unicast_socket_->is_open())
+    {
+        unicast_socket_->async_wait(
+            socket_type::wait_read,
+            std::bind(&udp_server_endpoint_impl::on_unicast_batch_received,
+                      std::dynamic_pointer_cast<udp_server_endpoint_impl>(shared_from_this()),
+                      std::placeholders::_1));
+    }
+}
+
+void udp_server_endpoint_impl::on_unicast_batch_received(boost::system::error_code const& _error)
+{
+    if (is_stopped_ || _error == boost::asio::error::eof
+        || _error == boost::asio::error::connection_reset)
+    {
+        shutdown_and_close();
+    }
+    else if (_error != boost::asio::error::operation_aborted)
+    {
+        boost::system::error_code its_error(_error);
+        std::size_t               its_count(0);
+        if (!its_error)
         {
-            if (is_same_subnet(multicast_remote_.address()))
-            {
-                auto find_joined = joined_.find(_destination.to_string());
-                if (find_joined != joined_.end())
-                    find_joined->second = true;
+            std::lock_guard<std::mutex> its_lock(unicast_mutex_);
+            if (unicast_socket_->is_open())
+                its_count = unicast_batch_->receive(unicast_socket_->native_handle(), its_error);
+        }
 
-                on_message_received(_error, _bytes, true, multicast_remote_,
-                                    multicast_recv_buffer_);
+        if (its_count > 0)
+        {
+            // See on_unicast_received
+            std::lock_guard<std::recursive_mutex> its_lock(multicast_mutex_);
+            for (std::size_t i = 0; i < its_count; ++i)
+            {
+                on_message_received(its_error, unicast_batch_->bytes(i), false,
+                                    unicast_batch_->sender(i), unicast_batch_->data(i));
             }
         }
-        else if (receive_own_multicast_messages_ && on_sent_multicast_received_)
+        receive_unicast();
+    }
+}
+
+//
+// on_multicast_batch_received is called with multicast_mutex_ being hold
+//
+void udp_server_endpoint_impl::on_multicast_batch_received(boost::system::error_code const& _error,
+                                                           std::size_t _count,
+                                                           uint8_t     _multicast_id)
+{
+    if (is_stopped_ || _error == boost::asio::error::eof
+        || _error == boost::asio::error::connection_reset)
+    {
+        shutdown_and_close();
+    }
+    else if (_error != boost::asio::error::operation_aborted)
+    {
+        for (std::size_t i = 0; i < _count; ++i)
         {
-            on_sent_multicast_received_(&multicast_recv_buffer_[0], static_cast<uint32_t>(_bytes),
-                                        boost::asio::ip::address());
+            multicast_remote_ = multicast_batch_->sender(i);
+            on_multicast_message_received(_error, multicast_batch_->bytes(i), multicast_remote_,
+                                          multicast_batch_->destination(i),
+                                          multicast_batch_->data(i));
         }
-
+        multicast_remote_ = endpoint_type();
         receive_multicast(_multicast_id);
     }
 }
+#endif
+
+//
+// on_multicast_message_received is called with multicast_mutex_ being hold
+//
+void udp_server_endpoint_impl::on_multicast_message_received(
+    boost::system::error_code const& _error, std::size_t _bytes, endpoint_type const& _remote,
+    const boost::asio::ip::address& _destination, const byte_t* _buffer)
+{
+    if (_remote.address() != local_.address())
+    {
+        if (is_same_subnet(_remote.address()))
+        {
+            auto find_joined = joined_.find(_destination.to_string());
+            if (find_joined != joined_.end())
+                find_joined->second = true;
+
+            on_message_received(_error, _bytes, true, _remote, _buffer);
+        }
+    }
+    else if (receive_own_multicast_messages_ && on_sent_multicast_received_)
+    {
+        on_sent_multicast_received_(_buffer, static_cast<uint32_t>(_bytes),
+                                    boost::asio::ip::address());
+    }
+}
 
 void udp_server_endpoint_impl::on_message_received(boost::system::error_code const& _error,
                                                    std::size_t _bytes, bool _is_multicast,
-                                                   endpoint_type const&    _remote,
-                                                   message_buffer_t const& _buffer)
+                                                   endpoint_type const& _remote,
+                                                   const byte_t*        _buffer)
 {
 #if 0
     std::stringstream msg;
@@ -649,19 +976,7 @@ void udp_server_endpoint_impl::on_message_received(boost::system::error_code con
                     const service_t its_service =
                         bithelper::read_uint16_be(&_buffer[i + VSOMEIP_SERVICE_POS_MIN]);
 
-                    if (utility::is_request(_buffer[i + VSOMEIP_MESSAGE_TYPE_POS]))
-                    {
-                        const client_t its_client =
-                            bithelper::read_uint16_be(&_buffer[i + VSOMEIP_CLIENT_POS_MIN]);
-                        if (its_client != MAGIC_COOKIE_CLIENT)
-                        {
-                            const session_t its_session =
-                                bithelper::read_uint16_be(&_buffer[i + VSOMEIP_SESSION_POS_MIN]);
-                            clients_mutex_.lock();
-                            clients_[its_client][its_session] = _remote;
-                            clients_mutex_.unlock();
-                        }
-                    }
+                    add_reply_route(&_buffer[i], _remote);
                     if (tp::tp::tp_flag_is_set(_buffer[i + VSOMEIP_MESSAGE_TYPE_POS]))
                     {
                         const method_t its_method =
@@ -686,18 +1001,7 @@ void udp_server_endpoint_impl::on_message_received(boost::system::error_code con
                             &_buffer[i], current_message_size, its_remote_address, its_remote_port);
                         if (res.first)
                         {
-                            if (utility::is_request(res.second[VSOMEIP_MESSAGE_TYPE_POS]))
-                            {
-                                const client_t its_client =
-                                    bithelper::read_uint16_be(&res.second[VSOMEIP_CLIENT_POS_MIN]);
-                                if (its_client != MAGIC_COOKIE_CLIENT)
-                                {
-                                    const session_t its_session = bithelper::read_uint16_be(
-                                        &res.second[VSOMEIP_SESSION_POS_MIN]);
-                                    std::lock_guard<std::mutex> its_client_lock(clients_mutex_);
-                                    clients_[its_client][its_session] = _remote;
-                                }
-                            }
+                            add_reply_route(&res.second[0], _remote);
                             its_host->on_message(&res.second[0],
                                                  static_cast<std::uint32_t>(res.second.size()),
                                                  this, _is_multicast, VSOMEIP_ROUTING_CLIENT,
@@ -791,6 +1095,13 @@ void udp_server_endpoint_impl::print_status()
                  << unicast_recv_buffer_.capacity() << " multicast_recv_buffer: " << std::dec
                  << multicast_recv_buffer_.capacity();
 
+    const auto its_routes = reply_routes_.get_statistics();
+    VSOMEIP_INFO << "status use: " << std::dec << local_port_
+                 << " reply routes: " << reply_routes_.capacity()
+                 << " inserted: " << its_routes.inserts_ << " used: " << its_routes.hits_
+                 << " missed: " << its_routes.misses_ << " evicted: " << its_routes.evictions_
+                 << " expired: " << its_routes.expirations_;
+
     for (const auto& c : targets_)
     {
         std::size_t its_data_size(0);
@@ -896,6 +1207,11 @@ void udp_server_endpoint_impl::set_multicast_option(const boost::asio::ip::addre
 #endif
         if (multicast_recv_buffer_.empty())
             multicast_recv_buffer_.resize(VSOMEIP_MAX_UDP_MESSAGE_SIZE, 0);
+#if defined(__linux__)
+        if (receive_batch_size_ > 1 && !multicast_batch_)
+            multicast_batch_ = std::make_shared<udp_receive_batch>(receive_batch_size_,
+                                                                   VSOMEIP_MAX_UDP_MESSAGE_SIZE);
+#endif
 
         if (!multicast_local_)
         {
@@ -65,6 +65,12 @@ bool virtual_server_endpoint_impl::send(const byte_t* _data, uint32_t _size)
     return false;
 }
 
+bool virtual_server_endpoint_impl::send_shared(const message_buffer_ptr_t& _buffer)
+{
+    (void)_buffer;
+    return false;
+}
+
 bool virtual_server_endpoint_impl::send_to(const std::shared_ptr<endpoint_definition> _target,
                                            const byte_t* _data, uint32_t _size)
 {
@@ -6,9 +6,17 @@
 #ifndef VSOMEIP_V3_LOGGER_CONFIGURATION_HPP_
 #define VSOMEIP_V3_LOGGER_CONFIGURATION_HPP_
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
 #include <memory>
 #include <mutex>
-#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
 
 #ifdef USE_DLT
 #ifndef ANDROID
@@ -18,6 +26,8 @@
 
 #include <vsomeip/internal/logger.hpp>
 
+#include "../../utility/include/mpmc_queue.hpp"
+
 namespace vsomeip_v3 {
 
 class configuration;
@@ -37,8 +47,24 @@ public:
     bool has_console_log() const;
     bool has_dlt_log() const;
     bool has_file_log() const;
+    bool has_async_log() const;
     std::string get_logfile() const;
 
+    // Returns false if the message must be dropped because its call site
+    // (the code address that logged it) exceeded the configured rate.
+    // _suppressed is set to the number of messages that were dropped before
+    // this one.
+    bool check_rate(const void* _site, std::uint32_t& _suppressed);
+
+    // Hands a message over to the background writer. Returns false if
+    // asynchronous logging is not active.
+    bool enqueue(level_e _level, std::chrono::system_clock::time_point _when,
+                 std::string&& _text);
+
+    // Writes a message to the console and/or the log file.
+    void write(level_e _level, std::chrono::system_clock::time_point _when,
+               const std::string& _text);
+
     const std::string& get_app_name() const;
     std::unique_lock<std::mutex> get_app_name_lock() const;
 
@@ -51,6 +77,39 @@ private:
 #endif
 
 private:
+    struct entry_t {
+        std::chrono::system_clock::time_point when_;
+        level_e level_;
+        std::string text_;
+    };
+
+    // Log messages of a single thread. Only the owning thread writes and
+    // only the writer thread reads, therefore no lock is needed.
+    struct buffer_t {
+        explicit buffer_t(std::size_t _size) : entries_(_size), dropped_(0) {}
+
+        mpmc_queue<entry_t> entries_;
+        std::atomic<std::uint64_t> dropped_;
+    };
+
+    struct site_t {
+        std::atomic<std::uintptr_t> key_ {0};
+        std::atomic<std::uint32_t> second_ {0};
+        std::atomic<std::uint32_t> count_ {0};
+        std::atomic<std::uint32_t> suppressed_ {0};
+    };
+
+    static constexpr std::size_t sites_count_ = 2048;
+
+    site_t* get_site(const void* _site);
+    const std::shared_ptr<buffer_t>& get_buffer();
+    bool has_pending_entries();
+    void start_writer();
+    void stop_writer();
+    void write_loop();
+    void write_unlocked(level_e _level, std::chrono::system_clock::time_point _when,
+                        const std::string& _text, bool _flush);
+
     static std::mutex mutex__;
     static std::string app_name__;
 
@@ -60,6 +119,27 @@ private:
     std::atomic_bool cfg_dlt_enabled {false};
     std::atomic_bool cfg_file_enabled {false};
     std::string cfg_file_name {""};
+    std::atomic_bool cfg_async_enabled {false};
+    std::atomic<std::uint32_t> cfg_async_buffer_size {0};
+    std::atomic<std::uint32_t> cfg_rate_limit {0};
+
+    // Serializes console and file output; the log file is kept open
+    std::mutex output_mutex_;
+    std::ofstream logfile_;
+    std::string logfile_name_;
+
+    // Asynchronous logging
+    std::mutex buffers_mutex_;
+    std::vector<std::shared_ptr<buffer_t>> buffers_;
+    std::thread writer_;
+    std::mutex writer_mutex_;
+    std::condition_variable writer_condition_;
+    std::atomic_bool is_writer_running_ {false};
+    std::atomic_bool is_writer_waiting_ {false};
+
+    // Rate limiting per call site
+    std::array<site_t, sites_count_> sites_;
+    site_t overflow_site_;
 
 #ifdef USE_DLT
 #ifndef ANDROID
@@ -3,8 +3,15 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
+#include <ctime>
+#include <iomanip>
 #include <iostream>
 
+#if defined(__linux__) || defined(ANDROID)
+#include <pthread.h>
+#endif
+
 #include <vsomeip/runtime.hpp>
 
 #include "../include/logger_impl.hpp"
@@ -39,6 +46,8 @@ void logger_impl::init(const std::shared_ptr<configuration>& _configuration)
 
 logger_impl::~logger_impl()
 {
+    stop_writer();
+
 #ifdef USE_DLT
 #ifndef ANDROID
     DLT_UNREGISTER_CONTEXT(dlt_);
@@ -66,6 +75,11 @@ bool logger_impl::has_file_log() const
     return cfg_file_enabled;
 }
 
+bool logger_impl::has_async_log() const
+{
+    return cfg_async_enabled;
+}
+
 std::string logger_impl::get_logfile() const
 {
     std::scoped_lock its_lock{configuration_mutex_};
@@ -93,6 +107,303 @@ void logger_impl::set_configuration(const std::shared_ptr<configuration>& _confi
         cfg_dlt_enabled     = _configuration->has_dlt_log();
         cfg_file_enabled    = _configuration->has_file_log();
         cfg_file_name       = _configuration->get_logfile();
+
+        cfg_async_buffer_size = _configuration->get_async_log_buffer_size();
+        cfg_rate_limit        = _configuration->get_log_rate_limit();
+        cfg_async_enabled     = _configuration->has_async_log();
+        if (cfg_async_enabled)
+            start_writer();
+    }
+}
+
+logger_impl::site_t* logger_impl::get_site(const void* _site)
+{
+    // Open addressing, a slot keeps its call site once it was claimed
+    const auto its_key  = reinterpret_cast<std::uintptr_t>(_site);
+    auto       its_hash = static_cast<std::uint64_t>(its_key);
+    its_hash ^= its_hash >> 33;
+    its_hash *= 0xff51afd7ed558ccdULL;
+    its_hash ^= its_hash >> 33;
+
+    for (std::size_t i = 0; i < sites_count_; ++i)
+    {
+        auto&          its_site = sites_[(its_hash + i) & (sites_count_ - 1)];
+        std::uintptr_t its_current(its_site.key_.load(std::memory_order_acquire));
+        if (its_current == 0
+            && its_site.key_.compare_exchange_strong(its_current, its_key,
+                                                     std::memory_order_acq_rel))
+            return &its_site;
+        if (its_current == its_key)
+            return &its_site;
+    }
+    return nullptr;
+}
+
+bool logger_impl::check_rate(const void* _site, std::uint32_t& _suppressed)
+{
+    _suppressed                   = 0;
+    const std::uint32_t its_limit = cfg_rate_limit;
+    if (its_limit == 0 || !_site)
+        return true;
+
+    // If all slots are taken, the remaining call sites share one budget
+    site_t*    its_site = get_site(_site);
+    auto&      its_rate = (its_site ? *its_site : overflow_site_);
+    const auto its_now  = static_cast<std::uint32_t>(
+        std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+
+    // The first message of a new second resets the counter and reports
+    // the messages that were suppressed before.
+    auto its_second = its_rate.second_.load(std::memory_order_relaxed);
+    if (its_second != its_now && its_rate.second_.compare_exchange_strong(its_second, its_now))
+    {
+        its_rate.count_ = 0;
+        _suppressed     = its_rate.suppressed_.exchange(0);
+    }
+
+    if (its_rate.count_.fetch_add(1, std::memory_order_relaxed) < its_limit)
+        return true;
+
+    its_rate.suppressed_++;
+    return false;
+}
+
+bool logger_impl::enqueue(level_e _level, std::chrono::system_clock::time_point _when,
+                          std::string&& _text)
+{
+    if (!cfg_async_enabled || !is_writer_running_)
+        return false;
+
+    auto& its_buffer = get_buffer();
+    if (!its_buffer->entries_.push(entry_t{_when, _level, std::move(_text)}))
+    {
+        // Keep the memory bounded; the writer reports the number of drops
+        its_buffer->dropped_++;
+        return true;
+    }
+
+    // Pairs with the fence in write_loop: either the writer sees the entry
+    // or we see the waiting writer.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (is_writer_waiting_)
+    {
+        std::scoped_lock its_lock{writer_mutex_};
+        writer_condition_.notify_one();
+    }
+    return true;
+}
+
+void logger_impl::write(level_e _level, std::chrono::system_clock::time_point _when,
+                        const std::string& _text)
+{
+    std::scoped_lock its_lock{output_mutex_};
+    write_unlocked(_level, _when, _text, true);
+}
+
+void logger_impl::write_unlocked(level_e _level, std::chrono::system_clock::time_point _when,
+                                 const std::string& _text, bool _flush)
+{
+    // Prepare log level
+    const char* its_level;
+    switch (_level)
+    {
+    case level_e::LL_FATAL:
+        its_level = "fatal";
+        break;
+    case level_e::LL_ERROR:
+        its_level = "error";
+        break;
+    case level_e::LL_WARNING:
+        its_level = "warning";
+        break;
+    case level_e::LL_INFO:
+        its_level = "info";
+        break;
+    case level_e::LL_DEBUG:
+        its_level = "debug";
+        break;
+    case level_e::LL_VERBOSE:
+        its_level = "verbose";
+        break;
+    default:
+        its_level = "none";
+    };
+
+    // Prepare time stamp
+    auto      its_time_t = std::chrono::system_clock::to_time_t(_when);
+    struct tm its_time;
+#ifdef _WIN32
+    localtime_s(&its_time, &its_time_t);
+#else
+    localtime_r(&its_time_t, &its_time);
+#endif
+    auto its_ms = (_when.time_since_epoch().count() / 100) % 1000000;
+
+#ifndef ANDROID
+    if (cfg_console_enabled)
+    {
+        std::unique_lock<std::mutex> app_name_lock = get_app_name_lock();
+        std::cout << std::dec << std::setw(4) << its_time.tm_year + 1900 << "-" << std::dec
+                  << std::setw(2) << std::setfill('0') << its_time.tm_mon + 1 << "-" << std::dec
+                  << std::setw(2) << std::setfill('0') << its_time.tm_mday << " " << std::dec
+                  << std::setw(2) << std::setfill('0') << its_time.tm_hour << ":" << std::dec
+                  << std::setw(2) << std::setfill('0') << its_time.tm_min << ":" << std::dec
+                  << std::setw(2) << std::setfill('0') << its_time.tm_sec << "." << std::dec
+                  << std::setw(6) << std::setfill('0') << its_ms << " " << get_app_name() << " ["
+                  << its_level << "] " << _text << '\n';
+        if (_flush)
+            std::cout.flush();
+    }
+#endif
+
+    if (cfg_file_enabled)
+    {
+        const std::string its_name = get_logfile();
+        if (!logfile_.is_open() || logfile_name_ != its_name)
+        {
+            if (logfile_.is_open())
+                logfile_.close();
+            logfile_.clear();
+            logfile_.open(its_name, std::ios_base::app);
+            logfile_name_ = its_name;
+        }
+        if (logfile_.is_open())
+        {
+            logfile_ << std::dec << std::setw(4) << its_time.tm_year + 1900 << "-" << std::dec
+                     << std::setw(2) << std::setfill('0') << its_time.tm_mon + 1 << "-"
+                     << std::dec << std::setw(2) << std::setfill('0') << its_time.tm_mday << " "
+                     << std::dec << std::setw(2) << std::setfill('0') << its_time.tm_hour << ":"
+                     << std::dec << std::setw(2) << std::setfill('0') << its_time.tm_min << ":"
+                     << std::dec << std::setw(2) << std::setfill('0') << its_time.tm_sec << "."
+                     << std::dec << std::setw(6) << std::setfill('0') << its_ms << " ["
+                     << its_level << "] " << _text << '\n';
+            if (_flush)
+                logfile_.flush();
+        }
+    }
+}
+
+const std::shared_ptr<logger_impl::buffer_t>& logger_impl::get_buffer()
+{
+    thread_local std::shared_ptr<buffer_t> its_buffer;
+    thread_local const logger_impl*        its_owner(nullptr);
+
+    if (!its_buffer || its_owner != this)
+    {
+        its_buffer = std::make_shared<buffer_t>(cfg_async_buffer_size);
+        its_owner  = this;
+
+        std::scoped_lock its_lock{buffers_mutex_};
+        buffers_.push_back(its_buffer);
+    }
+    return its_buffer;
+}
+
+bool logger_impl::has_pending_entries()
+{
+    std::scoped_lock its_lock{buffers_mutex_};
+    for (const auto& b : buffers_)
+    {
+        if (!b->entries_.empty())
+            return true;
+    }
+    return false;
+}
+
+void logger_impl::start_writer()
+{
+    std::scoped_lock its_lock{writer_mutex_};
+    if (!is_writer_running_)
+    {
+        is_writer_running_ = true;
+        writer_            = std::thread(&logger_impl::write_loop, this);
+    }
+}
+
+void logger_impl::stop_writer()
+{
+    {
+        std::scoped_lock its_lock{writer_mutex_};
+        if (!is_writer_running_)
+            return;
+        is_writer_running_ = false;
+        writer_condition_.notify_one();
+    }
+    if (writer_.joinable())
+        writer_.join();
+}
+
+void logger_impl::write_loop()
+{
+#if defined(__linux__) || defined(ANDROID)
+    pthread_setname_np(pthread_self(), "vsomeip_log");
+#endif
+    std::vector<std::shared_ptr<buffer_t>> its_buffers;
+    std::vector<entry_t>                   its_entries;
+    for (;;)
+    {
+        {
+            std::scoped_lock its_lock{buffers_mutex_};
+            // Forget the buffers of terminated threads once they are empty
+            buffers_.erase(std::remove_if(buffers_.begin(), buffers_.end(),
+                                          [](const std::shared_ptr<buffer_t>& _buffer) {
+                                              return _buffer.use_count() == 1
+                                                  && _buffer->entries_.empty();
+                                          }),
+                           buffers_.end());
+            its_buffers = buffers_;
+        }
+
+        std::uint64_t its_drops(0);
+        for (const auto& b : its_buffers)
+        {
+            entry_t its_entry;
+            while (b->entries_.pop(its_entry))
+                its_entries.push_back(std::move(its_entry));
+            its_drops += b->dropped_.exchange(0);
+        }
+        its_buffers.clear();
+
+        if (!its_entries.empty() || its_drops > 0)
+        {
+            // Restore the order of messages from different threads
+            std::stable_sort(its_entries.begin(), its_entries.end(),
+                             [](const entry_t& _a, const entry_t& _b) {
+                                 return _a.when_ < _b.when_;
+                             });
+
+            std::scoped_lock its_lock{output_mutex_};
+            for (const auto& e : its_entries)
+                write_unlocked(e.level_, e.when_, e.text_, false);
+            if (its_drops > 0)
+            {
+                write_unlocked(level_e::LL_WARNING, std::chrono::system_clock::now(),
+                               "Dropped " + std::to_string(its_drops)
+                                   + " log messages as the log buffer was full.",
+                               false);
+            }
+#ifndef ANDROID
+            if (cfg_console_enabled)
+                std::cout.flush();
+#endif
+            if (logfile_.is_open())
+                logfile_.flush();
+
+            its_entries.clear();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> its_lock{writer_mutex_};
+        if (!is_writer_running_)
+            break;
+
+        is_writer_waiting_ = true;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!has_pending_entries())
+            writer_condition_.wait_for(its_lock, std::chrono::seconds(1));
+        is_writer_waiting_ = false;
     }
 }
 
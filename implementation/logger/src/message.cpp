@@ -4,11 +4,15 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <chrono>
-#include <ctime>
-#include <fstream>
-#include <iomanip>
 #include <iostream>
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#define VSOMEIP_RETURN_ADDRESS() _ReturnAddress()
+#else
+#define VSOMEIP_RETURN_ADDRESS() __builtin_return_address(0)
+#endif
+
 #ifdef ANDROID
 #include <utils/Log.h>
 
@@ -77,66 +81,24 @@ message::message(level_e _level) : std::ostream(&buffer_), level_(_level)
 message::~message()
 try
 {
-    std::scoped_lock its_lock{mutex__};
-    auto             its_logger = logger_impl::get();
+    auto its_logger = logger_impl::get();
 
     if (level_ > its_logger->get_loglevel())
         return;
 
+    // The temporary message is destroyed by the statement that logs it, so
+    // the return address identifies the call site.
+    std::uint32_t its_suppressed(0);
+    if (!its_logger->check_rate(VSOMEIP_RETURN_ADDRESS(), its_suppressed))
+        return;
+    if (its_suppressed > 0)
+        buffer_.data_ << " (" << std::dec << its_suppressed << " similar messages suppressed)";
+
     if (its_logger->has_console_log() || its_logger->has_file_log())
     {
-        // Prepare log level
-        const char* its_level;
-        switch (level_)
-        {
-        case level_e::LL_FATAL:
-            its_level = "fatal";
-            break;
-        case level_e::LL_ERROR:
-            its_level = "error";
-            break;
-        case level_e::LL_WARNING:
-            its_level = "warning";
-            break;
-        case level_e::LL_INFO:
-            its_level = "info";
-            break;
-        case level_e::LL_DEBUG:
-            its_level = "debug";
-            break;
-        case level_e::LL_VERBOSE:
-            its_level = "verbose";
-            break;
-        default:
-            its_level = "none";
-        };
-
-        // Prepare time stamp
-        auto      its_time_t = std::chrono::system_clock::to_time_t(when_);
-        struct tm its_time;
-#ifdef _WIN32
-        localtime_s(&its_time, &its_time_t);
-#else
-        localtime_r(&its_time_t, &its_time);
-#endif
-        auto its_ms = (when_.time_since_epoch().count() / 100) % 1000000;
-
+#ifdef ANDROID
         if (its_logger->has_console_log())
         {
-#ifndef ANDROID
-            {
-                std::unique_lock<std::mutex> app_name_lock = its_logger->get_app_name_lock();
-                std::cout << std::dec << std::setw(4) << its_time.tm_year + 1900 << "-" << std::dec
-                          << std::setw(2) << std::setfill('0') << its_time.tm_mon + 1 << "-"
-                          << std::dec << std::setw(2) << std::setfill('0') << its_time.tm_mday
-                          << " " << std::dec << std::setw(2) << std::setfill('0')
-                          << its_time.tm_hour << ":" << std::dec << std::setw(2)
-                          << std::setfill('0') << its_time.tm_min << ":" << std::dec << std::setw(2)
-                          << std::setfill('0') << its_time.tm_sec << "." << std::dec << std::setw(6)
-                          << std::setfill('0') << its_ms << " " << its_logger->get_app_name()
-                          << " [" << its_level << "] " << buffer_.data_.str() << std::endl;
-            }
-#else
             std::string app = runtime::get_property("LogApplication");
 
             switch (level_)
@@ -162,24 +124,15 @@ try
             default:
                 ALOGI(app.c_str(), ("VSIP: " + buffer_.data_.str()).c_str());
             };
-#endif // !ANDROID
         }
+#endif // ANDROID
 
-        if (its_logger->has_file_log())
+        // Console (except on Android) and file output is either done by the
+        // background writer or directly.
+        if (!its_logger->enqueue(level_, when_, buffer_.data_.str()))
         {
-            std::ofstream its_logfile(its_logger->get_logfile(), std::ios_base::app);
-            if (its_logfile.is_open())
-            {
-                its_logfile << std::dec << std::setw(4) << its_time.tm_year + 1900 << "-"
-                            << std::dec << std::setw(2) << std::setfill('0') << its_time.tm_mon + 1
-                            << "-" << std::dec << std::setw(2) << std::setfill('0')
-                            << its_time.tm_mday << " " << std::dec << std::setw(2)
-                            << std::setfill('0') << its_time.tm_hour << ":" << std::dec
-                            << std::setw(2) << std::setfill('0') << its_time.tm_min << ":"
-                            << std::dec << std::setw(2) << std::setfill('0') << its_time.tm_sec
-                            << "." << std::dec << std::setw(6) << std::setfill('0') << its_ms
-                            << " [" << its_level << "] " << buffer_.data_.str() << std::endl;
-            }
+            std::scoped_lock its_lock{mutex__};
+            its_logger->write(level_, when_, buffer_.data_.str());
         }
     }
     if (its_logger->has_dlt_log())
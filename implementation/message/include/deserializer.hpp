@@ -6,6 +6,7 @@
 #ifndef VSOMEIP_V3_DESERIALIZER_HPP
 #define VSOMEIP_V3_DESERIALIZER_HPP
 
+#include <memory>
 #include <vector>
 
 #include <vsomeip/export.hpp>
@@ -29,6 +30,14 @@ public:
 
     VSOMEIP_EXPORT void set_data(const byte_t *_data, std::size_t _length);
     VSOMEIP_EXPORT void set_data(const std::vector<byte_t> &_data);
+    // Reads from _data instead of copying it. The caller must keep
+    // the data unchanged until reset() is called.
+    VSOMEIP_EXPORT void set_view(const byte_t *_data, std::size_t _length);
+    // Reads from the given range of _data instead of copying it.
+    // Deserialized payloads keep a reference to _data.
+    VSOMEIP_EXPORT void set_view(const std::shared_ptr<std::vector<byte_t> > &_data,
+                                 std::size_t _offset, std::size_t _length);
+    VSOMEIP_EXPORT const std::shared_ptr<std::vector<byte_t> > &get_shared_data() const;
     VSOMEIP_EXPORT void append_data(const byte_t *_data, std::size_t _length);
     VSOMEIP_EXPORT void drop_data(std::size_t _length);
 
@@ -48,6 +57,9 @@ public:
     VSOMEIP_EXPORT bool deserialize(uint8_t *_data, std::size_t _length);
     VSOMEIP_EXPORT bool deserialize(std::string& _target, std::size_t _length);
     VSOMEIP_EXPORT bool deserialize(std::vector<uint8_t>& _value);
+    // Returns the next _length bytes as a range of the shared data
+    VSOMEIP_EXPORT bool deserialize(std::size_t _length,
+            std::shared_ptr<std::vector<byte_t> > &_buffer, byte_t *&_data);
 
     VSOMEIP_EXPORT bool look_ahead(std::size_t _index, uint8_t &_value) const;
     VSOMEIP_EXPORT bool look_ahead(std::size_t _index, uint16_t &_value) const;
@@ -60,9 +72,14 @@ public:
 #endif
 protected:
     std::vector<byte_t> data_;
-    std::vector<byte_t>::iterator position_;
+    std::shared_ptr<std::vector<byte_t> > shared_data_;
+    const byte_t *begin_;
+    const byte_t *end_;
+    const byte_t *position_;
     std::size_t remaining_;
 private:
+    void reset_range();
+
     const std::uint32_t buffer_shrink_threshold_;
     std::uint32_t shrink_count_;
 
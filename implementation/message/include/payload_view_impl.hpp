@@ -0,0 +1,60 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_PAYLOAD_VIEW_IMPL_HPP
+#define VSOMEIP_V3_PAYLOAD_VIEW_IMPL_HPP
+
+#include <memory>
+
+#include <vsomeip/export.hpp>
+#include <vsomeip/payload.hpp>
+
+namespace vsomeip_v3 {
+
+class serializer;
+class deserializer;
+
+//
+// Payload of a received message that references the receive buffer the
+// message was deserialized from instead of owning a copy of its data.
+// The buffer is exclusively used by the message, therefore get_data()
+// may be used to modify the data in place. Replacing the data or changing
+// its capacity copies it into a buffer of its own.
+//
+class payload_view_impl : public payload {
+public:
+    VSOMEIP_EXPORT payload_view_impl();
+    VSOMEIP_EXPORT virtual ~payload_view_impl() = default;
+
+    VSOMEIP_EXPORT bool operator==(const payload& _other);
+
+    VSOMEIP_EXPORT byte_t* get_data();
+    VSOMEIP_EXPORT const byte_t* get_data() const;
+    VSOMEIP_EXPORT length_t get_length() const;
+
+    VSOMEIP_EXPORT void set_capacity(length_t _capacity);
+
+    VSOMEIP_EXPORT void set_data(const byte_t* _data, length_t _length);
+    VSOMEIP_EXPORT void set_data(const std::vector<byte_t>& _data);
+    VSOMEIP_EXPORT void set_data(std::vector<byte_t>&& _data);
+
+    VSOMEIP_EXPORT bool serialize(serializer* _to) const;
+    VSOMEIP_EXPORT bool deserialize(deserializer* _from);
+    VSOMEIP_EXPORT bool deserialize(deserializer* _from, length_t _length);
+
+    VSOMEIP_EXPORT bool is_view() const;
+
+private:
+    void own(std::vector<byte_t>&& _data);
+
+    std::shared_ptr<std::vector<byte_t>> buffer_;
+    byte_t* data_;
+    length_t length_;
+    bool is_view_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_PAYLOAD_VIEW_IMPL_HPP
@@ -18,7 +18,9 @@
 namespace vsomeip_v3 {
 
 deserializer::deserializer(std::uint32_t _buffer_shrink_threshold)
-    : position_(data_.begin()),
+    : begin_(nullptr),
+      end_(nullptr),
+      position_(nullptr),
       remaining_(0),
       buffer_shrink_threshold_(_buffer_shrink_threshold),
       shrink_count_(0)
@@ -27,25 +29,37 @@ deserializer::deserializer(std::uint32_t _buffer_shrink_threshold)
 deserializer::deserializer(byte_t* _data, std::size_t _length,
                            std::uint32_t _buffer_shrink_threshold)
     : data_(_data, _data + _length),
-      position_(data_.begin()),
       remaining_(_length),
       buffer_shrink_threshold_(_buffer_shrink_threshold),
       shrink_count_(0)
-{}
+{
+    reset_range();
+}
 
 deserializer::deserializer(const deserializer& _other)
     : data_(_other.data_),
+      shared_data_(_other.shared_data_),
+      begin_(_other.begin_),
+      end_(_other.end_),
       position_(_other.position_),
       remaining_(_other.remaining_),
       buffer_shrink_threshold_(_other.buffer_shrink_threshold_),
       shrink_count_(_other.shrink_count_)
-{}
+{
+    // Owned data must be referenced within the copy
+    if (_other.begin_ == _other.data_.data())
+    {
+        begin_    = data_.data();
+        end_      = begin_ + data_.size();
+        position_ = begin_ + (_other.position_ - _other.begin_);
+    }
+}
 
 deserializer::~deserializer() {}
 
 std::size_t deserializer::get_available() const
 {
-    return data_.size();
+    return static_cast<std::size_t>(end_ - begin_);
 }
 
 std::size_t deserializer::get_remaining() const
@@ -112,10 +126,9 @@ bool deserializer::deserialize(uint8_t* _data, std::size_t _length)
     if (_length > remaining_)
         return false;
 
-    std::memcpy(_data,
-                &data_[static_cast<std::vector<byte_t>::size_type>(position_ - data_.begin())],
-                _length);
-    position_ += static_cast<std::vector<byte_t>::difference_type>(_length);
+    if (_length > 0)
+        std::memcpy(_data, position_, _length);
+    position_ += _length;
     remaining_ -= _length;
 
     return true;
@@ -127,9 +140,8 @@ bool deserializer::deserialize(std::string& _target, std::size_t _length)
     {
         return false;
     }
-    _target.assign(position_,
-                   position_ + static_cast<std::vector<byte_t>::difference_type>(_length));
-    position_ += static_cast<std::vector<byte_t>::difference_type>(_length);
+    _target.assign(position_, position_ + _length);
+    position_ += _length;
     remaining_ -= _length;
 
     return true;
@@ -140,10 +152,24 @@ bool deserializer::deserialize(std::vector<uint8_t>& _value)
     if (_value.capacity() > remaining_)
         return false;
 
-    _value.assign(position_,
-                  position_ + static_cast<std::vector<byte_t>::difference_type>(_value.capacity()));
-    position_ += static_cast<std::vector<byte_t>::difference_type>(_value.capacity());
-    remaining_ -= _value.capacity();
+    const std::size_t its_length(_value.capacity());
+    _value.assign(position_, position_ + its_length);
+    position_ += its_length;
+    remaining_ -= its_length;
+
+    return true;
+}
+
+bool deserializer::deserialize(std::size_t _length, std::shared_ptr<std::vector<byte_t>>& _buffer,
+                               byte_t*& _data)
+{
+    if (!shared_data_ || _length > remaining_)
+        return false;
+
+    _buffer = shared_data_;
+    _data   = _buffer->data() + (position_ - _buffer->data());
+    position_ += _length;
+    remaining_ -= _length;
 
     return true;
 }
@@ -153,7 +179,7 @@ bool deserializer::look_ahead(std::size_t _index, uint8_t& _value) const
     if (_index > remaining_)
         return false;
 
-    _value = *(position_ + static_cast<std::vector<byte_t>::difference_type>(_index));
+    _value = *(position_ + _index);
 
     return true;
 }
@@ -163,9 +189,7 @@ bool deserializer::look_ahead(std::size_t _index, uint16_t& _value) const
     if (_index + 1 > remaining_)
         return false;
 
-    std::vector<uint8_t>::iterator i =
-        position_ + static_cast<std::vector<byte_t>::difference_type>(_index);
-    _value = bithelper::read_uint16_be(&(*i));
+    _value = bithelper::read_uint16_be(position_ + _index);
 
     return true;
 }
@@ -175,9 +199,7 @@ bool deserializer::look_ahead(std::size_t _index, uint32_t& _value) const
     if (_index + 3 > remaining_)
         return false;
 
-    std::vector<uint8_t>::const_iterator i =
-        position_ + static_cast<std::vector<byte_t>::difference_type>(_index);
-    _value = bithelper::read_uint32_be(&(*i));
+    _value = bithelper::read_uint32_be(position_ + _index);
 
     return true;
 }
@@ -201,41 +223,72 @@ try
 
 void deserializer::set_data(const byte_t* _data, std::size_t _length)
 {
+    shared_data_.reset();
     if (0 != _data)
-    {
         data_.assign(_data, _data + _length);
-        position_  = data_.begin();
-        remaining_ = static_cast<std::vector<byte_t>::size_type>(data_.end() - position_);
-    }
     else
-    {
         data_.clear();
-        position_  = data_.end();
-        remaining_ = 0;
-    }
+    reset_range();
+    remaining_ = data_.size();
 }
 
 void deserializer::set_data(const std::vector<byte_t>& _data)
 {
-    data_      = std::move(_data);
-    position_  = data_.begin();
+    shared_data_.reset();
+    data_ = _data;
+    reset_range();
     remaining_ = data_.size();
 }
 
+void deserializer::set_view(const byte_t* _data, std::size_t _length)
+{
+    shared_data_.reset();
+    data_.clear();
+    begin_     = _data;
+    end_       = _data ? _data + _length : _data;
+    position_  = begin_;
+    remaining_ = static_cast<std::size_t>(end_ - begin_);
+}
+
+void deserializer::set_view(const std::shared_ptr<std::vector<byte_t>>& _data, std::size_t _offset,
+                            std::size_t _length)
+{
+    if (!_data || _offset + _length > _data->size())
+    {
+        set_view(nullptr, 0);
+        return;
+    }
+
+    set_view(_data->data() + _offset, _length);
+    shared_data_ = _data;
+}
+
+const std::shared_ptr<std::vector<byte_t>>& deserializer::get_shared_data() const
+{
+    return shared_data_;
+}
+
 void deserializer::append_data(const byte_t* _data, std::size_t _length)
 {
-    std::vector<byte_t>::difference_type offset = (position_ - data_.begin());
+    const auto its_offset(position_ - begin_);
+    if (begin_ != data_.data())
+    {
+        // Viewed data is never modified, copy it first
+        data_.assign(begin_, end_);
+        shared_data_.reset();
+    }
     data_.insert(data_.end(), _data, _data + _length);
-    position_ = data_.begin() + offset;
+    reset_range();
+    position_ += its_offset;
     remaining_ += _length;
 }
 
 void deserializer::drop_data(std::size_t _length)
 {
-    if (position_ + static_cast<std::vector<byte_t>::difference_type>(_length) < data_.end())
-        position_ += static_cast<std::vector<byte_t>::difference_type>(_length);
+    if (_length < static_cast<std::size_t>(end_ - position_))
+        position_ += _length;
     else
-        position_ = data_.end();
+        position_ = end_;
 }
 
 void deserializer::reset()
@@ -252,13 +305,21 @@ void deserializer::reset()
         }
     }
     data_.clear();
-    position_  = data_.begin();
-    remaining_ = data_.size();
+    shared_data_.reset();
     if (buffer_shrink_threshold_ && shrink_count_ > buffer_shrink_threshold_)
     {
         data_.shrink_to_fit();
         shrink_count_ = 0;
     }
+    reset_range();
+    remaining_ = 0;
+}
+
+void deserializer::reset_range()
+{
+    begin_    = data_.data();
+    end_      = begin_ + data_.size();
+    position_ = begin_;
 }
 
 #ifdef VSOMEIP_DEBUGGING
@@ -267,8 +328,8 @@ void deserializer::show() const
     std::stringstream its_message;
     its_message << "(" << std::hex << std::setw(2) << std::setfill('0') << (int)*position_ << ", "
                 << std::dec << remaining_ << ") " << std::hex << std::setfill('0');
-    for (int i = 0; i < data_.size(); ++i)
-        its_message << std::setw(2) << (int)data_[i] << " ";
+    for (const byte_t* i = begin_; i < end_; ++i)
+        its_message << std::setw(2) << (int)*i << " ";
     VSOMEIP_INFO << its_message;
 }
 #endif
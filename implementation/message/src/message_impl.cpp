@@ -7,7 +7,9 @@
 #include <vsomeip/payload.hpp>
 #include <vsomeip/runtime.hpp>
 
+#include "../include/deserializer.hpp"
 #include "../include/message_impl.hpp"
+#include "../include/payload_view_impl.hpp"
 #ifdef ANDROID
 #include "../../configuration/include/internal_android.hpp"
 #else
@@ -46,12 +48,27 @@ bool message_impl::serialize(serializer* _to) const
 
 bool message_impl::deserialize(deserializer* _from)
 {
-    payload_           = runtime::get()->create_payload();
+    // Payloads reference the data of deserializers that share it
+    const bool is_view(_from && _from->get_shared_data());
+    if (is_view)
+        payload_ = std::make_shared<payload_view_impl>();
+    else
+        payload_ = runtime::get()->create_payload();
+
     bool is_successful = header_.deserialize(_from);
     if (is_successful)
     {
-        payload_->set_capacity(header_.length_ - VSOMEIP_SOMEIP_HEADER_SIZE);
-        is_successful = payload_->deserialize(_from);
+        const length_t its_length(header_.length_ - VSOMEIP_SOMEIP_HEADER_SIZE);
+        if (is_view)
+        {
+            is_successful = std::static_pointer_cast<payload_view_impl>(payload_)->deserialize(
+                _from, its_length);
+        }
+        else
+        {
+            payload_->set_capacity(its_length);
+            is_successful = payload_->deserialize(_from);
+        }
     }
     return is_successful;
 }
@@ -0,0 +1,98 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <cstring>
+
+#include "../include/deserializer.hpp"
+#include "../include/payload_view_impl.hpp"
+#include "../include/serializer.hpp"
+
+namespace vsomeip_v3 {
+
+payload_view_impl::payload_view_impl() : data_(nullptr), length_(0), is_view_(false) {}
+
+bool payload_view_impl::operator==(const payload& _other)
+{
+    bool is_equal{get_length() == _other.get_length()};
+    if (is_equal && length_ > 0)
+    {
+        is_equal = (0 == std::memcmp(get_data(), _other.get_data(), get_length()));
+    }
+    return is_equal;
+}
+
+byte_t* payload_view_impl::get_data()
+{
+    return data_;
+}
+
+const byte_t* payload_view_impl::get_data() const
+{
+    return data_;
+}
+
+length_t payload_view_impl::get_length() const
+{
+    return length_;
+}
+
+void payload_view_impl::set_capacity(length_t _capacity)
+{
+    std::vector<byte_t> its_data;
+    its_data.reserve(_capacity > length_ ? _capacity : length_);
+    if (length_ > 0)
+        its_data.assign(data_, data_ + length_);
+    own(std::move(its_data));
+}
+
+void payload_view_impl::set_data(const byte_t* _data, const length_t _length)
+{
+    own(std::vector<byte_t>(_data, _data + _length));
+}
+
+void payload_view_impl::set_data(const std::vector<byte_t>& _data)
+{
+    own(std::vector<byte_t>(_data));
+}
+
+void payload_view_impl::set_data(std::vector<byte_t>&& _data)
+{
+    own(std::move(_data));
+}
+
+bool payload_view_impl::serialize(serializer* _to) const
+{
+    return (0 != _to && _to->serialize(data_, length_));
+}
+
+bool payload_view_impl::deserialize(deserializer* _from)
+{
+    return (0 != _from && deserialize(_from, length_t(_from->get_remaining())));
+}
+
+bool payload_view_impl::deserialize(deserializer* _from, length_t _length)
+{
+    if (0 == _from || !_from->deserialize(_length, buffer_, data_))
+        return false;
+
+    length_  = _length;
+    is_view_ = true;
+    return true;
+}
+
+bool payload_view_impl::is_view() const
+{
+    return is_view_;
+}
+
+void payload_view_impl::own(std::vector<byte_t>&& _data)
+{
+    buffer_  = std::make_shared<std::vector<byte_t>>(std::move(_data));
+    data_    = buffer_->data();
+    length_  = length_t(buffer_->size());
+    is_view_ = false;
+}
+
+} // namespace vsomeip_v3
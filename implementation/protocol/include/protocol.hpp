@@ -54,6 +54,8 @@ enum class id_e : uint8_t {
     EXPIRE_ID = 0x2A,
     SUSPEND_ID = 0x30,
     CONFIG_ID = 0x31,
+    SEND_SHM_ID = 0x32,
+    RESYNC_ROUTING_INFO_ID = 0x33,
     UNKNOWN_ID = 0xFF
 };
 
@@ -107,6 +109,8 @@ struct service {
 };
 
 static const version_t MAX_SUPPORTED_VERSION = 0;
+// Routing info commands of this version carry an epoch
+static const version_t ROUTING_INFO_EPOCH_VERSION = 1;
 
 static const size_t TAG_SIZE = 4;
 static const size_t COMMAND_HEADER_SIZE = 9;
@@ -0,0 +1,26 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_PROTOCOL_RESYNC_ROUTING_INFO_COMMAND_HPP_
+#define VSOMEIP_V3_PROTOCOL_RESYNC_ROUTING_INFO_COMMAND_HPP_
+
+#include "simple_command.hpp"
+
+namespace vsomeip_v3 {
+namespace protocol {
+
+// Sent by a client that missed a routing info epoch. The routing manager
+// answers with the complete routing info of the client.
+class resync_routing_info_command
+    : public simple_command {
+
+public:
+    resync_routing_info_command();
+};
+
+} // namespace protocol
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_PROTOCOL_RESYNC_ROUTING_INFO_COMMAND_HPP_
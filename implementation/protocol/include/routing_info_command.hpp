@@ -26,8 +26,20 @@ public:
     void set_entries(std::vector<routing_info_entry> &&_entries);
     void add_entry(const routing_info_entry &_entry);
 
+    // The epoch is counted per receiver. If set, the command is serialized
+    // using ROUTING_INFO_EPOCH_VERSION. 0 means "no epoch".
+    std::uint32_t get_epoch() const;
+    void set_epoch(std::uint32_t _epoch);
+
+    // Whether the command contains the complete routing info of the receiver
+    // (the answer to a resync request) instead of changes only.
+    bool is_full() const;
+    void set_full(bool _is_full);
+
 private:
     std::vector<routing_info_entry> entries_;
+    std::uint32_t epoch_;
+    bool is_full_;
 };
 
 } // namespace protocol
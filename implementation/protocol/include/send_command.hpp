@@ -18,8 +18,17 @@ public:
 
     void serialize(std::vector<byte_t> &_buffer,
             error_e &_error) const;
+    // Serializes the command using the given message data instead of
+    // message_. This avoids copying large messages into the command.
+    // If _data is nullptr, space for the message is reserved only.
+    void serialize(const byte_t *_data, uint32_t _size,
+            std::vector<byte_t> &_buffer, error_e &_error) const;
     void deserialize(const std::vector<byte_t> &_buffer,
             error_e &_error);
+    // Deserializes the command without copying the message. Instead,
+    // _offset is set to the position of the message within _buffer.
+    void deserialize(const std::vector<byte_t> &_buffer,
+            size_t &_offset, error_e &_error);
 
     instance_t get_instance() const;
     void set_instance(instance_t _instance);
@@ -33,8 +42,7 @@ public:
     client_t get_target() const;
     void set_target(client_t _target);
 
-    // TODO: Optimize this as the vector might be huge!
-    std::vector<byte_t> get_message() const;
+    const std::vector<byte_t> &get_message() const;
     void set_message(const std::vector<byte_t> &_message);
 
 private:
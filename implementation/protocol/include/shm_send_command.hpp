@@ -0,0 +1,86 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_PROTOCOL_SHM_SEND_COMMAND_HPP_
+#define VSOMEIP_V3_PROTOCOL_SHM_SEND_COMMAND_HPP_
+
+#include <string>
+
+#include "command.hpp"
+
+namespace vsomeip_v3::protocol {
+
+/**
+ * A command for sending a message that was written to shared memory.
+ *
+ * It replaces a `send_command` of a large message between local peers and
+ * only describes where the message can be found: the name of the shared
+ * memory object, the slot and the sequence number it was written with and
+ * its length.
+ *
+ * See the vsomeip protocol documentation for more information on how this command
+ * is structured.
+ */
+class shm_send_command final : public command {
+public:
+    /** Creates a new `shm_send_command`. */
+    shm_send_command() : command(id_e::SEND_SHM_ID) { }
+
+    /**
+     * Serializes the `shm_send_command` into the given buffer.
+     *
+     * Serialized data will be represented in Little-Endian byte order.
+     */
+    void serialize(std::vector<byte_t>& _buffer, error_e& _error) const override;
+
+    /**
+     * Deserializes the `shm_send_command` from the given buffer.
+     *
+     * Serialized data is expected to be in Little-Endian byte order.
+     */
+    void deserialize(const std::vector<byte_t>& _buffer, error_e& _error) override;
+
+    instance_t get_instance() const { return instance_; }
+    void set_instance(instance_t _instance) { instance_ = _instance; }
+
+    bool is_reliable() const { return is_reliable_; }
+    void set_reliable(bool _is_reliable) { is_reliable_ = _is_reliable; }
+
+    uint8_t get_status() const { return status_; }
+    void set_status(uint8_t _status) { status_ = _status; }
+
+    client_t get_target() const { return target_; }
+    void set_target(client_t _target) { target_ = _target; }
+
+    /** The slot of the shared memory object that contains the message. */
+    std::uint32_t get_slot() const { return slot_; }
+    void set_slot(std::uint32_t _slot) { slot_ = _slot; }
+
+    /** The sequence number the slot was claimed with. */
+    std::uint64_t get_sequence() const { return sequence_; }
+    void set_sequence(std::uint64_t _sequence) { sequence_ = _sequence; }
+
+    /** The length of the message. */
+    std::uint32_t get_length() const { return length_; }
+    void set_length(std::uint32_t _length) { length_ = _length; }
+
+    /** The name of the shared memory object. */
+    const std::string& get_name() const { return name_; }
+    void set_name(const std::string& _name) { name_ = _name; }
+
+private:
+    instance_t    instance_ {0};
+    bool          is_reliable_ {false};
+    uint8_t       status_ {0};
+    client_t      target_ {0};
+    std::uint32_t slot_ {0};
+    std::uint64_t sequence_ {0};
+    std::uint32_t length_ {0};
+    std::string   name_;
+};
+
+} // namespace vsomeip_v3::protocol
+
+#endif // VSOMEIP_V3_PROTOCOL_SHM_SEND_COMMAND_HPP_
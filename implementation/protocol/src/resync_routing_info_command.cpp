@@ -0,0 +1,15 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/resync_routing_info_command.hpp"
+
+namespace vsomeip_v3 { namespace protocol {
+
+resync_routing_info_command::resync_routing_info_command() :
+    simple_command(id_e::RESYNC_ROUTING_INFO_ID)
+{
+}
+
+}} // namespace vsomeip_v3::protocol
@@ -9,11 +9,21 @@
 
 namespace vsomeip_v3 { namespace protocol {
 
-routing_info_command::routing_info_command() : command(id_e::ROUTING_INFO_ID) {}
+namespace {
+const size_t ROUTING_INFO_EPOCH_SIZE = sizeof(std::uint32_t) + sizeof(byte_t);
+const byte_t ROUTING_INFO_FLAG_FULL  = 0x01;
+} // namespace
+
+routing_info_command::routing_info_command() :
+    command(id_e::ROUTING_INFO_ID), epoch_(0), is_full_(false)
+{
+}
 
 void routing_info_command::serialize(std::vector<byte_t>& _buffer, error_e& _error) const
 {
     size_t its_size(COMMAND_HEADER_SIZE);
+    if (version_ >= ROUTING_INFO_EPOCH_VERSION)
+        its_size += ROUTING_INFO_EPOCH_SIZE;
     for (const auto& e : entries_)
         its_size += e.get_size();
 
@@ -30,6 +40,12 @@ void routing_info_command::serialize(std::vector<byte_t>& _buffer, error_e& _err
 
     // serialize payload
     size_t _index(COMMAND_HEADER_SIZE);
+    if (version_ >= ROUTING_INFO_EPOCH_VERSION)
+    {
+        std::memcpy(&_buffer[_index], &epoch_, sizeof(epoch_));
+        _buffer[_index + sizeof(epoch_)] = (is_full_ ? ROUTING_INFO_FLAG_FULL : byte_t(0));
+        _index += ROUTING_INFO_EPOCH_SIZE;
+    }
     for (const auto& e : entries_)
     {
         e.serialize(_buffer, _index, _error);
@@ -56,6 +72,17 @@ void routing_info_command::deserialize(const std::vector<byte_t>& _buffer, error
 
     // deserialize payload
     size_t its_index(COMMAND_HEADER_SIZE);
+    if (version_ >= ROUTING_INFO_EPOCH_VERSION)
+    {
+        if (COMMAND_HEADER_SIZE + ROUTING_INFO_EPOCH_SIZE > _buffer.size())
+        {
+            _error = error_e::ERROR_NOT_ENOUGH_BYTES;
+            return;
+        }
+        std::memcpy(&epoch_, &_buffer[its_index], sizeof(epoch_));
+        is_full_ = ((_buffer[its_index + sizeof(epoch_)] & ROUTING_INFO_FLAG_FULL) != 0);
+        its_index += ROUTING_INFO_EPOCH_SIZE;
+    }
     while (its_index < _buffer.size())
     {
         routing_info_entry its_entry;
@@ -84,4 +111,25 @@ void routing_info_command::add_entry(const routing_info_entry& _entry)
     entries_.push_back(_entry);
 }
 
+std::uint32_t routing_info_command::get_epoch() const
+{
+    return epoch_;
+}
+
+void routing_info_command::set_epoch(std::uint32_t _epoch)
+{
+    epoch_   = _epoch;
+    version_ = (_epoch != 0 ? ROUTING_INFO_EPOCH_VERSION : MAX_SUPPORTED_VERSION);
+}
+
+bool routing_info_command::is_full() const
+{
+    return is_full_;
+}
+
+void routing_info_command::set_full(bool _is_full)
+{
+    is_full_ = _is_full;
+}
+
 }} // namespace vsomeip_v3::protocol
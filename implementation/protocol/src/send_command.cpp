@@ -51,7 +51,7 @@ void send_command::set_target(client_t _target)
     target_ = _target;
 }
 
-std::vector<byte_t> send_command::get_message() const
+const std::vector<byte_t>& send_command::get_message() const
 {
     return message_;
 }
@@ -62,9 +62,15 @@ void send_command::set_message(const std::vector<byte_t>& _message)
 }
 
 void send_command::serialize(std::vector<byte_t>& _buffer, error_e& _error) const
+{
+    serialize(message_.data(), static_cast<uint32_t>(message_.size()), _buffer, _error);
+}
+
+void send_command::serialize(const byte_t* _data, uint32_t _size, std::vector<byte_t>& _buffer,
+                             error_e& _error) const
 {
     size_t its_size(COMMAND_HEADER_SIZE + sizeof(instance_) + sizeof(is_reliable_) + sizeof(status_)
-                    + sizeof(target_) + message_.size());
+                    + sizeof(target_) + _size);
 
     if (its_size > std::numeric_limits<command_size_t>::max())
     {
@@ -93,10 +99,22 @@ void send_command::serialize(std::vector<byte_t>& _buffer, error_e& _error) cons
     its_offset += sizeof(status_);
     std::memcpy(&_buffer[its_offset], &target_, sizeof(target_));
     its_offset += sizeof(target_);
-    std::memcpy(&_buffer[its_offset], &message_[0], message_.size());
+    if (_size > 0 && _data)
+        std::memcpy(&_buffer[its_offset], _data, _size);
 }
 
 void send_command::deserialize(const std::vector<byte_t>& _buffer, error_e& _error)
+{
+    size_t its_offset(0);
+    deserialize(_buffer, its_offset, _error);
+    if (_error != error_e::ERROR_OK)
+        return;
+
+    message_.assign(_buffer.begin() + static_cast<std::ptrdiff_t>(its_offset), _buffer.end());
+}
+
+void send_command::deserialize(const std::vector<byte_t>& _buffer, size_t& _offset,
+                               error_e& _error)
 {
     size_t its_size(COMMAND_HEADER_SIZE + sizeof(instance_) + sizeof(is_reliable_) + sizeof(status_)
                     + sizeof(target_));
@@ -122,8 +140,7 @@ void send_command::deserialize(const std::vector<byte_t>& _buffer, error_e& _err
     its_offset += sizeof(status_);
     std::memcpy(&target_, &_buffer[its_offset], sizeof(target_));
     its_offset += sizeof(target_);
-    message_.resize(_buffer.size() - its_offset);
-    std::memcpy(&message_[0], &_buffer[its_offset], message_.size());
+    _offset = its_offset;
 }
 
 }} // namespace vsomeip_v3::protocol
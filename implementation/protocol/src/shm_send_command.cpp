@@ -0,0 +1,89 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/shm_send_command.hpp"
+
+#include <limits>
+
+namespace vsomeip_v3::protocol {
+
+namespace {
+const size_t SHM_SEND_FIXED_SIZE = sizeof(instance_t) + sizeof(bool) + sizeof(uint8_t)
+                                 + sizeof(client_t) + sizeof(std::uint32_t)
+                                 + sizeof(std::uint64_t) + sizeof(std::uint32_t);
+}
+
+void shm_send_command::serialize(std::vector<byte_t>& _buffer, error_e& _error) const
+{
+    size_t its_size(COMMAND_HEADER_SIZE + SHM_SEND_FIXED_SIZE + name_.size());
+    if (its_size > std::numeric_limits<command_size_t>::max())
+    {
+        _error = error_e::ERROR_MAX_COMMAND_SIZE_EXCEEDED;
+        return;
+    }
+
+    _buffer.resize(its_size);
+    size_ = static_cast<command_size_t>(its_size - COMMAND_HEADER_SIZE);
+    command::serialize(_buffer, _error);
+    if (_error != error_e::ERROR_OK)
+        return;
+
+    size_t its_offset(COMMAND_POSITION_PAYLOAD);
+    std::memcpy(&_buffer[its_offset], &instance_, sizeof(instance_));
+    its_offset += sizeof(instance_);
+    _buffer[its_offset] = static_cast<byte_t>(is_reliable_);
+    its_offset += sizeof(is_reliable_);
+    _buffer[its_offset] = static_cast<byte_t>(status_);
+    its_offset += sizeof(status_);
+    std::memcpy(&_buffer[its_offset], &target_, sizeof(target_));
+    its_offset += sizeof(target_);
+    std::memcpy(&_buffer[its_offset], &slot_, sizeof(slot_));
+    its_offset += sizeof(slot_);
+    std::memcpy(&_buffer[its_offset], &sequence_, sizeof(sequence_));
+    its_offset += sizeof(sequence_);
+    std::memcpy(&_buffer[its_offset], &length_, sizeof(length_));
+    its_offset += sizeof(length_);
+    if (!name_.empty())
+        std::memcpy(&_buffer[its_offset], name_.data(), name_.size());
+}
+
+void shm_send_command::deserialize(const std::vector<byte_t>& _buffer, error_e& _error)
+{
+    if (_buffer.size() < COMMAND_HEADER_SIZE + SHM_SEND_FIXED_SIZE)
+    {
+        _error = error_e::ERROR_NOT_ENOUGH_BYTES;
+        return;
+    }
+
+    command::deserialize(_buffer, _error);
+    if (_error != error_e::ERROR_OK)
+        return;
+
+    if (size_ < SHM_SEND_FIXED_SIZE || _buffer.size() < COMMAND_HEADER_SIZE + size_)
+    {
+        _error = error_e::ERROR_NOT_ENOUGH_BYTES;
+        return;
+    }
+
+    size_t its_offset(COMMAND_POSITION_PAYLOAD);
+    std::memcpy(&instance_, &_buffer[its_offset], sizeof(instance_));
+    its_offset += sizeof(instance_);
+    is_reliable_ = static_cast<bool>(_buffer[its_offset]);
+    its_offset += sizeof(is_reliable_);
+    status_ = static_cast<uint8_t>(_buffer[its_offset]);
+    its_offset += sizeof(status_);
+    std::memcpy(&target_, &_buffer[its_offset], sizeof(target_));
+    its_offset += sizeof(target_);
+    std::memcpy(&slot_, &_buffer[its_offset], sizeof(slot_));
+    its_offset += sizeof(slot_);
+    std::memcpy(&sequence_, &_buffer[its_offset], sizeof(sequence_));
+    its_offset += sizeof(sequence_);
+    std::memcpy(&length_, &_buffer[its_offset], sizeof(length_));
+    its_offset += sizeof(length_);
+    name_.assign(reinterpret_cast<const char*>(&_buffer[its_offset]),
+                 size_ - SHM_SEND_FIXED_SIZE);
+}
+
+} // namespace vsomeip_v3::protocol
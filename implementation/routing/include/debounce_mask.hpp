@@ -0,0 +1,41 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_DEBOUNCE_MASK_HPP_
+#define VSOMEIP_V3_DEBOUNCE_MASK_HPP_
+
+#include <map>
+#include <vector>
+
+#include <vsomeip/export.hpp>
+#include <vsomeip/primitive_types.hpp>
+
+namespace vsomeip_v3 {
+
+class payload;
+
+//
+// The "ignore" part of a debounce filter compiled into a dense mask. Byte i
+// of the mask holds the bits of payload byte i that are compared. Bytes
+// behind the end of the mask are compared completely.
+//
+class VSOMEIP_IMPORT_EXPORT debounce_mask {
+public:
+    explicit debounce_mask(const std::map<std::size_t, byte_t>& _ignore);
+
+    bool operator==(const debounce_mask& _other) const;
+
+    // Returns whether the payloads differ in a byte or bit that is not ignored
+    bool is_changed(const payload& _old, const payload& _new) const;
+    bool is_changed(const byte_t* _old, std::size_t _old_length, const byte_t* _new,
+                    std::size_t _new_length) const;
+
+private:
+    std::vector<byte_t> mask_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_DEBOUNCE_MASK_HPP_
@@ -11,6 +11,7 @@
 #include <memory>
 #include <mutex>
 #include <set>
+#include <vector>
 #include <atomic>
 
 #include <boost/asio/ip/address.hpp>
@@ -20,18 +21,36 @@
 #include <vsomeip/function_types.hpp>
 #include <vsomeip/payload.hpp>
 
+#include "../../message/include/serializer.hpp"
 
 namespace vsomeip_v3 {
 
 
 class endpoint;
 class endpoint_definition;
+class debounce_mask;
+class eventgroupinfo;
 class message;
 class payload;
 class routing_manager;
 
 struct debounce_filter_impl_t;
 
+// Remote fan-out plan of an event. It is built by the routing manager and
+// stays valid as long as neither the routing manager's eventgroup table nor
+// one of the referenced eventgroups changes.
+struct remote_targets_t {
+    bool is_valid(uint32_t _revision) const;
+
+    std::vector<std::shared_ptr<endpoint_definition> > reliable_;
+    std::vector<std::shared_ptr<endpoint_definition> > unreliable_;
+    std::vector<std::shared_ptr<endpoint_definition> > multicast_;
+
+    // weak to not create a cycle (eventgroupinfo references its events)
+    std::vector<std::pair<std::weak_ptr<eventgroupinfo>, uint32_t> > eventgroups_;
+    uint32_t revision_;
+};
+
 class event
         : public std::enable_shared_from_this<event> {
 public:
@@ -129,6 +148,9 @@ public:
 
     void set_session();
 
+    std::shared_ptr<remote_targets_t> get_remote_targets(uint32_t _revision) const;
+    void set_remote_targets(const std::shared_ptr<remote_targets_t> &_targets);
+
 private:
     void update_cbk(boost::system::error_code const &_error);
     void notify(bool _force);
@@ -149,6 +171,8 @@ private:
             const std::shared_ptr<payload> &_payload, bool _force);
     void update_payload_unlocked();
 
+    bool prepare_frame_unlocked();
+
     void get_pending_updates(const std::set<client_t> &_clients);
 
 private:
@@ -158,6 +182,10 @@ private:
     std::shared_ptr<message> current_;
     std::shared_ptr<message> update_;
 
+    // Serialized update_. It is rebuilt when the payload of update_ changes,
+    // notifications only patch session and client.
+    serializer frame_;
+
     std::atomic<event_type_e> type_;
 
     boost::asio::steady_timer cycle_timer_;
@@ -185,8 +213,15 @@ private:
 
     std::set<std::shared_ptr<endpoint_definition> > pending_;
 
+    struct filter_t {
+        std::shared_ptr<debounce_filter_impl_t> filter_;
+        std::shared_ptr<const debounce_mask> mask_;
+    };
     std::mutex filters_mutex_;
-    std::map<client_t, epsilon_change_func_t> filters_;
+    std::map<client_t, filter_t> filters_;
+
+    mutable std::mutex remote_targets_mutex_;
+    std::shared_ptr<remote_targets_t> remote_targets_;
 };
 
 }  // namespace vsomeip_v3
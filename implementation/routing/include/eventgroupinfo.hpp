@@ -118,6 +118,10 @@ public:
     VSOMEIP_EXPORT uint8_t get_max_remote_subscribers() const;
     VSOMEIP_EXPORT void set_max_remote_subscribers(uint8_t _max_remote_subscribers);
 
+    // Changes whenever the set of remote targets (subscriptions, multicast
+    // address or threshold) changes.
+    VSOMEIP_EXPORT uint32_t get_revision() const;
+
 private:
     void update_id();
     uint32_t get_unreliable_target_count() const;
@@ -148,6 +152,8 @@ private:
     std::atomic<bool> reliability_auto_mode_;
 
     uint8_t max_remote_subscribers_;
+
+    std::atomic<uint32_t> revision_;
 };
 
 } // namespace vsomeip_v3
@@ -0,0 +1,68 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_ROUTING_INFO_COALESCER_HPP_
+#define VSOMEIP_V3_ROUTING_INFO_COALESCER_HPP_
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <vsomeip/export.hpp>
+#include <vsomeip/primitive_types.hpp>
+
+#include "../../protocol/include/routing_info_entry.hpp"
+
+namespace vsomeip_v3 {
+
+//
+// Collects the routing info changes of each client and sends them as one
+// routing info command per client. Consecutive changes of the same kind that
+// concern the same client are merged into one entry, the order of the changes
+// is kept. Each command carries an epoch that is counted per
+// receiving client; a client that detects a gap requests the complete
+// routing info (see send_full).
+//
+class VSOMEIP_IMPORT_EXPORT routing_info_coalescer {
+public:
+    // Sends a serialized command to the given client. Returns false if the
+    // command could not be sent.
+    typedef std::function<bool(client_t _target, const std::vector<byte_t>& _command)> sender_t;
+
+    explicit routing_info_coalescer(const sender_t& _sender);
+
+    // Adds a change for _target. Returns true if no change (for any client) was
+    // pending before.
+    bool add(client_t _target, const protocol::routing_info_entry& _entry);
+
+    // Sends the pending changes of all clients / of _target. _client is the
+    // client identifier of the routing manager.
+    void flush(client_t _client);
+    void flush(client_t _client, client_t _target);
+
+    // Sends the pending changes and then the complete routing info of _target.
+    void send_full(client_t _client, client_t _target,
+                   std::vector<protocol::routing_info_entry>&& _entries);
+
+    // Forgets pending changes and epoch of a deregistered client.
+    void remove(client_t _target);
+
+    bool has_pending() const;
+
+private:
+    void send(client_t _client, client_t _target,
+              std::vector<protocol::routing_info_entry>&& _entries, bool _is_full);
+
+    const sender_t sender_;
+
+    mutable std::mutex mutex_;
+    std::map<client_t, std::vector<protocol::routing_info_entry>> pending_;
+    std::map<client_t, std::uint32_t> epochs_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_ROUTING_INFO_COALESCER_HPP_
@@ -89,6 +89,10 @@ public:
             const std::shared_ptr<endpoint_definition> &_target,
             std::shared_ptr<message> _message) = 0;
 
+    virtual bool send_to(const client_t _client,
+            const std::shared_ptr<endpoint_definition> &_target,
+            const byte_t *_data, uint32_t _size, instance_t _instance) = 0;
+
     virtual bool send_to(const std::shared_ptr<endpoint_definition> &_target,
             const byte_t *_data, uint32_t _size, instance_t _instance) = 0;
 
@@ -27,6 +27,8 @@
 #include "../../protocol/include/protocol.hpp"
 #include "../../configuration/include/configuration.hpp"
 #include "../../endpoints/include/endpoint_manager_base.hpp"
+#include "../../utility/include/epoch_snapshot.hpp"
+#include "../../utility/include/flat_index.hpp"
 
 #if defined(__QNX__)
 #include "../../utility/include/qnx_helper.hpp"
@@ -41,6 +43,7 @@ class connector_impl;
 } // namespace trace
 #endif
 
+class local_shm_transport;
 class serializer;
 
 class routing_manager_base : public routing_manager,
@@ -52,6 +55,7 @@ public:
     virtual ~routing_manager_base() = default;
 
     virtual boost::asio::io_context& get_io();
+    boost::asio::io_context&         get_endpoint_io(std::size_t _hash);
     virtual client_t                 get_client() const;
 
     virtual std::string get_client_host() const;
@@ -190,6 +194,15 @@ protected:
     std::shared_ptr<eventgroupinfo> find_eventgroup(service_t _service, instance_t _instance,
                                                     eventgroup_t _eventgroup) const;
 
+    // Look up events_/eventgroups_ without using the snapshots, meant for
+    // (un)registrations. Must be called with events_mutex_/eventgroups_mutex_
+    // being hold.
+    std::shared_ptr<event>          find_event_unlocked(service_t _service, instance_t _instance,
+                                                        event_t _event) const;
+    std::shared_ptr<eventgroupinfo> find_eventgroup_unlocked(service_t    _service,
+                                                             instance_t   _instance,
+                                                             eventgroup_t _eventgroup) const;
+
     void remove_eventgroup_info(service_t _service, instance_t _instance, eventgroup_t _eventgroup);
 
     bool send_local_notification(client_t _client, const byte_t* _data, uint32_t _size,
@@ -200,6 +213,10 @@ protected:
                     uint32_t _size, instance_t _instance, bool _reliable, protocol::id_e _command,
                     uint8_t _status_check) const;
 
+    message_buffer_ptr_t serialize_local(client_t _target, const byte_t* _data, uint32_t _size,
+                                         instance_t _instance, bool _reliable,
+                                         protocol::id_e _command, uint8_t _status_check) const;
+
     bool insert_subscription(service_t _service, instance_t _instance, eventgroup_t _eventgroup,
                              event_t _event, const std::shared_ptr<debounce_filter_impl_t>& _filter,
                              client_t _client, std::set<event_t>* _already_subscribed_events);
@@ -266,6 +283,24 @@ private:
         service_t _service, instance_t _instance, eventgroup_t _eventgroup, event_t _event,
         const std::shared_ptr<debounce_filter_impl_t>& _filter, client_t _client) = 0;
 
+    typedef flat_index<uint64_t, std::shared_ptr<eventgroupinfo>> eventgroups_index_t;
+    typedef flat_index<uint64_t, std::shared_ptr<event>>          events_index_t;
+
+    static uint64_t get_index_key(service_t _service, instance_t _instance, uint16_t _id)
+    {
+        return (uint64_t(_service) << 32) | (uint64_t(_instance) << 16) | _id;
+    }
+
+    // Must be called with eventgroups_mutex_/events_mutex_ being hold.
+    // Build and publish the snapshot if it was reset by a change.
+    const eventgroups_index_t* get_eventgroups_index_unlocked() const;
+    const events_index_t*      get_events_index_unlocked() const;
+
+    // Lock free lookup of the eventgroup, unlike find_eventgroup it does not
+    // update the eventgroup from the configuration
+    std::shared_ptr<eventgroupinfo> find_eventgroup_info(service_t _service, instance_t _instance,
+                                                         eventgroup_t _eventgroup) const;
+
 protected:
     routing_manager_host*    host_;
     boost::asio::io_context& io_;
@@ -292,10 +327,18 @@ protected:
     std::map<service_t,
              std::map<instance_t, std::map<eventgroup_t, std::shared_ptr<eventgroupinfo>>>>
         eventgroups_;
+    // Changes whenever an eventgroup is added to or removed from eventgroups_
+    std::atomic<uint32_t> eventgroups_revision_;
     // Events (part of one or more eventgroups)
     mutable std::mutex events_mutex_;
     std::map<service_t, std::map<instance_t, std::map<event_t, std::shared_ptr<event>>>> events_;
 
+    // Snapshots of eventgroups_ and events_ for lookups on the data path.
+    // They are reset by a change of the maps and rebuilt once by the next
+    // lookup, thus a batch of registrations only leads to a single rebuild.
+    mutable epoch_snapshot<eventgroups_index_t> eventgroups_index_;
+    mutable epoch_snapshot<events_index_t>      events_index_;
+
     boost::asio::steady_timer debounce_timer;
     std::multimap<
         std::chrono::steady_clock::time_point,
@@ -332,6 +375,9 @@ protected:
 
     std::shared_ptr<endpoint_manager_base> ep_mgr_;
 
+    // Passes large local notifications via shared memory (if configured)
+    std::shared_ptr<local_shm_transport> shm_;
+
     mutable std::mutex              known_clients_mutex_;
     std::map<client_t, std::string> known_clients_;
 
@@ -19,6 +19,7 @@
 #include "routing_manager_base.hpp"
 #include "types.hpp"
 #include "../../protocol/include/protocol.hpp"
+#include "../../utility/include/message_statistics.hpp"
 
 namespace vsomeip_v3 {
 
@@ -83,6 +84,10 @@ public:
             const std::shared_ptr<endpoint_definition> &_target,
             std::shared_ptr<message> _message);
 
+    bool send_to(const client_t _client,
+            const std::shared_ptr<endpoint_definition> &_target,
+            const byte_t *_data, uint32_t _size, instance_t _instance);
+
     bool send_to(const std::shared_ptr<endpoint_definition> &_target,
             const byte_t *_data, uint32_t _size, instance_t _instance);
 
@@ -186,6 +191,7 @@ private:
     void register_application_timeout_cbk(boost::system::error_code const &_error);
 
     void send_registered_ack();
+    void send_resync_routing_info();
 
     void set_routing_state(routing_state_e _routing_state) {
         (void)_routing_state;
@@ -200,6 +206,10 @@ private:
 
     void request_debounce_timeout_cbk(boost::system::error_code const &_error);
 
+    void start_statistics();
+    void stop_statistics();
+    void statistics_timer_cbk(boost::system::error_code const &_error);
+
     void send_request_services(const std::set<protocol::service> &_requests);
 
     void send_unsubscribe_ack(service_t _service, instance_t _instance,
@@ -278,10 +288,20 @@ private:
 
     boost::asio::steady_timer register_application_timer_;
 
+    // Epoch of the last routing info (0 if the routing manager does not send epochs)
+    std::atomic<std::uint32_t> routing_info_epoch_;
+
     std::mutex request_timer_mutex_;
     boost::asio::steady_timer request_debounce_timer_;
     bool request_debounce_timer_running_;
 
+    // Metrics of the application, only written if the statistics of the
+    // process are not already exported by the routing manager
+    std::shared_ptr<message_statistics> message_statistics_;
+    std::mutex statistics_timer_mutex_;
+    boost::asio::steady_timer statistics_timer_;
+    std::string metrics_file_;
+
     const bool client_side_logging_;
     const std::set<std::tuple<service_t, instance_t> > client_side_logging_filter_;
 
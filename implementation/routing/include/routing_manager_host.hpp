@@ -34,6 +34,11 @@ public:
     virtual const std::string & get_name() const = 0;
     virtual std::shared_ptr<configuration> get_configuration() const = 0;
     virtual boost::asio::io_context &get_io() = 0;
+    // I/O context of the network endpoint with the given address/port hash
+    virtual boost::asio::io_context &get_endpoint_io(std::size_t _hash) {
+        (void)_hash;
+        return get_io();
+    }
 
     virtual void on_availability(service_t _service, instance_t _instance,
             availability_state_e _state,
@@ -26,6 +26,7 @@
 #include "../../endpoints/include/netlink_connector.hpp"
 #include "../../service_discovery/include/service_discovery_host.hpp"
 #include "../../endpoints/include/endpoint_manager_impl.hpp"
+#include "../../utility/include/message_statistics.hpp"
 
 namespace vsomeip_v3
 {
@@ -94,6 +95,9 @@ public:
     bool send_to(const client_t _client, const std::shared_ptr<endpoint_definition>& _target,
                  std::shared_ptr<message> _message);
 
+    bool send_to(const client_t _client, const std::shared_ptr<endpoint_definition>& _target,
+                 const byte_t* _data, uint32_t _size, instance_t _instance);
+
     bool send_to(const std::shared_ptr<endpoint_definition>& _target, const byte_t* _data,
                  uint32_t _size, instance_t _instance);
 
@@ -291,6 +295,9 @@ private:
 
     bool is_suppress_event(service_t _service, instance_t _instance, event_t _event) const;
 
+    std::shared_ptr<remote_targets_t> get_remote_targets(const std::shared_ptr<event>& _event,
+                                                         service_t _service, instance_t _instance);
+
     void init_service_info(service_t _service, instance_t _instance, bool _is_local_service);
 
     bool is_field(service_t _service, instance_t _instance, event_t _event) const;
@@ -479,10 +486,8 @@ private:
     std::mutex                statistics_log_timer_mutex_;
     boost::asio::steady_timer statistics_log_timer_;
 
-    std::mutex message_statistics_mutex_;
-    std::map<std::tuple<service_t, instance_t, method_t>, msg_statistic_t> message_statistics_;
-    std::tuple<service_t, instance_t, method_t>                            message_to_discard_;
-    uint32_t ignored_statistics_counter_;
+    std::shared_ptr<message_statistics> message_statistics_;
+    std::uint32_t queue_size_gauge_;
 
     // synchronize update_remote_subscription() and send_(un)subscription()
     std::mutex update_remote_subscription_mutex_;
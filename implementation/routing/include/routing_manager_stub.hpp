@@ -31,6 +31,8 @@
 namespace vsomeip_v3 {
 
 class configuration;
+class local_shm_transport;
+class routing_info_coalescer;
 #if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
 class netlink_connector;
 #endif // __linux__ || ANDROID
@@ -198,6 +200,8 @@ private:
     void send_client_routing_info(const client_t _target,
             std::vector<protocol::routing_info_entry> &&_entries);
     void send_client_credentials(client_t _target, std::set<std::pair<uid_t, gid_t>> &_credentials);
+    void on_routing_info_timer_expired(boost::system::error_code const &_error);
+    void on_resync_routing_info(client_t _client);
 
     void on_client_id_timer_expired(boost::system::error_code const &_error);
 
@@ -253,6 +257,14 @@ private:
     mutable std::mutex routing_info_mutex_;
     std::shared_ptr<configuration> configuration_;
 
+    // Receives large notifications of local clients via shared memory
+    std::shared_ptr<local_shm_transport> shm_;
+
+    // Collects routing info changes (if routing info coalescing is configured)
+    std::shared_ptr<routing_info_coalescer> routing_info_coalescer_;
+    std::mutex routing_info_timer_mutex_;
+    boost::asio::steady_timer routing_info_timer_;
+
     bool is_socket_activated_;
     std::atomic<bool> client_registration_running_;
     std::shared_ptr<std::thread> client_registration_thread_;
@@ -59,7 +59,16 @@ public:
     VSOMEIP_EXPORT void add_remote_ip(std::string _remote_ip);
     VSOMEIP_EXPORT std::set<std::string, std::less<>> get_remote_ip_accepting_sub();
 
+    // Changes whenever a local service info is added to or removed from the
+    // offered services or one of its properties that is announced by service
+    // discovery changes.
+    VSOMEIP_EXPORT static std::uint32_t get_offer_revision();
+    // Must be called after the set of offered services was changed.
+    VSOMEIP_EXPORT static void update_offer_revision();
+
 private:
+    void update_local_offer_revision() const;
+
     service_t service_;
     instance_t instance_;
 
@@ -86,6 +95,8 @@ private:
     std::set<std::string, std::less<>>
             accepting_remote_subscription_from_; // offers sent by unicast
     std::mutex accepting_remote_mutex;
+
+    static std::atomic<std::uint32_t> offer_revision_;
 };
 
 }  // namespace vsomeip_v3
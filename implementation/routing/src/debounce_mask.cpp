@@ -0,0 +1,124 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include <vsomeip/payload.hpp>
+
+#include "../include/debounce_mask.hpp"
+
+namespace vsomeip_v3 {
+
+namespace {
+
+// Returns whether _lhs and _rhs differ in a bit that is set in _mask
+bool is_different(const byte_t* _lhs, const byte_t* _rhs, const byte_t* _mask, std::size_t _length)
+{
+    std::size_t i(0);
+#if defined(__AVX2__)
+    for (; i + 32 <= _length; i += 32)
+    {
+        const __m256i its_lhs  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_lhs + i));
+        const __m256i its_rhs  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_rhs + i));
+        const __m256i its_mask = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_mask + i));
+        if (!_mm256_testz_si256(_mm256_xor_si256(its_lhs, its_rhs), its_mask))
+            return true;
+    }
+#endif
+#if defined(__SSE2__)
+    for (; i + 16 <= _length; i += 16)
+    {
+        const __m128i its_lhs  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_lhs + i));
+        const __m128i its_rhs  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_rhs + i));
+        const __m128i its_mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_mask + i));
+        const __m128i its_diff = _mm_and_si128(_mm_xor_si128(its_lhs, its_rhs), its_mask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(its_diff, _mm_setzero_si128())) != 0xFFFF)
+            return true;
+    }
+#elif defined(__ARM_NEON)
+    for (; i + 16 <= _length; i += 16)
+    {
+        const uint8x16_t its_diff =
+            vandq_u8(veorq_u8(vld1q_u8(_lhs + i), vld1q_u8(_rhs + i)), vld1q_u8(_mask + i));
+        const uint64x2_t its_words = vreinterpretq_u64_u8(its_diff);
+        if ((vgetq_lane_u64(its_words, 0) | vgetq_lane_u64(its_words, 1)) != 0)
+            return true;
+    }
+#endif
+    for (; i + sizeof(std::uint64_t) <= _length; i += sizeof(std::uint64_t))
+    {
+        std::uint64_t its_lhs, its_rhs, its_mask;
+        std::memcpy(&its_lhs, _lhs + i, sizeof(its_lhs));
+        std::memcpy(&its_rhs, _rhs + i, sizeof(its_rhs));
+        std::memcpy(&its_mask, _mask + i, sizeof(its_mask));
+        if ((its_lhs ^ its_rhs) & its_mask)
+            return true;
+    }
+    for (; i < _length; ++i)
+    {
+        if ((_lhs[i] ^ _rhs[i]) & _mask[i])
+            return true;
+    }
+    return false;
+}
+
+} // namespace
+
+debounce_mask::debounce_mask(const std::map<std::size_t, byte_t>& _ignore)
+{
+    if (!_ignore.empty())
+    {
+        mask_.assign(_ignore.rbegin()->first + 1, 0xFF);
+        for (const auto& i : _ignore)
+            mask_[i.first] = static_cast<byte_t>(~i.second);
+    }
+}
+
+bool debounce_mask::operator==(const debounce_mask& _other) const
+{
+    return mask_ == _other.mask_;
+}
+
+bool debounce_mask::is_changed(const payload& _old, const payload& _new) const
+{
+    return is_changed(_old.get_data(), _old.get_length(), _new.get_data(), _new.get_length());
+}
+
+bool debounce_mask::is_changed(const byte_t* _old, std::size_t _old_length, const byte_t* _new,
+                               std::size_t _new_length) const
+{
+    const std::size_t its_min_length = std::min(_old_length, _new_length);
+    const std::size_t its_max_length = std::max(_old_length, _new_length);
+
+    // Additional bytes are a change unless all of their bits are ignored
+    if (its_max_length > its_min_length)
+    {
+        if (its_max_length > mask_.size())
+            return true;
+        if (std::any_of(mask_.begin() + static_cast<std::ptrdiff_t>(its_min_length),
+                        mask_.begin() + static_cast<std::ptrdiff_t>(its_max_length),
+                        [](byte_t _bits) { return _bits != 0; }))
+            return true;
+    }
+
+    const std::size_t its_masked_length = std::min(its_min_length, mask_.size());
+    if (is_different(_old, _new, mask_.data(), its_masked_length))
+        return true;
+
+    return (its_min_length > its_masked_length
+            && std::memcmp(_old + its_masked_length, _new + its_masked_length,
+                           its_min_length - its_masked_length)
+                   != 0);
+}
+
+} // namespace vsomeip_v3
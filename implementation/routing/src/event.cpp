@@ -3,6 +3,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
 #include <chrono>
 #include <iomanip>
 #include <sstream>
@@ -15,10 +16,13 @@
 #include <vsomeip/runtime.hpp>
 #include <vsomeip/internal/logger.hpp>
 
+#include "../include/debounce_mask.hpp"
 #include "../include/event.hpp"
+#include "../include/eventgroupinfo.hpp"
 #include "../include/routing_manager.hpp"
 #include "../../endpoints/include/endpoint_definition.hpp"
 #include "../../message/include/payload_impl.hpp"
+#include "../../utility/include/bithelper.hpp"
 
 namespace vsomeip_v3 {
 
@@ -26,6 +30,7 @@ event::event(routing_manager* _routing, bool _is_shadow)
     : routing_(_routing),
       current_(runtime::get()->create_notification()),
       update_(runtime::get()->create_notification()),
+      frame_(0),
       type_(event_type_e::ET_EVENT),
       cycle_timer_(_routing->get_io()),
       cycle_(std::chrono::milliseconds::zero()),
@@ -50,6 +55,7 @@ void event::set_service(service_t _service)
 {
     current_->set_service(_service);
     update_->set_service(_service);
+    frame_.reset();
 }
 
 instance_t event::get_instance() const
@@ -61,6 +67,7 @@ void event::set_instance(instance_t _instance)
 {
     current_->set_instance(_instance);
     update_->set_instance(_instance);
+    frame_.reset();
 }
 
 major_version_t event::get_version() const
@@ -72,6 +79,7 @@ void event::set_version(major_version_t _major)
 {
     current_->set_interface_version(_major);
     update_->set_interface_version(_major);
+    frame_.reset();
 }
 
 event_t event::get_event() const
@@ -83,6 +91,7 @@ void event::set_event(event_t _event)
 {
     current_->set_method(_event);
     update_->set_method(_event);
+    frame_.reset();
 }
 
 event_type_e event::get_type() const
@@ -215,13 +224,15 @@ bool event::set_payload_notify_pending(const std::shared_ptr<payload>& _payload)
     if (is_provided_ && !is_set_)
     {
         update_->set_payload(_payload);
+        frame_.reset();
         is_set_ = true;
 
         // Send pending initial events.
         for (const auto& its_target : pending_)
         {
-            set_session();
-            routing_->send_to(VSOMEIP_ROUTING_CLIENT, its_target, update_);
+            if (prepare_frame_unlocked())
+                routing_->send_to(VSOMEIP_ROUTING_CLIENT, its_target, frame_.get_data(),
+                                  frame_.get_size(), get_instance());
         }
         pending_.clear();
 
@@ -315,16 +326,22 @@ std::set<eventgroup_t> event::get_eventgroups(client_t _client) const
 
 void event::add_eventgroup(eventgroup_t _eventgroup)
 {
-    std::lock_guard<std::mutex> its_lock(eventgroups_mutex_);
-    if (eventgroups_.find(_eventgroup) == eventgroups_.end())
-        eventgroups_[_eventgroup] = std::set<client_t>();
+    {
+        std::lock_guard<std::mutex> its_lock(eventgroups_mutex_);
+        if (eventgroups_.find(_eventgroup) == eventgroups_.end())
+            eventgroups_[_eventgroup] = std::set<client_t>();
+    }
+    set_remote_targets(nullptr);
 }
 
 void event::set_eventgroups(const std::set<eventgroup_t>& _eventgroups)
 {
-    std::lock_guard<std::mutex> its_lock(eventgroups_mutex_);
-    for (auto e : _eventgroups)
-        eventgroups_[e] = std::set<client_t>();
+    {
+        std::lock_guard<std::mutex> its_lock(eventgroups_mutex_);
+        for (auto e : _eventgroups)
+            eventgroups_[e] = std::set<client_t>();
+    }
+    set_remote_targets(nullptr);
 }
 
 void event::update_cbk(boost::system::error_code const& _error)
@@ -343,8 +360,10 @@ void event::notify(bool _force)
 {
     if (is_set_)
     {
-        set_session();
-        routing_->send(VSOMEIP_ROUTING_CLIENT, update_, _force);
+        if (prepare_frame_unlocked())
+            routing_->send(VSOMEIP_ROUTING_CLIENT, frame_.get_data(), frame_.get_size(),
+                           get_instance(), update_->is_reliable(), routing_->get_client(),
+                           routing_->get_sec_client(), 0, false, _force);
     }
     else
     {
@@ -376,8 +395,9 @@ void event::notify_one_unlocked(client_t                                    _cli
     {
         if (is_set_)
         {
-            set_session();
-            routing_->send_to(_client, _target, update_);
+            if (prepare_frame_unlocked())
+                routing_->send_to(_client, _target, frame_.get_data(), frame_.get_size(),
+                                  get_instance());
         }
         else
         {
@@ -405,8 +425,10 @@ void event::notify_one_unlocked(client_t _client, bool _force)
 {
     if (is_set_)
     {
-        set_session();
-        routing_->send(_client, update_, _force);
+        if (prepare_frame_unlocked())
+            routing_->send(_client, frame_.get_data(), frame_.get_size(), get_instance(),
+                           update_->is_reliable(), routing_->get_client(),
+                           routing_->get_sec_client(), 0, false, _force);
     }
     else
     {
@@ -432,6 +454,7 @@ bool event::prepare_update_payload_unlocked(const std::shared_ptr<payload>& _pay
     }
 
     update_->set_payload(_payload);
+    frame_.reset();
 
     if (!is_set_)
     {
@@ -520,86 +543,18 @@ bool event::add_subscriber(eventgroup_t                                   _event
             VSOMEIP_INFO << "Filter parameters: " << its_filter_parameters.str();
             {
                 std::scoped_lock lk{filters_mutex_};
-                filters_[_client] = [_filter](const std::shared_ptr<payload>& _old,
-                                              const std::shared_ptr<payload>& _new) {
-                    bool is_changed(false), is_elapsed(false);
-
-                    // Check whether we should forward because of changed data
-                    if (_filter->on_change_)
-                    {
-                        length_t its_min_length, its_max_length;
-
-                        if (_old->get_length() < _new->get_length())
-                        {
-                            its_min_length = _old->get_length();
-                            its_max_length = _new->get_length();
-                        }
-                        else
-                        {
-                            its_min_length = _new->get_length();
-                            its_max_length = _old->get_length();
-                        }
-
-                        // Check whether all additional bytes (if any) are excluded
-                        for (length_t i = its_min_length; i < its_max_length; i++)
-                        {
-                            auto j = _filter->ignore_.find(i);
-                            // A change is detected when an additional byte is not
-                            // excluded at all or if its exclusion does not cover all
-                            // bits
-                            if (j == _filter->ignore_.end() || j->second != 0xFF)
-                            {
-                                is_changed = true;
-                                break;
-                            }
-                        }
-
-                        if (!is_changed)
-                        {
-                            const byte_t* its_old = _old->get_data();
-                            const byte_t* its_new = _new->get_data();
-                            for (length_t i = 0; i < its_min_length; i++)
-                            {
-                                auto j = _filter->ignore_.find(i);
-                                if (j == _filter->ignore_.end())
-                                {
-                                    if (its_old[i] != its_new[i])
-                                    {
-                                        is_changed = true;
-                                        break;
-                                    }
-                                }
-                                else if (j->second != 0xFF)
-                                {
-                                    if ((its_old[i] & ~(j->second)) != (its_new[i] & ~(j->second)))
-                                    {
-                                        is_changed = true;
-                                        break;
-                                    }
-                                }
-                            }
-                        }
-                    }
-
-                    if (_filter->interval_ > -1)
+                // Subscribers with equal filters share the mask and thereby the
+                // result of its comparison in get_filtered_subscribers
+                auto its_mask = std::make_shared<const debounce_mask>(_filter->ignore_);
+                for (const auto& f : filters_)
+                {
+                    if (*f.second.mask_ == *its_mask)
                     {
-                        // Check whether we should forward because of the elapsed time since
-                        // we did last time
-                        std::chrono::steady_clock::time_point its_current =
-                            std::chrono::steady_clock::now();
-
-                        int64_t elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-                                              its_current - _filter->last_forwarded_)
-                                              .count();
-                        is_elapsed = (_filter->last_forwarded_
-                                          == std::chrono::steady_clock::time_point::max()
-                                      || elapsed >= _filter->interval_);
-                        if (is_elapsed || (is_changed && _filter->on_change_resets_interval_))
-                            _filter->last_forwarded_ = its_current;
+                        its_mask = f.second.mask_;
+                        break;
                     }
-
-                    return (is_changed || is_elapsed);
-                };
+                }
+                filters_[_client] = {_filter, its_mask};
             }
 
             // Create a new callback for this client if filter interval is used
@@ -689,6 +644,7 @@ std::set<client_t> event::get_filtered_subscribers(bool _force)
     else
     {
         byte_t is_allowed(0xff);
+        std::vector<std::pair<const debounce_mask*, bool>> its_changes;
 
         std::scoped_lock its_lock{filters_mutex_};
         for (const auto s : its_subscribers)
@@ -696,7 +652,23 @@ std::set<client_t> event::get_filtered_subscribers(bool _force)
             auto its_specific = filters_.find(s);
             if (its_specific != filters_.end())
             {
-                if (its_specific->second(its_payload, its_payload_update))
+                const auto& its_filter = its_specific->second;
+                bool        is_changed(false);
+                if (its_filter.filter_->on_change_)
+                {
+                    // Compare once per mask
+                    const debounce_mask* its_mask = its_filter.mask_.get();
+                    auto its_change = std::find_if(its_changes.begin(), its_changes.end(),
+                                                   [its_mask](const auto& _change) {
+                                                       return _change.first == its_mask;
+                                                   });
+                    if (its_change == its_changes.end())
+                        its_change = its_changes.emplace(
+                            its_changes.end(), its_mask,
+                            its_mask->is_changed(*its_payload, *its_payload_update));
+                    is_changed = its_change->second;
+                }
+                if (its_filter.filter_->is_forwarded(is_changed))
                     its_filtered_subscribers.insert(s);
             }
             else
@@ -866,6 +838,42 @@ reliability_type_e event::get_reliability() const
 void event::set_reliability(const reliability_type_e _reliability)
 {
     reliability_ = _reliability;
+    set_remote_targets(nullptr);
+}
+
+std::shared_ptr<remote_targets_t> event::get_remote_targets(uint32_t _revision) const
+{
+    std::shared_ptr<remote_targets_t> its_targets;
+    {
+        std::lock_guard<std::mutex> its_lock(remote_targets_mutex_);
+        its_targets = remote_targets_;
+    }
+
+    if (its_targets && !its_targets->is_valid(_revision))
+        its_targets.reset();
+
+    return its_targets;
+}
+
+void event::set_remote_targets(const std::shared_ptr<remote_targets_t>& _targets)
+{
+    std::lock_guard<std::mutex> its_lock(remote_targets_mutex_);
+    remote_targets_ = _targets;
+}
+
+bool remote_targets_t::is_valid(uint32_t _revision) const
+{
+    if (revision_ != _revision)
+        return false;
+
+    for (const auto& its_eventgroup : eventgroups_)
+    {
+        auto its_info = its_eventgroup.first.lock();
+        if (!its_info || its_info->get_revision() != its_eventgroup.second)
+            return false;
+    }
+
+    return true;
 }
 
 void event::remove_pending(const std::shared_ptr<endpoint_definition>& _target)
@@ -879,4 +887,29 @@ void event::set_session()
     update_->set_session(routing_->get_session(false));
 }
 
+bool event::prepare_frame_unlocked()
+{
+    set_session();
+
+    if (frame_.get_size() == 0)
+    {
+        if (!frame_.serialize(update_.get()))
+        {
+            VSOMEIP_ERROR << "event::" << __func__ << ": Serializing " << std::hex
+                          << std::setw(4) << std::setfill('0') << get_service() << "."
+                          << get_instance() << "." << get_event() << " failed.";
+            frame_.reset();
+            return false;
+        }
+    }
+    else
+    {
+        // The frame may carry session and client of the previous notification
+        auto its_data = const_cast<byte_t*>(frame_.get_data());
+        bithelper::write_uint16_be(update_->get_session(), &its_data[VSOMEIP_SESSION_POS_MIN]);
+        bithelper::write_uint16_be(update_->get_client(), &its_data[VSOMEIP_CLIENT_POS_MIN]);
+    }
+    return true;
+}
+
 } // namespace vsomeip_v3
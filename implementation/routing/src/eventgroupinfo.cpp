@@ -32,7 +32,8 @@ eventgroupinfo::eventgroupinfo()
       id_(PENDING_SUBSCRIPTION_ID),
       reliability_(reliability_type_e::RT_UNKNOWN),
       reliability_auto_mode_(false),
-      max_remote_subscribers_(VSOMEIP_DEFAULT_MAX_REMOTE_SUBSCRIBERS)
+      max_remote_subscribers_(VSOMEIP_DEFAULT_MAX_REMOTE_SUBSCRIBERS),
+      revision_(0)
 {}
 
 eventgroupinfo::eventgroupinfo(const service_t _service, const instance_t _instance,
@@ -48,7 +49,8 @@ eventgroupinfo::eventgroupinfo(const service_t _service, const instance_t _insta
       id_(PENDING_SUBSCRIPTION_ID),
       reliability_(reliability_type_e::RT_UNKNOWN),
       reliability_auto_mode_(false),
-      max_remote_subscribers_(_max_remote_subscribers)
+      max_remote_subscribers_(_max_remote_subscribers),
+      revision_(0)
 {}
 
 eventgroupinfo::~eventgroupinfo() {}
@@ -129,8 +131,12 @@ bool eventgroupinfo::get_multicast(boost::asio::ip::address& _address, uint16_t&
 void eventgroupinfo::set_multicast(const boost::asio::ip::address& _address, uint16_t _port)
 {
     std::lock_guard<std::mutex> its_lock(address_mutex_);
-    address_ = _address;
-    port_    = _port;
+    if (address_ != _address || port_ != _port)
+    {
+        address_ = _address;
+        port_    = _port;
+        revision_++;
+    }
 }
 
 std::set<std::shared_ptr<event>> eventgroupinfo::get_events() const
@@ -236,7 +242,8 @@ uint8_t eventgroupinfo::get_threshold() const
 
 void eventgroupinfo::set_threshold(uint8_t _threshold)
 {
-    threshold_ = _threshold;
+    if (threshold_.exchange(_threshold) != _threshold)
+        revision_++;
 }
 
 std::set<std::shared_ptr<remote_subscription>> eventgroupinfo::get_remote_subscriptions() const
@@ -304,6 +311,7 @@ bool eventgroupinfo::update_remote_subscription(
                         update_id();
                         _subscription->set_id(id_);
                         subscriptions_[id_] = _subscription;
+                        revision_++;
                     }
                     else
                     {
@@ -404,6 +412,7 @@ eventgroupinfo::add_remote_subscription(const std::shared_ptr<remote_subscriptio
 
     _subscription->set_id(id_);
     subscriptions_[id_] = _subscription;
+    revision_++;
 
     boost::asio::ip::address its_address;
     if (_subscription->get_ip_address(its_address))
@@ -446,7 +455,8 @@ void eventgroupinfo::remove_remote_subscription(const remote_subscription_id_t _
         }
     }
 
-    subscriptions_.erase(_id);
+    if (subscriptions_.erase(_id) > 0)
+        revision_++;
 }
 
 void eventgroupinfo::clear_remote_subscriptions()
@@ -454,6 +464,7 @@ void eventgroupinfo::clear_remote_subscriptions()
     std::lock_guard<std::mutex> its_lock(subscriptions_mutex_);
     subscriptions_.clear();
     remote_subscribers_count_.clear();
+    revision_++;
 }
 
 std::set<std::shared_ptr<endpoint_definition>> eventgroupinfo::get_unicast_targets() const
@@ -593,4 +604,9 @@ void eventgroupinfo::set_max_remote_subscribers(uint8_t _max_remote_subscribers)
     max_remote_subscribers_ = _max_remote_subscribers;
 }
 
+uint32_t eventgroupinfo::get_revision() const
+{
+    return revision_;
+}
+
 } // namespace vsomeip_v3
@@ -0,0 +1,156 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+#include <iomanip>
+
+#include <vsomeip/internal/logger.hpp>
+
+#include "../include/routing_info_coalescer.hpp"
+#include "../../protocol/include/routing_info_command.hpp"
+
+namespace vsomeip_v3 {
+
+namespace {
+bool is_service_entry(protocol::routing_info_entry_type_e _type)
+{
+    return (_type == protocol::routing_info_entry_type_e::RIE_ADD_SERVICE_INSTANCE
+            || _type == protocol::routing_info_entry_type_e::RIE_DELETE_SERVICE_INSTANCE);
+}
+} // namespace
+
+routing_info_coalescer::routing_info_coalescer(const sender_t& _sender) : sender_(_sender) { }
+
+bool routing_info_coalescer::add(client_t _target, const protocol::routing_info_entry& _entry)
+{
+    std::lock_guard<std::mutex> its_lock(mutex_);
+    const bool                  was_empty(pending_.empty());
+    auto&                       its_entries = pending_[_target];
+
+    // Merge with the previous change if it is of the same kind and concerns the
+    // same client. Changes are not merged across other changes, as a service
+    // instance may move from one client to another.
+    if (!its_entries.empty() && its_entries.back().get_client() == _entry.get_client()
+        && its_entries.back().get_type() == _entry.get_type())
+    {
+        auto& its_last = its_entries.back();
+        if (is_service_entry(_entry.get_type()))
+        {
+            for (const auto& s : _entry.get_services())
+            {
+                const auto& its_services = its_last.get_services();
+                if (std::find_if(its_services.begin(), its_services.end(),
+                                 [&s](const protocol::service& _other) {
+                                     return _other.service_ == s.service_
+                                         && _other.instance_ == s.instance_
+                                         && _other.major_ == s.major_
+                                         && _other.minor_ == s.minor_;
+                                 })
+                    == its_services.end())
+                {
+                    its_last.add_service(s);
+                }
+            }
+        }
+        if (!_entry.get_address().is_unspecified())
+        {
+            its_last.set_address(_entry.get_address());
+            its_last.set_port(_entry.get_port());
+        }
+    }
+    else
+    {
+        its_entries.emplace_back(_entry);
+    }
+    return was_empty;
+}
+
+void routing_info_coalescer::flush(client_t _client)
+{
+    std::lock_guard<std::mutex> its_lock(mutex_);
+    for (auto& p : pending_)
+    {
+        if (!p.second.empty())
+            send(_client, p.first, std::move(p.second), false);
+    }
+    pending_.clear();
+}
+
+void routing_info_coalescer::flush(client_t _client, client_t _target)
+{
+    std::lock_guard<std::mutex> its_lock(mutex_);
+    auto                        found_target = pending_.find(_target);
+    if (found_target != pending_.end())
+    {
+        if (!found_target->second.empty())
+            send(_client, _target, std::move(found_target->second), false);
+        pending_.erase(found_target);
+    }
+}
+
+void routing_info_coalescer::send_full(client_t _client, client_t _target,
+                                       std::vector<protocol::routing_info_entry>&& _entries)
+{
+    std::lock_guard<std::mutex> its_lock(mutex_);
+    auto                        found_target = pending_.find(_target);
+    if (found_target != pending_.end())
+    {
+        if (!found_target->second.empty())
+            send(_client, _target, std::move(found_target->second), false);
+        pending_.erase(found_target);
+    }
+    send(_client, _target, std::move(_entries), true);
+}
+
+void routing_info_coalescer::remove(client_t _target)
+{
+    std::lock_guard<std::mutex> its_lock(mutex_);
+    pending_.erase(_target);
+    epochs_.erase(_target);
+}
+
+bool routing_info_coalescer::has_pending() const
+{
+    std::lock_guard<std::mutex> its_lock(mutex_);
+    return !pending_.empty();
+}
+
+void routing_info_coalescer::send(client_t _client, client_t _target,
+                                  std::vector<protocol::routing_info_entry>&& _entries,
+                                  bool _is_full)
+{
+    // The epoch is consumed even if the command cannot be sent. Thus, the
+    // client detects the loss with the next command.
+    auto& its_epoch = epochs_[_target];
+    if (++its_epoch == 0)
+        its_epoch = 1;
+
+    protocol::routing_info_command its_command;
+    its_command.set_client(_client);
+    its_command.set_epoch(its_epoch);
+    its_command.set_full(_is_full);
+    its_command.set_entries(std::move(_entries));
+
+    std::vector<byte_t> its_buffer;
+    protocol::error_e   its_error;
+    its_command.serialize(its_buffer, its_error);
+    if (its_error != protocol::error_e::ERROR_OK)
+    {
+        VSOMEIP_ERROR << "routing_info_coalescer::" << __func__
+                      << ": routing info command serialization failed ("
+                      << static_cast<int>(its_error) << ")";
+        return;
+    }
+
+    if (!sender_(_target, its_buffer))
+    {
+        VSOMEIP_WARNING << "routing_info_coalescer::" << __func__
+                        << ": Sending routing info (epoch " << std::dec << its_epoch
+                        << ") to client [" << std::hex << std::setw(4) << std::setfill('0')
+                        << _target << "] failed";
+    }
+}
+
+} // namespace vsomeip_v3
@@ -4,11 +4,14 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <iomanip>
+#include <limits>
 
 #include <vsomeip/runtime.hpp>
 #include <vsomeip/internal/logger.hpp>
 
+#include "../include/debounce_mask.hpp"
 #include "../include/routing_manager_base.hpp"
+#include "../../endpoints/include/local_shm_transport.hpp"
 #include "../../configuration/include/debounce_filter_impl.hpp"
 #include "../../protocol/include/send_command.hpp"
 #include "../../security/include/policy_manager_impl.hpp"
@@ -25,6 +28,7 @@ routing_manager_base::routing_manager_base(routing_manager_host* _host)
     : host_(_host),
       io_(host_->get_io()),
       configuration_(host_->get_configuration()),
+      eventgroups_revision_(0),
       debounce_timer(host_->get_io()),
       routing_state_(routing_state_e::RS_UNKNOWN)
 #ifdef USE_DLT
@@ -41,6 +45,11 @@ routing_manager_base::routing_manager_base(routing_manager_host* _host)
         deserializers_.push(std::make_shared<deserializer>(its_buffer_shrink_threshold));
     }
 
+    if (configuration_->is_local_routing() && configuration_->get_shm_threshold() > 0)
+    {
+        shm_ = std::make_shared<local_shm_transport>(configuration_);
+    }
+
     if (!configuration_->is_local_routing())
     {
         auto its_routing_address = configuration_->get_routing_host_address();
@@ -204,6 +213,11 @@ boost::asio::io_context& routing_manager_base::get_io()
     return io_;
 }
 
+boost::asio::io_context& routing_manager_base::get_endpoint_io(std::size_t _hash)
+{
+    return host_->get_endpoint_io(_hash);
+}
+
 client_t routing_manager_base::get_client() const
 {
     return host_->get_client();
@@ -411,8 +425,12 @@ void routing_manager_base::register_event(
         }
     };
 
-    std::shared_ptr<event> its_event = find_event(_service, _instance, _notifier);
-    bool                   transfer_subscriptions_from_any_event(false);
+    std::shared_ptr<event> its_event;
+    {
+        std::lock_guard<std::mutex> its_lock(events_mutex_);
+        its_event = find_event_unlocked(_service, _instance, _notifier);
+    }
+    bool transfer_subscriptions_from_any_event(false);
     if (its_event)
     {
         if (!its_event->is_cache_placeholder())
@@ -545,83 +563,12 @@ void routing_manager_base::register_event(
                                 << std::setfill('0') << _notifier << "."
                                 << " Debounce parameters: " << its_debounce_parameters.str();
 
-                _epsilon_change_func = [its_debounce](const std::shared_ptr<payload>& _old,
-                                                      const std::shared_ptr<payload>& _new) {
-                    bool is_changed(false), is_elapsed(false);
-
-                    // Check whether we should forward because of changed data
-                    if (its_debounce->on_change_)
-                    {
-                        length_t its_min_length, its_max_length;
-
-                        if (_old->get_length() < _new->get_length())
-                        {
-                            its_min_length = _old->get_length();
-                            its_max_length = _new->get_length();
-                        }
-                        else
-                        {
-                            its_min_length = _new->get_length();
-                            its_max_length = _old->get_length();
-                        }
-
-                        // Check whether all additional bytes (if any) are excluded
-                        for (length_t i = its_min_length; i < its_max_length; i++)
-                        {
-                            auto j = its_debounce->ignore_.find(i);
-                            // A change is detected when an additional byte is not
-                            // excluded at all or if its exclusion does not cover all
-                            // bits
-                            if (j == its_debounce->ignore_.end() || j->second != 0xFF)
-                            {
-                                is_changed = true;
-                                break;
-                            }
-                        }
-
-                        if (!is_changed)
-                        {
-                            const byte_t* its_old = _old->get_data();
-                            const byte_t* its_new = _new->get_data();
-                            for (length_t i = 0; i < its_min_length; i++)
-                            {
-                                auto j = its_debounce->ignore_.find(i);
-                                if (j == its_debounce->ignore_.end())
-                                {
-                                    if (its_old[i] != its_new[i])
-                                    {
-                                        is_changed = true;
-                                        break;
-                                    }
-                                }
-                                else if (j->second != 0xFF)
-                                {
-                                    if ((its_old[i] & ~(j->second)) != (its_new[i] & ~(j->second)))
-                                    {
-                                        is_changed = true;
-                                        break;
-                                    }
-                                }
-                            }
-                        }
-                    }
-
-                    if (its_debounce->interval_ > -1)
-                    {
-                        // Check whether we should forward because of the elapsed time since
-                        // we did last time
-                        std::chrono::steady_clock::time_point its_current =
-                            std::chrono::steady_clock::now();
-                        int64_t elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-                                              its_current - its_debounce->last_forwarded_)
-                                              .count();
-                        is_elapsed = (its_debounce->last_forwarded_
-                                          == std::chrono::steady_clock::time_point::max()
-                                      || elapsed >= its_debounce->interval_);
-                        if (is_elapsed || (is_changed && its_debounce->on_change_resets_interval_))
-                            its_debounce->last_forwarded_ = its_current;
-                    }
-                    return (is_changed || is_elapsed);
+                auto its_mask = std::make_shared<const debounce_mask>(its_debounce->ignore_);
+                _epsilon_change_func = [its_debounce,
+                                        its_mask](const std::shared_ptr<payload>& _old,
+                                                  const std::shared_ptr<payload>& _new) {
+                    return its_debounce->is_forwarded(its_debounce->on_change_
+                                                      && its_mask->is_changed(*_old, *_new));
                 };
 
                 // Create a new callback for this client if filter interval is used
@@ -657,7 +604,11 @@ void routing_manager_base::register_event(
         // check if someone subscribed to ANY_EVENT and the subscription
         // was stored in the cache placeholder. Move the subscribers
         // into new event
-        std::shared_ptr<event> its_any_event = find_event(_service, _instance, ANY_EVENT);
+        std::shared_ptr<event> its_any_event;
+        {
+            std::lock_guard<std::mutex> its_lock(events_mutex_);
+            its_any_event = find_event_unlocked(_service, _instance, ANY_EVENT);
+        }
         if (its_any_event)
         {
             std::set<eventgroup_t> any_events_eventgroups = its_any_event->get_eventgroups();
@@ -681,26 +632,41 @@ void routing_manager_base::register_event(
         its_event->add_ref(_client, _is_provided);
     }
 
-    for (auto eg : _eventgroups)
+    std::vector<std::shared_ptr<eventgroupinfo>> its_eventgroupinfos;
     {
-        std::shared_ptr<eventgroupinfo> its_eventgroupinfo =
-            find_eventgroup(_service, _instance, eg);
-        if (!its_eventgroupinfo)
+        std::lock_guard<std::mutex> its_lock(eventgroups_mutex_);
+        bool                        has_changed(false);
+        for (auto eg : _eventgroups)
         {
-            its_eventgroupinfo = std::make_shared<eventgroupinfo>();
-            its_eventgroupinfo->set_service(_service);
-            its_eventgroupinfo->set_instance(_instance);
-            its_eventgroupinfo->set_eventgroup(eg);
-            its_eventgroupinfo->set_max_remote_subscribers(
-                configuration_->get_max_remote_subscribers());
-            std::lock_guard<std::mutex> its_lock(eventgroups_mutex_);
-            eventgroups_[_service][_instance][eg] = its_eventgroupinfo;
+            std::shared_ptr<eventgroupinfo> its_eventgroupinfo =
+                find_eventgroup_unlocked(_service, _instance, eg);
+            if (!its_eventgroupinfo)
+            {
+                its_eventgroupinfo = std::make_shared<eventgroupinfo>();
+                its_eventgroupinfo->set_service(_service);
+                its_eventgroupinfo->set_instance(_instance);
+                its_eventgroupinfo->set_eventgroup(eg);
+                its_eventgroupinfo->set_max_remote_subscribers(
+                    configuration_->get_max_remote_subscribers());
+                eventgroups_[_service][_instance][eg] = its_eventgroupinfo;
+                eventgroups_revision_++;
+                has_changed = true;
+            }
+            its_eventgroupinfos.push_back(its_eventgroupinfo);
         }
-        its_eventgroupinfo->add_event(its_event);
+        if (has_changed)
+            eventgroups_index_.publish(nullptr);
     }
+    for (const auto& its_eventgroupinfo : its_eventgroupinfos)
+        its_eventgroupinfo->add_event(its_event);
 
     std::lock_guard<std::mutex> its_lock(events_mutex_);
-    events_[_service][_instance][_notifier] = its_event;
+    auto&                       its_registered_event = events_[_service][_instance][_notifier];
+    if (its_registered_event != its_event)
+    {
+        its_registered_event = its_event;
+        events_index_.publish(nullptr);
+    }
 }
 
 void routing_manager_base::unregister_event(client_t _client, service_t _service,
@@ -725,6 +691,7 @@ void routing_manager_base::unregister_event(client_t _client, service_t _service
                     {
                         its_unrefed_event = its_event;
                         found_instance->second.erase(found_event);
+                        events_index_.publish(nullptr);
                     }
                     else if (_is_provided)
                     {
@@ -739,8 +706,11 @@ void routing_manager_base::unregister_event(client_t _client, service_t _service
         auto its_eventgroups = its_unrefed_event->get_eventgroups();
         for (auto eg : its_eventgroups)
         {
-            std::shared_ptr<eventgroupinfo> its_eventgroup_info =
-                find_eventgroup(_service, _instance, eg);
+            std::shared_ptr<eventgroupinfo> its_eventgroup_info;
+            {
+                std::lock_guard<std::mutex> its_lock(eventgroups_mutex_);
+                its_eventgroup_info = find_eventgroup_unlocked(_service, _instance, eg);
+            }
             if (its_eventgroup_info)
             {
                 its_eventgroup_info->remove_event(its_unrefed_event);
@@ -757,22 +727,12 @@ std::set<std::shared_ptr<event>> routing_manager_base::find_events(service_t
                                                                    instance_t   _instance,
                                                                    eventgroup_t _eventgroup) const
 {
-    std::lock_guard<std::mutex>      its_lock(eventgroups_mutex_);
-    std::set<std::shared_ptr<event>> its_events;
-    auto                             found_service = eventgroups_.find(_service);
-    if (found_service != eventgroups_.end())
+    const auto its_info = find_eventgroup_info(_service, _instance, _eventgroup);
+    if (its_info)
     {
-        auto found_instance = found_service->second.find(_instance);
-        if (found_instance != found_service->second.end())
-        {
-            auto found_eventgroup = found_instance->second.find(_eventgroup);
-            if (found_eventgroup != found_instance->second.end())
-            {
-                return found_eventgroup->second->get_events();
-            }
-        }
+        return its_info->get_events();
     }
-    return its_events;
+    return std::set<std::shared_ptr<event>>();
 }
 
 std::vector<event_t> routing_manager_base::find_events(service_t  _service,
@@ -1225,6 +1185,8 @@ routing_manager_base::create_service_info(service_t _service, instance_t _instan
     {
         std::lock_guard<std::mutex> its_lock(services_mutex_);
         services_[_service][_instance] = its_info;
+        if (_is_local_service)
+            serviceinfo::update_offer_revision();
     }
     if (!_is_local_service)
     {
@@ -1279,6 +1241,10 @@ void routing_manager_base::clear_service_info(service_t _service, instance_t _in
                 services_[_service].erase(_instance);
                 deleted_instance = true;
             }
+            // The service info may outlive its removal (e.g. in a pending
+            // stop handler), thus the revision is updated here.
+            if (its_info->is_local())
+                serviceinfo::update_offer_revision();
         }
         else
         {
@@ -1472,22 +1438,123 @@ void routing_manager_base::remove_local(
 std::shared_ptr<event> routing_manager_base::find_event(service_t _service, instance_t _instance,
                                                         event_t _event) const
 {
+    const uint64_t its_key = get_index_key(_service, _instance, _event);
+    {
+        epoch_snapshot<events_index_t>::reader_t its_reader(events_index_);
+        if (its_reader.get())
+        {
+            const auto its_event = its_reader.get()->find(its_key);
+            return (its_event ? *its_event : nullptr);
+        }
+    }
+
     std::lock_guard<std::mutex> its_lock(events_mutex_);
-    std::shared_ptr<event>      its_event;
-    auto                        find_service = events_.find(_service);
-    if (find_service != events_.end())
+    const auto                  its_event = get_events_index_unlocked()->find(its_key);
+    return (its_event ? *its_event : nullptr);
+}
+
+std::shared_ptr<event> routing_manager_base::find_event_unlocked(service_t  _service,
+                                                                 instance_t _instance,
+                                                                 event_t    _event) const
+{
+    auto found_service = events_.find(_service);
+    if (found_service != events_.end())
     {
-        auto find_instance = find_service->second.find(_instance);
-        if (find_instance != find_service->second.end())
+        auto found_instance = found_service->second.find(_instance);
+        if (found_instance != found_service->second.end())
         {
-            auto find_event = find_instance->second.find(_event);
-            if (find_event != find_instance->second.end())
-            {
-                its_event = find_event->second;
-            }
+            auto found_event = found_instance->second.find(_event);
+            if (found_event != found_instance->second.end())
+                return found_event->second;
         }
     }
-    return its_event;
+    return nullptr;
+}
+
+const routing_manager_base::events_index_t* routing_manager_base::get_events_index_unlocked() const
+{
+    auto its_index = events_index_.get_published();
+    if (!its_index)
+    {
+        std::size_t its_count(0);
+        for (const auto& its_service : events_)
+            for (const auto& its_instance : its_service.second)
+                its_count += its_instance.second.size();
+
+        auto its_new_index = new events_index_t(its_count);
+        for (const auto& its_service : events_)
+            for (const auto& its_instance : its_service.second)
+                for (const auto& its_event : its_instance.second)
+                    its_new_index->insert(
+                        get_index_key(its_service.first, its_instance.first, its_event.first),
+                        its_event.second);
+
+        events_index_.publish(its_new_index);
+        its_index = its_new_index;
+    }
+    return its_index;
+}
+
+const routing_manager_base::eventgroups_index_t*
+routing_manager_base::get_eventgroups_index_unlocked() const
+{
+    auto its_index = eventgroups_index_.get_published();
+    if (!its_index)
+    {
+        std::size_t its_count(0);
+        for (const auto& its_service : eventgroups_)
+            for (const auto& its_instance : its_service.second)
+                its_count += its_instance.second.size();
+
+        auto its_new_index = new eventgroups_index_t(its_count);
+        for (const auto& its_service : eventgroups_)
+            for (const auto& its_instance : its_service.second)
+                for (const auto& its_eventgroup : its_instance.second)
+                    its_new_index->insert(
+                        get_index_key(its_service.first, its_instance.first, its_eventgroup.first),
+                        its_eventgroup.second);
+
+        eventgroups_index_.publish(its_new_index);
+        its_index = its_new_index;
+    }
+    return its_index;
+}
+
+std::shared_ptr<eventgroupinfo>
+routing_manager_base::find_eventgroup_info(service_t _service, instance_t _instance,
+                                           eventgroup_t _eventgroup) const
+{
+    const uint64_t its_key = get_index_key(_service, _instance, _eventgroup);
+    {
+        epoch_snapshot<eventgroups_index_t>::reader_t its_reader(eventgroups_index_);
+        if (its_reader.get())
+        {
+            const auto its_info = its_reader.get()->find(its_key);
+            return (its_info ? *its_info : nullptr);
+        }
+    }
+
+    std::lock_guard<std::mutex> its_lock(eventgroups_mutex_);
+    const auto                  its_info = get_eventgroups_index_unlocked()->find(its_key);
+    return (its_info ? *its_info : nullptr);
+}
+
+std::shared_ptr<eventgroupinfo>
+routing_manager_base::find_eventgroup_unlocked(service_t _service, instance_t _instance,
+                                               eventgroup_t _eventgroup) const
+{
+    auto found_service = eventgroups_.find(_service);
+    if (found_service != eventgroups_.end())
+    {
+        auto found_instance = found_service->second.find(_instance);
+        if (found_instance != found_service->second.end())
+        {
+            auto found_eventgroup = found_instance->second.find(_eventgroup);
+            if (found_eventgroup != found_instance->second.end())
+                return found_eventgroup->second;
+        }
+    }
+    return nullptr;
 }
 
 std::set<std::shared_ptr<eventgroupinfo>>
@@ -1514,49 +1581,37 @@ std::shared_ptr<eventgroupinfo>
 routing_manager_base::find_eventgroup(service_t _service, instance_t _instance,
                                       eventgroup_t _eventgroup) const
 {
-    std::lock_guard<std::mutex> its_lock(eventgroups_mutex_);
-
-    std::shared_ptr<eventgroupinfo> its_info(nullptr);
-    auto                            found_service = eventgroups_.find(_service);
-    if (found_service != eventgroups_.end())
+    std::shared_ptr<eventgroupinfo> its_info =
+        find_eventgroup_info(_service, _instance, _eventgroup);
+    if (its_info)
     {
-        auto found_instance = found_service->second.find(_instance);
-        if (found_instance != found_service->second.end())
+        std::shared_ptr<serviceinfo> its_service_info = find_service(_service, _instance);
+        if (its_service_info)
         {
-            auto found_eventgroup = found_instance->second.find(_eventgroup);
-            if (found_eventgroup != found_instance->second.end())
+            std::string its_multicast_address;
+            uint16_t    its_multicast_port;
+            if (configuration_->get_multicast(_service, _instance, _eventgroup,
+                                              its_multicast_address, its_multicast_port))
             {
-                its_info                                      = found_eventgroup->second;
-                std::shared_ptr<serviceinfo> its_service_info = find_service(_service, _instance);
-                if (its_service_info)
+                try
                 {
-                    std::string its_multicast_address;
-                    uint16_t    its_multicast_port;
-                    if (configuration_->get_multicast(_service, _instance, _eventgroup,
-                                                      its_multicast_address, its_multicast_port))
-                    {
-                        try
-                        {
-                            its_info->set_multicast(
-                                boost::asio::ip::address::from_string(its_multicast_address),
-                                its_multicast_port);
-                        } catch (...)
-                        {
-                            VSOMEIP_ERROR << "Eventgroup [" << std::hex << std::setw(4)
-                                          << std::setfill('0') << _service << "." << _instance
-                                          << "." << _eventgroup
-                                          << "] is configured as multicast, but no valid "
-                                             "multicast address is configured!";
-                        }
-                    }
-
-                    // LB: THIS IS STRANGE. A "FIND" - METHOD SHOULD NOT ADD INFORMATION...
-                    its_info->set_major(its_service_info->get_major());
-                    its_info->set_ttl(its_service_info->get_ttl());
-                    its_info->set_threshold(
-                        configuration_->get_threshold(_service, _instance, _eventgroup));
+                    its_info->set_multicast(
+                        boost::asio::ip::address::from_string(its_multicast_address),
+                        its_multicast_port);
+                } catch (...)
+                {
+                    VSOMEIP_ERROR << "Eventgroup [" << std::hex << std::setw(4) << std::setfill('0')
+                                  << _service << "." << _instance << "." << _eventgroup
+                                  << "] is configured as multicast, but no valid "
+                                     "multicast address is configured!";
                 }
             }
+
+            // LB: THIS IS STRANGE. A "FIND" - METHOD SHOULD NOT ADD INFORMATION...
+            its_info->set_major(its_service_info->get_major());
+            its_info->set_ttl(its_service_info->get_ttl());
+            its_info->set_threshold(
+                configuration_->get_threshold(_service, _instance, _eventgroup));
         }
     }
     return its_info;
@@ -1572,7 +1627,11 @@ void routing_manager_base::remove_eventgroup_info(service_t _service, instance_t
         auto found_instance = found_service->second.find(_instance);
         if (found_instance != found_service->second.end())
         {
-            found_instance->second.erase(_eventgroup);
+            if (found_instance->second.erase(_eventgroup) > 0)
+            {
+                eventgroups_revision_++;
+                eventgroups_index_.publish(nullptr);
+            }
         }
     }
 }
@@ -1593,6 +1652,10 @@ bool routing_manager_base::send_local_notification(client_t _client, const byte_
     std::shared_ptr<event> its_event = find_event(its_service, _instance, its_method);
     if (its_event && !its_event->is_shadow())
     {
+        // The command is serialized once and the resulting buffer is shared
+        // by all local subscribers. As for notify_one, the target field
+        // contains the sending client, it is not evaluated by the receivers.
+        std::vector<std::shared_ptr<endpoint>> its_targets;
         for (auto its_client : its_event->get_filtered_subscribers(_force))
         {
             // local
@@ -1610,9 +1673,40 @@ bool routing_manager_base::send_local_notification(client_t _client, const byte_
 
             std::shared_ptr<endpoint> its_local_target = ep_mgr_->find_local(its_client);
             if (its_local_target)
+                its_targets.emplace_back(std::move(its_local_target));
+        }
+
+        if (!its_targets.empty())
+        {
+            // Large messages are written to shared memory once, only a
+            // descriptor of the slot is sent to the subscribers.
+            message_buffer_ptr_t its_buffer;
+            if (shm_ && _size >= shm_->get_threshold()
+                && its_targets.size() <= std::numeric_limits<std::uint16_t>::max())
             {
-                send_local(its_local_target, its_client, _data, _size, _instance, _reliable,
-                           protocol::id_e::SEND_ID, _status_check);
+                its_buffer = shm_->serialize(get_client(), _data, _size, _instance, _reliable,
+                                             _status_check,
+                                             static_cast<std::uint16_t>(its_targets.size()));
+                if (its_buffer)
+                {
+                    for (const auto& t : its_targets)
+                    {
+                        if (!t->send_shared(its_buffer))
+                            shm_->release(*its_buffer);
+                    }
+                    its_targets.clear();
+                }
+            }
+
+            if (!its_targets.empty())
+            {
+                its_buffer = serialize_local(get_client(), _data, _size, _instance, _reliable,
+                                             protocol::id_e::SEND_ID, _status_check);
+                if (its_buffer)
+                {
+                    for (const auto& t : its_targets)
+                        t->send_shared(its_buffer);
+                }
             }
         }
     }
@@ -1635,23 +1729,37 @@ bool routing_manager_base::send_local(std::shared_ptr<endpoint>& _target, client
 {
     bool has_sent(false);
 
+    auto its_buffer =
+        serialize_local(_client, _data, _size, _instance, _reliable, _command, _status_check);
+    if (its_buffer)
+    {
+        has_sent = _target->send_shared(its_buffer);
+    }
+
+    return has_sent;
+}
+
+message_buffer_ptr_t routing_manager_base::serialize_local(client_t _target, const byte_t* _data,
+                                                           uint32_t _size, instance_t _instance,
+                                                           bool _reliable, protocol::id_e _command,
+                                                           uint8_t _status_check) const
+{
     protocol::send_command its_command(_command);
     its_command.set_client(get_client());
     its_command.set_instance(_instance);
     its_command.set_reliable(_reliable);
     its_command.set_status(_status_check);
-    its_command.set_target(_client);
-    its_command.set_message(std::vector<byte_t>(_data, _data + _size));
+    its_command.set_target(_target);
 
-    std::vector<byte_t> its_buffer;
-    protocol::error_e   its_error;
-    its_command.serialize(its_buffer, its_error);
-    if (its_error == protocol::error_e::ERROR_OK)
+    auto              its_buffer = std::make_shared<message_buffer_t>();
+    protocol::error_e its_error;
+    its_command.serialize(_data, _size, *its_buffer, its_error);
+    if (its_error != protocol::error_e::ERROR_OK)
     {
-        has_sent = _target->send(&its_buffer[0], uint32_t(its_buffer.size()));
+        its_buffer.reset();
     }
 
-    return has_sent;
+    return its_buffer;
 }
 
 bool routing_manager_base::insert_subscription(
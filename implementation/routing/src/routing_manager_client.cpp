@@ -27,6 +27,7 @@
 #include "../include/routing_manager_host.hpp"
 #include "../include/routing_manager_client.hpp"
 #include "../../configuration/include/configuration.hpp"
+#include "../../endpoints/include/local_shm_transport.hpp"
 #include "../../endpoints/include/netlink_connector.hpp"
 #include "../../message/include/deserializer.hpp"
 #include "../../message/include/message_impl.hpp"
@@ -51,6 +52,7 @@
 #include "../../protocol/include/remove_security_policy_response_command.hpp"
 #include "../../protocol/include/request_service_command.hpp"
 #include "../../protocol/include/resend_provided_events_command.hpp"
+#include "../../protocol/include/resync_routing_info_command.hpp"
 #include "../../protocol/include/routing_info_command.hpp"
 #include "../../protocol/include/send_command.hpp"
 #include "../../protocol/include/stop_offer_service_command.hpp"
@@ -89,8 +91,11 @@ routing_manager_client::routing_manager_client(
       sender_(nullptr),
       receiver_(nullptr),
       register_application_timer_(io_),
+      routing_info_epoch_(0),
       request_debounce_timer_(io_),
       request_debounce_timer_running_(false),
+      message_statistics_(message_statistics::get()),
+      statistics_timer_(io_),
       client_side_logging_(_client_side_logging),
       client_side_logging_filter_(_client_side_logging_filter)
 #if defined(__linux__) || defined(ANDROID)
@@ -149,6 +154,8 @@ void routing_manager_client::init()
 
 void routing_manager_client::start()
 {
+    start_statistics();
+
 #if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
     if (configuration_->is_local_routing())
     {
@@ -226,6 +233,8 @@ void routing_manager_client::stop()
         request_debounce_timer_.cancel();
     }
 
+    stop_statistics();
+
     if (receiver_)
     {
         receiver_->stop();
@@ -1079,6 +1088,19 @@ bool routing_manager_client::send_to(const client_t
     return false;
 }
 
+bool routing_manager_client::send_to(const client_t                              _client,
+                                     const std::shared_ptr<endpoint_definition>& _target,
+                                     const byte_t* _data, uint32_t _size, instance_t _instance)
+{
+    (void)_client;
+    (void)_target;
+    (void)_data;
+    (void)_size;
+    (void)_instance;
+
+    return false;
+}
+
 bool routing_manager_client::send_to(const std::shared_ptr<endpoint_definition>& _target,
                                      const byte_t* _data, uint32_t _size, instance_t _instance)
 {
@@ -1152,8 +1174,26 @@ void routing_manager_client::on_message(const byte_t* _data, length_t _size, end
 #ifndef VSOMEIP_DISABLE_SECURITY
     bool is_internal_policy_update(false);
 #endif // !VSOMEIP_DISABLE_SECURITY
-    std::vector<byte_t> its_buffer(_data, _data + _size);
-    protocol::error_e   its_error;
+    // Shared, as the payloads of received messages reference it
+    auto                 its_data = std::make_shared<std::vector<byte_t>>();
+    std::vector<byte_t>& its_buffer(*its_data);
+    protocol::error_e    its_error;
+
+    if (_size > 0 && _data[0] == static_cast<byte_t>(protocol::id_e::SEND_SHM_ID))
+    {
+        // Large notifications are copied from the shared memory of the sender
+        if (!shm_ || !shm_->deserialize(_data, _size, its_buffer))
+        {
+            VSOMEIP_WARNING << "routing_manager_client::on_message: Client 0x" << std::hex
+                            << std::setw(4) << std::setfill('0') << get_client()
+                            << " dropped a message that was sent via shared memory.";
+            return;
+        }
+    }
+    else
+    {
+        its_buffer.assign(_data, _data + _size);
+    }
 
     auto its_policy_manager = configuration_->get_policy_manager();
     if (!its_policy_manager)
@@ -1203,11 +1243,12 @@ void routing_manager_client::on_message(const byte_t* _data, length_t _size, end
         {
         case protocol::id_e::SEND_ID: {
             protocol::send_command its_send_command(protocol::id_e::SEND_ID);
-            its_send_command.deserialize(its_buffer, its_error);
+            size_t                 its_offset(0);
+            its_send_command.deserialize(its_buffer, its_offset, its_error);
             if (its_error == protocol::error_e::ERROR_OK)
             {
                 auto a_deserializer = get_deserializer();
-                a_deserializer->set_data(its_send_command.get_message());
+                a_deserializer->set_view(its_data, its_offset, its_buffer.size() - its_offset);
                 std::shared_ptr<message_impl> its_message(a_deserializer->deserialize_message());
                 a_deserializer->reset();
                 put_deserializer(a_deserializer);
@@ -1409,7 +1450,7 @@ void routing_manager_client::on_message(const byte_t* _data, length_t _size, end
                                 its_message_size = 0;
 
                             tc_->trace(its_header.data_, VSOMEIP_TRACE_HEADER_SIZE,
-                                       &_data[vsomeip_v3::protocol::SEND_COMMAND_HEADER_SIZE],
+                                       &its_buffer[vsomeip_v3::protocol::SEND_COMMAND_HEADER_SIZE],
                                        its_message_size);
                         }
                     }
@@ -2070,7 +2111,50 @@ void routing_manager_client::on_routing_info(const byte_t* _data, uint32_t _size
         return;
     }
 
-    for (const auto& e : its_command.get_entries())
+    std::vector<protocol::routing_info_entry> its_entries;
+    if (its_command.get_version() >= protocol::ROUTING_INFO_EPOCH_VERSION)
+    {
+        const auto its_epoch      = its_command.get_epoch();
+        const auto its_last_epoch = routing_info_epoch_.exchange(its_epoch);
+        if (its_command.is_full())
+        {
+            // Service instances that are missing in the complete routing info
+            // were stopped while the routing info was out of sync.
+            std::set<std::pair<service_t, instance_t>> its_services;
+            for (const auto& e : its_command.get_entries())
+                for (const auto& s : e.get_services())
+                    its_services.insert(std::make_pair(s.service_, s.instance_));
+
+            std::lock_guard<std::mutex> its_lock(local_services_mutex_);
+            for (const auto& s : local_services_)
+            {
+                for (const auto& i : s.second)
+                {
+                    if (its_services.find(std::make_pair(s.first, i.first)) == its_services.end())
+                    {
+                        protocol::routing_info_entry its_entry;
+                        its_entry.set_type(
+                            protocol::routing_info_entry_type_e::RIE_DELETE_SERVICE_INSTANCE);
+                        its_entry.set_client(std::get<2>(i.second));
+                        its_entry.add_service({s.first, i.first, std::get<0>(i.second),
+                                               std::get<1>(i.second)});
+                        its_entries.emplace_back(its_entry);
+                    }
+                }
+            }
+        }
+        else if (its_last_epoch != 0 && its_epoch != 1 && its_epoch != its_last_epoch + 1)
+        {
+            VSOMEIP_WARNING << __func__ << ": Missed routing info (epoch " << std::dec
+                            << its_last_epoch << " --> " << its_epoch
+                            << "). Requesting resync.";
+            send_resync_routing_info();
+        }
+    }
+    its_entries.insert(its_entries.end(), its_command.get_entries().begin(),
+                       its_command.get_entries().end());
+
+    for (const auto& e : its_entries)
     {
         auto its_client = e.get_client();
         switch (e.get_type())
@@ -2488,7 +2572,8 @@ void routing_manager_client::register_application()
             std::lock_guard<std::mutex> its_lock(sender_mutex_);
             if (sender_)
             {
-                state_ = inner_state_type_e::ST_REGISTERING;
+                state_              = inner_state_type_e::ST_REGISTERING;
+                routing_info_epoch_ = 0;
                 sender_->send(&its_buffer[0], uint32_t(its_buffer.size()));
 
                 register_application_timer_.cancel();
@@ -3048,6 +3133,28 @@ void routing_manager_client::send_registered_ack()
                       << int(its_error) << ")";
 }
 
+void routing_manager_client::send_resync_routing_info()
+{
+    protocol::resync_routing_info_command its_command;
+    its_command.set_client(get_client());
+
+    std::vector<byte_t> its_buffer;
+    protocol::error_e   its_error;
+    its_command.serialize(its_buffer, its_error);
+
+    if (its_error == protocol::error_e::ERROR_OK)
+    {
+        std::lock_guard<std::mutex> its_lock(sender_mutex_);
+        if (sender_)
+        {
+            sender_->send(&its_buffer[0], uint32_t(its_buffer.size()));
+        }
+    }
+    else
+        VSOMEIP_ERROR << __func__ << ": resync routing info command serialization failed ("
+                      << std::dec << int(its_error) << ")";
+}
+
 bool routing_manager_client::is_client_known(client_t _client)
 {
     std::lock_guard<std::mutex> its_lock(known_clients_mutex_);
@@ -3120,6 +3227,63 @@ void routing_manager_client::request_debounce_timeout_cbk(boost::system::error_c
     }
 }
 
+void routing_manager_client::start_statistics()
+{
+    const std::string& its_metrics_file = configuration_->get_statistics_metrics_file();
+    if (!configuration_->log_statistics() || its_metrics_file.empty())
+        return;
+
+    std::lock_guard<std::mutex> its_lock(statistics_timer_mutex_);
+    // Already started or exported by the routing manager (or another
+    // application) of this process
+    if (!metrics_file_.empty() || message_statistics_->is_enabled())
+        return;
+
+    metrics_file_ = its_metrics_file + "." + host_->get_name();
+    message_statistics_->set_max_messages(configuration_->get_statistics_max_messages());
+    message_statistics_->enable(true);
+
+    boost::system::error_code ec;
+    statistics_timer_.expires_from_now(
+        std::chrono::milliseconds(std::max(configuration_->get_statistics_interval(), 1000u)), ec);
+    statistics_timer_.async_wait(
+        std::bind(&routing_manager_client::statistics_timer_cbk,
+                  std::dynamic_pointer_cast<routing_manager_client>(shared_from_this()),
+                  std::placeholders::_1));
+}
+
+void routing_manager_client::stop_statistics()
+{
+    std::lock_guard<std::mutex> its_lock(statistics_timer_mutex_);
+    if (metrics_file_.empty())
+        return;
+
+    boost::system::error_code ec;
+    statistics_timer_.cancel(ec);
+    message_statistics_->disable(true);
+    metrics_file_.clear();
+}
+
+void routing_manager_client::statistics_timer_cbk(boost::system::error_code const& _error)
+{
+    std::lock_guard<std::mutex> its_lock(statistics_timer_mutex_);
+    if (_error || metrics_file_.empty())
+        return;
+
+    // Applications do not log the intervals, they only close them
+    std::uint64_t its_ignored(0);
+    message_statistics_->rotate(its_ignored);
+    message_statistics_->write(metrics_file_);
+
+    boost::system::error_code ec;
+    statistics_timer_.expires_from_now(
+        std::chrono::milliseconds(std::max(configuration_->get_statistics_interval(), 1000u)), ec);
+    statistics_timer_.async_wait(
+        std::bind(&routing_manager_client::statistics_timer_cbk,
+                  std::dynamic_pointer_cast<routing_manager_client>(shared_from_this()),
+                  std::placeholders::_1));
+}
+
 void routing_manager_client::register_client_error_handler(
     client_t _client, const std::shared_ptr<endpoint>& _endpoint)
 {
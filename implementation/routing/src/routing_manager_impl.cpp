@@ -86,7 +86,8 @@ routing_manager_impl::routing_manager_impl(routing_manager_host* _host)
       pending_remote_offer_id_(0),
       last_resume_(std::chrono::steady_clock::now().min()),
       statistics_log_timer_(_host->get_io()),
-      ignored_statistics_counter_(0)
+      message_statistics_(message_statistics::get()),
+      queue_size_gauge_(0)
 {}
 
 routing_manager_impl::~routing_manager_impl()
@@ -300,6 +301,25 @@ void routing_manager_impl::start()
 
     if (configuration_->log_statistics())
     {
+        message_statistics_->set_max_messages(configuration_->get_statistics_max_messages());
+        // Handler latencies are only exported as metrics
+        message_statistics_->enable(!configuration_->get_statistics_metrics_file().empty());
+        std::weak_ptr<endpoint_manager_impl> its_ep_mgr(ep_mgr_impl_);
+        queue_size_gauge_ = message_statistics_->add_gauge(
+            "vsomeip_server_queue_bytes",
+            [its_ep_mgr](std::vector<std::pair<std::string, std::uint64_t>>& _values) {
+                if (auto its_manager = its_ep_mgr.lock())
+                {
+                    for (const auto& q : its_manager->get_server_queue_sizes())
+                    {
+                        _values.emplace_back("port=\"" + std::to_string(q.first.first)
+                                                 + "\",protocol=\""
+                                                 + (q.first.second ? "tcp" : "udp") + "\"",
+                                             q.second);
+                    }
+                }
+            });
+
         std::lock_guard<std::mutex> its_lock(statistics_log_timer_mutex_);
         boost::system::error_code   ec;
         statistics_log_timer_.expires_from_now(std::chrono::seconds(0), ec);
@@ -361,6 +381,11 @@ void routing_manager_impl::stop()
         boost::system::error_code   ec;
         statistics_log_timer_.cancel(ec);
     }
+    if (configuration_->log_statistics())
+    {
+        message_statistics_->disable(!configuration_->get_statistics_metrics_file().empty());
+        message_statistics_->remove_gauge(queue_size_gauge_);
+    }
 
     host_->on_state(state_type_e::ST_DEREGISTERED);
 
@@ -1040,8 +1065,6 @@ bool routing_manager_impl::send(client_t _client, const byte_t* _data, length_t
             }
             else
             {
-                e2e_buffer its_buffer;
-
                 if (e2e_provider_)
                 {
                     if (!is_service_discovery)
@@ -1057,16 +1080,15 @@ bool routing_manager_impl::send(client_t _client, const byte_t* _data, length_t
                             size_t its_base =
                                 e2e_provider_->get_protection_base({its_service, its_method});
 
-                            // Build a corresponding buffer
-                            its_buffer.assign(_data + its_base, _data + _size);
-
-                            e2e_provider_->protect({its_service, its_method}, its_buffer,
-                                                   _instance);
-
-                            // Prepend header
-                            its_buffer.insert(its_buffer.begin(), _data, _data + its_base);
-
-                            _data = its_buffer.data();
+                            // Protect in place. The data is owned by the sender's
+                            // serializer (or receive buffer) and is copied by the
+                            // endpoints, so there is no need for an own buffer.
+                            if (its_base <= _size)
+                                e2e_provider_->protect(
+                                    {its_service, its_method},
+                                    buffer_span(const_cast<byte_t*>(_data) + its_base,
+                                                _size - its_base),
+                                    _instance);
                         }
 #endif
                     }
@@ -1113,7 +1135,6 @@ bool routing_manager_impl::send(client_t _client, const byte_t* _data, length_t
 #ifdef USE_DLT
                                 bool has_sent(false);
 #endif
-                                std::set<std::shared_ptr<endpoint_definition>> its_targets;
                                 // we need both endpoints as clients can subscribe to events via TCP
                                 // and UDP
                                 std::shared_ptr<endpoint> its_udp_server_endpoint =
@@ -1123,81 +1144,38 @@ bool routing_manager_impl::send(client_t _client, const byte_t* _data, length_t
 
                                 if (its_udp_server_endpoint || its_tcp_server_endpoint)
                                 {
-                                    const auto its_reliability = its_event->get_reliability();
-                                    for (auto its_group : its_event->get_eventgroups())
+                                    const auto its_targets =
+                                        get_remote_targets(its_event, its_service, _instance);
+                                    if (its_tcp_server_endpoint)
                                     {
-                                        auto its_eventgroup =
-                                            find_eventgroup(its_service, _instance, its_group);
-                                        if (its_eventgroup)
+                                        for (const auto& its_target : its_targets->reliable_)
                                         {
-                                            // Unicast targets
-                                            for (const auto& its_remote :
-                                                 its_eventgroup->get_unicast_targets())
-                                            {
-                                                if (its_remote->is_reliable()
-                                                    && its_tcp_server_endpoint)
-                                                {
-                                                    if (its_reliability
-                                                            == reliability_type_e::RT_RELIABLE
-                                                        || its_reliability
-                                                               == reliability_type_e::RT_BOTH)
-                                                    {
-                                                        its_targets.insert(its_remote);
-                                                    }
-                                                }
-                                                else if (its_udp_server_endpoint
-                                                         && !its_eventgroup->is_sending_multicast())
-                                                {
-                                                    if (its_reliability
-                                                            == reliability_type_e::RT_UNRELIABLE
-                                                        || its_reliability
-                                                               == reliability_type_e::RT_BOTH)
-                                                    {
-                                                        its_targets.insert(its_remote);
-                                                    }
-                                                }
-                                            }
-                                            // Send to multicast targets if subscribers are still
-                                            // interested
-                                            if (its_eventgroup->is_sending_multicast())
-                                            {
-                                                if (its_reliability
-                                                        == reliability_type_e::RT_UNRELIABLE
-                                                    || its_reliability
-                                                           == reliability_type_e::RT_BOTH)
-                                                {
-                                                    boost::asio::ip::address its_address;
-                                                    uint16_t                 its_port;
-                                                    if (its_eventgroup->get_multicast(its_address,
-                                                                                      its_port))
-                                                    {
-                                                        std::shared_ptr<endpoint_definition>
-                                                            its_multicast_target;
-                                                        its_multicast_target =
-                                                            endpoint_definition::get(
-                                                                its_address, its_port, false,
-                                                                its_service, _instance);
-                                                        its_targets.insert(its_multicast_target);
-                                                    }
-                                                }
-                                            }
+                                            its_tcp_server_endpoint->send_to(its_target, _data,
+                                                                             _size);
+#ifdef USE_DLT
+                                            has_sent = true;
+#endif
                                         }
                                     }
-                                }
-
-                                for (auto const& target : its_targets)
-                                {
-                                    if (target->is_reliable())
+                                    if (its_udp_server_endpoint)
                                     {
-                                        its_tcp_server_endpoint->send_to(target, _data, _size);
-                                    }
-                                    else
-                                    {
-                                        its_udp_server_endpoint->send_to(target, _data, _size);
-                                    }
+                                        for (const auto& its_target : its_targets->unreliable_)
+                                        {
+                                            its_udp_server_endpoint->send_to(its_target, _data,
+                                                                             _size);
 #ifdef USE_DLT
-                                    has_sent = true;
+                                            has_sent = true;
 #endif
+                                        }
+                                        for (const auto& its_target : its_targets->multicast_)
+                                        {
+                                            its_udp_server_endpoint->send_to(its_target, _data,
+                                                                             _size);
+#ifdef USE_DLT
+                                            has_sent = true;
+#endif
+                                        }
+                                    }
                                 }
 #ifdef USE_DLT
                                 if (has_sent)
@@ -1275,41 +1253,84 @@ bool routing_manager_impl::send(client_t _client, const byte_t* _data, length_t
     return is_sent;
 }
 
-bool routing_manager_impl::send_to(const client_t                              _client,
-                                   const std::shared_ptr<endpoint_definition>& _target,
-                                   std::shared_ptr<message>                    _message)
+std::shared_ptr<remote_targets_t>
+routing_manager_impl::get_remote_targets(const std::shared_ptr<event>& _event, service_t _service,
+                                         instance_t _instance)
 {
-    bool is_sent(false);
+    // Read the revision before collecting the targets. Concurrent changes
+    // then lead to a rebuild on the next call instead of a stale plan.
+    const uint32_t its_revision = eventgroups_revision_;
 
-    std::shared_ptr<serializer> its_serializer(get_serializer());
-    if (its_serializer->serialize(_message.get()))
+    auto its_targets = _event->get_remote_targets(its_revision);
+    if (its_targets)
+        return its_targets;
+
+    its_targets            = std::make_shared<remote_targets_t>();
+    its_targets->revision_ = its_revision;
+
+    const auto its_reliability = _event->get_reliability();
+    const bool is_reliable     = (its_reliability == reliability_type_e::RT_RELIABLE
+                              || its_reliability == reliability_type_e::RT_BOTH);
+    const bool is_unreliable   = (its_reliability == reliability_type_e::RT_UNRELIABLE
+                                || its_reliability == reliability_type_e::RT_BOTH);
+
+    std::set<std::shared_ptr<endpoint_definition>> its_reliable, its_unreliable, its_multicast;
+    for (auto its_group : _event->get_eventgroups())
     {
-        const byte_t* its_data = its_serializer->get_data();
-        length_t      its_size = its_serializer->get_size();
-        e2e_buffer    its_buffer;
-        if (e2e_provider_)
+        auto its_eventgroup = find_eventgroup(_service, _instance, its_group);
+        if (!its_eventgroup)
+            continue;
+
+        its_targets->eventgroups_.emplace_back(its_eventgroup, its_eventgroup->get_revision());
+
+        const bool is_sending_multicast = its_eventgroup->is_sending_multicast();
+
+        // Unicast targets
+        for (const auto& its_remote : its_eventgroup->get_unicast_targets())
         {
-            service_t its_service = bithelper::read_uint16_be(&its_data[VSOMEIP_SERVICE_POS_MIN]);
-            method_t  its_method  = bithelper::read_uint16_be(&its_data[VSOMEIP_METHOD_POS_MIN]);
-#ifndef ANDROID
-            if (e2e_provider_->is_protected({its_service, its_method}))
+            if (its_remote->is_reliable())
             {
-                auto its_base = e2e_provider_->get_protection_base({its_service, its_method});
-                its_buffer.assign(its_data + its_base, its_data + its_size);
-                e2e_provider_->protect({its_service, its_method}, its_buffer,
-                                       _message->get_instance());
-                its_buffer.insert(its_buffer.begin(), its_data, its_data + its_base);
-                its_data = its_buffer.data();
+                if (is_reliable)
+                    its_reliable.insert(its_remote);
+            }
+            else if (is_unreliable && !is_sending_multicast)
+            {
+                its_unreliable.insert(its_remote);
             }
-#endif
         }
 
-        uint8_t its_client[2] = {0};
-        bithelper::write_uint16_le(_client, its_client);
-        const_cast<byte_t*>(its_data)[VSOMEIP_CLIENT_POS_MIN] = its_client[1];
-        const_cast<byte_t*>(its_data)[VSOMEIP_CLIENT_POS_MAX] = its_client[0];
+        // Send to multicast targets if subscribers are still interested
+        if (is_unreliable && is_sending_multicast)
+        {
+            boost::asio::ip::address its_address;
+            uint16_t                 its_port;
+            if (its_eventgroup->get_multicast(its_address, its_port))
+            {
+                its_multicast.insert(
+                    endpoint_definition::get(its_address, its_port, false, _service, _instance));
+            }
+        }
+    }
+
+    its_targets->reliable_.assign(its_reliable.begin(), its_reliable.end());
+    its_targets->unreliable_.assign(its_unreliable.begin(), its_unreliable.end());
+    its_targets->multicast_.assign(its_multicast.begin(), its_multicast.end());
+
+    _event->set_remote_targets(its_targets);
+    return its_targets;
+}
 
-        is_sent = send_to(_target, its_data, its_size, _message->get_instance());
+bool routing_manager_impl::send_to(const client_t                              _client,
+                                   const std::shared_ptr<endpoint_definition>& _target,
+                                   std::shared_ptr<message>                    _message)
+{
+    bool is_sent(false);
+
+    std::shared_ptr<serializer> its_serializer(get_serializer());
+    if (its_serializer->serialize(_message.get()))
+    {
+        is_sent = send_to(_client, _target, its_serializer->get_data(),
+                          its_serializer->get_size(), _message->get_instance());
 
         its_serializer->reset();
         put_serializer(its_serializer);
@@ -1321,6 +1342,35 @@ bool routing_manager_impl::send_to(const client_t                              _
     return is_sent;
 }
 
+bool routing_manager_impl::send_to(const client_t                              _client,
+                                   const std::shared_ptr<endpoint_definition>& _target,
+                                   const byte_t* _data, uint32_t _size, instance_t _instance)
+{
+    byte_t* its_data = const_cast<byte_t*>(_data);
+    if (e2e_provider_)
+    {
+        service_t its_service = bithelper::read_uint16_be(&its_data[VSOMEIP_SERVICE_POS_MIN]);
+        method_t  its_method  = bithelper::read_uint16_be(&its_data[VSOMEIP_METHOD_POS_MIN]);
+#ifndef ANDROID
+        if (e2e_provider_->is_protected({its_service, its_method}))
+        {
+            auto its_base = e2e_provider_->get_protection_base({its_service, its_method});
+            if (its_base <= _size)
+                e2e_provider_->protect({its_service, its_method},
+                                       buffer_span(its_data + its_base, _size - its_base),
+                                       _instance);
+        }
+#endif
+    }
+
+    uint8_t its_client[2] = {0};
+    bithelper::write_uint16_le(_client, its_client);
+    its_data[VSOMEIP_CLIENT_POS_MIN] = its_client[1];
+    its_data[VSOMEIP_CLIENT_POS_MAX] = its_client[0];
+
+    return send_to(_target, its_data, _size, _instance);
+}
+
 bool routing_manager_impl::send_to(const std::shared_ptr<endpoint_definition>& _target,
                                    const byte_t* _data, uint32_t _size, instance_t _instance)
 {
@@ -1370,7 +1420,11 @@ void routing_manager_impl::register_event(
     bool _update_on_change, epsilon_change_func_t _epsilon_change_func, bool _is_provided,
     bool _is_shadow, bool _is_cache_placeholder)
 {
-    auto its_event = find_event(_service, _instance, _notifier);
+    std::shared_ptr<event> its_event;
+    {
+        std::lock_guard<std::mutex> its_lock(events_mutex_);
+        its_event = find_event_unlocked(_service, _instance, _notifier);
+    }
     bool is_first(false);
     if (its_event)
     {
@@ -1795,9 +1849,12 @@ void routing_manager_impl::on_message(const byte_t* _data, length_t _size, endpo
                 if (e2e_provider_->is_checked({its_service, its_method}))
                 {
                     auto its_base = e2e_provider_->get_protection_base({its_service, its_method});
-                    e2e_buffer its_buffer(_data + its_base, _data + _size);
-                    e2e_provider_->check({its_service, its_method}, its_buffer, its_instance,
-                                         its_check_status);
+                    if (its_base <= _size)
+                        e2e_provider_->check({its_service, its_method},
+                                             buffer_view(_data + its_base, _size - its_base),
+                                             its_instance, its_check_status);
+                    else
+                        its_check_status = e2e::profile_interface::generic_check_status::E2E_ERROR;
 
                     if (its_check_status != e2e::profile_interface::generic_check_status::E2E_OK)
                     {
@@ -2106,7 +2163,8 @@ bool routing_manager_impl::deliver_message(const byte_t* _data, length_t _size,
     bool is_delivered(false);
 
     auto its_deserializer = get_deserializer();
-    its_deserializer->set_data(_data, _size);
+    // The data is only read until reset() below, no need to copy it
+    its_deserializer->set_view(_data, _size);
     std::shared_ptr<message_impl> its_message(its_deserializer->deserialize_message());
     its_deserializer->reset();
     put_deserializer(its_deserializer);
@@ -5466,64 +5524,7 @@ bool routing_manager_impl::remove_security_policy_configuration(
 bool routing_manager_impl::insert_event_statistics(service_t _service, instance_t _instance,
                                                    method_t _method, length_t _length)
 {
-    static uint32_t             its_max_messages = configuration_->get_statistics_max_messages();
-    std::lock_guard<std::mutex> its_lock(message_statistics_mutex_);
-    const auto                  its_tuple  = std::make_tuple(_service, _instance, _method);
-    const auto                  its_main_s = message_statistics_.find(its_tuple);
-    if (its_main_s != message_statistics_.end())
-    {
-        // increase counter and calculate moving average for payload length
-        its_main_s->second.avg_length_ =
-            (its_main_s->second.avg_length_ * its_main_s->second.counter_ + _length)
-            / (its_main_s->second.counter_ + 1);
-        its_main_s->second.counter_++;
-
-        if (its_tuple == message_to_discard_)
-        {
-            // check list for entry with least counter value
-            uint32_t its_min_count(0xFFFFFFFF);
-            auto     its_tuple_to_discard = std::make_tuple(0xFFFF, 0xFFFF, 0xFFFF);
-            for (const auto& s : message_statistics_)
-            {
-                if (s.second.counter_ < its_min_count)
-                {
-                    its_min_count        = s.second.counter_;
-                    its_tuple_to_discard = s.first;
-                }
-            }
-            if (its_min_count != 0xFFFF && its_min_count < its_main_s->second.counter_)
-            {
-                // update message to discard with current message
-                message_to_discard_ = its_tuple;
-            }
-        }
-    }
-    else
-    {
-        if (message_statistics_.size() < its_max_messages)
-        {
-            message_statistics_[its_tuple] = {1, _length};
-            message_to_discard_            = its_tuple;
-        }
-        else
-        {
-            // no slot empty
-            const auto it = message_statistics_.find(message_to_discard_);
-            if (it != message_statistics_.end() && it->second.counter_ == 1)
-            {
-                message_statistics_.erase(message_to_discard_);
-                message_statistics_[its_tuple] = {1, _length};
-                message_to_discard_            = its_tuple;
-            }
-            else
-            {
-                // ignore message
-                ignored_statistics_counter_++;
-                return false;
-            }
-        }
-    }
-    return true;
+    return message_statistics_->insert(_service, _instance, _method, _length);
 }
 
 void routing_manager_impl::statistics_log_timer_cbk(boost::system::error_code const& _error)
@@ -5534,39 +5535,32 @@ void routing_manager_impl::statistics_log_timer_cbk(boost::system::error_code co
         its_interval                   = its_interval >= 1000 ? its_interval : 1000;
         static uint32_t   its_min_freq = configuration_->get_statistics_min_freq();
         std::stringstream its_log;
+
+        std::uint64_t its_ignored(0);
+        for (const auto& s : message_statistics_->rotate(its_ignored))
         {
-            std::lock_guard<std::mutex> its_lock(message_statistics_mutex_);
-            for (const auto& s : message_statistics_)
+            if (s.count_ / (its_interval / 1000) > its_min_freq)
             {
-                if (s.second.counter_ / (its_interval / 1000) > its_min_freq)
+                uint16_t               its_subscribed(0);
+                std::shared_ptr<event> its_event = find_event(s.service_, s.instance_, s.method_);
+                if (its_event)
                 {
-                    uint16_t               its_subscribed(0);
-                    std::shared_ptr<event> its_event = find_event(
-                        std::get<0>(s.first), std::get<1>(s.first), std::get<2>(s.first));
-                    if (its_event)
+                    if (!its_event->is_provided())
                     {
-                        if (!its_event->is_provided())
-                        {
-                            its_subscribed =
-                                static_cast<std::uint16_t>(its_event->get_subscribers().size());
-                        }
+                        its_subscribed =
+                            static_cast<std::uint16_t>(its_event->get_subscribers().size());
                     }
-                    its_log << std::hex << std::setfill('0') << std::setw(4) << std::get<0>(s.first)
-                            << "." << std::get<1>(s.first) << "." << std::get<2>(s.first)
-                            << ": #=" << std::dec << s.second.counter_
-                            << " L=" << s.second.avg_length_ << " S=" << std::dec << its_subscribed
-                            << ", ";
                 }
+                its_log << std::hex << std::setfill('0') << std::setw(4) << s.service_ << "."
+                        << s.instance_ << "." << s.method_ << ": #=" << std::dec << s.count_
+                        << " L=" << s.bytes_ / s.count_ << " S=" << std::dec << its_subscribed
+                        << ", ";
             }
+        }
 
-            if (ignored_statistics_counter_)
-            {
-                its_log << std::dec << " #ignored: " << ignored_statistics_counter_;
-            }
-
-            message_statistics_.clear();
-            message_to_discard_         = std::make_tuple(0x00, 0x00, 0x00);
-            ignored_statistics_counter_ = 0;
+        if (its_ignored)
+        {
+            its_log << std::dec << " #ignored: " << its_ignored;
         }
 
         if (its_log.str().length() > 0)
@@ -5574,6 +5568,15 @@ void routing_manager_impl::statistics_log_timer_cbk(boost::system::error_code co
             VSOMEIP_INFO << "Received events statistics: [" << its_log.str() << "]";
         }
 
+        const auto its_definitions = endpoint_definition::get_statistics();
+        VSOMEIP_INFO << "Endpoint definitions: size=" << its_definitions.size_
+                     << " hits=" << its_definitions.hits_ << " misses=" << its_definitions.misses_
+                     << " reclaimed=" << its_definitions.reclaimed_;
+
+        const std::string& its_metrics_file = configuration_->get_statistics_metrics_file();
+        if (!its_metrics_file.empty())
+            message_statistics_->write(its_metrics_file);
+
         {
             std::lock_guard<std::mutex> its_lock(statistics_log_timer_mutex_);
             statistics_log_timer_.expires_from_now(std::chrono::milliseconds(its_interval));
@@ -21,8 +21,10 @@
 #include "../include/routing_manager_stub.hpp"
 #include "../include/routing_manager_stub_host.hpp"
 #include "../include/remote_subscription.hpp"
+#include "../include/routing_info_coalescer.hpp"
 #include "../../configuration/include/configuration.hpp"
 #include "../../endpoints/include/endpoint_manager_impl.hpp"
+#include "../../endpoints/include/local_shm_transport.hpp"
 #include "../../endpoints/include/netlink_connector.hpp"
 #include "../../protocol/include/deregister_application_command.hpp"
 #include "../../protocol/include/distribute_security_policies_command.hpp"
@@ -41,6 +43,7 @@
 #include "../../protocol/include/remove_security_policy_response_command.hpp"
 #include "../../protocol/include/request_service_command.hpp"
 #include "../../protocol/include/resend_provided_events_command.hpp"
+#include "../../protocol/include/resync_routing_info_command.hpp"
 #include "../../protocol/include/routing_info_command.hpp"
 #include "../../protocol/include/send_command.hpp"
 #include "../../protocol/include/stop_offer_service_command.hpp"
@@ -71,6 +74,7 @@ routing_manager_stub::routing_manager_stub(routing_manager_stub_host*
       root_(nullptr),
       local_receiver_(nullptr),
       configuration_(_configuration),
+      routing_info_timer_(_host->get_io()),
       is_socket_activated_(false),
       client_registration_running_(false),
       max_local_message_size_(configuration_->get_max_message_size_local()),
@@ -81,7 +85,20 @@ routing_manager_stub::routing_manager_stub(routing_manager_stub_host*
       ,
       is_local_link_available_(false)
 #endif
-{}
+{
+    if (configuration_->is_local_routing() && configuration_->get_shm_threshold() > 0)
+        shm_ = std::make_shared<local_shm_transport>(configuration_);
+
+    if (configuration_->get_routing_info_coalescing_time() > 0)
+    {
+        routing_info_coalescer_ = std::make_shared<routing_info_coalescer>(
+            [this](client_t _target, const std::vector<byte_t>& _command) {
+                auto its_target_endpoint = host_->find_local(_target);
+                return (its_target_endpoint
+                        && its_target_endpoint->send(&_command[0], uint32_t(_command.size())));
+            });
+    }
+}
 
 routing_manager_stub::~routing_manager_stub() {}
 
@@ -181,6 +198,11 @@ void routing_manager_stub::stop()
         client_id_timer_.cancel();
     }
 
+    {
+        std::lock_guard<std::mutex> its_lock(routing_info_timer_mutex_);
+        routing_info_timer_.cancel();
+    }
+
     bool is_local_routing(configuration_->is_local_routing());
 
 #if defined(__linux__) || defined(ANDROID)
@@ -268,9 +290,24 @@ void routing_manager_stub::on_message(const byte_t* _data, length_t _size, endpo
     std::uint16_t            its_subscription_id(PENDING_SUBSCRIPTION_ID);
     port_t                   its_port(ILLEGAL_PORT);
 
-    std::vector<byte_t> its_buffer(_data, _data + _size);
+    std::vector<byte_t> its_buffer;
     protocol::error_e   its_error;
 
+    if (_size > 0 && _data[0] == static_cast<byte_t>(protocol::id_e::SEND_SHM_ID))
+    {
+        // Large notifications are copied from the shared memory of the sender
+        if (!shm_ || !shm_->deserialize(_data, _size, its_buffer))
+        {
+            VSOMEIP_WARNING << "routing_manager_stub::on_message: "
+                            << "Dropped a message that was sent via shared memory.";
+            return;
+        }
+    }
+    else
+    {
+        its_buffer.assign(_data, _data + _size);
+    }
+
     // Use dummy command to deserialize id and client.
     protocol::dummy_command its_base_command;
     its_base_command.deserialize(its_buffer, its_error);
@@ -547,11 +584,14 @@ void routing_manager_stub::on_message(const byte_t* _data, length_t _size, endpo
 
     case protocol::id_e::SEND_ID: {
         protocol::send_command its_command(its_id);
-        its_command.deserialize(its_buffer, its_error);
+        size_t its_offset(0);
+        its_command.deserialize(its_buffer, its_offset, its_error);
         if (its_error == protocol::error_e::ERROR_OK)
         {
-            auto its_message_data(its_command.get_message());
-            if (its_message_data.size() > VSOMEIP_MESSAGE_TYPE_POS)
+            // The message is used in place, no need to copy it out of the command
+            const byte_t* its_message_data = its_buffer.data() + its_offset;
+            const size_t  its_message_size = its_buffer.size() - its_offset;
+            if (its_message_size > VSOMEIP_MESSAGE_TYPE_POS)
             {
                 its_service = bithelper::read_uint16_be(&its_message_data[VSOMEIP_SERVICE_POS_MIN]);
                 its_method  = bithelper::read_uint16_be(&its_message_data[VSOMEIP_METHOD_POS_MIN]);
@@ -581,14 +621,14 @@ void routing_manager_stub::on_message(const byte_t* _data, length_t _size, endpo
                 // reduce by size of instance, flush, reliable, client and is_valid_crc flag
                 uint32_t its_contained_size =
                     bithelper::read_uint32_be(&its_message_data[VSOMEIP_LENGTH_POS_MIN]);
-                if (its_message_data.size() != its_contained_size + VSOMEIP_SOMEIP_HEADER_SIZE)
+                if (its_message_size != its_contained_size + VSOMEIP_SOMEIP_HEADER_SIZE)
                 {
                     VSOMEIP_WARNING
                         << "Received a SEND command containing message with invalid size -> skip!";
                     break;
                 }
-                host_->on_message(its_service, its_instance, &its_message_data[0],
-                                  length_t(its_message_data.size()), is_reliable, _bound_client,
+                host_->on_message(its_service, its_instance, its_message_data,
+                                  length_t(its_message_size), is_reliable, _bound_client,
                                   _sec_client, its_check_status, false);
             }
         }
@@ -598,11 +638,14 @@ void routing_manager_stub::on_message(const byte_t* _data, length_t _size, endpo
     case protocol::id_e::NOTIFY_ID:
     case protocol::id_e::NOTIFY_ONE_ID: {
         protocol::send_command its_command(its_id);
-        its_command.deserialize(its_buffer, its_error);
+        size_t its_offset(0);
+        its_command.deserialize(its_buffer, its_offset, its_error);
         if (its_error == protocol::error_e::ERROR_OK)
         {
-            auto its_message_data(its_command.get_message());
-            if (its_message_data.size() > VSOMEIP_MESSAGE_TYPE_POS)
+            // The message is used in place, no need to copy it out of the command
+            const byte_t* its_message_data = its_buffer.data() + its_offset;
+            const size_t  its_message_size = its_buffer.size() - its_offset;
+            if (its_message_size > VSOMEIP_MESSAGE_TYPE_POS)
             {
                 its_client  = its_command.get_target();
                 its_service = bithelper::read_uint16_be(&its_message_data[VSOMEIP_SERVICE_POS_MIN]);
@@ -611,15 +654,15 @@ void routing_manager_stub::on_message(const byte_t* _data, length_t _size, endpo
                 uint32_t its_contained_size =
                     bithelper::read_uint32_be(&its_message_data[VSOMEIP_LENGTH_POS_MIN]);
 
-                if (its_message_data.size() != its_contained_size + VSOMEIP_SOMEIP_HEADER_SIZE)
+                if (its_message_size != its_contained_size + VSOMEIP_SOMEIP_HEADER_SIZE)
                 {
                     VSOMEIP_WARNING
                         << "Received a NOTIFY command containing message with invalid size -> skip!";
                     break;
                 }
 
-                host_->on_notification(its_client, its_service, its_instance, &its_message_data[0],
-                                       length_t(its_message_data.size()),
+                host_->on_notification(its_client, its_service, its_instance, its_message_data,
+                                       length_t(its_message_size),
                                        its_id == protocol::id_e::NOTIFY_ONE_ID);
                 break;
             }
@@ -823,6 +866,20 @@ void routing_manager_stub::on_message(const byte_t* _data, length_t _size, endpo
         }
         break;
     }
+    case protocol::id_e::RESYNC_ROUTING_INFO_ID: {
+        protocol::resync_routing_info_command its_command;
+        its_command.deserialize(its_buffer, its_error);
+        if (its_error == protocol::error_e::ERROR_OK)
+        {
+            VSOMEIP_INFO << "RESYNC_ROUTING_INFO(" << std::hex << std::setw(4)
+                         << std::setfill('0') << its_client << ")";
+            on_resync_routing_info(its_client);
+        }
+        else
+            VSOMEIP_ERROR << __func__ << ": resync routing info deserialization failed ("
+                          << std::dec << static_cast<int>(its_error) << ")";
+        break;
+    }
     default:
         VSOMEIP_WARNING << __func__ << ": Received an unhandled command (" << std::dec
                         << static_cast<int>(its_id) << ")";
@@ -1044,6 +1101,8 @@ void routing_manager_stub::client_registration_func(void)
                             remove_connection(its_connections.first, r.first);
                         }
                         service_requests_.erase(r.first);
+                        if (routing_info_coalescer_)
+                            routing_info_coalescer_->remove(r.first);
                     }
                     // Don't remove client ID to UID maping as same client
                     // could have passed its credentials again
@@ -1249,6 +1308,37 @@ void routing_manager_stub::send_client_routing_info(const client_t
 void routing_manager_stub::send_client_routing_info(
     const client_t _target, std::vector<protocol::routing_info_entry>&& _entries)
 {
+    if (routing_info_coalescer_)
+    {
+        bool is_registration(false);
+        bool is_first(false);
+        for (const auto& e : _entries)
+        {
+            is_first = routing_info_coalescer_->add(_target, e) || is_first;
+            if (e.get_client() == _target
+                && (e.get_type() == protocol::routing_info_entry_type_e::RIE_ADD_CLIENT
+                    || e.get_type() == protocol::routing_info_entry_type_e::RIE_DELETE_CLIENT))
+                is_registration = true;
+        }
+
+        // Applications must not wait for their own (de)registration
+        if (is_registration)
+        {
+            routing_info_coalescer_->flush(get_client(), _target);
+        }
+        else if (is_first)
+        {
+            std::lock_guard<std::mutex> its_lock(routing_info_timer_mutex_);
+            routing_info_timer_.expires_from_now(
+                std::chrono::milliseconds(configuration_->get_routing_info_coalescing_time()));
+            routing_info_timer_.async_wait(
+                std::bind(&routing_manager_stub::on_routing_info_timer_expired,
+                          std::dynamic_pointer_cast<routing_manager_stub>(shared_from_this()),
+                          std::placeholders::_1));
+        }
+        return;
+    }
+
     auto its_target_endpoint = host_->find_local(_target);
     if (its_target_endpoint)
     {
@@ -1273,6 +1363,78 @@ void routing_manager_stub::send_client_routing_info(
                       << std::setw(4) << std::setfill('0') << _target << "] failed";
 }
 
+void routing_manager_stub::on_routing_info_timer_expired(boost::system::error_code const& _error)
+{
+    if (!_error && routing_info_coalescer_)
+        routing_info_coalescer_->flush(get_client());
+}
+
+void routing_manager_stub::on_resync_routing_info(client_t _client)
+{
+    if (!routing_info_coalescer_)
+        return;
+
+    boost::asio::ip::address its_address;
+    port_t                   its_port;
+
+    std::vector<protocol::routing_info_entry> its_entries;
+    std::lock_guard<std::mutex>               its_guard(routing_info_mutex_);
+
+    auto found_connections = connection_matrix_.find(_client);
+    if (found_connections != connection_matrix_.end())
+    {
+        for (const auto c : found_connections->second)
+        {
+            if (c != _client && c != VSOMEIP_ROUTING_CLIENT && c != get_client())
+            {
+                protocol::routing_info_entry its_entry;
+                its_entry.set_type(protocol::routing_info_entry_type_e::RIE_ADD_CLIENT);
+                its_entry.set_client(c);
+                if (host_->get_guest(c, its_address, its_port))
+                {
+                    its_entry.set_address(its_address);
+                    its_entry.set_port(its_port);
+                }
+                its_entries.emplace_back(its_entry);
+            }
+        }
+    }
+
+    auto found_requests = service_requests_.find(_client);
+    if (found_requests != service_requests_.end())
+    {
+        for (const auto& its_info : routing_info_)
+        {
+            protocol::routing_info_entry its_entry;
+            its_entry.set_type(protocol::routing_info_entry_type_e::RIE_ADD_SERVICE_INSTANCE);
+            its_entry.set_client(its_info.first);
+            if (host_->get_guest(its_info.first, its_address, its_port))
+            {
+                its_entry.set_address(its_address);
+                its_entry.set_port(its_port);
+            }
+            for (const auto& s : its_info.second.second)
+            {
+                auto found_service = found_requests->second.find(s.first);
+                if (found_service == found_requests->second.end())
+                    continue;
+                const bool is_any(found_service->second.find(ANY_INSTANCE)
+                                  != found_service->second.end());
+                for (const auto& i : s.second)
+                {
+                    if (is_any
+                        || found_service->second.find(i.first) != found_service->second.end())
+                        its_entry.add_service({s.first, i.first, i.second.first, i.second.second});
+                }
+            }
+            if (!its_entry.get_services().empty())
+                its_entries.emplace_back(its_entry);
+        }
+    }
+
+    routing_info_coalescer_->send_full(get_client(), _client, std::move(its_entries));
+}
+
 void routing_manager_stub::distribute_credentials(client_t _hoster, service_t _service,
                                                   instance_t _instance)
 {
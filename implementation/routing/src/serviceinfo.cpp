@@ -7,6 +7,8 @@
 
 namespace vsomeip_v3 {
 
+std::atomic<std::uint32_t> serviceinfo::offer_revision_(0);
+
 serviceinfo::serviceinfo(service_t _service, instance_t _instance, major_version_t _major,
                          minor_version_t _minor, ttl_t _ttl, bool _is_local)
     : service_(_service),
@@ -70,7 +72,12 @@ void serviceinfo::set_ttl(ttl_t _ttl)
 {
     std::lock_guard<std::mutex> its_lock(ttl_mutex_);
     std::chrono::seconds        ttl = static_cast<std::chrono::seconds>(_ttl);
-    ttl_                            = std::chrono::duration_cast<std::chrono::milliseconds>(ttl);
+    const auto its_ttl = std::chrono::duration_cast<std::chrono::milliseconds>(ttl);
+    if (ttl_ != its_ttl)
+    {
+        ttl_ = its_ttl;
+        update_local_offer_revision();
+    }
 }
 
 std::chrono::milliseconds serviceinfo::get_precise_ttl() const
@@ -102,6 +109,7 @@ void serviceinfo::set_endpoint(const std::shared_ptr<endpoint>& _endpoint, bool
     {
         unreliable_ = _endpoint;
     }
+    update_local_offer_revision();
 }
 
 void serviceinfo::add_client(client_t _client)
@@ -134,7 +142,8 @@ bool serviceinfo::is_in_mainphase() const
 
 void serviceinfo::set_is_in_mainphase(bool _in_mainphase)
 {
-    is_in_mainphase_ = _in_mainphase;
+    if (is_in_mainphase_.exchange(_in_mainphase) != _in_mainphase)
+        update_local_offer_revision();
 }
 
 bool serviceinfo::is_accepting_remote_subscriptions() const
@@ -164,4 +173,21 @@ std::set<std::string, std::less<>> serviceinfo::get_remote_ip_accepting_sub()
     return accepting_remote_subscription_from_;
 }
 
+std::uint32_t serviceinfo::get_offer_revision()
+{
+    return offer_revision_;
+}
+
+void serviceinfo::update_offer_revision()
+{
+    offer_revision_++;
+}
+
+void serviceinfo::update_local_offer_revision() const
+{
+    // Remote services are not offered
+    if (is_local_)
+        update_offer_revision();
+}
+
 } // namespace vsomeip_v3
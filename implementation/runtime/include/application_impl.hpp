@@ -40,6 +40,9 @@
 #include "../../configuration/include/internal.hpp"
 #endif // ANDROID
 #include "../../routing/include/routing_manager_host.hpp"
+#include "../../utility/include/message_statistics.hpp"
+#include "../../utility/include/mpmc_queue.hpp"
+#include "io_shards.hpp"
 
 namespace vsomeip_v3 {
 
@@ -158,6 +161,7 @@ public:
     VSOMEIP_EXPORT std::shared_ptr<policy_manager> get_policy_manager() const;
     VSOMEIP_EXPORT std::shared_ptr<configuration_public> get_public_configuration() const;
     VSOMEIP_EXPORT boost::asio::io_context &get_io();
+    VSOMEIP_EXPORT boost::asio::io_context &get_endpoint_io(std::size_t _hash);
 
     VSOMEIP_EXPORT void on_state(state_type_e _state);
     VSOMEIP_EXPORT void on_availability(service_t _service, instance_t _instance,
@@ -247,7 +251,8 @@ public:
 private:
 
     using members_key_t = std::uint64_t;
-    using members_t = std::unordered_map<members_key_t, std::deque<message_handler_t>>;
+    using members_t = std::unordered_map<members_key_t,
+            std::deque<std::shared_ptr<message_handler_t>>>;
 
     static members_key_t to_members_key(service_t _service, instance_t _instance, method_t _method) {
         return (static_cast<members_key_t>(_service)  <<  0) |
@@ -272,6 +277,8 @@ private:
 
         sync_handler(const std::function<void()> &_handler) :
                     handler_(_handler),
+                    message_handler_(nullptr),
+                    message_(nullptr),
                     service_id_(ANY_SERVICE),
                     instance_id_(ANY_INSTANCE),
                     method_id_(ANY_METHOD),
@@ -283,6 +290,8 @@ private:
                      method_t _method_id, session_t _session_id,
                      eventgroup_t _eventgroup_id, handler_type_e _handler_type) :
                     handler_(nullptr),
+                    message_handler_(nullptr),
+                    message_(nullptr),
                     service_id_(_service_id),
                     instance_id_(_instance_id),
                     method_id_(_method_id),
@@ -291,6 +300,10 @@ private:
                     handler_type_(_handler_type) { }
 
         std::function<void()> handler_;
+        // Message handlers are stored unbound to avoid creating a closure
+        // per received message.
+        std::shared_ptr<message_handler_t> message_handler_;
+        std::shared_ptr<message> message_;
         service_t service_id_;
         instance_t instance_id_;
         method_t method_id_;
@@ -318,6 +331,13 @@ private:
     void invoke_handler(std::shared_ptr<sync_handler> &_handler);
     std::shared_ptr<sync_handler> get_next_handler();
     void reschedule_availability_handler(const std::shared_ptr<sync_handler> &_handler);
+    void release_dispatch_lane(const std::shared_ptr<sync_handler> &_handler);
+    void drain_dispatch_queue_unlocked();
+    void push_handler_unlocked(const std::shared_ptr<sync_handler> &_handler);
+    bool has_pending_handlers_unlocked();
+    void wait_for_handlers(std::unique_lock<std::mutex> &_lock);
+    std::shared_ptr<sync_handler> get_message_handler();
+    void recycle_message_handler(std::shared_ptr<sync_handler> &_handler);
     bool has_active_dispatcher();
     bool is_active_dispatcher(const std::thread::id &_id) const;
     void remove_elapsed_dispatchers();
@@ -341,13 +361,14 @@ private:
     bool check_subscription_state(service_t _service, instance_t _instance,
             eventgroup_t _eventgroup, event_t _event);
 
-    void print_blocking_call(const std::shared_ptr<sync_handler>& _handler);
+    void print_blocking_call(const sync_handler& _handler);
 
     void watchdog_cbk(boost::system::error_code const &_error);
 
     bool is_local_endpoint(const boost::asio::ip::address &_unicast, port_t _port);
 
-    const std::deque<message_handler_t>& find_handlers(service_t _service, instance_t _instance, method_t _method) const;
+    const std::deque<std::shared_ptr<message_handler_t>>& find_handlers(
+            service_t _service, instance_t _instance, method_t _method) const;
 
     void invoke_availability_handler(service_t _service, instance_t _instance,
             major_version_t _major, minor_version_t _minor);
@@ -384,6 +405,8 @@ private:
 
     boost::asio::io_context io_;
     std::set<std::shared_ptr<std::thread> > io_threads_;
+    // Separate I/O contexts for network endpoints (optional, must outlive routing_)
+    io_shards io_shards_;
     std::shared_ptr<boost::asio::executor_work_guard<
         boost::asio::io_context::executor_type> > work_;
 
@@ -446,6 +469,19 @@ private:
     mutable std::deque<std::shared_ptr<sync_handler>> handlers_;
     mutable std::mutex handlers_mutex_;
 
+    // Message handlers are queued without taking handlers_mutex_. The
+    // dispatchers move them to handlers_ before selecting the next handler.
+    mpmc_queue<std::shared_ptr<sync_handler>> dispatch_queue_;
+    // Number of dispatchers waiting on dispatcher_condition_
+    std::atomic<std::size_t> waiting_dispatchers_;
+    // Message handler objects for reuse
+    mpmc_queue<std::shared_ptr<sync_handler>> message_handler_pool_;
+    // Number of message handlers that were queued, but did not start yet
+    std::atomic<std::size_t> dispatcher_backlog_;
+
+    std::shared_ptr<message_statistics> message_statistics_;
+    std::uint32_t dispatcher_backlog_gauge_;
+
     // Dispatching
     std::atomic<bool> is_dispatching_;
     // Dispatcher threads
@@ -469,6 +505,16 @@ private:
     std::size_t max_dispatchers_;
     std::size_t max_dispatch_time_;
 
+    // Number of dispatchers that execute handlers of different service
+    // instances in parallel (1 = all handlers are executed sequentially)
+    std::size_t dispatch_lanes_;
+    // Dispatcher threads that are always active (guarded by dispatcher_mutex_)
+    std::set<std::thread::id> lane_dispatchers_;
+    // Service instances whose handler is currently executed and the handlers
+    // that wait for it to finish (guarded by handlers_mutex_)
+    std::map<std::pair<service_t, instance_t>,
+            std::deque<std::shared_ptr<sync_handler>>> busy_lanes_;
+
     // Counter for dispatcher threads
     std::atomic<uint16_t> dispatcher_counter_;
 
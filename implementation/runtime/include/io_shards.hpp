@@ -0,0 +1,58 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_IO_SHARDS_HPP_
+#define VSOMEIP_V3_IO_SHARDS_HPP_
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+
+namespace vsomeip_v3 {
+
+//
+// Set of I/O contexts that are each run by a single thread. Network endpoints
+// are assigned to a shard by a hash of their address and port, so that their
+// sockets, timers and handlers always run on the same (optionally pinned)
+// thread instead of on any thread of the shared I/O context.
+//
+class io_shards {
+public:
+    io_shards();
+    ~io_shards();
+
+    io_shards(const io_shards&)            = delete;
+    io_shards& operator=(const io_shards&) = delete;
+
+    // Creates the contexts. Must be called before any endpoint is created.
+    void init(std::size_t _count);
+
+    std::size_t size() const;
+
+    // Returns the context of the shard the hash is assigned to.
+    boost::asio::io_context& get(std::size_t _hash);
+
+    // Starts one thread per shard, named _name followed by the shard number.
+    // Shard i is pinned to _cpus[i % _cpus.size()] unless _cpus is empty.
+    void start(const std::string& _name, int _nice_level, const std::vector<int>& _cpus);
+
+    // Stops all contexts and joins their threads.
+    void stop();
+
+private:
+    typedef boost::asio::executor_work_guard<boost::asio::io_context::executor_type> work_guard_t;
+
+    std::vector<std::unique_ptr<boost::asio::io_context>> contexts_;
+    std::vector<std::unique_ptr<work_guard_t>>            work_;
+    std::vector<std::thread>                              threads_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_IO_SHARDS_HPP_
@@ -7,6 +7,7 @@
 #include <thread>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 
 #include <boost/asio/ip/host_name.hpp>
 #include <boost/asio/ip/tcp.hpp>
@@ -65,9 +66,16 @@ application_impl::application_impl(const std::string& _name, const std::string&
       signals_(io_, SIGINT, SIGTERM),
       catched_signal_(false),
 #endif
+      dispatch_queue_(VSOMEIP_DISPATCH_QUEUE_SIZE),
+      waiting_dispatchers_(0),
+      message_handler_pool_(VSOMEIP_DISPATCH_QUEUE_SIZE),
+      dispatcher_backlog_(0),
+      message_statistics_(message_statistics::get()),
+      dispatcher_backlog_gauge_(0),
       is_dispatching_(false),
       max_dispatchers_(VSOMEIP_MAX_DISPATCHERS),
       max_dispatch_time_(VSOMEIP_MAX_DISPATCH_TIME),
+      dispatch_lanes_(VSOMEIP_DEFAULT_DISPATCH_LANES),
       dispatcher_counter_(0),
       max_detached_thread_wait_time(VSOMEIP_MAX_WAIT_TIME_DETACHED_THREADS),
       stopped_(false),
@@ -82,6 +90,8 @@ application_impl::application_impl(const std::string& _name, const std::string&
 application_impl::~application_impl()
 {
     runtime_->remove_application(name_);
+    if (is_initialized_)
+        message_statistics_->remove_gauge(dispatcher_backlog_gauge_);
 
 #ifndef VSOMEIP_ENABLE_MULTIPLE_ROUTING_MANAGERS
     if (configuration_)
@@ -328,6 +338,10 @@ bool application_impl::init()
         max_dispatch_time_            = its_configuration->get_max_dispatch_time(name_);
         max_detached_thread_wait_time = its_configuration->get_max_detached_thread_wait_time(name_);
 
+        // Each additional dispatch lane is served by a dispatcher of its own
+        dispatch_lanes_ = its_configuration->get_dispatch_lanes(name_);
+        max_dispatchers_ += dispatch_lanes_ - 1;
+
         has_session_handling_ = its_configuration->has_session_handling(name_);
         if (!has_session_handling_)
             VSOMEIP_INFO << "application: " << name_ << " has session handling switched off!";
@@ -370,6 +384,8 @@ bool application_impl::init()
                                                 & configuration_->get_diagnosis_mask());
                 utility::request_client_id(configuration_, name_, client_);
             }
+            // Network endpoints only exist within the routing manager
+            io_shards_.init(configuration_->get_io_shards(name_));
             routing_ = std::make_shared<routing_manager_impl>(this);
         }
         else
@@ -390,7 +406,20 @@ bool application_impl::init()
 
         VSOMEIP_INFO << "Application(" << (name_ != "" ? name_ : "unnamed") << ", " << std::hex
                      << std::setfill('0') << std::setw(4) << client_ << ") is initialized ("
-                     << std::dec << max_dispatchers_ << ", " << max_dispatch_time_ << ").";
+                     << std::dec << max_dispatchers_ << ", " << max_dispatch_time_ << ", "
+                     << dispatch_lanes_ << ").";
+
+        std::weak_ptr<application_impl> its_application(shared_from_this());
+        dispatcher_backlog_gauge_ = message_statistics_->add_gauge(
+            "vsomeip_dispatcher_backlog",
+            [its_application, its_name = name_](
+                std::vector<std::pair<std::string, std::uint64_t>>& _values) {
+                if (auto its_me = its_application.lock())
+                {
+                    _values.emplace_back("application=\"" + its_name + "\"",
+                                         its_me->dispatcher_backlog_.load());
+                }
+            });
 
         is_initialized_ = true;
     }
@@ -524,6 +553,31 @@ void application_impl::start()
 #endif
             dispatchers_[its_main_dispatcher->get_id()] = its_main_dispatcher;
             increment_active_threads();
+
+            if (dispatch_lanes_ > 1)
+            {
+                lane_dispatchers_.insert(its_main_dispatcher->get_id());
+                for (std::size_t i = 1; i < dispatch_lanes_; i++)
+                {
+                    std::packaged_task<void()> its_lane_task(
+                        std::bind(&application_impl::main_dispatch, shared_from_this()));
+                    std::future<void> its_lane_future = its_lane_task.get_future();
+                    auto its_lane_dispatcher =
+                        std::make_shared<std::thread>(std::move(its_lane_task));
+#ifdef _WIN32
+                    dispatchers_control_[its_lane_dispatcher->get_id()] = {
+                        OpenThread(THREAD_ALL_ACCESS, false,
+                                   GetThreadId(its_lane_dispatcher->native_handle())),
+                        std::move(its_lane_future)};
+#else
+                    dispatchers_control_[its_lane_dispatcher->get_id()] = {
+                        its_lane_dispatcher->native_handle(), std::move(its_lane_future)};
+#endif
+                    dispatchers_[its_lane_dispatcher->get_id()] = its_lane_dispatcher;
+                    lane_dispatchers_.insert(its_lane_dispatcher->get_id());
+                    increment_active_threads();
+                }
+            }
         }
 
         if (stop_thread_.joinable())
@@ -532,6 +586,14 @@ void application_impl::start()
         }
         stop_thread_ = std::thread(&application_impl::shutdown, shared_from_this());
 
+        if (io_shards_.size() > 0)
+        {
+            std::stringstream s;
+            s << std::hex << std::setw(4) << std::setfill('0') << client_ << "_sh";
+            io_shards_.start(s.str(), io_thread_nice_level,
+                             configuration_->get_io_shard_cpus(name_));
+        }
+
         if (routing_)
             routing_->start();
 
@@ -1191,7 +1253,7 @@ void application_impl::invoke_availability_handler(service_t _service, instance_
                         its_sync_handler->handler_type_ = handler_type_e::AVAILABILITY;
                         its_sync_handler->service_id_   = _service;
                         its_sync_handler->instance_id_  = _instance;
-                        handlers_.push_back(its_sync_handler);
+                        push_handler_unlocked(its_sync_handler);
                         dispatcher_condition_.notify_one();
                     }
                 }
@@ -1220,7 +1282,7 @@ void application_impl::register_availability_handler_unlocked(
     its_sync_handler->handler_type_ = handler_type_e::AVAILABILITY;
     its_sync_handler->service_id_   = _service;
     its_sync_handler->instance_id_  = _instance;
-    handlers_.push_back(its_sync_handler);
+    push_handler_unlocked(its_sync_handler);
     dispatcher_condition_.notify_one();
 }
 
@@ -1626,7 +1688,7 @@ void application_impl::deliver_subscription_state(service_t _service, instance_t
             its_sync_handler->instance_id_   = _instance;
             its_sync_handler->method_id_     = _event;
             its_sync_handler->eventgroup_id_ = _eventgroup;
-            handlers_.push_back(its_sync_handler);
+            push_handler_unlocked(its_sync_handler);
         }
         if (handlers.size())
         {
@@ -1817,6 +1879,11 @@ boost::asio::io_context& application_impl::get_io()
     return io_;
 }
 
+boost::asio::io_context& application_impl::get_endpoint_io(std::size_t _hash)
+{
+    return (io_shards_.size() > 0 ? io_shards_.get(_hash) : io_);
+}
+
 void application_impl::on_state(state_type_e _state)
 {
     bool            has_state_handler(false);
@@ -1836,7 +1903,7 @@ void application_impl::on_state(state_type_e _state)
             handler(_state);
         });
         its_sync_handler->handler_type_ = handler_type_e::STATE;
-        handlers_.push_back(its_sync_handler);
+        push_handler_unlocked(its_sync_handler);
         dispatcher_condition_.notify_one();
     }
 }
@@ -2015,7 +2082,7 @@ void application_impl::on_availability(service_t _service, instance_t _instance,
                 its_sync_handler->handler_type_ = handler_type_e::AVAILABILITY;
                 its_sync_handler->service_id_   = _service;
                 its_sync_handler->instance_id_  = _instance;
-                handlers_.push_back(its_sync_handler);
+                push_handler_unlocked(its_sync_handler);
             }
         }
     }
@@ -2066,7 +2133,7 @@ void application_impl::on_availability(service_t _service, instance_t _instance,
     }
 }
 
-const std::deque<message_handler_t>&
+const std::deque<std::shared_ptr<message_handler_t>>&
 application_impl::find_handlers(service_t _service, instance_t _instance, method_t _method) const
 {
     // The (ordered!) sequence of queries to attempt
@@ -2089,7 +2156,7 @@ application_impl::find_handlers(service_t _service, instance_t _instance, method
         }
     }
 
-    static const std::deque<message_handler_t> empty;
+    static const std::deque<std::shared_ptr<message_handler_t>> empty;
     return empty;
 }
 
@@ -2112,26 +2179,40 @@ void application_impl::on_message(std::shared_ptr<message>&& _message)
         }
     }
 
+    bool has_handlers(false);
     {
         std::lock_guard<std::mutex> its_lock(members_mutex_);
 
-        const auto its_handlers = find_handlers(its_service, its_instance, its_method);
-
-        if (!its_handlers.empty())
+        const auto& its_handlers = find_handlers(its_service, its_instance, its_method);
+        for (const auto& handler : its_handlers)
         {
-            std::lock_guard<std::mutex> its_lock(handlers_mutex_);
-            for (const auto& handler : its_handlers)
+            auto its_sync_handler              = get_message_handler();
+            its_sync_handler->message_handler_ = handler;
+            its_sync_handler->message_         = _message;
+            its_sync_handler->service_id_      = its_service;
+            its_sync_handler->instance_id_     = its_instance;
+            its_sync_handler->method_id_       = its_method;
+            its_sync_handler->session_id_      = _message->get_session();
+
+            dispatcher_backlog_.fetch_add(1, std::memory_order_relaxed);
+            if (!dispatch_queue_.push(std::move(its_sync_handler)))
             {
-                auto its_sync_handler = std::make_shared<sync_handler>([handler, _message]() {
-                    handler(_message);
-                });
-                its_sync_handler->handler_type_ = handler_type_e::MESSAGE;
-                its_sync_handler->service_id_   = _message->get_service();
-                its_sync_handler->instance_id_  = _message->get_instance();
-                its_sync_handler->method_id_    = _message->get_method();
-                its_sync_handler->session_id_   = _message->get_session();
-                handlers_.push_back(its_sync_handler);
+                // Queue is full, fall back to the locked path (which keeps the order)
+                std::lock_guard<std::mutex> its_handlers_lock(handlers_mutex_);
+                push_handler_unlocked(its_sync_handler);
             }
+            has_handlers = true;
+        }
+    }
+
+    if (has_handlers)
+    {
+        // Pairs with the fence in wait_for_handlers: either the dispatcher
+        // sees the queued handler, or we see the waiting dispatcher.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiting_dispatchers_ > 0)
+        {
+            std::lock_guard<std::mutex> its_lock(handlers_mutex_);
             dispatcher_condition_.notify_one();
         }
     }
@@ -2163,14 +2244,15 @@ void application_impl::main_dispatch()
     std::unique_lock<std::mutex> its_lock(handlers_mutex_);
     while (is_dispatching_)
     {
-        if (handlers_.empty() || !is_active_dispatcher(its_id))
+        if (!has_pending_handlers_unlocked() || !is_active_dispatcher(its_id))
         {
             // Cancel other waiting dispatcher
             dispatcher_condition_.notify_all();
             // Wait for new handlers to execute
-            while (is_dispatching_ && (handlers_.empty() || !is_active_dispatcher(its_id)))
+            while (is_dispatching_
+                   && (!has_pending_handlers_unlocked() || !is_active_dispatcher(its_id)))
             {
-                dispatcher_condition_.wait(its_lock);
+                wait_for_handlers(its_lock);
             }
         }
         else
@@ -2188,6 +2270,8 @@ void application_impl::main_dispatch()
                 its_lock.lock();
 
                 reschedule_availability_handler(its_handler);
+                release_dispatch_lane(its_handler);
+                recycle_message_handler(its_handler);
                 remove_elapsed_dispatchers();
 
 #ifdef _WIN32
@@ -2222,11 +2306,11 @@ void application_impl::dispatch()
     std::unique_lock<std::mutex> its_lock(handlers_mutex_);
     while (is_active_dispatcher(its_id))
     {
-        if (is_dispatching_ && handlers_.empty())
+        if (is_dispatching_ && !has_pending_handlers_unlocked())
         {
-            dispatcher_condition_.wait(its_lock);
+            wait_for_handlers(its_lock);
             // Maybe woken up from main dispatcher
-            if (handlers_.empty() && !is_active_dispatcher(its_id))
+            if (!has_pending_handlers_unlocked() && !is_active_dispatcher(its_id))
             {
                 if (!is_dispatching_)
                 {
@@ -2252,6 +2336,8 @@ void application_impl::dispatch()
                 its_lock.lock();
 
                 reschedule_availability_handler(its_handler);
+                release_dispatch_lane(its_handler);
+                recycle_message_handler(its_handler);
                 remove_elapsed_dispatchers();
             }
         }
@@ -2267,11 +2353,25 @@ void application_impl::dispatch()
 std::shared_ptr<application_impl::sync_handler> application_impl::get_next_handler()
 {
     std::shared_ptr<sync_handler> its_next_handler;
-    while (!handlers_.empty() && !its_next_handler)
+    while (has_pending_handlers_unlocked() && !its_next_handler)
     {
         its_next_handler = handlers_.front();
         handlers_.pop_front();
 
+        if (dispatch_lanes_ > 1)
+        {
+            auto found_lane = busy_lanes_.find(
+                std::make_pair(its_next_handler->service_id_, its_next_handler->instance_id_));
+            if (found_lane != busy_lanes_.end())
+            {
+                // Another dispatcher is executing a handler for this service
+                // instance. Keep the order by waiting for it to finish.
+                found_lane->second.push_back(its_next_handler);
+                its_next_handler = nullptr;
+                continue;
+            }
+        }
+
         // Check handler
         if (its_next_handler->handler_type_ == handler_type_e::AVAILABILITY)
         {
@@ -2306,6 +2406,17 @@ std::shared_ptr<application_impl::sync_handler> application_impl::get_next_handl
         }
     }
 
+    if (its_next_handler && dispatch_lanes_ > 1)
+    {
+        busy_lanes_.emplace(
+            std::make_pair(its_next_handler->service_id_, its_next_handler->instance_id_),
+            std::deque<std::shared_ptr<sync_handler>>());
+
+        // Let another dispatcher take care of the remaining handlers
+        if (waiting_dispatchers_ > 0 && (!handlers_.empty() || !dispatch_queue_.empty()))
+            dispatcher_condition_.notify_one();
+    }
+
     return its_next_handler;
 }
 
@@ -2337,13 +2448,90 @@ void application_impl::reschedule_availability_handler(
     }
 }
 
+void application_impl::release_dispatch_lane(const std::shared_ptr<sync_handler>& _handler)
+{
+    if (dispatch_lanes_ > 1)
+    {
+        auto found_lane =
+            busy_lanes_.find(std::make_pair(_handler->service_id_, _handler->instance_id_));
+        if (found_lane != busy_lanes_.end())
+        {
+            // Schedule the handlers that waited for this lane in front of all others
+            for (auto it = found_lane->second.rbegin(); it != found_lane->second.rend(); it++)
+            {
+                handlers_.push_front(*it);
+            }
+            busy_lanes_.erase(found_lane);
+        }
+    }
+}
+
+void application_impl::drain_dispatch_queue_unlocked()
+{
+    std::shared_ptr<sync_handler> its_handler;
+    while (dispatch_queue_.pop(its_handler))
+    {
+        handlers_.push_back(std::move(its_handler));
+    }
+}
+
+void application_impl::push_handler_unlocked(const std::shared_ptr<sync_handler>& _handler)
+{
+    // Handlers that were queued without lock must be executed first
+    drain_dispatch_queue_unlocked();
+    handlers_.push_back(_handler);
+}
+
+bool application_impl::has_pending_handlers_unlocked()
+{
+    drain_dispatch_queue_unlocked();
+    return !handlers_.empty();
+}
+
+void application_impl::wait_for_handlers(std::unique_lock<std::mutex>& _lock)
+{
+    waiting_dispatchers_++;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (dispatch_queue_.empty())
+    {
+        dispatcher_condition_.wait(_lock);
+    }
+    waiting_dispatchers_--;
+}
+
+std::shared_ptr<application_impl::sync_handler> application_impl::get_message_handler()
+{
+    std::shared_ptr<sync_handler> its_handler;
+    if (!message_handler_pool_.pop(its_handler))
+    {
+        its_handler = std::make_shared<sync_handler>(ANY_SERVICE, ANY_INSTANCE, ANY_METHOD, 0, 0,
+                                                     handler_type_e::MESSAGE);
+    }
+    return its_handler;
+}
+
+void application_impl::recycle_message_handler(std::shared_ptr<sync_handler>& _handler)
+{
+    // Only reuse the handler object if no one else refers to it
+    if (_handler->handler_type_ == handler_type_e::MESSAGE && _handler->message_handler_
+        && _handler.use_count() == 1)
+    {
+        _handler->message_handler_.reset();
+        _handler->message_.reset();
+        (void)message_handler_pool_.push(std::move(_handler));
+    }
+    _handler.reset();
+}
+
 void application_impl::invoke_handler(std::shared_ptr<sync_handler>& _handler)
 {
     const std::thread::id its_id = std::this_thread::get_id();
 
-    auto its_sync_handler = std::make_shared<sync_handler>(
-        _handler->service_id_, _handler->instance_id_, _handler->method_id_, _handler->session_id_,
-        _handler->eventgroup_id_, _handler->handler_type_);
+    // Copy of the handler identification (without handler and message) to
+    // report blocking calls.
+    const sync_handler its_sync_handler(_handler->service_id_, _handler->instance_id_,
+                                        _handler->method_id_, _handler->session_id_,
+                                        _handler->eventgroup_id_, _handler->handler_type_);
 
     boost::asio::steady_timer its_dispatcher_timer(io_);
     its_dispatcher_timer.expires_from_now(std::chrono::milliseconds(max_dispatch_time_));
@@ -2418,17 +2606,17 @@ void application_impl::invoke_handler(std::shared_ptr<sync_handler>& _handler)
         && (client_side_logging_filter_.empty()
             || (1
                 == client_side_logging_filter_.count(
-                    std::make_tuple(its_sync_handler->service_id_, ANY_INSTANCE)))
+                    std::make_tuple(its_sync_handler.service_id_, ANY_INSTANCE)))
             || (1
                 == client_side_logging_filter_.count(std::make_tuple(
-                    its_sync_handler->service_id_, its_sync_handler->instance_id_)))))
+                    its_sync_handler.service_id_, its_sync_handler.instance_id_)))))
     {
         VSOMEIP_INFO << "Invoking handler: (" << std::hex << std::setfill('0') << std::setw(4)
-                     << client_ << "): [" << std::setw(4) << its_sync_handler->service_id_ << "."
-                     << std::setw(4) << its_sync_handler->instance_id_ << "." << std::setw(4)
-                     << its_sync_handler->method_id_ << ":" << std::setw(4)
-                     << its_sync_handler->session_id_ << "] "
-                     << "type=" << static_cast<std::uint32_t>(its_sync_handler->handler_type_)
+                     << client_ << "): [" << std::setw(4) << its_sync_handler.service_id_ << "."
+                     << std::setw(4) << its_sync_handler.instance_id_ << "." << std::setw(4)
+                     << its_sync_handler.method_id_ << ":" << std::setw(4)
+                     << its_sync_handler.session_id_ << "] "
+                     << "type=" << static_cast<std::uint32_t>(its_sync_handler.handler_type_)
                      << " thread=" << std::hex << its_id;
     }
 
@@ -2447,7 +2635,27 @@ void application_impl::invoke_handler(std::shared_ptr<sync_handler>& _handler)
     {
         try
         {
-            _handler->handler_();
+            if (_handler->message_handler_)
+            {
+                dispatcher_backlog_.fetch_sub(1, std::memory_order_relaxed);
+                if (message_statistics_->is_latency_enabled())
+                {
+                    const auto its_start = std::chrono::steady_clock::now();
+                    (*_handler->message_handler_)(_handler->message_);
+                    const auto its_duration =
+                        std::chrono::duration_cast<std::chrono::microseconds>(
+                            std::chrono::steady_clock::now() - its_start);
+                    message_statistics_->insert_latency(
+                        its_sync_handler.service_id_, its_sync_handler.instance_id_,
+                        its_sync_handler.method_id_,
+                        static_cast<std::uint32_t>(std::min<std::chrono::microseconds::rep>(
+                            its_duration.count(), std::numeric_limits<std::uint32_t>::max())));
+                }
+                else
+                    (*_handler->message_handler_)(_handler->message_);
+            }
+            else
+                _handler->handler_();
         } catch (const std::exception& e)
         {
             VSOMEIP_ERROR << "application_impl::invoke_handler caught exception: " << e.what();
@@ -2498,6 +2706,12 @@ bool application_impl::is_active_dispatcher(const std::thread::id& _id) const
     {
         if (dispatcher_mutex_.try_lock())
         {
+            // Lane dispatchers run in parallel and therefore are always active
+            if (lane_dispatchers_.find(_id) != lane_dispatchers_.end())
+            {
+                dispatcher_mutex_.unlock();
+                return true;
+            }
             for (const auto& d : dispatchers_)
             {
                 if (d.first != _id
@@ -2565,6 +2779,7 @@ void application_impl::clear_all_handler()
     }
     {
         std::lock_guard<std::mutex> its_lock(handlers_mutex_);
+        drain_dispatch_queue_unlocked();
         handlers_.clear();
     }
 }
@@ -2632,6 +2847,8 @@ void application_impl::shutdown()
             }
         }
         availability_handlers_.clear();
+        busy_lanes_.clear();
+        lane_dispatchers_.clear();
         running_dispatchers_.clear();
         elapsed_dispatchers_.clear();
         dispatchers_.clear();
@@ -2724,6 +2941,7 @@ void application_impl::shutdown()
     {
         work_.reset();
         io_.stop();
+        io_shards_.stop();
     } catch (const std::exception& e)
     {
         VSOMEIP_ERROR << "application_impl::" << __func__ << ": stopping io, "
@@ -3033,21 +3251,21 @@ bool application_impl::check_subscription_state(service_t _service, instance_t _
     return should_subscribe;
 }
 
-void application_impl::print_blocking_call(const std::shared_ptr<sync_handler>& _handler)
+void application_impl::print_blocking_call(const sync_handler& _handler)
 {
-    switch (_handler->handler_type_)
+    switch (_handler.handler_type_)
     {
     case handler_type_e::AVAILABILITY:
         VSOMEIP_WARNING << "BLOCKING CALL AVAILABILITY(" << std::hex << std::setfill('0')
                         << std::setw(4) << get_client() << "): [" << std::setw(4)
-                        << _handler->service_id_ << "." << std::setw(4) << _handler->instance_id_
+                        << _handler.service_id_ << "." << std::setw(4) << _handler.instance_id_
                         << "]";
         break;
     case handler_type_e::MESSAGE:
         VSOMEIP_WARNING << "BLOCKING CALL MESSAGE(" << std::hex << std::setfill('0') << std::setw(4)
-                        << get_client() << "): [" << std::setw(4) << _handler->service_id_ << "."
-                        << std::setw(4) << _handler->instance_id_ << "." << std::setw(4)
-                        << _handler->method_id_ << ":" << std::setw(4) << _handler->session_id_
+                        << get_client() << "): [" << std::setw(4) << _handler.service_id_ << "."
+                        << std::setw(4) << _handler.instance_id_ << "." << std::setw(4)
+                        << _handler.method_id_ << ":" << std::setw(4) << _handler.session_id_
                         << "]";
         break;
     case handler_type_e::STATE:
@@ -3057,9 +3275,9 @@ void application_impl::print_blocking_call(const std::shared_ptr<sync_handler>&
     case handler_type_e::SUBSCRIPTION:
         VSOMEIP_WARNING << "BLOCKING CALL SUBSCRIPTION(" << std::hex << std::setfill('0')
                         << std::setw(4) << get_client() << "): [" << std::setw(4)
-                        << _handler->service_id_ << "." << std::setw(4) << _handler->instance_id_
-                        << "." << std::setw(4) << _handler->eventgroup_id_ << ":" << std::setw(4)
-                        << _handler->method_id_ << "]";
+                        << _handler.service_id_ << "." << std::setw(4) << _handler.instance_id_
+                        << "." << std::setw(4) << _handler.eventgroup_id_ << ":" << std::setw(4)
+                        << _handler.method_id_ << "]";
         break;
     case handler_type_e::OFFERED_SERVICES_INFO:
         VSOMEIP_WARNING << "BLOCKING CALL OFFERED_SERVICES_INFO(" << std::hex << std::setw(4)
@@ -3152,7 +3370,7 @@ void application_impl::on_offered_services_info(
             handler(_services);
         });
         its_sync_handler->handler_type_ = handler_type_e::OFFERED_SERVICES_INFO;
-        handlers_.push_back(its_sync_handler);
+        push_handler_unlocked(its_sync_handler);
         dispatcher_condition_.notify_one();
     }
 }
@@ -3180,7 +3398,7 @@ void application_impl::watchdog_cbk(boost::system::error_code const& _error)
                 handler();
             });
             its_sync_handler->handler_type_ = handler_type_e::WATCHDOG;
-            handlers_.push_back(its_sync_handler);
+            push_handler_unlocked(its_sync_handler);
             dispatcher_condition_.notify_one();
         }
     }
@@ -3604,10 +3822,10 @@ void application_impl::register_message_handler_ext(service_t _service, instance
         members_[key].clear();
         [[gnu::fallthrough]];
     case handler_registration_type_e::HRT_APPEND:
-        members_[key].push_back(_handler);
+        members_[key].push_back(std::make_shared<message_handler_t>(_handler));
         break;
     case handler_registration_type_e::HRT_PREPEND:
-        members_[key].push_front(_handler);
+        members_[key].push_front(std::make_shared<message_handler_t>(_handler));
         break;
     default:;
     }
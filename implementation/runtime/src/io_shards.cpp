@@ -0,0 +1,108 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <iomanip>
+#include <sstream>
+
+#if defined(__linux__) || defined(ANDROID)
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <vsomeip/internal/logger.hpp>
+
+#include "../include/io_shards.hpp"
+#include "../../utility/include/utility.hpp"
+
+namespace vsomeip_v3 {
+
+io_shards::io_shards() {}
+
+io_shards::~io_shards()
+{
+    stop();
+}
+
+void io_shards::init(std::size_t _count)
+{
+    while (contexts_.size() < _count)
+        contexts_.emplace_back(new boost::asio::io_context());
+}
+
+std::size_t io_shards::size() const
+{
+    return contexts_.size();
+}
+
+boost::asio::io_context& io_shards::get(std::size_t _hash)
+{
+    return *contexts_[_hash % contexts_.size()];
+}
+
+void io_shards::start(const std::string& _name, int _nice_level, const std::vector<int>& _cpus)
+{
+    for (std::size_t i = 0; i < contexts_.size(); ++i)
+    {
+        auto& its_context = *contexts_[i];
+        if (its_context.stopped())
+            its_context.restart();
+        work_.emplace_back(new work_guard_t(its_context.get_executor()));
+
+        const int its_cpu = (_cpus.empty() ? -1 : _cpus[i % _cpus.size()]);
+        threads_.emplace_back([&its_context, i, _name, _nice_level, its_cpu] {
+#if defined(__linux__) || defined(ANDROID)
+            {
+                std::stringstream s;
+                s << _name << std::hex << std::setw(2) << std::setfill('0') << i;
+                pthread_setname_np(pthread_self(), s.str().c_str());
+            }
+#endif
+            utility::set_thread_niceness(_nice_level);
+            if (its_cpu >= 0)
+                utility::set_thread_affinity(its_cpu);
+
+            VSOMEIP_INFO << "io shard thread " << _name << std::hex << std::setw(2)
+                         << std::setfill('0') << i << " is: " << std::this_thread::get_id()
+#if defined(__linux__) || defined(ANDROID)
+                         << " TID: " << std::dec << static_cast<int>(syscall(SYS_gettid))
+#endif
+                         << " CPU: " << std::dec << its_cpu;
+
+            while (true)
+            {
+                try
+                {
+                    its_context.run();
+                    break;
+                } catch (const std::exception& e)
+                {
+                    VSOMEIP_ERROR << "io_shards::start() caught exception: " << e.what();
+                }
+            }
+        });
+    }
+}
+
+void io_shards::stop()
+{
+    work_.clear();
+    for (auto& c : contexts_)
+        c->stop();
+
+    for (auto& t : threads_)
+    {
+        if (t.joinable())
+        {
+            if (t.get_id() == std::this_thread::get_id())
+                t.detach();
+            else
+                t.join();
+        }
+    }
+    threads_.clear();
+}
+
+} // namespace vsomeip_v3
@@ -0,0 +1,107 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_SECURITY_POLICY_DECISIONS_HPP_
+#define VSOMEIP_V3_SECURITY_POLICY_DECISIONS_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <vsomeip/export.hpp>
+#include <vsomeip/primitive_types.hpp>
+
+namespace vsomeip_v3 {
+
+struct policy;
+
+//
+// The client policies compiled into sorted, closed ranges that are searched
+// binary. Policies that allow credentials are indexed by disjoint uid
+// segments, so a lookup only visits the policies of the client's uid.
+// Policies that deny credentials apply to everybody else and are always
+// visited. The decisions are immutable and meant to be published as a
+// snapshot (std::shared_ptr<const policy_decisions>) that is rebuilt
+// whenever the policies change. Recent results, positive and negative,
+// are kept in a small direct mapped cache that is read without a lock.
+//
+class VSOMEIP_IMPORT_EXPORT policy_decisions {
+public:
+    explicit policy_decisions(const std::vector<std::shared_ptr<policy>>& _policies);
+
+    bool is_client_allowed(uid_t _uid, gid_t _gid, service_t _service, instance_t _instance,
+                           method_t _method, bool _is_request_service) const;
+
+private:
+    template<typename T_>
+    struct range {
+        T_ lower_;
+        T_ upper_;
+    };
+
+    struct instance_methods {
+        range<instance_t>            instances_;
+        std::vector<range<method_t>> methods_;
+    };
+
+    struct service_requests {
+        range<service_t>              services_;
+        std::vector<instance_methods> instances_;
+    };
+
+    struct credentials {
+        range<uid_t>              uids_;
+        std::vector<range<gid_t>> gids_;
+    };
+
+    struct rule {
+        std::vector<credentials>      credentials_;
+        std::vector<service_requests> requests_;
+        bool                          allow_what_;
+    };
+
+    // Credentials of a rule that allows credentials
+    struct grant {
+        std::uint32_t rule_;
+        std::uint32_t credentials_;
+    };
+
+    struct cache_entry {
+        // Odd while the entry is written
+        std::atomic<std::uint32_t> sequence_{0};
+        std::atomic<std::uint64_t> credentials_{0};
+        std::atomic<std::uint64_t> request_{0};
+    };
+
+    static constexpr std::size_t CACHE_SIZE = 1024;
+
+    bool decide(uid_t _uid, gid_t _gid, service_t _service, instance_t _instance,
+                method_t _method, bool _is_request_service) const;
+    bool is_allowed(const rule& _rule, service_t _service, instance_t _instance,
+                    method_t _method, bool _is_request_service) const;
+    bool has_credentials(const rule& _rule, uid_t _uid, gid_t _gid) const;
+
+    bool get_cached(std::size_t _index, std::uint64_t _credentials, std::uint64_t _request,
+                    bool& _is_allowed) const;
+    void set_cached(std::size_t _index, std::uint64_t _credentials, std::uint64_t _request,
+                    bool _is_allowed) const;
+
+    std::vector<rule> rules_;
+
+    // Sorted starts of the uid segments and the grants of each segment
+    std::vector<uid_t>              segment_starts_;
+    std::vector<std::vector<grant>> segments_;
+
+    // Rules that deny credentials
+    std::vector<std::uint32_t> exceptions_;
+
+    mutable std::array<cache_entry, CACHE_SIZE> cache_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_SECURITY_POLICY_DECISIONS_HPP_
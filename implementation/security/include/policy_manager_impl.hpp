@@ -20,6 +20,7 @@
 #include <vsomeip/vsomeip_sec.h>
 
 #include "../include/policy.hpp"
+#include "../include/policy_decisions.hpp"
 
 namespace vsomeip_v3 {
 
@@ -94,6 +95,9 @@ private:
             boost::icl::interval_set<T_> &_range, bool _exclude_margins = false);
     void load_security_update_whitelist(const configuration_element &_element);
     void load_security_policy_extensions(const configuration_element &_element);
+
+    std::shared_ptr<const policy_decisions> get_policy_decisions() const;
+    void reset_policy_decisions();
 #endif // !VSOMEIP_DISABLE_SECURITY
 
 public:
@@ -130,10 +134,9 @@ private:
     mutable boost::shared_mutex  any_client_policies_mutex_;
     std::vector<std::shared_ptr<policy> > any_client_policies_;
 
-    mutable boost::shared_mutex is_client_allowed_cache_mutex_;
-    mutable std::map<std::pair<uid_t, gid_t>,
-        std::set<std::tuple<service_t, instance_t, method_t> >
-    > is_client_allowed_cache_;
+    // Compiled any_client_policies_. Reset whenever the policies change and
+    // rebuilt by the next lookup. Accessed by std::atomic_load/std::atomic_store only.
+    mutable std::shared_ptr<const policy_decisions> policy_decisions_;
 
     bool policy_enabled_;
     bool check_credentials_;
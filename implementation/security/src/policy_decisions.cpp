@@ -0,0 +1,262 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+#include <limits>
+
+#include <vsomeip/constants.hpp>
+
+#include "../include/policy.hpp"
+#include "../include/policy_decisions.hpp"
+
+namespace vsomeip_v3 {
+
+namespace {
+
+const std::uint64_t CACHE_VALID           = 0x1;
+const std::uint64_t CACHE_ALLOWED         = 0x2;
+const std::uint64_t CACHE_REQUEST_SERVICE = 0x4;
+
+std::size_t get_cache_index(std::uint64_t _credentials, std::uint64_t _request, std::size_t _size)
+{
+    const std::uint64_t its_hash =
+        ((_credentials * 0x9E3779B97F4A7C15ULL) ^ _request) * 0xFF51AFD7ED558CCDULL;
+    return static_cast<std::size_t>(its_hash >> 32) & (_size - 1);
+}
+
+// Returns the entry whose range (as returned by _get_range) contains _value
+template<typename Entry_, typename Value_, typename Get_range_>
+const Entry_* find_entry(const std::vector<Entry_>& _entries, Value_ _value, Get_range_ _get_range)
+{
+    auto its_entry = std::upper_bound(
+        _entries.begin(), _entries.end(), _value,
+        [&_get_range](Value_ _v, const Entry_& _e) { return _v < _get_range(_e).lower_; });
+    if (its_entry == _entries.begin())
+        return nullptr;
+
+    --its_entry;
+    return (_value <= _get_range(*its_entry).upper_ ? &*its_entry : nullptr);
+}
+
+template<typename Range_>
+bool contains(const std::vector<Range_>& _ranges, decltype(Range_::lower_) _value)
+{
+    return find_entry(_ranges, _value, [](const Range_& _r) -> const Range_& { return _r; })
+           != nullptr;
+}
+
+} // namespace
+
+policy_decisions::policy_decisions(const std::vector<std::shared_ptr<policy>>& _policies)
+{
+    std::vector<grant> its_grants;
+    for (const auto& p : _policies)
+    {
+        std::lock_guard<std::mutex> its_policy_lock(p->mutex_);
+
+        rule its_rule;
+        its_rule.allow_what_ = p->allow_what_;
+
+        for (const auto& c : p->credentials_)
+        {
+            credentials its_credentials;
+            get_bounds(c.first, its_credentials.uids_.lower_, its_credentials.uids_.upper_);
+            for (const auto& g : c.second)
+            {
+                range<gid_t> its_gids;
+                get_bounds(g, its_gids.lower_, its_gids.upper_);
+                its_credentials.gids_.push_back(its_gids);
+            }
+            its_rule.credentials_.push_back(std::move(its_credentials));
+        }
+
+        for (const auto& s : p->requests_)
+        {
+            service_requests its_requests;
+            get_bounds(s.first, its_requests.services_.lower_, its_requests.services_.upper_);
+            for (const auto& i : s.second)
+            {
+                instance_methods its_methods;
+                get_bounds(i.first, its_methods.instances_.lower_, its_methods.instances_.upper_);
+                for (const auto& m : i.second)
+                {
+                    range<method_t> its_range;
+                    get_bounds(m, its_range.lower_, its_range.upper_);
+                    its_methods.methods_.push_back(its_range);
+                }
+                its_requests.instances_.push_back(std::move(its_methods));
+            }
+            its_rule.requests_.push_back(std::move(its_requests));
+        }
+
+        const auto its_rule_index = static_cast<std::uint32_t>(rules_.size());
+        if (p->allow_who_)
+        {
+            for (std::uint32_t i = 0; i < its_rule.credentials_.size(); ++i)
+                its_grants.push_back({its_rule_index, i});
+        }
+        else
+        {
+            exceptions_.push_back(its_rule_index);
+        }
+        rules_.push_back(std::move(its_rule));
+    }
+
+    // Split the uids into segments that are covered by the same grants
+    std::vector<std::uint64_t> its_boundaries;
+    for (const auto& g : its_grants)
+    {
+        const auto& its_uids = rules_[g.rule_].credentials_[g.credentials_].uids_;
+        its_boundaries.push_back(its_uids.lower_);
+        its_boundaries.push_back(std::uint64_t(its_uids.upper_) + 1);
+    }
+    std::sort(its_boundaries.begin(), its_boundaries.end());
+    its_boundaries.erase(std::unique(its_boundaries.begin(), its_boundaries.end()),
+                         its_boundaries.end());
+    for (const auto b : its_boundaries)
+    {
+        if (b <= std::numeric_limits<uid_t>::max())
+            segment_starts_.push_back(static_cast<uid_t>(b));
+    }
+    segments_.resize(segment_starts_.size());
+
+    for (const auto& g : its_grants)
+    {
+        const auto& its_uids = rules_[g.rule_].credentials_[g.credentials_].uids_;
+        auto        its_start =
+            std::lower_bound(segment_starts_.begin(), segment_starts_.end(), its_uids.lower_);
+        for (; its_start != segment_starts_.end() && *its_start <= its_uids.upper_; ++its_start)
+            segments_[static_cast<std::size_t>(its_start - segment_starts_.begin())].push_back(g);
+    }
+}
+
+bool policy_decisions::is_client_allowed(uid_t _uid, gid_t _gid, service_t _service,
+                                         instance_t _instance, method_t _method,
+                                         bool _is_request_service) const
+{
+    const std::uint64_t its_credentials = std::uint64_t(_uid) << 32 | _gid;
+    const std::uint64_t its_request =
+        std::uint64_t(_service) << 48 | std::uint64_t(_instance) << 32
+        | std::uint64_t(_method) << 16 | (_is_request_service ? CACHE_REQUEST_SERVICE : 0)
+        | CACHE_VALID;
+    const std::size_t its_index = get_cache_index(its_credentials, its_request, CACHE_SIZE);
+
+    bool is_allowed(false);
+    if (!get_cached(its_index, its_credentials, its_request, is_allowed))
+    {
+        is_allowed = decide(_uid, _gid, _service, _instance, _method, _is_request_service);
+        set_cached(its_index, its_credentials, its_request, is_allowed);
+    }
+    return is_allowed;
+}
+
+bool policy_decisions::decide(uid_t _uid, gid_t _gid, service_t _service, instance_t _instance,
+                              method_t _method, bool _is_request_service) const
+{
+    // Policies that allow the credentials
+    auto its_segment = std::upper_bound(segment_starts_.begin(), segment_starts_.end(), _uid);
+    if (its_segment != segment_starts_.begin())
+    {
+        const auto& its_grants =
+            segments_[static_cast<std::size_t>(its_segment - segment_starts_.begin()) - 1];
+        for (const auto& g : its_grants)
+        {
+            const auto& its_rule = rules_[g.rule_];
+            if (contains(its_rule.credentials_[g.credentials_].gids_, _gid)
+                && is_allowed(its_rule, _service, _instance, _method, _is_request_service))
+                return true;
+        }
+    }
+
+    // Policies that deny the credentials apply to all others
+    for (const auto r : exceptions_)
+    {
+        const auto& its_rule = rules_[r];
+        if (!has_credentials(its_rule, _uid, _gid)
+            && is_allowed(its_rule, _service, _instance, _method, _is_request_service))
+            return true;
+    }
+
+    return false;
+}
+
+bool policy_decisions::is_allowed(const rule& _rule, service_t _service, instance_t _instance,
+                                  method_t _method, bool _is_request_service) const
+{
+    bool is_matching(false);
+
+    const auto its_service = find_entry(_rule.requests_, _service,
+                                        [](const service_requests& _r) { return _r.services_; });
+    if (its_service)
+    {
+        const auto its_instance =
+            find_entry(its_service->instances_, _instance,
+                       [](const instance_methods& _i) { return _i.instances_; });
+        if (its_instance)
+        {
+            // handle VSOMEIP_REQUEST_SERVICE
+            is_matching = (_is_request_service || contains(its_instance->methods_, _method));
+        }
+    }
+
+    if (_rule.allow_what_)
+        return is_matching;
+
+    // deny policy
+    // allow client if the service / instance / !ANY_METHOD was not found
+    // or if the service / instance / ANY_METHOD was not found and it is a
+    // "deny nothing" policy
+    return (!is_matching && (_method != ANY_METHOD || _rule.requests_.empty()));
+}
+
+bool policy_decisions::has_credentials(const rule& _rule, uid_t _uid, gid_t _gid) const
+{
+    const auto its_credentials =
+        find_entry(_rule.credentials_, _uid, [](const credentials& _c) { return _c.uids_; });
+    return (its_credentials && contains(its_credentials->gids_, _gid));
+}
+
+bool policy_decisions::get_cached(std::size_t _index, std::uint64_t _credentials,
+                                  std::uint64_t _request, bool& _is_allowed) const
+{
+    const auto& its_entry = cache_[_index];
+
+    const auto its_sequence = its_entry.sequence_.load(std::memory_order_acquire);
+    if (its_sequence & 1)
+        return false;
+
+    const auto its_credentials = its_entry.credentials_.load(std::memory_order_relaxed);
+    const auto its_request     = its_entry.request_.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (its_entry.sequence_.load(std::memory_order_relaxed) != its_sequence)
+        return false;
+
+    if (its_credentials != _credentials || (its_request & ~CACHE_ALLOWED) != _request)
+        return false;
+
+    _is_allowed = ((its_request & CACHE_ALLOWED) != 0);
+    return true;
+}
+
+void policy_decisions::set_cached(std::size_t _index, std::uint64_t _credentials,
+                                  std::uint64_t _request, bool _is_allowed) const
+{
+    auto& its_entry = cache_[_index];
+
+    // Skip if another thread is just writing the entry
+    auto its_sequence = its_entry.sequence_.load(std::memory_order_relaxed);
+    if ((its_sequence & 1)
+        || !its_entry.sequence_.compare_exchange_strong(its_sequence, its_sequence + 1,
+                                                        std::memory_order_relaxed))
+        return;
+    std::atomic_thread_fence(std::memory_order_release);
+
+    its_entry.credentials_.store(_credentials, std::memory_order_relaxed);
+    its_entry.request_.store(_request | (_is_allowed ? CACHE_ALLOWED : 0),
+                             std::memory_order_relaxed);
+    its_entry.sequence_.store(its_sequence + 2, std::memory_order_release);
+}
+
+} // namespace vsomeip_v3
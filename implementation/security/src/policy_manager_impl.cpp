@@ -246,85 +246,10 @@ bool policy_manager_impl::is_client_allowed(const vsomeip_sec_client_t* _sec_cli
         return !check_credentials_;
     }
 
-    // Check cache
-    auto its_credentials = std::make_pair(its_uid, its_gid);
-    auto its_key         = std::make_tuple(_service, _instance, _method);
+    if (get_policy_decisions()->is_client_allowed(its_uid, its_gid, _service, _instance, _method,
+                                                  _is_request_service))
     {
-        boost::shared_lock<boost::shared_mutex> its_cache_lock(is_client_allowed_cache_mutex_);
-        const auto its_iter = is_client_allowed_cache_.find(its_credentials);
-        if (its_iter != is_client_allowed_cache_.end())
-        {
-            if (its_iter->second.find(its_key) != its_iter->second.end())
-            {
-                return true;
-            }
-        }
-    }
-
-    // Check policies
-    boost::shared_lock<boost::shared_mutex> its_lock(any_client_policies_mutex_);
-    for (const auto& p : any_client_policies_)
-    {
-        std::lock_guard<std::mutex> its_policy_lock(p->mutex_);
-        bool                        has_uid, has_gid(false);
-        bool                        is_matching(false);
-
-        const auto found_uid = p->credentials_.find(its_uid);
-        has_uid              = (found_uid != p->credentials_.end());
-        if (has_uid)
-        {
-            const auto found_gid = found_uid->second.find(its_gid);
-            has_gid              = (found_gid != found_uid->second.end());
-        }
-
-        const auto found_service = p->requests_.find(_service);
-        if (found_service != p->requests_.end())
-        {
-            const auto found_instance = found_service->second.find(_instance);
-            if (found_instance != found_service->second.end())
-            {
-                if (!_is_request_service)
-                {
-                    const auto found_method = found_instance->second.find(_method);
-                    is_matching             = (found_method != found_instance->second.end());
-                }
-                else
-                {
-                    // handle VSOMEIP_REQUEST_SERVICE
-                    is_matching = true;
-                }
-            }
-        }
-
-        if ((has_uid && has_gid && p->allow_who_) || ((!has_uid || !has_gid) && !p->allow_who_))
-        {
-            if (p->allow_what_)
-            {
-                // allow policy
-                if (is_matching)
-                {
-                    boost::unique_lock<boost::shared_mutex> its_cache_lock(
-                        is_client_allowed_cache_mutex_);
-                    is_client_allowed_cache_[its_credentials].insert(its_key);
-                    return true;
-                }
-            }
-            else
-            {
-                // deny policy
-                // allow client if the service / instance / !ANY_METHOD was not found
-                if ((!is_matching && (_method != ANY_METHOD))
-                    // allow client if the service / instance / ANY_METHOD was not found
-                    // and it is a "deny nothing" policy
-                    || (!is_matching && (_method == ANY_METHOD) && p->requests_.empty()))
-                {
-                    boost::unique_lock<boost::shared_mutex> its_cache_lock(
-                        is_client_allowed_cache_mutex_);
-                    is_client_allowed_cache_[its_credentials].insert(its_key);
-                    return true;
-                }
-            }
-        }
+        return true;
     }
 
     std::string security_mode_text = " ~> Skip!";
@@ -482,10 +407,10 @@ bool policy_manager_impl::remove_security_policy(uid_t _uid, gid_t _gid)
             {
                 ++p_it;
             }
-
-            boost::unique_lock<boost::shared_mutex> its_cache_lock(is_client_allowed_cache_mutex_);
-            is_client_allowed_cache_.erase(std::make_pair(_uid, _gid));
         }
+        // Drop the cached decisions before the exclusive lock is released
+        if (was_removed)
+            reset_policy_decisions();
     }
     return was_removed;
 }
@@ -550,8 +475,7 @@ void policy_manager_impl::update_security_policy(uid_t _uid, gid_t _gid,
         any_client_policies_.push_back(_policy);
     }
 
-    boost::unique_lock<boost::shared_mutex> its_cache_lock(is_client_allowed_cache_mutex_);
-    is_client_allowed_cache_.erase(std::make_pair(_uid, _gid));
+    reset_policy_decisions();
 }
 
 void policy_manager_impl::add_security_credentials(uid_t _uid, gid_t _gid,
@@ -585,6 +509,7 @@ void policy_manager_impl::add_security_credentials(uid_t _uid, gid_t _gid,
     if (!was_found)
     {
         any_client_policies_.push_back(_policy);
+        reset_policy_decisions();
         VSOMEIP_INFO << __func__ << " Added security credentials at client: 0x" << std::hex
                      << _client << std::dec << " with UID: " << _uid << " GID: " << _gid;
     }
@@ -884,7 +809,10 @@ void policy_manager_impl::load_policy(const boost::property_tree::ptree& _tree)
     }
     boost::unique_lock<boost::shared_mutex> its_lock(any_client_policies_mutex_);
     if (!exist_in_any_client_policies_unlocked(policy))
+    {
         any_client_policies_.push_back(policy);
+        reset_policy_decisions();
+    }
 }
 
 void policy_manager_impl::load_policy_body(std::shared_ptr<policy>& _policy,
@@ -1308,6 +1236,28 @@ void policy_manager_impl::load_interval_set(const boost::property_tree::ptree& _
     _intervals = its_intervals;
 }
 
+std::shared_ptr<const policy_decisions> policy_manager_impl::get_policy_decisions() const
+{
+    auto its_decisions = std::atomic_load(&policy_decisions_);
+    if (!its_decisions)
+    {
+        boost::shared_lock<boost::shared_mutex> its_lock(any_client_policies_mutex_);
+        its_decisions = std::atomic_load(&policy_decisions_);
+        if (!its_decisions)
+        {
+            its_decisions = std::make_shared<const policy_decisions>(any_client_policies_);
+            std::atomic_store(&policy_decisions_, its_decisions);
+        }
+    }
+    return its_decisions;
+}
+
+// Must be called with any_client_policies_mutex_ locked exclusively
+void policy_manager_impl::reset_policy_decisions()
+{
+    std::atomic_store(&policy_decisions_, std::shared_ptr<const policy_decisions>());
+}
+
 void policy_manager_impl::get_requester_policies(
     const std::shared_ptr<policy> _policy, std::set<std::shared_ptr<policy>>& _requesters) const
 {
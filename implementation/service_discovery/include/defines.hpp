@@ -21,6 +21,10 @@
 #define VSOMEIP_SOMEIP_SD_OPTION_HEADER_SIZE     3
 #define VSOMEIP_SOMEIP_SD_EMPTY_MESSAGE_SIZE     28
 #define VSOMEIP_SOMEIP_SD_SPACE_FOR_PAYLOAD      VSOMEIP_MAX_UDP_MESSAGE_SIZE - VSOMEIP_SOMEIP_SD_EMPTY_MESSAGE_SIZE;
+#define VSOMEIP_SOMEIP_SD_ARENA_BLOCK_SIZE       4096
+
+#define VSOMEIP_SOMEIP_SD_FLAGS_POS              16
+#define VSOMEIP_REBOOT_FLAG                      0x80
 
 
 
@@ -13,9 +13,11 @@
 
 #include <vsomeip/message.hpp>
 
+#include "../include/defines.hpp"
 #include "../include/primitive_types.hpp"
 #include "../../message/include/message_base_impl.hpp"
 #include "../../endpoints/include/endpoint_definition.hpp"
+#include "../../utility/include/arena.hpp"
 
 #  if _MSC_VER >= 1300
 /*
@@ -51,9 +53,21 @@ public:
         vsomeip_v3::instance_t instance_;
         vsomeip_v3::eventgroup_t eventgroup_;
     };
-    message_impl();
+    // Entries and options are allocated from an arena with blocks of
+    // the given size. A block size of 0 allocates them separately.
+    message_impl(std::size_t _arena_block_size = VSOMEIP_SOMEIP_SD_ARENA_BLOCK_SIZE);
     virtual ~message_impl();
 
+    // Creates an entry or option within the arena of the message.
+    // Must not be called concurrently for the same message.
+    template<typename T_, typename... Args_>
+    std::shared_ptr<T_> create(Args_&&... _args) {
+        if (arena_)
+            return std::allocate_shared<T_>(arena_allocator<T_>(arena_),
+                    std::forward<Args_>(_args)...);
+        return std::make_shared<T_>(std::forward<Args_>(_args)...);
+    }
+
     length_t get_length() const;
     void set_length(length_t _length);
 
@@ -106,8 +120,8 @@ public:
     std::string get_env() const;
 
 private:
-    entry_impl * deserialize_entry(vsomeip_v3::deserializer *_from);
-    option_impl * deserialize_option(vsomeip_v3::deserializer *_from);
+    std::shared_ptr<entry_impl> deserialize_entry(vsomeip_v3::deserializer *_from);
+    std::shared_ptr<option_impl> deserialize_option(vsomeip_v3::deserializer *_from);
 
 private:
     flags_t flags_;
@@ -119,6 +133,8 @@ private:
     std::mutex message_mutex_;
 
     std::uint32_t current_message_size_;
+
+    std::shared_ptr<arena> arena_;
 };
 
 } // namespace sd
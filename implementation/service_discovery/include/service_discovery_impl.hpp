@@ -128,7 +128,8 @@ private:
     entry_data_t create_eventgroup_entry(service_t _service, instance_t _instance,
                                          eventgroup_t                         _eventgroup,
                                          const std::shared_ptr<subscription>& _subscription,
-                                         reliability_type_e                   _offer_type);
+                                         reliability_type_e                   _offer_type,
+                                         const std::shared_ptr<message_impl>& _message);
 
     void insert_subscription_ack(const std::shared_ptr<remote_subscription_ack>& _acknowledgement,
                                  const std::shared_ptr<eventgroupinfo>& _info, ttl_t _ttl,
@@ -196,6 +197,8 @@ private:
                                              const std::set<client_t>& _clients);
 
     bool send(const std::vector<std::shared_ptr<message_impl>>& _messages);
+    void update_offer_cache(std::uint32_t _revision);
+    bool send_offer_cache();
     bool serialize_and_send(const std::vector<std::shared_ptr<message_impl>>& _messages,
                             const boost::asio::ip::address&                   _address);
 
@@ -324,8 +327,9 @@ private:
 
     void send_subscription_ack(const std::shared_ptr<remote_subscription_ack>& _acknowledgement);
 
-    std::shared_ptr<option_impl> create_ip_option(const boost::asio::ip::address& _address,
-                                                  uint16_t _port, bool _is_reliable) const;
+    std::shared_ptr<option_impl>
+    create_ip_option(const boost::asio::ip::address& _address, uint16_t _port, bool _is_reliable,
+                     const std::shared_ptr<message_impl>& _message) const;
 
     void send_subscription(const std::shared_ptr<subscription>& _subscription,
                            const service_t _service, const instance_t _instance,
@@ -473,6 +477,16 @@ private:
 
     std::mutex offer_mutex_;
     std::mutex check_ttl_mutex_;
+
+    // Serialized offer messages of the main phase. They are only created
+    // again if an offered service (see serviceinfo::get_offer_revision)
+    // or the SD state changed. Protected by offer_mutex_.
+    std::vector<std::vector<byte_t>>     offer_cache_;
+    std::shared_ptr<endpoint_definition> offer_cache_target_;
+    bool                                 is_offer_cache_valid_;
+    std::uint32_t                        offer_cache_revision_;
+    bool                                 offer_cache_suspended_;
+    bool                                 offer_cache_diagnosis_;
 };
 
 } // namespace sd
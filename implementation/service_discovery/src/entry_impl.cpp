@@ -177,9 +177,11 @@ bool entry_impl::deserialize(vsomeip_v3::deserializer* _from)
     num_options_[0] = uint8_t(its_numbers >> 4);
     num_options_[1] = uint8_t(its_numbers & 0xF);
 
+    options_[0].reserve(num_options_[0]);
     for (uint16_t i = index1_; i < index1_ + num_options_[0]; ++i)
         options_[0].push_back((uint8_t)(i));
 
+    options_[1].reserve(num_options_[1]);
     for (uint16_t i = index2_; i < index2_ + num_options_[1]; ++i)
         options_[1].push_back((uint8_t)(i));
 
@@ -34,9 +34,12 @@
 
 namespace vsomeip_v3 { namespace sd {
 
-message_impl::message_impl()
+message_impl::message_impl(std::size_t _arena_block_size)
     : flags_(0x0), options_length_(0x0), current_message_size_(VSOMEIP_SOMEIP_SD_EMPTY_MESSAGE_SIZE)
 {
+    if (_arena_block_size > 0)
+        arena_ = std::make_shared<arena>(_arena_block_size);
+
     header_.service_  = VSOMEIP_SD_SERVICE;
     header_.instance_ = VSOMEIP_SD_INSTANCE;
     header_.method_   = VSOMEIP_SD_METHOD;
@@ -78,8 +81,6 @@ length_t message_impl::get_size() const
     return current_message_size_;
 }
 
-#define VSOMEIP_REBOOT_FLAG 0x80
-
 bool message_impl::get_reboot_flag() const
 {
     return ((flags_ & VSOMEIP_REBOOT_FLAG) != 0);
@@ -318,14 +319,15 @@ bool message_impl::deserialize(vsomeip_v3::deserializer* _from)
 
     // set remaining bytes to length of entries array
     _from->set_remaining(entries_length);
+    entries_.reserve(entries_length / VSOMEIP_SOMEIP_SD_ENTRY_SIZE);
 
     // deserialize the entries
     while (is_successful && _from->get_remaining())
     {
-        std::shared_ptr<entry_impl> its_entry(deserialize_entry(_from));
+        auto its_entry = deserialize_entry(_from);
         if (its_entry)
         {
-            entries_.push_back(its_entry);
+            entries_.push_back(std::move(its_entry));
         }
         else
         {
@@ -353,10 +355,10 @@ bool message_impl::deserialize(vsomeip_v3::deserializer* _from)
 
     while (option_is_successful && _from->get_remaining())
     {
-        std::shared_ptr<option_impl> its_option(deserialize_option(_from));
+        auto its_option = deserialize_option(_from);
         if (its_option)
         {
-            options_.push_back(its_option);
+            options_.push_back(std::move(its_option));
         }
         else
         {
@@ -367,10 +369,10 @@ bool message_impl::deserialize(vsomeip_v3::deserializer* _from)
     return is_successful;
 }
 
-entry_impl* message_impl::deserialize_entry(vsomeip_v3::deserializer* _from)
+std::shared_ptr<entry_impl> message_impl::deserialize_entry(vsomeip_v3::deserializer* _from)
 {
-    entry_impl* deserialized_entry = 0;
-    uint8_t     tmp_entry_type;
+    std::shared_ptr<entry_impl> deserialized_entry;
+    uint8_t                     tmp_entry_type;
 
     if (_from->look_ahead(0, tmp_entry_type))
     {
@@ -382,7 +384,7 @@ entry_impl* message_impl::deserialize_entry(vsomeip_v3::deserializer* _from)
         case entry_type_e::OFFER_SERVICE:
             // case entry_type_e::STOP_OFFER_SERVICE:
         case entry_type_e::REQUEST_SERVICE:
-            deserialized_entry = new serviceentry_impl;
+            deserialized_entry = create<serviceentry_impl>();
             break;
 
         case entry_type_e::FIND_EVENT_GROUP:
@@ -392,7 +394,7 @@ entry_impl* message_impl::deserialize_entry(vsomeip_v3::deserializer* _from)
             // case entry_type_e::STOP_SUBSCRIBE_EVENTGROUP:
         case entry_type_e::SUBSCRIBE_EVENTGROUP_ACK:
             // case entry_type_e::STOP_SUBSCRIBE_EVENTGROUP_ACK:
-            deserialized_entry = new eventgroupentry_impl;
+            deserialized_entry = create<eventgroupentry_impl>();
             break;
 
         default:
@@ -400,24 +402,21 @@ entry_impl* message_impl::deserialize_entry(vsomeip_v3::deserializer* _from)
         };
 
         // deserialize object
-        if (0 != deserialized_entry)
+        if (deserialized_entry)
         {
             deserialized_entry->set_owning_message(this);
             if (!deserialized_entry->deserialize(_from))
-            {
-                delete deserialized_entry;
-                deserialized_entry = 0;
-            };
+                deserialized_entry.reset();
         }
     }
 
     return deserialized_entry;
 }
 
-option_impl* message_impl::deserialize_option(vsomeip_v3::deserializer* _from)
+std::shared_ptr<option_impl> message_impl::deserialize_option(vsomeip_v3::deserializer* _from)
 {
-    option_impl* deserialized_option = 0;
-    uint8_t      tmp_option_type;
+    std::shared_ptr<option_impl> deserialized_option;
+    uint8_t                      tmp_option_type;
 
     if (_from->look_ahead(2, tmp_option_type))
     {
@@ -426,37 +425,34 @@ option_impl* message_impl::deserialize_option(vsomeip_v3::deserializer* _from)
         switch (deserialized_option_type)
         {
         case option_type_e::CONFIGURATION:
-            deserialized_option = new configuration_option_impl;
+            deserialized_option = create<configuration_option_impl>();
             break;
         case option_type_e::LOAD_BALANCING:
-            deserialized_option = new load_balancing_option_impl;
+            deserialized_option = create<load_balancing_option_impl>();
             break;
         case option_type_e::PROTECTION:
-            deserialized_option = new protection_option_impl;
+            deserialized_option = create<protection_option_impl>();
             break;
         case option_type_e::IP4_ENDPOINT:
         case option_type_e::IP4_MULTICAST:
-            deserialized_option = new ipv4_option_impl;
+            deserialized_option = create<ipv4_option_impl>();
             break;
         case option_type_e::IP6_ENDPOINT:
         case option_type_e::IP6_MULTICAST:
-            deserialized_option = new ipv6_option_impl;
+            deserialized_option = create<ipv6_option_impl>();
             break;
         case option_type_e::SELECTIVE:
-            deserialized_option = new selective_option_impl;
+            deserialized_option = create<selective_option_impl>();
             break;
 
         default:
-            deserialized_option = new unknown_option_impl();
+            deserialized_option = create<unknown_option_impl>();
             break;
         };
 
         // deserialize object
-        if (0 != deserialized_option && !deserialized_option->deserialize(_from))
-        {
-            delete deserialized_option;
-            deserialized_option = 0;
-        };
+        if (deserialized_option && !deserialized_option->deserialize(_from))
+            deserialized_option.reset();
     }
 
     return deserialized_option;
@@ -71,7 +71,11 @@ service_discovery_impl::service_discovery_impl(service_discovery_host*
       is_diagnosis_(false),
       last_msg_received_timer_(_host->get_io()),
       last_msg_received_timer_timeout_(VSOMEIP_SD_DEFAULT_CYCLIC_OFFER_DELAY
-                                       + (VSOMEIP_SD_DEFAULT_CYCLIC_OFFER_DELAY / 10))
+                                       + (VSOMEIP_SD_DEFAULT_CYCLIC_OFFER_DELAY / 10)),
+      is_offer_cache_valid_(false),
+      offer_cache_revision_(0),
+      offer_cache_suspended_(false),
+      offer_cache_diagnosis_(false)
 {
     next_subscription_expiration_ = std::chrono::steady_clock::now() + std::chrono::hours(24);
 }
@@ -350,6 +354,8 @@ void service_discovery_impl::send_subscription(const std::shared_ptr<subscriptio
     get_subscription_address(its_reliable, its_unreliable, its_address);
     if (!its_address.is_unspecified())
     {
+        // TODO: Implement a simple path, that sends a single message
+        auto                     its_current_message = std::make_shared<message_impl>();
         entry_data_t             its_data;
         const reliability_type_e its_reliability_type =
             get_eventgroup_reliability(_service, _instance, _eventgroup, _subscription);
@@ -358,7 +364,7 @@ void service_discovery_impl::send_subscription(const std::shared_ptr<subscriptio
             if (its_unreliable->is_established())
             {
                 its_data = create_eventgroup_entry(_service, _instance, _eventgroup, _subscription,
-                                                   its_reliability_type);
+                                                   its_reliability_type, its_current_message);
             }
             else
             {
@@ -370,7 +376,7 @@ void service_discovery_impl::send_subscription(const std::shared_ptr<subscriptio
             if (its_reliable->is_established())
             {
                 its_data = create_eventgroup_entry(_service, _instance, _eventgroup, _subscription,
-                                                   its_reliability_type);
+                                                   its_reliability_type, its_current_message);
             }
             else
             {
@@ -383,7 +389,7 @@ void service_discovery_impl::send_subscription(const std::shared_ptr<subscriptio
             if (its_reliable->is_established() && its_unreliable->is_established())
             {
                 its_data = create_eventgroup_entry(_service, _instance, _eventgroup, _subscription,
-                                                   its_reliability_type);
+                                                   its_reliability_type, its_current_message);
             }
             else
             {
@@ -408,8 +414,6 @@ void service_discovery_impl::send_subscription(const std::shared_ptr<subscriptio
 
         if (its_data.entry_)
         {
-            // TODO: Implement a simple path, that sends a single message
-            auto its_current_message = std::make_shared<message_impl>();
             std::vector<std::shared_ptr<message_impl>> its_messages;
             its_messages.push_back(its_current_message);
 
@@ -506,8 +510,9 @@ void service_discovery_impl::unsubscribe(service_t _service, instance_t _instanc
 
                     const reliability_type_e its_reliability_type = get_eventgroup_reliability(
                         _service, _instance, _eventgroup, its_subscription);
-                    auto its_data = create_eventgroup_entry(_service, _instance, _eventgroup,
-                                                            its_subscription, its_reliability_type);
+                    auto its_data =
+                        create_eventgroup_entry(_service, _instance, _eventgroup, its_subscription,
+                                                its_reliability_type, its_current_message);
                     if (its_data.entry_)
                         its_current_message->add_entry_data(its_data.entry_, its_data.options_);
 
@@ -559,9 +564,9 @@ void service_discovery_impl::unsubscribe_all(service_t _service, instance_t _ins
                     const reliability_type_e its_reliability = get_eventgroup_reliability(
                         _service, _instance, its_eventgroup.first, its_subscription);
 
-                    auto its_data =
-                        create_eventgroup_entry(_service, _instance, its_eventgroup.first,
-                                                its_subscription, its_reliability);
+                    auto its_data = create_eventgroup_entry(_service, _instance,
+                                                            its_eventgroup.first, its_subscription,
+                                                            its_reliability, its_current_message);
                     auto its_reliable   = its_subscription->get_endpoint(true);
                     auto its_unreliable = its_subscription->get_endpoint(false);
                     get_subscription_address(its_reliable, its_unreliable, its_address);
@@ -601,9 +606,9 @@ void service_discovery_impl::unsubscribe_all_on_suspend()
                     const reliability_type_e its_reliability =
                         get_eventgroup_reliability(its_service.first, its_instance.first,
                                                    its_eventgroup.first, its_subscription);
-                    auto its_data = create_eventgroup_entry(its_service.first, its_instance.first,
-                                                            its_eventgroup.first, its_subscription,
-                                                            its_reliability);
+                    auto its_data = create_eventgroup_entry(
+                        its_service.first, its_instance.first, its_eventgroup.first,
+                        its_subscription, its_reliability, its_current_message);
                     auto its_reliable   = its_subscription->get_endpoint(true);
                     auto its_unreliable = its_subscription->get_endpoint(false);
                     get_subscription_address(its_reliable, its_unreliable, its_address);
@@ -817,7 +822,7 @@ void service_discovery_impl::insert_find_entries(
                     uint8_t its_sent_counter = its_request->get_sent_counter();
                     if (its_sent_counter != repetitions_max_ + 1)
                     {
-                        auto its_entry = std::make_shared<serviceentry_impl>();
+                        auto its_entry = _messages.back()->create<serviceentry_impl>();
                         if (its_entry)
                         {
                             its_entry->set_type(entry_type_e::FIND_SERVICE);
@@ -871,7 +876,8 @@ void service_discovery_impl::insert_offer_entries(
 
 entry_data_t service_discovery_impl::create_eventgroup_entry(
     service_t _service, instance_t _instance, eventgroup_t _eventgroup,
-    const std::shared_ptr<subscription>& _subscription, reliability_type_e _reliability_type)
+    const std::shared_ptr<subscription>& _subscription, reliability_type_e _reliability_type,
+    const std::shared_ptr<message_impl>& _message)
 {
     entry_data_t its_data;
     its_data.entry_ = nullptr;
@@ -953,7 +959,7 @@ entry_data_t service_discovery_impl::create_eventgroup_entry(
         const std::uint16_t its_port = its_reliable_endpoint->get_local_port();
         if (its_port)
         {
-            its_entry = std::make_shared<eventgroupentry_impl>();
+            its_entry = _message->create<eventgroupentry_impl>();
             if (!its_entry)
             {
                 VSOMEIP_ERROR << __func__ << ": Could not create eventgroup entry.";
@@ -974,7 +980,7 @@ entry_data_t service_discovery_impl::create_eventgroup_entry(
                 if (_subscription->get_state(its_client)
                     == subscription_state_e::ST_RESUBSCRIBING_NOT_ACKNOWLEDGED)
                 {
-                    its_other = std::make_shared<eventgroupentry_impl>();
+                    its_other = _message->create<eventgroupentry_impl>();
                     its_other->set_type(entry_type_e::SUBSCRIBE_EVENTGROUP);
                     its_other->set_service(_service);
                     its_other->set_instance(_instance);
@@ -987,7 +993,7 @@ entry_data_t service_discovery_impl::create_eventgroup_entry(
                 }
             }
 
-            auto its_option = create_ip_option(unicast_, its_port, true);
+            auto its_option = create_ip_option(unicast_, its_port, true, _message);
             its_data.options_.push_back(its_option);
         }
         else
@@ -1011,7 +1017,7 @@ entry_data_t service_discovery_impl::create_eventgroup_entry(
         {
             if (!its_entry)
             {
-                its_entry = std::make_shared<eventgroupentry_impl>();
+                its_entry = _message->create<eventgroupentry_impl>();
                 if (!its_entry)
                 {
                     VSOMEIP_ERROR << __func__ << ": Could not create eventgroup entry.";
@@ -1035,7 +1041,7 @@ entry_data_t service_discovery_impl::create_eventgroup_entry(
                 {
                     if (!its_other)
                     {
-                        its_other = std::make_shared<eventgroupentry_impl>();
+                        its_other = _message->create<eventgroupentry_impl>();
                         its_other->set_type(entry_type_e::SUBSCRIBE_EVENTGROUP);
                         its_other->set_service(_service);
                         its_other->set_instance(_instance);
@@ -1049,7 +1055,7 @@ entry_data_t service_discovery_impl::create_eventgroup_entry(
                 }
             }
 
-            auto its_option = create_ip_option(unicast_, its_port, false);
+            auto its_option = create_ip_option(unicast_, its_port, false, _message);
             its_data.options_.push_back(its_option);
         }
         else
@@ -1068,7 +1074,7 @@ entry_data_t service_discovery_impl::create_eventgroup_entry(
 
     if (its_entry && _subscription->is_selective())
     {
-        auto its_selective_option = std::make_shared<selective_option_impl>();
+        auto its_selective_option = _message->create<selective_option_impl>();
         its_selective_option->set_clients(_subscription->get_clients());
         its_data.options_.push_back(its_selective_option);
     }
@@ -1143,7 +1149,7 @@ void service_discovery_impl::insert_subscription_ack(
 
     entry_data_t its_data;
 
-    auto its_entry = std::make_shared<eventgroupentry_impl>();
+    auto its_entry = its_message->create<eventgroupentry_impl>();
     its_entry->set_type(entry_type_e::SUBSCRIBE_EVENTGROUP_ACK);
     its_entry->set_service(its_service);
     its_entry->set_instance(its_instance);
@@ -1166,7 +1172,7 @@ void service_discovery_impl::insert_subscription_ack(
         {
             // SIP_SD_855
             // Only insert a multicast option for eventgroups with multicast threshold > 0
-            auto its_option = create_ip_option(its_address, its_port, false);
+            auto its_option = create_ip_option(its_address, its_port, false, its_message);
             its_data.options_.push_back(its_option);
         }
     }
@@ -1174,7 +1180,7 @@ void service_discovery_impl::insert_subscription_ack(
     // Selective
     if (_clients.size() > 1 || (*(_clients.begin())) != 0)
     {
-        auto its_selective_option = std::make_shared<selective_option_impl>();
+        auto its_selective_option = its_message->create<selective_option_impl>();
         static_cast<void>(its_selective_option->set_clients(_clients));
 
         its_data.options_.push_back(its_selective_option);
@@ -1191,25 +1197,94 @@ bool service_discovery_impl::send(bool _is_announcing)
     std::shared_ptr<runtime> its_runtime = runtime_.lock();
     if (its_runtime)
     {
-        std::vector<std::shared_ptr<message_impl>> its_messages;
-        std::shared_ptr<message_impl>              its_message;
-
         if (_is_announcing)
         {
-            its_message = std::make_shared<message_impl>();
-            its_messages.push_back(its_message);
-
             std::lock_guard<std::mutex> its_lock(offer_mutex_);
-            services_t                  its_offers = host_->get_offered_services();
-            insert_offer_entries(its_messages, its_offers, false);
 
-            // Serialize and send
-            return send(its_messages);
+            // The offers are only collected and serialized again if an offered
+            // service or the state of the service discovery changed.
+            const std::uint32_t its_revision = serviceinfo::get_offer_revision();
+            if (!is_offer_cache_valid_ || its_revision != offer_cache_revision_
+                || is_suspended_ != offer_cache_suspended_
+                || is_diagnosis_ != offer_cache_diagnosis_)
+            {
+                update_offer_cache(its_revision);
+            }
+
+            return send_offer_cache();
         }
     }
     return false;
 }
 
+void service_discovery_impl::update_offer_cache(std::uint32_t _revision)
+{
+    std::vector<std::shared_ptr<message_impl>> its_messages;
+    its_messages.push_back(std::make_shared<message_impl>());
+
+    services_t its_offers = host_->get_offered_services();
+    insert_offer_entries(its_messages, its_offers, false);
+
+    if (!offer_cache_target_)
+    {
+        offer_cache_target_ = endpoint_definition::get(sd_multicast_address_, port_, false,
+                                                       VSOMEIP_SD_SERVICE, VSOMEIP_SD_INSTANCE);
+    }
+
+    bool is_valid(true);
+    offer_cache_.clear();
+    std::lock_guard<std::mutex> its_lock(serialize_mutex_);
+    for (const auto& m : its_messages)
+    {
+        if (m->has_entry())
+        {
+            if (serializer_->serialize(m.get()))
+            {
+                offer_cache_.emplace_back(serializer_->get_data(),
+                                          serializer_->get_data() + serializer_->get_size());
+            }
+            else
+            {
+                VSOMEIP_ERROR << "service_discovery_impl::" << __func__
+                              << ": Serialization failed!";
+                is_valid = false;
+            }
+            serializer_->reset();
+        }
+    }
+
+    is_offer_cache_valid_  = is_valid;
+    offer_cache_revision_  = _revision;
+    offer_cache_suspended_ = is_suspended_;
+    offer_cache_diagnosis_ = is_diagnosis_;
+}
+
+bool service_discovery_impl::send_offer_cache()
+{
+    if (offer_cache_.empty())
+        return false;
+
+    std::lock_guard<std::mutex> its_lock(serialize_mutex_);
+    for (auto& its_data : offer_cache_)
+    {
+        // Session identifier and reboot flag are the only fields that change
+        // from one cycle to the next.
+        std::pair<session_t, bool> its_session = get_session(unicast_);
+        bithelper::write_uint16_be(its_session.first, &its_data[VSOMEIP_SESSION_POS_MIN]);
+        if (its_session.second)
+            its_data[VSOMEIP_SOMEIP_SD_FLAGS_POS] |= VSOMEIP_REBOOT_FLAG;
+        else
+            its_data[VSOMEIP_SOMEIP_SD_FLAGS_POS] &= static_cast<byte_t>(~VSOMEIP_REBOOT_FLAG);
+
+        if (host_->send_via_sd(offer_cache_target_, its_data.data(),
+                               static_cast<uint32_t>(its_data.size()), port_))
+        {
+            increment_session(unicast_);
+        }
+    }
+    return true;
+}
+
 // Interface endpoint_host
 void service_discovery_impl::on_message(const byte_t* _data, length_t _length,
                                         const boost::asio::ip::address& _sender, bool _is_multicast)
@@ -1778,9 +1853,9 @@ void service_discovery_impl::process_offerservice_serviceentry(
                         const reliability_type_e its_reliability = get_eventgroup_reliability(
                             _service, _instance, its_eventgroup.first, its_subscription);
 
-                        auto its_data =
-                            create_eventgroup_entry(_service, _instance, its_eventgroup.first,
-                                                    its_subscription, its_reliability);
+                        auto its_data = create_eventgroup_entry(
+                            _service, _instance, its_eventgroup.first, its_subscription,
+                            its_reliability, _resubscribes.back());
                         if (its_data.entry_)
                         {
                             add_entry_data(_resubscribes, its_data);
@@ -1968,7 +2043,7 @@ void service_discovery_impl::on_endpoint_connected(service_t _service, instance_
                                                                    its_subscription);
                                     auto its_data = create_eventgroup_entry(
                                         _service, _instance, its_eventgroup.first, its_subscription,
-                                        its_reliability_type);
+                                        its_reliability_type, its_messages.back());
 
                                     if (its_data.entry_)
                                     {
@@ -1988,16 +2063,17 @@ void service_discovery_impl::on_endpoint_connected(service_t _service, instance_
 
 std::shared_ptr<option_impl>
 service_discovery_impl::create_ip_option(const boost::asio::ip::address& _address, uint16_t _port,
-                                         bool _is_reliable) const
+                                         bool                                 _is_reliable,
+                                         const std::shared_ptr<message_impl>& _message) const
 {
     std::shared_ptr<option_impl> its_option;
     if (_address.is_v4())
     {
-        its_option = std::make_shared<ipv4_option_impl>(_address, _port, _is_reliable);
+        its_option = _message->create<ipv4_option_impl>(_address, _port, _is_reliable);
     }
     else
     {
-        its_option = std::make_shared<ipv6_option_impl>(_address, _port, _is_reliable);
+        its_option = _message->create<ipv6_option_impl>(_address, _port, _is_reliable);
     }
     return its_option;
 }
@@ -2006,24 +2082,28 @@ void service_discovery_impl::insert_offer_service(
     std::vector<std::shared_ptr<message_impl>>& _messages,
     const std::shared_ptr<const serviceinfo>&   _info)
 {
+    // Entries and options are created within the message they will most likely be added to
+    const auto&  its_message = _messages.back();
     entry_data_t its_data;
     its_data.entry_ = its_data.other_ = nullptr;
 
     std::shared_ptr<endpoint> its_reliable = _info->get_endpoint(true);
     if (its_reliable)
     {
-        auto its_new_option = create_ip_option(unicast_, its_reliable->get_local_port(), true);
+        auto its_new_option = create_ip_option(unicast_, its_reliable->get_local_port(), true,
+                                               its_message);
         its_data.options_.push_back(its_new_option);
     }
 
     std::shared_ptr<endpoint> its_unreliable = _info->get_endpoint(false);
     if (its_unreliable)
     {
-        auto its_new_option = create_ip_option(unicast_, its_unreliable->get_local_port(), false);
+        auto its_new_option = create_ip_option(unicast_, its_unreliable->get_local_port(), false,
+                                               its_message);
         its_data.options_.push_back(its_new_option);
     }
 
-    auto its_entry = std::make_shared<serviceentry_impl>();
+    auto its_entry = its_message->create<serviceentry_impl>();
     if (its_entry)
     {
         its_data.entry_ = its_entry;
@@ -4418,7 +4498,7 @@ void service_discovery_impl::deserialize_data(const byte_t* _data, const length_
                                               std::shared_ptr<message_impl>& _message)
 {
     std::lock_guard its_lock(deserialize_mutex_);
-    deserializer_->set_data(_data, _size);
+    deserializer_->set_view(_data, _size);
     _message = std::shared_ptr<message_impl>(deserializer_->deserialize_sd_message());
     deserializer_->reset();
 }
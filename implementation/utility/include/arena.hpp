@@ -0,0 +1,121 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_ARENA_HPP_
+#define VSOMEIP_V3_ARENA_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace vsomeip_v3 {
+
+//
+// Monotonic allocator for objects that share their lifetime, e.g. the
+// entries and options of a Service Discovery message. Memory is taken from
+// blocks of a fixed size and is only released when the arena is destroyed.
+// Requests that exceed the block size get a block of their own.
+// The arena is not thread safe.
+//
+class arena {
+public:
+    explicit arena(std::size_t _block_size)
+        : block_size_(_block_size), blocks_(nullptr), position_(nullptr), available_(0),
+          block_count_(0)
+    {}
+
+    arena(const arena&)            = delete;
+    arena& operator=(const arena&) = delete;
+
+    ~arena()
+    {
+        while (blocks_)
+        {
+            block_t* its_next = blocks_->next_;
+            ::operator delete(blocks_);
+            blocks_ = its_next;
+        }
+    }
+
+    void* allocate(std::size_t _size, std::size_t _alignment)
+    {
+        void* its_position = position_;
+        if (!its_position || !std::align(_alignment, _size, its_position, available_))
+        {
+            const std::size_t its_size =
+                (_size + _alignment > block_size_ ? _size + _alignment : block_size_);
+            auto its_block = static_cast<block_t*>(::operator new(sizeof(block_t) + its_size));
+            its_block->next_ = blocks_;
+            blocks_          = its_block;
+            block_count_++;
+
+            its_position = its_block + 1;
+            available_   = its_size;
+            (void)std::align(_alignment, _size, its_position, available_);
+        }
+        position_ = static_cast<char*>(its_position) + _size;
+        available_ -= _size;
+        return its_position;
+    }
+
+    std::size_t get_block_count() const { return block_count_; }
+
+private:
+    struct alignas(std::max_align_t) block_t {
+        block_t* next_;
+    };
+
+    const std::size_t block_size_;
+    block_t*          blocks_;
+    void*             position_;
+    std::size_t       available_;
+    std::size_t       block_count_;
+};
+
+//
+// Allocator that takes its memory from an arena. Each copy shares the
+// ownership of the arena, so objects created by std::allocate_shared
+// keep it alive. Memory is never released before the arena is destroyed.
+//
+template<typename T>
+class arena_allocator {
+public:
+    using value_type = T;
+
+    explicit arena_allocator(const std::shared_ptr<arena>& _arena) : arena_(_arena) {}
+
+    template<typename U>
+    arena_allocator(const arena_allocator<U>& _other) : arena_(_other.arena_)
+    {}
+
+    T* allocate(std::size_t _count)
+    {
+        return static_cast<T*>(arena_->allocate(_count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, std::size_t) noexcept {}
+
+    template<typename U>
+    bool operator==(const arena_allocator<U>& _other) const
+    {
+        return arena_ == _other.arena_;
+    }
+
+    template<typename U>
+    bool operator!=(const arena_allocator<U>& _other) const
+    {
+        return arena_ != _other.arena_;
+    }
+
+private:
+    template<typename U>
+    friend class arena_allocator;
+
+    std::shared_ptr<arena> arena_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_ARENA_HPP_
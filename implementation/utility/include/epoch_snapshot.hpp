@@ -0,0 +1,102 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_EPOCH_SNAPSHOT_HPP_
+#define VSOMEIP_V3_EPOCH_SNAPSHOT_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace vsomeip_v3 {
+
+//
+// Immutable snapshot that is read without locking and replaced by writers.
+// Readers announce themselves in the counter of the current epoch while
+// they access the snapshot. A writer switches the epoch after replacing the
+// snapshot and deletes the replaced one once the counter of the previous
+// epoch has dropped to zero. Readers that arrive later use the other
+// counter, so the writer only waits for the reads that are in progress.
+//
+// Writers must be serialized by the caller. A reader must not publish a
+// snapshot of the same instance while it holds a reader_t.
+//
+template<typename T_>
+class epoch_snapshot {
+public:
+    class reader_t {
+    public:
+        explicit reader_t(const epoch_snapshot& _snapshot)
+            : snapshot_(_snapshot), epoch_(_snapshot.enter()),
+              current_(_snapshot.current_.load())
+        {}
+
+        ~reader_t() { snapshot_.leave(epoch_); }
+
+        reader_t(const reader_t&)            = delete;
+        reader_t& operator=(const reader_t&) = delete;
+
+        // Valid until the reader is destroyed, nullptr if nothing was published
+        const T_* get() const { return current_; }
+
+    private:
+        const epoch_snapshot& snapshot_;
+        const unsigned        epoch_;
+        const T_* const       current_;
+    };
+
+    epoch_snapshot() = default;
+    ~epoch_snapshot() { delete current_.load(); }
+
+    epoch_snapshot(const epoch_snapshot&)            = delete;
+    epoch_snapshot& operator=(const epoch_snapshot&) = delete;
+
+    // Writers only: the snapshot that was published last
+    const T_* get_published() const { return current_.load(std::memory_order_relaxed); }
+
+    // Writers only: takes the ownership of _snapshot (may be nullptr) and
+    // deletes the replaced snapshot once no reader accesses it anymore.
+    void publish(const T_* _snapshot)
+    {
+        const T_* its_replaced = current_.exchange(_snapshot);
+        if (its_replaced)
+        {
+            synchronize();
+            delete its_replaced;
+        }
+    }
+
+private:
+    // Returns the epoch the calling reader was counted for
+    unsigned enter() const
+    {
+        while (true)
+        {
+            const unsigned its_epoch = epoch_.load();
+            readers_[its_epoch].fetch_add(1);
+            if (epoch_.load() == its_epoch)
+                return its_epoch;
+            readers_[its_epoch].fetch_sub(1);
+        }
+    }
+
+    void leave(unsigned _epoch) const { readers_[_epoch].fetch_sub(1, std::memory_order_release); }
+
+    void synchronize()
+    {
+        const unsigned its_epoch = epoch_.load(std::memory_order_relaxed);
+        epoch_.store(its_epoch ^ 1);
+        while (readers_[its_epoch].load() != 0)
+            std::this_thread::yield();
+    }
+
+    std::atomic<const T_*>             current_{nullptr};
+    std::atomic<unsigned>              epoch_{0};
+    mutable std::atomic<std::uint32_t> readers_[2]{{0}, {0}};
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_EPOCH_SNAPSHOT_HPP_
@@ -0,0 +1,103 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_FLAT_INDEX_HPP_
+#define VSOMEIP_V3_FLAT_INDEX_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace vsomeip_v3 {
+
+//
+// Open addressing hash table with linear probing that is filled once and
+// read only afterwards. It is meant to be published as an immutable
+// snapshot (std::shared_ptr<const flat_index>): readers look up values
+// without any lock while writers build and publish a new snapshot.
+// The table is kept at most half full, so lookups of missing keys stop
+// after a few probes.
+//
+template<typename Key_, typename Value_, typename Hash_ = std::hash<Key_>>
+class flat_index {
+public:
+    explicit flat_index(std::size_t _count) : shift_(64), size_(0)
+    {
+        std::size_t its_capacity(2);
+        while (its_capacity < 2 * _count)
+            its_capacity <<= 1;
+        for (std::size_t i = its_capacity; i > 1; i >>= 1)
+            shift_--;
+
+        mask_ = its_capacity - 1;
+        slots_.resize(its_capacity);
+    }
+
+    // Must not be called once the index is shared with readers.
+    // Returns false if the key is already contained or the index is full.
+    bool insert(const Key_& _key, Value_ _value)
+    {
+        if (2 * (size_ + 1) > slots_.size())
+            return false;
+
+        for (std::size_t i = position(_key);; i = (i + 1) & mask_)
+        {
+            slot_t& its_slot = slots_[i];
+            if (!its_slot.is_used_)
+            {
+                its_slot.key_     = _key;
+                its_slot.value_   = std::move(_value);
+                its_slot.is_used_ = true;
+                size_++;
+                return true;
+            }
+            if (its_slot.key_ == _key)
+                return false;
+        }
+    }
+
+    const Value_* find(const Key_& _key) const
+    {
+        for (std::size_t i = position(_key);; i = (i + 1) & mask_)
+        {
+            const slot_t& its_slot = slots_[i];
+            if (!its_slot.is_used_)
+                return nullptr;
+            if (its_slot.key_ == _key)
+                return &its_slot.value_;
+        }
+    }
+
+    std::size_t size() const { return size_; }
+
+private:
+    struct slot_t {
+        slot_t() : key_(), value_(), is_used_(false) {}
+
+        Key_   key_;
+        Value_ value_;
+        bool   is_used_;
+    };
+
+    // Fibonacci hashing spreads keys whose hash only differs in the
+    // upper bits, e.g. packed service/instance/method identifiers.
+    std::size_t position(const Key_& _key) const
+    {
+        const std::uint64_t its_hash = static_cast<std::uint64_t>(Hash_()(_key));
+        return static_cast<std::size_t>((its_hash * 0x9E3779B97F4A7C15ULL) >> shift_) & mask_;
+    }
+
+    unsigned int        shift_;
+    std::size_t         mask_;
+    std::size_t         size_;
+    std::vector<slot_t> slots_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_FLAT_INDEX_HPP_
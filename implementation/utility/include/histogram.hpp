@@ -0,0 +1,88 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_HISTOGRAM_HPP_
+#define VSOMEIP_V3_HISTOGRAM_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace vsomeip_v3 {
+
+//
+// Histogram of 32 bit values with logarithmic bucket sizes in the style of
+// HDR histograms: each power of two is divided into four buckets, so the
+// relative error of a value is at most 25% while 124 buckets cover the
+// whole range. Recording a value is a relaxed atomic increment.
+//
+class histogram {
+public:
+    static constexpr std::size_t buckets_ = 124;
+
+    histogram() : sum_(0)
+    {
+        reset();
+    }
+
+    histogram(const histogram&)            = delete;
+    histogram& operator=(const histogram&) = delete;
+
+    inline void record(std::uint32_t _value)
+    {
+        counts_[get_bucket(_value)].fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(_value, std::memory_order_relaxed);
+    }
+
+    // Must not be called while values are recorded
+    inline void reset()
+    {
+        for (auto& c : counts_)
+            c.store(0, std::memory_order_relaxed);
+        sum_.store(0, std::memory_order_relaxed);
+    }
+
+    inline std::uint64_t get_count(std::size_t _bucket) const
+    {
+        return counts_[_bucket].load(std::memory_order_relaxed);
+    }
+
+    inline std::uint64_t get_sum() const { return sum_.load(std::memory_order_relaxed); }
+
+    static inline std::size_t get_bucket(std::uint32_t _value)
+    {
+        if (_value < 4)
+            return _value;
+#if defined(_MSC_VER)
+        unsigned long its_index;
+        _BitScanReverse(&its_index, _value);
+        const auto its_msb = static_cast<std::size_t>(its_index);
+#else
+        const auto its_msb = static_cast<std::size_t>(31 - __builtin_clz(_value));
+#endif
+        return ((its_msb - 1) << 2) + ((_value >> (its_msb - 2)) & 0x3);
+    }
+
+    // Largest value that is counted in the given bucket
+    static inline std::uint64_t get_upper_bound(std::size_t _bucket)
+    {
+        if (_bucket < 4)
+            return _bucket;
+        const std::size_t its_shift = (_bucket >> 2) - 1;
+        return ((std::uint64_t(4 + (_bucket & 0x3)) + 1) << its_shift) - 1;
+    }
+
+private:
+    std::atomic<std::uint64_t> counts_[buckets_];
+    std::atomic<std::uint64_t> sum_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_HISTOGRAM_HPP_
@@ -0,0 +1,160 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_MESSAGE_STATISTICS_HPP_
+#define VSOMEIP_V3_MESSAGE_STATISTICS_HPP_
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <vsomeip/export.hpp>
+#include <vsomeip/primitive_types.hpp>
+
+#include "histogram.hpp"
+
+namespace vsomeip_v3 {
+
+//
+// Process wide statistics of the messages per service, instance and method:
+// number of messages, payload sizes and handler latencies. Nothing is
+// recorded unless the statistics are enabled by the routing manager.
+//
+// Recording takes no lock: the message is looked up in a lock free directory
+// of the current interval and counted in the shard of the calling thread, so
+// threads do not share cache lines. Received messages and handler latencies
+// use separate directories, each limited to the configured maximum number of
+// messages. Each interval is closed by rotate(), which starts an empty
+// interval, returns the counters of the closed one and adds them to the
+// totals that are written as metrics.
+//
+// Gauges (queue sizes, dispatcher backlogs, ...) are not maintained here, but
+// read from the registered providers when a snapshot is written.
+//
+class VSOMEIP_IMPORT_EXPORT message_statistics {
+public:
+    // Maximum number of distinct messages per interval
+    static constexpr std::size_t capacity_ = 1024;
+
+    // Provides the current values of a gauge as pairs of labels and value
+    typedef std::function<void(std::vector<std::pair<std::string, std::uint64_t>>&)>
+        gauge_provider_t;
+
+    struct counter_t {
+        service_t service_;
+        instance_t instance_;
+        method_t method_;
+        std::uint64_t count_;
+        std::uint64_t bytes_;
+    };
+
+    static std::shared_ptr<message_statistics> get();
+
+    message_statistics();
+    ~message_statistics();
+
+    message_statistics(const message_statistics&)            = delete;
+    message_statistics& operator=(const message_statistics&) = delete;
+
+    // Starts recording received messages and, if requested, handler latencies.
+    // Each call must be matched by a call to disable with the same argument,
+    // recording stops when the last user disabled it.
+    void enable(bool _with_latencies);
+    void disable(bool _with_latencies);
+    bool is_enabled() const;
+    bool is_latency_enabled() const;
+
+    // Limits the number of distinct messages per interval (at most half of
+    // the capacity). Messages beyond are ignored.
+    void set_max_messages(std::size_t _max);
+
+    // Counts a received message. Returns false if the message was ignored.
+    bool insert(service_t _service, instance_t _instance, method_t _method, length_t _length);
+
+    // Records the time a message handler was running.
+    bool insert_latency(service_t _service, instance_t _instance, method_t _method,
+                        std::uint32_t _microseconds);
+
+    // Closes the current interval. Returns its counters, sorted by service,
+    // instance and method, and the number of ignored messages.
+    std::vector<counter_t> rotate(std::uint64_t& _ignored);
+
+    std::uint32_t add_gauge(const std::string& _name, gauge_provider_t _provider);
+    void remove_gauge(std::uint32_t _id);
+
+    // Writes the totals of all closed intervals and the gauges in the
+    // Prometheus text format.
+    void write(std::ostream& _out) const;
+
+    // Replaces the file _path by a snapshot, so that readers always get a
+    // complete one.
+    void write(const std::string& _path) const;
+
+private:
+    enum kind_e : unsigned { MESSAGES = 0, LATENCIES = 1 };
+
+    static constexpr std::size_t shards_ = 8;
+
+    struct directory_t {
+        // Keys of the messages, 0 marks a free slot
+        std::atomic<std::uint64_t> keys_[capacity_];
+        std::atomic<std::size_t> size_;
+        std::atomic<std::uint64_t> ignored_;
+    };
+
+    // Histograms of a shard per interval (two, alternating), kind and slot
+    struct alignas(64) shard_t {
+        std::atomic<std::uint32_t> writers_[2];
+        std::atomic<histogram*> histograms_[2][2][capacity_];
+    };
+
+    struct gauge_t {
+        std::string name_;
+        gauge_provider_t provider_;
+    };
+
+    struct totals_t {
+        std::uint64_t counts_[histogram::buckets_];
+        std::uint64_t sum_;
+        bool is_updated_;
+    };
+
+    shard_t* get_shard() const;
+    bool record(kind_e _kind, std::uint64_t _key, std::uint32_t _value);
+    histogram* get_histogram(unsigned _interval, kind_e _kind, std::uint64_t _key,
+                             shard_t& _shard);
+    void write_histogram(std::ostream& _out, const std::string& _name,
+                         const std::string& _labels, const totals_t& _totals) const;
+
+    std::atomic<bool> is_enabled_;
+    std::atomic<bool> is_latency_enabled_;
+    // Number of enable calls (with latencies), guarded by totals_mutex_
+    std::uint32_t users_;
+    std::uint32_t latency_users_;
+    std::atomic<std::size_t> max_;
+
+    // Index of the current interval
+    std::atomic<unsigned> interval_;
+    directory_t directories_[2][2];
+    std::unique_ptr<shard_t[]> shards_data_;
+
+    // Totals of the closed intervals per kind and key
+    mutable std::mutex totals_mutex_;
+    std::map<std::uint64_t, totals_t> totals_[2];
+    std::uint64_t ignored_;
+
+    mutable std::mutex gauges_mutex_;
+    std::map<std::uint32_t, gauge_t> gauges_;
+    std::uint32_t next_gauge_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_MESSAGE_STATISTICS_HPP_
@@ -0,0 +1,130 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_MPMC_QUEUE_HPP_
+#define VSOMEIP_V3_MPMC_QUEUE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace vsomeip_v3 {
+
+//
+// Bounded multi-producer/multi-consumer queue. Each slot carries a sequence
+// number that tells producers and consumers whether it may be written or
+// read, so neither side needs a lock. The capacity is rounded up to the
+// next power of two. push() and pop() fail instead of blocking if the queue
+// is full or empty.
+//
+template<typename T>
+class mpmc_queue {
+public:
+    explicit mpmc_queue(std::size_t _capacity)
+        : mask_(round_up(_capacity) - 1), cells_(new cell_t[mask_ + 1]), enqueue_pos_(0),
+          dequeue_pos_(0)
+    {
+        for (std::size_t i = 0; i <= mask_; ++i)
+            cells_[i].sequence_.store(i, std::memory_order_relaxed);
+    }
+
+    mpmc_queue(const mpmc_queue&)            = delete;
+    mpmc_queue& operator=(const mpmc_queue&) = delete;
+
+    std::size_t capacity() const { return mask_ + 1; }
+
+    // Leaves _value untouched if the queue is full.
+    bool push(T&& _value)
+    {
+        cell_t*     its_cell;
+        std::size_t its_pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            its_cell = &cells_[its_pos & mask_];
+            const std::size_t its_sequence = its_cell->sequence_.load(std::memory_order_acquire);
+            const auto        its_diff     = static_cast<std::ptrdiff_t>(its_sequence - its_pos);
+            if (its_diff == 0)
+            {
+                if (enqueue_pos_.compare_exchange_weak(its_pos, its_pos + 1,
+                                                       std::memory_order_relaxed))
+                    break;
+            }
+            else if (its_diff < 0)
+            {
+                return false; // full
+            }
+            else
+            {
+                its_pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        its_cell->value_ = std::move(_value);
+        its_cell->sequence_.store(its_pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T& _value)
+    {
+        cell_t*     its_cell;
+        std::size_t its_pos = dequeue_pos_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            its_cell = &cells_[its_pos & mask_];
+            const std::size_t its_sequence = its_cell->sequence_.load(std::memory_order_acquire);
+            const auto its_diff = static_cast<std::ptrdiff_t>(its_sequence - (its_pos + 1));
+            if (its_diff == 0)
+            {
+                if (dequeue_pos_.compare_exchange_weak(its_pos, its_pos + 1,
+                                                       std::memory_order_relaxed))
+                    break;
+            }
+            else if (its_diff < 0)
+            {
+                return false; // empty
+            }
+            else
+            {
+                its_pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        _value           = std::move(its_cell->value_);
+        its_cell->value_ = T();
+        its_cell->sequence_.store(its_pos + mask_ + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Snapshot only: the result may be outdated as soon as it is returned.
+    bool empty() const
+    {
+        const std::size_t its_pos = dequeue_pos_.load(std::memory_order_acquire);
+        return cells_[its_pos & mask_].sequence_.load(std::memory_order_acquire) != its_pos + 1;
+    }
+
+private:
+    struct cell_t {
+        std::atomic<std::size_t> sequence_;
+        T                        value_;
+    };
+
+    static std::size_t round_up(std::size_t _capacity)
+    {
+        std::size_t its_capacity(2);
+        while (its_capacity < _capacity)
+            its_capacity <<= 1;
+        return its_capacity;
+    }
+
+    const std::size_t         mask_;
+    std::unique_ptr<cell_t[]> cells_;
+
+    // Producers and consumers update different cache lines
+    alignas(64) std::atomic<std::size_t> enqueue_pos_;
+    alignas(64) std::atomic<std::size_t> dequeue_pos_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_MPMC_QUEUE_HPP_
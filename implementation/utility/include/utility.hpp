@@ -151,6 +151,7 @@ public:
     }
 
     static void set_thread_niceness(int _nice) noexcept;
+    static void set_thread_affinity(int _cpu) noexcept;
 
 private:
     struct data_t {
@@ -0,0 +1,446 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+#include <tuple>
+
+#include <vsomeip/internal/logger.hpp>
+
+#include "../include/message_statistics.hpp"
+
+namespace vsomeip_v3 {
+
+namespace {
+const std::size_t mask = message_statistics::capacity_ - 1;
+
+inline std::uint64_t get_key(service_t _service, instance_t _instance, method_t _method)
+{
+    return (std::uint64_t(1) << 48) | (std::uint64_t(_service) << 32)
+        | (std::uint64_t(_instance) << 16) | _method;
+}
+
+inline std::size_t get_slot(std::uint64_t _key)
+{
+    _key ^= _key >> 33;
+    _key *= 0xff51afd7ed558ccdULL;
+    _key ^= _key >> 33;
+    return static_cast<std::size_t>(_key) & mask;
+}
+
+std::string get_labels(std::uint64_t _key)
+{
+    std::stringstream its_labels;
+    its_labels << std::hex << std::setfill('0') << "service=\"0x" << std::setw(4)
+               << ((_key >> 32) & 0xFFFF) << "\",instance=\"0x" << std::setw(4)
+               << ((_key >> 16) & 0xFFFF) << "\",method=\"0x" << std::setw(4) << (_key & 0xFFFF)
+               << "\"";
+    return its_labels.str();
+}
+} // namespace
+
+std::shared_ptr<message_statistics> message_statistics::get()
+{
+    static std::shared_ptr<message_statistics> the_statistics =
+        std::make_shared<message_statistics>();
+    return the_statistics;
+}
+
+message_statistics::message_statistics()
+    : is_enabled_(false),
+      is_latency_enabled_(false),
+      users_(0),
+      latency_users_(0),
+      max_(capacity_ >> 1),
+      interval_(0),
+      ignored_(0),
+      next_gauge_(0)
+{
+    for (auto& i : directories_)
+    {
+        for (auto& d : i)
+        {
+            for (auto& k : d.keys_)
+                k.store(0, std::memory_order_relaxed);
+            d.size_.store(0, std::memory_order_relaxed);
+            d.ignored_.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+message_statistics::~message_statistics()
+{
+    if (shards_data_)
+    {
+        for (std::size_t s = 0; s < shards_; ++s)
+            for (auto& i : shards_data_[s].histograms_)
+                for (auto& k : i)
+                    for (auto& h : k)
+                        delete h.load(std::memory_order_relaxed);
+    }
+}
+
+void message_statistics::enable(bool _with_latencies)
+{
+    std::lock_guard<std::mutex> its_lock(totals_mutex_);
+    // The shards are only needed by processes that record statistics
+    if (!shards_data_)
+    {
+        shards_data_.reset(new shard_t[shards_]);
+        for (std::size_t s = 0; s < shards_; ++s)
+        {
+            for (auto& w : shards_data_[s].writers_)
+                w.store(0, std::memory_order_relaxed);
+            for (auto& i : shards_data_[s].histograms_)
+                for (auto& k : i)
+                    for (auto& h : k)
+                        h.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+    users_++;
+    if (_with_latencies)
+        latency_users_++;
+    is_latency_enabled_.store(latency_users_ > 0, std::memory_order_release);
+    is_enabled_.store(true, std::memory_order_release);
+}
+
+void message_statistics::disable(bool _with_latencies)
+{
+    std::lock_guard<std::mutex> its_lock(totals_mutex_);
+    if (users_ > 0)
+        users_--;
+    if (_with_latencies && latency_users_ > 0)
+        latency_users_--;
+    is_enabled_.store(users_ > 0, std::memory_order_release);
+    is_latency_enabled_.store(latency_users_ > 0, std::memory_order_release);
+}
+
+bool message_statistics::is_enabled() const
+{
+    return is_enabled_.load(std::memory_order_relaxed);
+}
+
+bool message_statistics::is_latency_enabled() const
+{
+    return is_latency_enabled_.load(std::memory_order_relaxed);
+}
+
+void message_statistics::set_max_messages(std::size_t _max)
+{
+    max_ = std::min(_max, capacity_ >> 1);
+}
+
+message_statistics::shard_t* message_statistics::get_shard() const
+{
+    // The shard is chosen once per thread
+    static std::atomic<std::size_t> its_next_shard(0);
+    thread_local const std::size_t  its_shard =
+        its_next_shard.fetch_add(1, std::memory_order_relaxed) % shards_;
+    return &shards_data_[its_shard];
+}
+
+histogram* message_statistics::get_histogram(unsigned _interval, kind_e _kind, std::uint64_t _key,
+                                             shard_t& _shard)
+{
+    auto&       its_directory = directories_[_interval][_kind];
+    std::size_t its_slot      = get_slot(_key);
+    std::size_t its_probes(0);
+    for (; its_probes < capacity_; ++its_probes, its_slot = (its_slot + 1) & mask)
+    {
+        std::uint64_t its_current = its_directory.keys_[its_slot].load(std::memory_order_acquire);
+        if (its_current == _key)
+            break;
+        if (its_current == 0)
+        {
+            if (its_directory.size_.fetch_add(1, std::memory_order_relaxed)
+                >= max_.load(std::memory_order_relaxed))
+            {
+                its_directory.size_.fetch_sub(1, std::memory_order_relaxed);
+                its_probes = capacity_;
+                break;
+            }
+            if (its_directory.keys_[its_slot].compare_exchange_strong(its_current, _key,
+                                                                      std::memory_order_acq_rel))
+                break;
+            // Taken by another message in between
+            its_directory.size_.fetch_sub(1, std::memory_order_relaxed);
+            if (its_current == _key)
+                break;
+        }
+    }
+    if (its_probes == capacity_)
+    {
+        its_directory.ignored_.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    auto&      its_entry  = _shard.histograms_[_interval][_kind][its_slot];
+    histogram* its_result = its_entry.load(std::memory_order_acquire);
+    if (!its_result)
+    {
+        // Threads that share a shard may race for the first message
+        auto its_new = std::make_unique<histogram>();
+        if (its_entry.compare_exchange_strong(its_result, its_new.get(), std::memory_order_acq_rel))
+            its_result = its_new.release();
+    }
+    return its_result;
+}
+
+bool message_statistics::record(kind_e _kind, std::uint64_t _key, std::uint32_t _value)
+{
+    if (!is_enabled_.load(std::memory_order_acquire))
+        return false;
+
+    // Announce the writer in the current interval. If the interval was closed
+    // in between, retry in the new one.
+    shard_t& its_shard = *get_shard();
+    unsigned its_interval;
+    while (true)
+    {
+        its_interval = interval_.load();
+        its_shard.writers_[its_interval].fetch_add(1);
+        if (interval_.load() == its_interval)
+            break;
+        its_shard.writers_[its_interval].fetch_sub(1);
+    }
+
+    histogram* its_histogram = get_histogram(its_interval, _kind, _key, its_shard);
+    if (its_histogram)
+        its_histogram->record(_value);
+
+    its_shard.writers_[its_interval].fetch_sub(1, std::memory_order_release);
+    return (its_histogram != nullptr);
+}
+
+bool message_statistics::insert(service_t _service, instance_t _instance, method_t _method,
+                                length_t _length)
+{
+    return record(MESSAGES, get_key(_service, _instance, _method), _length);
+}
+
+bool message_statistics::insert_latency(service_t _service, instance_t _instance, method_t _method,
+                                        std::uint32_t _microseconds)
+{
+    if (!is_latency_enabled_.load(std::memory_order_relaxed))
+        return false;
+    return record(LATENCIES, get_key(_service, _instance, _method), _microseconds);
+}
+
+std::vector<message_statistics::counter_t> message_statistics::rotate(std::uint64_t& _ignored)
+{
+    std::vector<counter_t> its_counters;
+    _ignored = 0;
+
+    std::lock_guard<std::mutex> its_lock(totals_mutex_);
+    if (!shards_data_)
+        return its_counters;
+
+    // Start the next interval and wait for the writers of the closed one
+    const unsigned its_interval = interval_.load();
+    interval_.store(its_interval ^ 1);
+    for (std::size_t s = 0; s < shards_; ++s)
+        while (shards_data_[s].writers_[its_interval].load() != 0)
+            std::this_thread::yield();
+
+    for (const kind_e its_kind : {MESSAGES, LATENCIES})
+    {
+        auto& its_directory = directories_[its_interval][its_kind];
+        auto& its_totals    = totals_[its_kind];
+        for (auto& t : its_totals)
+            t.second.is_updated_ = false;
+
+        for (std::size_t i = 0; i < capacity_; ++i)
+        {
+            const std::uint64_t its_key = its_directory.keys_[i].load(std::memory_order_relaxed);
+            if (!its_key)
+                continue;
+
+            auto found_totals = its_totals.find(its_key);
+            if (found_totals == its_totals.end())
+                found_totals = its_totals.emplace(its_key, totals_t()).first;
+            auto&         t = found_totals->second;
+            std::uint64_t its_count(0), its_sum(0);
+            for (std::size_t s = 0; s < shards_; ++s)
+            {
+                histogram* its_histogram =
+                    shards_data_[s].histograms_[its_interval][its_kind][i].load(
+                        std::memory_order_acquire);
+                if (its_histogram)
+                {
+                    for (std::size_t b = 0; b < histogram::buckets_; ++b)
+                    {
+                        t.counts_[b] += its_histogram->get_count(b);
+                        its_count += its_histogram->get_count(b);
+                    }
+                    its_sum += its_histogram->get_sum();
+                    its_histogram->reset();
+                }
+            }
+            t.sum_ += its_sum;
+            t.is_updated_ = true;
+
+            if (its_kind == MESSAGES)
+            {
+                its_counters.push_back({static_cast<service_t>(its_key >> 32),
+                                        static_cast<instance_t>(its_key >> 16),
+                                        static_cast<method_t>(its_key), its_count, its_sum});
+            }
+            its_directory.keys_[i].store(0, std::memory_order_relaxed);
+        }
+        its_directory.size_.store(0, std::memory_order_relaxed);
+        if (its_kind == MESSAGES)
+            _ignored = its_directory.ignored_.exchange(0, std::memory_order_relaxed);
+        else
+            its_directory.ignored_.store(0, std::memory_order_relaxed);
+
+        // Keep the totals bounded, messages that were idle are dropped first
+        for (auto t = its_totals.begin(); its_totals.size() > capacity_ && t != its_totals.end();)
+        {
+            if (!t->second.is_updated_)
+                t = its_totals.erase(t);
+            else
+                ++t;
+        }
+    }
+    ignored_ += _ignored;
+
+    std::sort(its_counters.begin(), its_counters.end(),
+              [](const counter_t& _a, const counter_t& _b) {
+                  return std::tie(_a.service_, _a.instance_, _a.method_)
+                         < std::tie(_b.service_, _b.instance_, _b.method_);
+              });
+    return its_counters;
+}
+
+std::uint32_t message_statistics::add_gauge(const std::string& _name, gauge_provider_t _provider)
+{
+    std::lock_guard<std::mutex> its_lock(gauges_mutex_);
+    const std::uint32_t         its_id = next_gauge_++;
+    gauges_[its_id]                    = {_name, std::move(_provider)};
+    return its_id;
+}
+
+void message_statistics::remove_gauge(std::uint32_t _id)
+{
+    std::lock_guard<std::mutex> its_lock(gauges_mutex_);
+    gauges_.erase(_id);
+}
+
+void message_statistics::write_histogram(std::ostream& _out, const std::string& _name,
+                                         const std::string& _labels, const totals_t& _totals) const
+{
+    // Buckets are cumulative, empty ones are left out
+    std::uint64_t its_total(0);
+    for (std::size_t b = 0; b < histogram::buckets_; ++b)
+    {
+        if (_totals.counts_[b])
+        {
+            its_total += _totals.counts_[b];
+            _out << _name << "_bucket{" << _labels << ",le=\"" << histogram::get_upper_bound(b)
+                 << "\"} " << its_total << "\n";
+        }
+    }
+    if (its_total)
+    {
+        _out << _name << "_bucket{" << _labels << ",le=\"+Inf\"} " << its_total << "\n"
+             << _name << "_sum{" << _labels << "} " << _totals.sum_ << "\n"
+             << _name << "_count{" << _labels << "} " << its_total << "\n";
+    }
+}
+
+void message_statistics::write(std::ostream& _out) const
+{
+    _out << std::dec;
+    {
+        std::lock_guard<std::mutex> its_lock(totals_mutex_);
+        const auto&                 its_messages = totals_[MESSAGES];
+
+        _out << "# TYPE vsomeip_messages_received_total counter\n";
+        for (const auto& m : its_messages)
+        {
+            std::uint64_t its_count(0);
+            for (const auto c : m.second.counts_)
+                its_count += c;
+            _out << "vsomeip_messages_received_total{" << get_labels(m.first) << "} " << its_count
+                 << "\n";
+        }
+        _out << "# TYPE vsomeip_payload_received_bytes_total counter\n";
+        for (const auto& m : its_messages)
+        {
+            _out << "vsomeip_payload_received_bytes_total{" << get_labels(m.first) << "} "
+                 << m.second.sum_ << "\n";
+        }
+        _out << "# TYPE vsomeip_messages_ignored_total counter\n"
+             << "vsomeip_messages_ignored_total " << ignored_ << "\n";
+
+        _out << "# TYPE vsomeip_payload_size_bytes histogram\n";
+        for (const auto& m : its_messages)
+            write_histogram(_out, "vsomeip_payload_size_bytes", get_labels(m.first), m.second);
+        _out << "# TYPE vsomeip_handler_latency_microseconds histogram\n";
+        for (const auto& l : totals_[LATENCIES])
+        {
+            write_histogram(_out, "vsomeip_handler_latency_microseconds", get_labels(l.first),
+                            l.second);
+        }
+    }
+
+    std::multimap<std::string, gauge_provider_t> its_gauges;
+    {
+        std::lock_guard<std::mutex> its_lock(gauges_mutex_);
+        for (const auto& g : gauges_)
+            its_gauges.emplace(g.second.name_, g.second.provider_);
+    }
+    std::string its_name;
+    for (const auto& g : its_gauges)
+    {
+        if (g.first != its_name)
+        {
+            its_name = g.first;
+            _out << "# TYPE " << its_name << " gauge\n";
+        }
+        std::vector<std::pair<std::string, std::uint64_t>> its_values;
+        try
+        {
+            g.second(its_values);
+        } catch (const std::exception& e)
+        {
+            VSOMEIP_ERROR << "message_statistics::" << __func__ << ": " << its_name << ": "
+                          << e.what();
+        }
+        for (const auto& v : its_values)
+        {
+            _out << its_name;
+            if (!v.first.empty())
+                _out << "{" << v.first << "}";
+            _out << " " << v.second << "\n";
+        }
+    }
+}
+
+void message_statistics::write(const std::string& _path) const
+{
+    const std::string its_temporary = _path + ".tmp";
+    {
+        std::ofstream its_file(its_temporary, std::ios::out | std::ios::trunc);
+        if (!its_file)
+        {
+            VSOMEIP_WARNING << "message_statistics::" << __func__ << ": Cannot open "
+                            << its_temporary;
+            return;
+        }
+        write(its_file);
+    }
+    if (std::rename(its_temporary.c_str(), _path.c_str()) != 0)
+    {
+        VSOMEIP_WARNING << "message_statistics::" << __func__ << ": Cannot rename " << its_temporary
+                        << " to " << _path;
+    }
+}
+
+} // namespace vsomeip_v3
@@ -15,6 +15,8 @@
 #include <signal.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
 #include <sys/mman.h>
 #include <thread>
 #include <sstream>
@@ -337,6 +339,23 @@ void utility::set_thread_niceness(int _nice) noexcept
 #endif
 }
 
+void utility::set_thread_affinity(int _cpu) noexcept
+{
+#if defined(__linux__) && !defined(ANDROID)
+    cpu_set_t its_cpus;
+    CPU_ZERO(&its_cpus);
+    CPU_SET(_cpu, &its_cpus);
+    const int its_error = pthread_setaffinity_np(pthread_self(), sizeof(its_cpus), &its_cpus);
+    if (its_error != 0)
+    {
+        VSOMEIP_WARNING << "failed to pin thread " << std::this_thread::get_id() << " to CPU "
+                        << std::dec << _cpu << " (error: " << strerror(its_error) << ')';
+    }
+#else
+    (void)_cpu;
+#endif
+}
+
 std::uint16_t utility::get_max_client_number(const std::shared_ptr<configuration>& _config)
 {
     std::uint16_t its_max_clients(0);
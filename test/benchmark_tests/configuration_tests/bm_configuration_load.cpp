@@ -0,0 +1,171 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include "../../../implementation/configuration/include/configuration_impl.hpp"
+#include "../../../implementation/configuration/include/configuration_snapshot.hpp"
+
+namespace {
+const int service_count     = 500;
+const int application_count = 200;
+
+// A configuration folder of a larger system: the application and logging
+// settings, and the services split into several files
+class configuration_folder {
+public:
+    configuration_folder()
+    {
+        folder_ = boost::filesystem::temp_directory_path()
+                / boost::filesystem::unique_path("vsomeip-startup-%%%%-%%%%");
+        boost::filesystem::create_directories(folder_);
+        snapshot_ = (folder_.parent_path() / (folder_.filename().string() + ".snapshot")).string();
+
+        std::stringstream its_applications;
+        its_applications << R"({ "unicast" : "127.0.0.1",
+            "logging" : { "level" : "error", "console" : "false", "dlt" : "false" },
+            "routing" : "routing", "applications" : [ )";
+        for (int a = 0; a < application_count; ++a)
+            its_applications << (a ? ", " : "") << R"({ "name" : "application_)" << a
+                             << R"(", "id" : "0x)" << std::hex << 0x1000 + a << std::dec
+                             << R"(", "max_dispatchers" : "10", "threads" : "2" })";
+        its_applications << " ] }";
+        write_file("vsomeip_std.json", its_applications.str());
+
+        for (int f = 0; f < 5; ++f)
+        {
+            std::stringstream its_services;
+            its_services << R"({ "services" : [ )";
+            for (int s = f * service_count / 5; s < (f + 1) * service_count / 5; ++s)
+            {
+                its_services << (s % (service_count / 5) ? ", " : "") << R"({ "service" : "0x)"
+                             << std::hex << 0x1000 + s << std::dec
+                             << R"(", "instance" : "0x0001", "unreliable" : ")" << 30000 + s
+                             << R"(", "reliable" : { "port" : ")" << 40000 + s
+                             << R"(", "enable-magic-cookies" : "false" }, "events" : [ )";
+                for (int e = 0; e < 4; ++e)
+                    its_services << (e ? ", " : "") << R"({ "event" : "0x800)" << e
+                                 << R"(", "is_field" : "true", "is_reliable" : "false" })";
+                its_services << R"( ], "eventgroups" : [ { "eventgroup" : "0x0001", )"
+                             << R"("events" : [ "0x8000", "0x8001", "0x8002", "0x8003" ] } ] })";
+            }
+            its_services << " ] }";
+            write_file("vsomeip_services_" + std::to_string(f) + ".json", its_services.str());
+        }
+    }
+
+    ~configuration_folder()
+    {
+        boost::filesystem::remove_all(folder_);
+        boost::filesystem::remove(snapshot_);
+    }
+
+    void write_snapshot() const
+    {
+        std::vector<vsomeip_v3::configuration_element> its_elements;
+        for (const auto& n : names_)
+        {
+            boost::property_tree::ptree its_tree;
+            boost::property_tree::json_parser::read_json(n, its_tree);
+            its_elements.push_back({n, its_tree});
+        }
+        vsomeip_v3::cfg::configuration_snapshot::write(snapshot_, its_elements);
+    }
+
+    std::string get_folder() const { return folder_.string(); }
+    std::string get_snapshot() const { return snapshot_; }
+    const std::vector<std::string>& get_names() const { return names_; }
+
+private:
+    void write_file(const std::string& _name, const std::string& _content)
+    {
+        names_.push_back((folder_ / _name).string());
+        std::ofstream its_file(names_.back(), std::ios::trunc);
+        its_file << _content;
+    }
+
+    boost::filesystem::path  folder_;
+    std::string              snapshot_;
+    std::vector<std::string> names_;
+};
+
+void load_configuration(benchmark::State& _state)
+{
+    for (auto _ : _state)
+    {
+        auto its_configuration = std::make_shared<vsomeip_v3::cfg::configuration_impl>("");
+        benchmark::DoNotOptimize(its_configuration->load("routing"));
+    }
+}
+} // namespace
+
+static void BM_load_configuration_json(benchmark::State& state)
+{
+    configuration_folder its_folder;
+    setenv(VSOMEIP_ENV_CONFIGURATION, its_folder.get_folder().c_str(), 1);
+    unsetenv(VSOMEIP_ENV_CONFIGURATION_SNAPSHOT);
+
+    load_configuration(state);
+
+    unsetenv(VSOMEIP_ENV_CONFIGURATION);
+}
+
+static void BM_load_configuration_snapshot(benchmark::State& state)
+{
+    configuration_folder its_folder;
+    its_folder.write_snapshot();
+    setenv(VSOMEIP_ENV_CONFIGURATION, its_folder.get_folder().c_str(), 1);
+    setenv(VSOMEIP_ENV_CONFIGURATION_SNAPSHOT, its_folder.get_snapshot().c_str(), 1);
+
+    load_configuration(state);
+
+    unsetenv(VSOMEIP_ENV_CONFIGURATION_SNAPSHOT);
+    unsetenv(VSOMEIP_ENV_CONFIGURATION);
+}
+
+static void BM_read_configuration_json(benchmark::State& state)
+{
+    configuration_folder its_folder;
+    for (auto _ : state)
+    {
+        for (const auto& n : its_folder.get_names())
+        {
+            boost::property_tree::ptree its_tree;
+            boost::property_tree::json_parser::read_json(n, its_tree);
+            benchmark::DoNotOptimize(its_tree);
+        }
+    }
+}
+
+static void BM_read_configuration_snapshot(benchmark::State& state)
+{
+    configuration_folder its_folder;
+    its_folder.write_snapshot();
+    for (auto _ : state)
+    {
+        auto its_snapshot =
+            vsomeip_v3::cfg::configuration_snapshot::open(its_folder.get_snapshot());
+        for (const auto& n : its_folder.get_names())
+        {
+            boost::property_tree::ptree its_tree;
+            benchmark::DoNotOptimize(its_snapshot->get(n, its_tree));
+        }
+    }
+}
+
+BENCHMARK(BM_load_configuration_json)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_load_configuration_snapshot)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_read_configuration_json)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_read_configuration_snapshot)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,55 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include "../../../implementation/e2e_protection/include/crc/crc.hpp"
+
+namespace {
+vsomeip_v3::e2e_buffer create_buffer(size_t _length)
+{
+    vsomeip_v3::e2e_buffer its_buffer(_length);
+    for (size_t i = 0; i < _length; ++i)
+        its_buffer[i] = static_cast<uint8_t>(i * 31 + 7);
+    return its_buffer;
+}
+} // namespace
+
+static void BM_e2e_crc_profile_04(benchmark::State& state)
+{
+    const auto its_buffer = create_buffer(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(vsomeip_v3::e2e_crc::calculate_profile_04(its_buffer));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * its_buffer.size()));
+}
+
+static void BM_e2e_crc_profile_05(benchmark::State& state)
+{
+    const auto its_buffer = create_buffer(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(vsomeip_v3::e2e_crc::calculate_profile_05(its_buffer));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * its_buffer.size()));
+}
+
+static void BM_e2e_crc_profile_07(benchmark::State& state)
+{
+    const auto its_buffer = create_buffer(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(vsomeip_v3::e2e_crc::calculate_profile_07(its_buffer));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * its_buffer.size()));
+}
+
+static void BM_e2e_crc_profile_custom(benchmark::State& state)
+{
+    const auto its_buffer = create_buffer(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(vsomeip_v3::e2e_crc::calculate_profile_custom(its_buffer));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * its_buffer.size()));
+}
+
+BENCHMARK(BM_e2e_crc_profile_04)->Arg(64)->Arg(4096)->Arg(4 * 1024 * 1024);
+BENCHMARK(BM_e2e_crc_profile_05)->Arg(64)->Arg(4096);
+BENCHMARK(BM_e2e_crc_profile_07)->Arg(64)->Arg(4096)->Arg(4 * 1024 * 1024);
+BENCHMARK(BM_e2e_crc_profile_custom)->Arg(64)->Arg(4096);
@@ -0,0 +1,35 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "../../../implementation/endpoints/include/endpoint_definition.hpp"
+
+namespace {
+const auto          remote_address = boost::asio::ip::make_address("192.168.0.2");
+const std::uint16_t remote_ports   = 256;
+} // namespace
+
+// Lookups of known definitions, e.g. the subscribers of a multicast event.
+// The subscriptions keep the definitions alive.
+static void BM_endpoint_definition_get(benchmark::State& state)
+{
+    std::vector<std::shared_ptr<vsomeip_v3::endpoint_definition>> its_subscribers;
+    for (std::uint16_t p = 0; p < remote_ports; ++p)
+        its_subscribers.push_back(
+            vsomeip_v3::endpoint_definition::get(remote_address, p, false, 0x1234, 0x0001));
+
+    std::uint16_t its_port(0);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            vsomeip_v3::endpoint_definition::get(remote_address, its_port, false, 0x1234, 0x0001));
+        its_port = static_cast<std::uint16_t>((its_port + 1) % remote_ports);
+    }
+}
+
+BENCHMARK(BM_endpoint_definition_get)->Threads(1)->Threads(4);
@@ -0,0 +1,183 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#if defined(__linux__)
+
+#include <benchmark/benchmark.h>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../../implementation/endpoints/include/local_shm_segment.hpp"
+#include "../../../implementation/protocol/include/protocol.hpp"
+#include "../../../implementation/protocol/include/send_command.hpp"
+#include "../../../implementation/protocol/include/shm_send_command.hpp"
+
+using vsomeip_v3::byte_t;
+
+namespace {
+bool read_fully(int _socket, byte_t* _data, std::size_t _size)
+{
+    while (_size > 0)
+    {
+        const auto its_result = ::read(_socket, _data, _size);
+        if (its_result <= 0)
+            return false;
+        _data += its_result;
+        _size -= static_cast<std::size_t>(its_result);
+    }
+    return true;
+}
+
+bool write_fully(int _socket, const byte_t* _data, std::size_t _size)
+{
+    while (_size > 0)
+    {
+        const auto its_result = ::write(_socket, _data, _size);
+        if (its_result <= 0)
+            return false;
+        _data += its_result;
+        _size -= static_cast<std::size_t>(its_result);
+    }
+    return true;
+}
+
+// A local connection with a receiver thread that reads a command, copies the
+// message into a buffer of its own (as routing_manager_client::on_message
+// does) and acknowledges it.
+class local_connection {
+public:
+    explicit local_connection(bool _use_shm)
+    {
+        ::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets_);
+        receiver_ = std::thread([this, _use_shm]() { _use_shm ? receive_shm() : receive_uds(); });
+    }
+
+    ~local_connection()
+    {
+        ::shutdown(sockets_[0], SHUT_RDWR);
+        receiver_.join();
+        ::close(sockets_[0]);
+        ::close(sockets_[1]);
+    }
+
+    bool send(const std::vector<byte_t>& _command)
+    {
+        byte_t its_ack;
+        return write_fully(sockets_[0], _command.data(), _command.size())
+            && read_fully(sockets_[0], &its_ack, 1);
+    }
+
+private:
+    bool read_command(std::vector<byte_t>& _command)
+    {
+        _command.resize(vsomeip_v3::protocol::COMMAND_HEADER_SIZE);
+        if (!read_fully(sockets_[1], _command.data(), _command.size()))
+            return false;
+        std::uint32_t its_size;
+        std::memcpy(&its_size, &_command[vsomeip_v3::protocol::COMMAND_POSITION_SIZE],
+                    sizeof(its_size));
+        _command.resize(vsomeip_v3::protocol::COMMAND_HEADER_SIZE + its_size);
+        return read_fully(sockets_[1], &_command[vsomeip_v3::protocol::COMMAND_HEADER_SIZE],
+                          its_size);
+    }
+
+    void receive_uds()
+    {
+        std::vector<byte_t> its_command;
+        byte_t              its_ack(0);
+        while (read_command(its_command))
+        {
+            std::vector<byte_t> its_message(its_command.begin(), its_command.end());
+            benchmark::DoNotOptimize(its_message.data());
+            write_fully(sockets_[1], &its_ack, 1);
+        }
+    }
+
+    void receive_shm()
+    {
+        std::vector<byte_t>                            its_command;
+        byte_t                                         its_ack(0);
+        std::shared_ptr<vsomeip_v3::local_shm_segment> its_segment;
+        while (read_command(its_command))
+        {
+            vsomeip_v3::protocol::shm_send_command its_shm_command;
+            vsomeip_v3::protocol::error_e          its_error;
+            its_shm_command.deserialize(its_command, its_error);
+            if (!its_segment)
+                its_segment = vsomeip_v3::local_shm_segment::open(its_shm_command.get_name());
+
+            std::vector<byte_t> its_message(its_shm_command.get_length());
+            its_segment->read(its_shm_command.get_slot(), its_shm_command.get_sequence(),
+                              its_shm_command.get_length(), its_message.data());
+            its_segment->release(its_shm_command.get_slot(), its_shm_command.get_sequence());
+            benchmark::DoNotOptimize(its_message.data());
+            write_fully(sockets_[1], &its_ack, 1);
+        }
+    }
+
+    int         sockets_[2];
+    std::thread receiver_;
+};
+} // namespace
+
+static void BM_local_send_uds(benchmark::State& state)
+{
+    const std::vector<byte_t> its_message(static_cast<std::size_t>(state.range(0)), 0x5a);
+    local_connection          its_connection(false);
+
+    vsomeip_v3::protocol::send_command its_command(vsomeip_v3::protocol::id_e::SEND_ID);
+    std::vector<byte_t>                its_buffer;
+    vsomeip_v3::protocol::error_e      its_error;
+    for (auto _ : state)
+    {
+        its_command.serialize(its_message.data(), static_cast<std::uint32_t>(its_message.size()),
+                              its_buffer, its_error);
+        its_connection.send(its_buffer);
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * state.range(0));
+}
+
+static void BM_local_send_shm(benchmark::State& state)
+{
+    const std::vector<byte_t> its_message(static_cast<std::size_t>(state.range(0)), 0x5a);
+    const std::string         its_name = "/vsomeip-bm-shm-" + std::to_string(getpid());
+    auto its_segment = vsomeip_v3::local_shm_segment::create(
+        its_name, 4, 4 * 1024 * 1024, 0600, std::chrono::milliseconds(10000));
+    if (!its_segment)
+    {
+        state.SkipWithError("Cannot create shared memory");
+        return;
+    }
+    local_connection its_connection(true);
+
+    vsomeip_v3::protocol::shm_send_command its_command;
+    its_command.set_name(its_name);
+    its_command.set_length(static_cast<std::uint32_t>(its_message.size()));
+    std::vector<byte_t>           its_buffer;
+    vsomeip_v3::protocol::error_e its_error;
+    for (auto _ : state)
+    {
+        std::uint32_t its_slot;
+        std::uint64_t its_sequence;
+        its_segment->write(its_message.data(), static_cast<std::uint32_t>(its_message.size()), 1,
+                           its_slot, its_sequence);
+        its_command.set_slot(its_slot);
+        its_command.set_sequence(its_sequence);
+        its_command.serialize(its_buffer, its_error);
+        its_connection.send(its_buffer);
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * state.range(0));
+}
+
+BENCHMARK(BM_local_send_uds)->Arg(64 * 1024)->Arg(1024 * 1024)->Arg(4 * 1024 * 1024 - 64);
+BENCHMARK(BM_local_send_shm)->Arg(64 * 1024)->Arg(1024 * 1024)->Arg(4 * 1024 * 1024 - 64);
+
+#endif // __linux__
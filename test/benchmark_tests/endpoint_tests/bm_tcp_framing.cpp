@@ -0,0 +1,102 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <vector>
+
+#include <vsomeip/constants.hpp>
+#include <vsomeip/defines.hpp>
+
+#include "../../../implementation/endpoints/include/tcp_framing.hpp"
+
+using vsomeip_v3::byte_t;
+
+namespace {
+// Receive buffer of a TCP connection with magic cookies: a cookie, followed
+// by messages of the given payload size.
+std::vector<byte_t> get_stream(std::size_t _payload_size, std::size_t _size)
+{
+    std::vector<byte_t> its_stream(vsomeip_v3::CLIENT_COOKIE,
+                                   vsomeip_v3::CLIENT_COOKIE + sizeof(vsomeip_v3::CLIENT_COOKIE));
+    const auto its_length = static_cast<std::uint32_t>(8 + _payload_size);
+    while (its_stream.size() + 16 + _payload_size <= _size)
+    {
+        const byte_t its_header[16] = {0x12, 0x34, 0x00, 0x01,
+                                       static_cast<byte_t>(its_length >> 24),
+                                       static_cast<byte_t>(its_length >> 16),
+                                       static_cast<byte_t>(its_length >> 8),
+                                       static_cast<byte_t>(its_length),
+                                       0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00};
+        its_stream.insert(its_stream.end(), its_header, its_header + 16);
+        for (std::size_t i = 0; i < _payload_size; ++i)
+            its_stream.push_back(static_cast<byte_t>(i * 7));
+    }
+    return its_stream;
+}
+
+// Byte by byte search as done for each message before
+std::size_t find_cookie_bytewise(const byte_t* _data, std::size_t _size)
+{
+    for (std::size_t i = 0; i + 16 < _size; ++i)
+    {
+        if (_data[i] == 0xFF && _data[i + 1] == 0xFF && _data[i + 2] == 0x00
+            && 0 == std::memcmp(_data + i, vsomeip_v3::CLIENT_COOKIE, 16))
+            return i;
+    }
+    return _size;
+}
+} // namespace
+
+// Each message is framed on its own, the rest of the buffer is searched for
+// a cookie for every message.
+static void BM_tcp_framing_per_message(benchmark::State& state)
+{
+    const auto its_stream = get_stream(static_cast<std::size_t>(state.range(0)), 64 * 1024);
+    std::size_t its_messages(0);
+    for (auto _ : state)
+    {
+        std::size_t its_offset(16);
+        while (its_offset + 16 <= its_stream.size())
+        {
+            const byte_t* its_message = &its_stream[its_offset];
+            const std::uint32_t its_size =
+                8 + (std::uint32_t(its_message[4]) << 24 | std::uint32_t(its_message[5]) << 16
+                     | std::uint32_t(its_message[6]) << 8 | std::uint32_t(its_message[7]));
+            benchmark::DoNotOptimize(
+                find_cookie_bytewise(its_message, its_stream.size() - its_offset));
+            its_offset += its_size;
+            its_messages++;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(its_messages));
+}
+
+static void BM_tcp_framing_scan(benchmark::State& state)
+{
+    const auto its_stream = get_stream(static_cast<std::size_t>(state.range(0)), 64 * 1024);
+    std::uint32_t its_sizes[vsomeip_v3::tcp_framing::max_frames_];
+    std::size_t   its_messages(0);
+    for (auto _ : state)
+    {
+        std::size_t its_offset(16);
+        std::size_t its_frames(0);
+        do
+        {
+            its_frames = vsomeip_v3::tcp_framing::scan(
+                &its_stream[its_offset], its_stream.size() - its_offset,
+                vsomeip_v3::CLIENT_COOKIE, true, its_sizes, vsomeip_v3::tcp_framing::max_frames_);
+            for (std::size_t f = 0; f < its_frames; ++f)
+                its_offset += its_sizes[f];
+            its_messages += its_frames;
+        } while (its_frames);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(its_messages));
+}
+
+// Argument: payload size of the messages within a 64 KiB receive buffer
+BENCHMARK(BM_tcp_framing_per_message)->Arg(64)->Arg(1024);
+BENCHMARK(BM_tcp_framing_scan)->Arg(64)->Arg(1024);
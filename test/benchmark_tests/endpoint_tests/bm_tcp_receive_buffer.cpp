@@ -0,0 +1,51 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include <vsomeip/primitive_types.hpp>
+
+#include "../../../implementation/endpoints/include/tcp_receive_buffer.hpp"
+
+namespace {
+const std::size_t initial_size = 16;
+} // namespace
+
+// Receive buffer handling of a large message as done before: the header is
+// received into the initial buffer, the buffer is resized to the message
+// size and shrunk back once the message was processed.
+static void BM_tcp_receive_vector(benchmark::State& state)
+{
+    const auto its_message_size = static_cast<std::size_t>(state.range(0));
+    std::vector<vsomeip_v3::byte_t> its_buffer(initial_size, 0);
+    for (auto _ : state)
+    {
+        its_buffer.reserve(its_message_size);
+        its_buffer.resize(its_message_size, 0x0);
+        benchmark::DoNotOptimize(its_buffer.data());
+        its_buffer.resize(initial_size, 0x0);
+        its_buffer.shrink_to_fit();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * its_message_size));
+}
+
+static void BM_tcp_receive_buffer(benchmark::State& state)
+{
+    const auto its_message_size = static_cast<std::size_t>(state.range(0));
+    vsomeip_v3::tcp_receive_buffer its_buffer(initial_size);
+    for (auto _ : state)
+    {
+        its_buffer.prepare(initial_size, its_message_size - initial_size, its_message_size);
+        benchmark::DoNotOptimize(its_buffer.get_free(initial_size));
+        its_buffer.reset(initial_size);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * its_message_size));
+}
+
+// Argument: message size
+BENCHMARK(BM_tcp_receive_vector)->Arg(64 * 1024)->Arg(8 * 1024 * 1024);
+BENCHMARK(BM_tcp_receive_buffer)->Arg(64 * 1024)->Arg(8 * 1024 * 1024);
@@ -0,0 +1,126 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#if defined(__linux__)
+
+#include <benchmark/benchmark.h>
+
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <vsomeip/defines.hpp>
+
+#include "../../../implementation/endpoints/include/tp.hpp"
+
+namespace {
+// Sender that is connected to a discarding receiver on the loopback interface
+struct segment_sockets {
+    segment_sockets()
+    {
+        receiver_ = ::socket(AF_INET, SOCK_DGRAM, 0);
+        sender_   = ::socket(AF_INET, SOCK_DGRAM, 0);
+
+        sockaddr_in its_address{};
+        its_address.sin_family      = AF_INET;
+        its_address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        its_address.sin_port        = 0;
+        ::bind(receiver_, reinterpret_cast<sockaddr*>(&its_address), sizeof(its_address));
+
+        socklen_t its_length = sizeof(its_address);
+        ::getsockname(receiver_, reinterpret_cast<sockaddr*>(&its_address), &its_length);
+        ::connect(sender_, reinterpret_cast<sockaddr*>(&its_address), sizeof(its_address));
+    }
+
+    ~segment_sockets()
+    {
+        ::close(receiver_);
+        ::close(sender_);
+    }
+
+    void drain() const
+    {
+        vsomeip_v3::byte_t its_buffer[VSOMEIP_MAX_UDP_MESSAGE_SIZE];
+        while (::recv(receiver_, its_buffer, sizeof(its_buffer), MSG_DONTWAIT) > 0)
+            ;
+    }
+
+    int receiver_;
+    int sender_;
+};
+
+vsomeip_v3::message_buffer_ptr_t get_message(std::size_t _size)
+{
+    auto its_message = std::make_shared<vsomeip_v3::message_buffer_t>(_size, 0);
+    (*its_message)[VSOMEIP_MESSAGE_TYPE_POS] = 0x02;
+    return its_message;
+}
+} // namespace
+
+// Each segment is copied into a buffer of its own and sent from there.
+static void BM_tp_segmentation_split(benchmark::State& state)
+{
+    segment_sockets its_sockets;
+    const auto      its_message = get_message(static_cast<std::size_t>(state.range(0)));
+
+    std::size_t its_segments(0);
+    for (auto _ : state)
+    {
+        const auto its_split = vsomeip_v3::tp::tp::tp_split_message(
+            its_message->data(), static_cast<std::uint32_t>(its_message->size()),
+            vsomeip_v3::tp::tp::tp_max_segment_length_);
+        for (const auto& its_segment : its_split)
+        {
+            (void)::send(its_sockets.sender_, its_segment->data(), its_segment->size(),
+                         MSG_DONTWAIT);
+        }
+        its_segments += its_split.size();
+
+        state.PauseTiming();
+        its_sockets.drain();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(its_segments));
+}
+
+// Each segment is sent from its header and the payload of the message.
+static void BM_tp_segmentation_view(benchmark::State& state)
+{
+    segment_sockets its_sockets;
+    const auto      its_message = get_message(static_cast<std::size_t>(state.range(0)));
+
+    std::size_t              its_segments(0);
+    vsomeip_v3::tp::tp_segment its_segment;
+    for (auto _ : state)
+    {
+        its_segment.first(its_message, vsomeip_v3::tp::tp::tp_max_segment_length_);
+        do
+        {
+            struct iovec its_vecs[2];
+            its_vecs[0].iov_base = const_cast<vsomeip_v3::byte_t*>(its_segment.get_header());
+            its_vecs[0].iov_len  = its_segment.get_header_size();
+            its_vecs[1].iov_base = const_cast<vsomeip_v3::byte_t*>(its_segment.get_payload());
+            its_vecs[1].iov_len  = its_segment.get_payload_size();
+
+            struct msghdr its_header {};
+            its_header.msg_iov    = its_vecs;
+            its_header.msg_iovlen = 2;
+            (void)::sendmsg(its_sockets.sender_, &its_header, MSG_DONTWAIT);
+            its_segments++;
+        } while (its_segment.next());
+
+        state.PauseTiming();
+        its_sockets.drain();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(its_segments));
+}
+
+// Argument: size of the unsegmented message
+BENCHMARK(BM_tp_segmentation_split)->Arg(64 * 1024)->Arg(1024 * 1024);
+BENCHMARK(BM_tp_segmentation_view)->Arg(64 * 1024)->Arg(1024 * 1024);
+
+#endif // __linux__
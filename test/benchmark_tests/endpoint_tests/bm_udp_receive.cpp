@@ -0,0 +1,117 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#if defined(__linux__)
+
+#include <benchmark/benchmark.h>
+
+#include <arpa/inet.h>
+#include <unistd.h>
+
+#include <vsomeip/defines.hpp>
+
+#include "../../../implementation/endpoints/include/udp_receive_batch.hpp"
+
+namespace {
+const std::size_t burst_size   = 32;
+const std::size_t payload_size = 64;
+
+// Loopback socket pair; the receiver is bound to an ephemeral port.
+struct socket_pair {
+    socket_pair()
+    {
+        receiver_ = ::socket(AF_INET, SOCK_DGRAM, 0);
+        sender_   = ::socket(AF_INET, SOCK_DGRAM, 0);
+
+        sockaddr_in its_address{};
+        its_address.sin_family      = AF_INET;
+        its_address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        its_address.sin_port        = 0;
+        ::bind(receiver_, reinterpret_cast<sockaddr*>(&its_address), sizeof(its_address));
+
+        socklen_t its_length = sizeof(its_address);
+        ::getsockname(receiver_, reinterpret_cast<sockaddr*>(&its_address), &its_length);
+        ::connect(sender_, reinterpret_cast<sockaddr*>(&its_address), sizeof(its_address));
+    }
+
+    ~socket_pair()
+    {
+        ::close(receiver_);
+        ::close(sender_);
+    }
+
+    void send_burst() const
+    {
+        vsomeip_v3::byte_t its_data[payload_size] = {0};
+        for (std::size_t i = 0; i < burst_size; ++i)
+            (void)::send(sender_, its_data, sizeof(its_data), 0);
+    }
+
+    int receiver_;
+    int sender_;
+};
+} // namespace
+
+static void BM_udp_receive_recvmsg(benchmark::State& state)
+{
+    socket_pair its_sockets;
+    std::vector<vsomeip_v3::byte_t> its_buffer(VSOMEIP_MAX_UDP_MESSAGE_SIZE);
+
+    std::size_t its_packets(0);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        its_sockets.send_burst();
+        state.ResumeTiming();
+
+        for (std::size_t i = 0; i < burst_size; ++i)
+        {
+            sockaddr_in its_sender;
+            iovec       its_vec{its_buffer.data(), its_buffer.size()};
+            msghdr      its_header{};
+            its_header.msg_name    = &its_sender;
+            its_header.msg_namelen = sizeof(its_sender);
+            its_header.msg_iov     = &its_vec;
+            its_header.msg_iovlen  = 1;
+            if (::recvmsg(its_sockets.receiver_, &its_header, MSG_DONTWAIT) > 0)
+                its_packets++;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(its_packets));
+}
+
+static void BM_udp_receive_recvmmsg(benchmark::State& state)
+{
+    socket_pair                   its_sockets;
+    vsomeip_v3::udp_receive_batch its_batch(static_cast<std::size_t>(state.range(0)),
+                                            VSOMEIP_MAX_UDP_MESSAGE_SIZE);
+
+    std::size_t its_packets(0);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        its_sockets.send_burst();
+        state.ResumeTiming();
+
+        std::size_t its_received(0);
+        while (its_received < burst_size)
+        {
+            boost::system::error_code its_error;
+            const auto its_count = its_batch.receive(its_sockets.receiver_, its_error);
+            if (its_error || its_count == 0)
+                break;
+            for (std::size_t i = 0; i < its_count; ++i)
+                benchmark::DoNotOptimize(its_batch.sender(i));
+            its_received += its_count;
+        }
+        its_packets += its_received;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(its_packets));
+}
+
+BENCHMARK(BM_udp_receive_recvmsg);
+BENCHMARK(BM_udp_receive_recvmmsg)->Arg(8)->Arg(16)->Arg(32);
+
+#endif // __linux__
@@ -0,0 +1,116 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#if defined(__linux__)
+
+#include <benchmark/benchmark.h>
+
+#include <arpa/inet.h>
+#include <unistd.h>
+
+#include <vsomeip/defines.hpp>
+
+#include "../../../implementation/endpoints/include/udp_send_batch.hpp"
+
+namespace {
+const std::size_t burst_size   = 32;
+const std::size_t payload_size = 1392;
+
+// Unconnected sender and a receiver that is drained outside of the timing.
+struct transmit_sockets {
+    transmit_sockets()
+    {
+        receiver_ = ::socket(AF_INET, SOCK_DGRAM, 0);
+        sender_   = ::socket(AF_INET, SOCK_DGRAM, 0);
+
+        int its_size(4 * 1024 * 1024);
+        ::setsockopt(receiver_, SOL_SOCKET, SO_RCVBUF, &its_size, sizeof(its_size));
+
+        sockaddr_in its_address{};
+        its_address.sin_family      = AF_INET;
+        its_address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        its_address.sin_port        = 0;
+        ::bind(receiver_, reinterpret_cast<sockaddr*>(&its_address), sizeof(its_address));
+
+        socklen_t its_length = sizeof(its_address);
+        ::getsockname(receiver_, reinterpret_cast<sockaddr*>(&its_address), &its_length);
+        target_ = boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(),
+                                                 ntohs(its_address.sin_port));
+    }
+
+    ~transmit_sockets()
+    {
+        ::close(receiver_);
+        ::close(sender_);
+    }
+
+    void drain() const
+    {
+        vsomeip_v3::byte_t its_buffer[VSOMEIP_MAX_UDP_MESSAGE_SIZE];
+        while (::recv(receiver_, its_buffer, sizeof(its_buffer), MSG_DONTWAIT) > 0)
+            ;
+    }
+
+    int                            receiver_;
+    int                            sender_;
+    boost::asio::ip::udp::endpoint target_;
+};
+} // namespace
+
+static void BM_udp_transmit_sendto(benchmark::State& state)
+{
+    transmit_sockets   its_sockets;
+    vsomeip_v3::byte_t its_data[payload_size] = {0};
+
+    std::size_t its_packets(0);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < burst_size; ++i)
+        {
+            if (::sendto(its_sockets.sender_, its_data, sizeof(its_data), MSG_DONTWAIT,
+                         its_sockets.target_.data(),
+                         static_cast<socklen_t>(its_sockets.target_.size()))
+                > 0)
+                its_packets++;
+        }
+
+        state.PauseTiming();
+        its_sockets.drain();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(its_packets));
+}
+
+static void BM_udp_transmit_sendmmsg(benchmark::State& state)
+{
+    transmit_sockets           its_sockets;
+    vsomeip_v3::udp_send_batch its_batch(burst_size, state.range(0) != 0);
+
+    std::vector<vsomeip_v3::message_buffer_ptr_t> its_buffers;
+    for (std::size_t i = 0; i < burst_size; ++i)
+        its_buffers.push_back(std::make_shared<vsomeip_v3::message_buffer_t>(payload_size, 0));
+
+    std::size_t its_packets(0);
+    for (auto _ : state)
+    {
+        its_batch.clear();
+        for (const auto& its_buffer : its_buffers)
+            its_batch.add(&its_sockets.target_, its_buffer, true);
+
+        boost::system::error_code its_error;
+        its_packets += its_batch.send(its_sockets.sender_, its_error);
+
+        state.PauseTiming();
+        its_sockets.drain();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(its_packets));
+}
+
+BENCHMARK(BM_udp_transmit_sendto);
+// Argument: 0 = sendmmsg only, 1 = sendmmsg with UDP_SEGMENT
+BENCHMARK(BM_udp_transmit_sendmmsg)->Arg(0)->Arg(1);
+
+#endif // __linux__
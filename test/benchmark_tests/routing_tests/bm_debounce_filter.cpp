@@ -0,0 +1,93 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <vector>
+
+#include <vsomeip/primitive_types.hpp>
+
+#include "../../../implementation/routing/include/debounce_mask.hpp"
+
+namespace {
+using ignore_t = std::map<std::size_t, vsomeip_v3::byte_t>;
+
+// Ignores the lower nibble of every 16th byte
+ignore_t create_ignore(std::size_t _length)
+{
+    ignore_t its_ignore;
+    for (std::size_t i = 0; i < _length; i += 16)
+        its_ignore[i] = 0x0F;
+    return its_ignore;
+}
+
+// Payloads that only differ in ignored bits, so that all bytes are compared
+std::vector<vsomeip_v3::byte_t> create_payload(std::size_t _length, vsomeip_v3::byte_t _ignored)
+{
+    std::vector<vsomeip_v3::byte_t> its_payload(_length);
+    for (std::size_t i = 0; i < _length; ++i)
+        its_payload[i] = static_cast<vsomeip_v3::byte_t>(i * 7);
+    for (std::size_t i = 0; i < _length; i += 16)
+        its_payload[i] = static_cast<vsomeip_v3::byte_t>((its_payload[i] & 0xF0) | _ignored);
+    return its_payload;
+}
+} // namespace
+
+// Map lookup per byte, as formerly done by the debounce filters
+static void BM_debounce_filter_map(benchmark::State& state)
+{
+    const auto its_length = static_cast<std::size_t>(state.range(0));
+    const auto its_ignore = create_ignore(its_length);
+    const auto its_old    = create_payload(its_length, 0x01);
+    const auto its_new    = create_payload(its_length, 0x02);
+
+    for (auto _ : state)
+    {
+        bool is_changed(false);
+        for (std::size_t i = 0; i < its_length; i++)
+        {
+            auto j = its_ignore.find(i);
+            if (j == its_ignore.end())
+            {
+                if (its_old[i] != its_new[i])
+                {
+                    is_changed = true;
+                    break;
+                }
+            }
+            else if (j->second != 0xFF)
+            {
+                if ((its_old[i] & ~(j->second)) != (its_new[i] & ~(j->second)))
+                {
+                    is_changed = true;
+                    break;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(is_changed);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * its_length));
+}
+
+// Precompiled mask
+static void BM_debounce_filter_mask(benchmark::State& state)
+{
+    const auto                      its_length = static_cast<std::size_t>(state.range(0));
+    const vsomeip_v3::debounce_mask its_mask(create_ignore(its_length));
+    const auto                      its_old = create_payload(its_length, 0x01);
+    const auto                      its_new = create_payload(its_length, 0x02);
+
+    for (auto _ : state)
+    {
+        bool is_changed =
+            its_mask.is_changed(its_old.data(), its_old.size(), its_new.data(), its_new.size());
+        benchmark::DoNotOptimize(is_changed);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * its_length));
+}
+
+BENCHMARK(BM_debounce_filter_map)->Arg(64)->Arg(1024)->Arg(16384);
+BENCHMARK(BM_debounce_filter_mask)->Arg(64)->Arg(1024)->Arg(16384);
@@ -0,0 +1,54 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <mutex>
+#include <tuple>
+
+#include "../../../implementation/utility/include/message_statistics.hpp"
+
+using namespace vsomeip_v3;
+
+namespace {
+const std::uint16_t events = 32;
+
+// Counting as done before: one map behind one mutex
+struct locked_statistics {
+    std::mutex mutex_;
+    std::map<std::tuple<service_t, instance_t, method_t>, std::pair<std::uint32_t, length_t>>
+        statistics_;
+} the_locked_statistics;
+} // namespace
+
+static void BM_message_statistics_locked(benchmark::State& state)
+{
+    std::uint16_t its_event(0);
+    for (auto _ : state)
+    {
+        std::lock_guard<std::mutex> its_lock(the_locked_statistics.mutex_);
+        auto& its_entry = the_locked_statistics.statistics_[std::make_tuple(
+            0x1234, 0x0001, static_cast<method_t>(0x8000 + its_event))];
+        its_entry.second = (its_entry.second * its_entry.first + 64) / (its_entry.first + 1);
+        its_entry.first++;
+        its_event = static_cast<std::uint16_t>((its_event + 1) % events);
+    }
+}
+
+static void BM_message_statistics_insert(benchmark::State& state)
+{
+    static message_statistics its_statistics;
+    its_statistics.enable(false);
+    std::uint16_t its_event(0);
+    for (auto _ : state)
+    {
+        its_statistics.insert(0x1234, 0x0001, static_cast<method_t>(0x8000 + its_event), 64);
+        its_event = static_cast<std::uint16_t>((its_event + 1) % events);
+    }
+}
+
+BENCHMARK(BM_message_statistics_locked)->Threads(1)->Threads(4);
+BENCHMARK(BM_message_statistics_insert)->Threads(1)->Threads(4);
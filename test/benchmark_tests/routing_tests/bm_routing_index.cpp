@@ -0,0 +1,154 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <vsomeip/primitive_types.hpp>
+
+#include "../../../implementation/utility/include/epoch_snapshot.hpp"
+#include "../../../implementation/utility/include/flat_index.hpp"
+
+namespace {
+const std::size_t            service_count         = 1000;
+const std::size_t            events_per_service    = 10;
+const std::size_t            lookups_per_iteration = 1024;
+const vsomeip_v3::instance_t instance              = 0x0001;
+const vsomeip_v3::event_t    first_event           = 0x8001;
+
+struct event_t {
+    vsomeip_v3::event_t id_;
+};
+
+struct lookup_t {
+    vsomeip_v3::service_t service_;
+    vsomeip_v3::event_t   event_;
+};
+
+using events_t =
+    std::map<vsomeip_v3::service_t,
+             std::map<vsomeip_v3::instance_t,
+                      std::map<vsomeip_v3::event_t, std::shared_ptr<event_t>>>>;
+using events_index_t = vsomeip_v3::flat_index<uint64_t, std::shared_ptr<event_t>>;
+using reader_t       = vsomeip_v3::epoch_snapshot<events_index_t>::reader_t;
+
+uint64_t get_key(vsomeip_v3::service_t _service, vsomeip_v3::instance_t _instance,
+                 vsomeip_v3::event_t _event)
+{
+    return (uint64_t(_service) << 32) | (uint64_t(_instance) << 16) | _event;
+}
+
+events_t create_events()
+{
+    events_t its_events;
+    for (std::size_t s = 0; s < service_count; ++s)
+    {
+        for (std::size_t e = 0; e < events_per_service; ++e)
+        {
+            const auto its_event = static_cast<vsomeip_v3::event_t>(first_event + e);
+            its_events[static_cast<vsomeip_v3::service_t>(0x1000 + s)][instance][its_event] =
+                std::make_shared<event_t>(event_t{its_event});
+        }
+    }
+    return its_events;
+}
+
+const events_index_t* create_index(const events_t& _events)
+{
+    auto its_index = new events_index_t(service_count * events_per_service);
+    for (const auto& s : _events)
+        for (const auto& i : s.second)
+            for (const auto& e : i.second)
+                its_index->insert(get_key(s.first, i.first, e.first), e.second);
+    return its_index;
+}
+
+// Pseudo random sequence of registered events
+std::vector<lookup_t> create_lookups()
+{
+    std::vector<lookup_t> its_lookups;
+    uint32_t              its_seed(0x12345678);
+    for (std::size_t i = 0; i < lookups_per_iteration; ++i)
+    {
+        its_seed = its_seed * 1103515245 + 12345;
+        its_lookups.push_back(
+            {static_cast<vsomeip_v3::service_t>(0x1000 + (its_seed >> 8) % service_count),
+             static_cast<vsomeip_v3::event_t>(first_event + (its_seed >> 4) % events_per_service)});
+    }
+    return its_lookups;
+}
+
+const events_t                             events  = create_events();
+const std::vector<lookup_t>                lookups = create_lookups();
+std::mutex                                 events_mutex;
+vsomeip_v3::epoch_snapshot<events_index_t> events_index;
+
+struct events_index_publisher {
+    events_index_publisher() { events_index.publish(create_index(events)); }
+} publisher;
+} // namespace
+
+// Nested maps guarded by a mutex, as formerly used by routing_manager_base::find_event
+static void BM_routing_nested_map_lookup(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        for (const auto& l : lookups)
+        {
+            std::shared_ptr<event_t>    its_event;
+            std::lock_guard<std::mutex> its_lock(events_mutex);
+            auto                        found_service = events.find(l.service_);
+            if (found_service != events.end())
+            {
+                auto found_instance = found_service->second.find(instance);
+                if (found_instance != found_service->second.end())
+                {
+                    auto found_event = found_instance->second.find(l.event_);
+                    if (found_event != found_instance->second.end())
+                        its_event = found_event->second;
+                }
+            }
+            benchmark::DoNotOptimize(its_event);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * lookups_per_iteration));
+}
+
+// Flat index snapshot that is entered for each lookup
+static void BM_routing_flat_index_lookup(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        for (const auto& l : lookups)
+        {
+            const uint64_t           its_key = get_key(l.service_, instance, l.event_);
+            reader_t                 its_reader(events_index);
+            const auto               found_event = its_reader.get()->find(its_key);
+            std::shared_ptr<event_t> its_event(found_event ? *found_event : nullptr);
+            benchmark::DoNotOptimize(its_event);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * lookups_per_iteration));
+}
+
+// Rebuild of the snapshot, as done by the first lookup after a change
+static void BM_routing_flat_index_rebuild(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::unique_ptr<const events_index_t> its_index(create_index(events));
+        benchmark::DoNotOptimize(its_index);
+    }
+    state.SetItemsProcessed(
+        static_cast<int64_t>(state.iterations() * service_count * events_per_service));
+}
+
+BENCHMARK(BM_routing_nested_map_lookup)->ThreadRange(1, 4);
+BENCHMARK(BM_routing_flat_index_lookup)->ThreadRange(1, 4);
+BENCHMARK(BM_routing_flat_index_rebuild);
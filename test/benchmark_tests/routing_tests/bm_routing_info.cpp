@@ -0,0 +1,138 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#if defined(__linux__)
+
+#include <benchmark/benchmark.h>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <thread>
+#include <vector>
+
+#include <vsomeip/primitive_types.hpp>
+
+#include "../../../implementation/protocol/include/routing_info_command.hpp"
+#include "../../../implementation/routing/include/routing_info_coalescer.hpp"
+
+using vsomeip_v3::byte_t;
+using vsomeip_v3::client_t;
+
+namespace {
+const client_t              routing_client = 0x0100;
+const client_t              first_client   = 0x1001;
+const vsomeip_v3::service_t first_service  = 0x1000;
+
+// Local connections of the routing manager to its clients. A receiver thread
+// drains all connections, the routing manager pays for one write per command.
+class local_connections {
+public:
+    local_connections()
+    {
+        ::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets_);
+        receiver_ = std::thread([this]() {
+            byte_t its_buffer[65536];
+            while (::read(sockets_[1], its_buffer, sizeof(its_buffer)) > 0) { }
+        });
+    }
+
+    ~local_connections()
+    {
+        ::shutdown(sockets_[0], SHUT_RDWR);
+        receiver_.join();
+        ::close(sockets_[0]);
+        ::close(sockets_[1]);
+    }
+
+    bool send(client_t _target, const std::vector<byte_t>& _command)
+    {
+        (void)_target;
+        commands_++;
+        bytes_ += _command.size();
+        return (::write(sockets_[0], _command.data(), _command.size())
+                == static_cast<ssize_t>(_command.size()));
+    }
+
+    std::size_t commands_ = 0;
+    std::size_t bytes_    = 0;
+
+private:
+    int         sockets_[2];
+    std::thread receiver_;
+};
+
+vsomeip_v3::protocol::routing_info_entry get_offer(std::size_t _client)
+{
+    vsomeip_v3::protocol::routing_info_entry its_entry;
+    its_entry.set_type(vsomeip_v3::protocol::routing_info_entry_type_e::RIE_ADD_SERVICE_INSTANCE);
+    its_entry.set_client(static_cast<client_t>(first_client + _client));
+    its_entry.add_service(
+        {static_cast<vsomeip_v3::service_t>(first_service + _client), 0x0001, 0x01, 0x00000000});
+    return its_entry;
+}
+
+void set_counters(benchmark::State& state, const local_connections& _connections)
+{
+    state.counters["commands"] = benchmark::Counter(static_cast<double>(_connections.commands_),
+                                                    benchmark::Counter::kAvgIterations);
+    state.counters["bytes"]    = benchmark::Counter(static_cast<double>(_connections.bytes_),
+                                                    benchmark::Counter::kAvgIterations);
+}
+} // namespace
+
+// Boot storm: N local clients come up, each offers a service that all others
+// requested. Every offer is sent to every requester as one routing info command.
+static void BM_routing_info_boot_storm_immediate(benchmark::State& state)
+{
+    const auto        its_clients = static_cast<std::size_t>(state.range(0));
+    local_connections its_connections;
+
+    std::vector<byte_t>           its_buffer;
+    vsomeip_v3::protocol::error_e its_error;
+    for (auto _ : state)
+    {
+        for (std::size_t o = 0; o < its_clients; ++o)
+        {
+            for (std::size_t r = 0; r < its_clients; ++r)
+            {
+                vsomeip_v3::protocol::routing_info_command its_command;
+                its_command.set_client(routing_client);
+                its_command.add_entry(get_offer(o));
+                its_command.serialize(its_buffer, its_error);
+                its_connections.send(static_cast<client_t>(first_client + r), its_buffer);
+            }
+        }
+    }
+    set_counters(state, its_connections);
+}
+
+// Same boot storm, the offers are collected during the coalescing window and
+// each requester receives one routing info command.
+static void BM_routing_info_boot_storm_coalesced(benchmark::State& state)
+{
+    const auto        its_clients = static_cast<std::size_t>(state.range(0));
+    local_connections its_connections;
+
+    vsomeip_v3::routing_info_coalescer its_coalescer(
+        [&its_connections](client_t _target, const std::vector<byte_t>& _command) {
+            return its_connections.send(_target, _command);
+        });
+    for (auto _ : state)
+    {
+        for (std::size_t o = 0; o < its_clients; ++o)
+        {
+            for (std::size_t r = 0; r < its_clients; ++r)
+                its_coalescer.add(static_cast<client_t>(first_client + r), get_offer(o));
+        }
+        its_coalescer.flush(routing_client);
+    }
+    set_counters(state, its_connections);
+}
+
+BENCHMARK(BM_routing_info_boot_storm_immediate)->Arg(10)->Arg(50)->Arg(100);
+BENCHMARK(BM_routing_info_boot_storm_coalesced)->Arg(10)->Arg(50)->Arg(100);
+
+#endif // __linux__
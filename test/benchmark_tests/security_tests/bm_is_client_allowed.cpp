@@ -5,6 +5,9 @@
 
 #include <benchmark/benchmark.h>
 
+#include <sstream>
+#include <string>
+
 #include <common/utility.hpp>
 
 namespace {
@@ -24,6 +27,51 @@ vsomeip_v3::gid_t invalid_gid = 1;
 vsomeip_v3::gid_t     deny_uid     = 9999;
 vsomeip_v3::gid_t     deny_gid     = 9999;
 vsomeip_v3::service_t deny_service = 0x40;
+
+vsomeip_v3::uid_t many_policies_uid   = 100000;
+int               many_policies_count = 5000;
+
+// Loads the example policies and adds many_policies_count policies, each
+// allowing one uid/gid to request one service
+std::unique_ptr<vsomeip_v3::policy_manager_impl> create_manager_with_many_policies()
+{
+    std::unique_ptr<vsomeip_v3::policy_manager_impl> its_manager(
+        new vsomeip_v3::policy_manager_impl);
+    std::set<std::string>                          its_failed;
+    std::vector<vsomeip_v3::configuration_element> policy_elements;
+    std::vector<std::string>                       dir_skip;
+    utility::read_data(utility::get_all_files_in_dir(utility::get_policies_path(), dir_skip),
+                       policy_elements, its_failed);
+    for (const auto& e : policy_elements)
+    {
+        its_manager->load(e, false);
+    }
+
+    boost::property_tree::ptree its_policies;
+    for (int i = 0; i < many_policies_count; i++)
+    {
+        const auto its_id = std::to_string(many_policies_uid + static_cast<vsomeip_v3::uid_t>(i));
+        std::stringstream its_service;
+        its_service << "0x" << std::hex << 0x1000 + i;
+
+        boost::property_tree::ptree its_request;
+        its_request.put("service", its_service.str());
+        its_request.put("instance", "any");
+        boost::property_tree::ptree its_requests;
+        its_requests.push_back(std::make_pair("", its_request));
+
+        boost::property_tree::ptree its_policy;
+        its_policy.put("credentials.uid", its_id);
+        its_policy.put("credentials.gid", its_id);
+        its_policy.add_child("allow.requests", its_requests);
+        its_policies.push_back(std::make_pair("", its_policy));
+    }
+    boost::property_tree::ptree its_tree;
+    its_tree.add_child("security.policies", its_policies);
+    its_manager->load(vsomeip_v3::configuration_element("many_policies", its_tree), false);
+
+    return its_manager;
+}
 } // namespace
 
 static void BM_is_client_allowed_policies_not_loaded(benchmark::State& state)
@@ -238,6 +286,37 @@ BM_is_client_allowed_policies_loaded_audit_mode_deny_valid_values(benchmark::Sta
     }
 }
 
+static void BM_is_client_allowed_many_policies_valid_values(benchmark::State& state)
+{
+    auto its_manager = create_manager_with_many_policies();
+
+    // The last policy, found after all others were scanned
+    const auto its_id = static_cast<vsomeip_v3::uid_t>(many_policies_uid + many_policies_count - 1);
+    const auto its_service = static_cast<vsomeip_v3::service_t>(0x1000 + many_policies_count - 1);
+    vsomeip_sec_client_t its_sec_client = utility::create_uds_client(its_id, its_id, host_address);
+
+    // Different methods, so that not only the cache is measured
+    vsomeip_v3::method_t its_method(0x01);
+    for (auto _ : state)
+    {
+        its_manager->is_client_allowed(&its_sec_client, its_service, instance, its_method);
+        its_method = static_cast<vsomeip_v3::method_t>(its_method % 0x7FFF + 1);
+    }
+}
+
+static void BM_is_client_allowed_many_policies_invalid_values(benchmark::State& state)
+{
+    auto its_manager = create_manager_with_many_policies();
+
+    vsomeip_sec_client_t its_sec_client_invalid =
+        utility::create_uds_client(invalid_uid, invalid_gid, host_address);
+
+    for (auto _ : state)
+    {
+        its_manager->is_client_allowed(&its_sec_client_invalid, service_1, instance, method);
+    }
+}
+
 BENCHMARK(BM_is_client_allowed_policies_not_loaded);
 BENCHMARK(BM_is_client_allowed_policies_loaded_valid_values);
 BENCHMARK(BM_is_client_allowed_cache_policies_loaded);
@@ -247,3 +326,5 @@ BENCHMARK(BM_is_client_allowed_policies_loaded_audit_mode_valid_values);
 BENCHMARK(BM_is_client_allowed_cache_policies_loaded_audit_mode);
 BENCHMARK(BM_is_client_allowed_policies_loaded_audit_mode_invalid_values);
 BENCHMARK(BM_is_client_allowed_policies_loaded_audit_mode_deny_valid_values);
+BENCHMARK(BM_is_client_allowed_many_policies_valid_values);
+BENCHMARK(BM_is_client_allowed_many_policies_invalid_values);
@@ -0,0 +1,110 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include "../../../implementation/service_discovery/include/deserializer.hpp"
+#include "../../../implementation/service_discovery/include/message_impl.hpp"
+
+namespace {
+const std::size_t entry_count  = 60;
+const std::size_t option_count = 120;
+
+void append_uint16(std::vector<vsomeip_v3::byte_t>& _data, std::uint16_t _value)
+{
+    _data.push_back(static_cast<vsomeip_v3::byte_t>(_value >> 8));
+    _data.push_back(static_cast<vsomeip_v3::byte_t>(_value));
+}
+
+void append_uint32(std::vector<vsomeip_v3::byte_t>& _data, std::uint32_t _value)
+{
+    append_uint16(_data, static_cast<std::uint16_t>(_value >> 16));
+    append_uint16(_data, static_cast<std::uint16_t>(_value));
+}
+
+// SD message with offer and subscribe entries that reference two IPv4
+// endpoint options each, as sent during startup of a large system.
+std::vector<vsomeip_v3::byte_t> create_sd_message()
+{
+    std::vector<vsomeip_v3::byte_t> its_payload;
+    its_payload.push_back(0xc0); // flags
+    its_payload.insert(its_payload.end(), 3, 0x00); // reserved
+
+    append_uint32(its_payload, static_cast<std::uint32_t>(entry_count * 16));
+    for (std::size_t i = 0; i < entry_count; ++i)
+    {
+        const bool is_offer(i % 2 == 0);
+        its_payload.push_back(is_offer ? 0x01 : 0x06); // OFFER_SERVICE / SUBSCRIBE_EVENTGROUP
+        its_payload.push_back(static_cast<vsomeip_v3::byte_t>((2 * i) % option_count));
+        its_payload.push_back(0x00);
+        its_payload.push_back(0x20); // two options in the first run
+        append_uint16(its_payload, static_cast<std::uint16_t>(0x1000 + i));
+        append_uint16(its_payload, 0x0001);
+        its_payload.push_back(0x01); // major
+        its_payload.insert(its_payload.end(), {0x00, 0x00, 0x03}); // ttl
+        if (is_offer)
+        {
+            append_uint32(its_payload, 0x00000000); // minor
+        }
+        else
+        {
+            append_uint16(its_payload, 0x0000); // reserved, counter
+            append_uint16(its_payload, 0x0001); // eventgroup
+        }
+    }
+
+    append_uint32(its_payload, static_cast<std::uint32_t>(option_count * 12));
+    for (std::size_t i = 0; i < option_count; ++i)
+    {
+        append_uint16(its_payload, 0x0009);
+        its_payload.push_back(0x04); // IP4_ENDPOINT
+        its_payload.push_back(0x00);
+        its_payload.insert(its_payload.end(),
+                           {192, 168, 0, static_cast<vsomeip_v3::byte_t>(i % 250 + 1)});
+        its_payload.push_back(0x00);
+        its_payload.push_back(i % 2 ? 0x06 : 0x11); // TCP / UDP
+        append_uint16(its_payload, static_cast<std::uint16_t>(30000 + i));
+    }
+
+    std::vector<vsomeip_v3::byte_t> its_data;
+    append_uint16(its_data, 0xffff); // service
+    append_uint16(its_data, 0x8100); // method
+    append_uint32(its_data, static_cast<std::uint32_t>(8 + its_payload.size()));
+    append_uint16(its_data, 0x0000); // client
+    append_uint16(its_data, 0x0001); // session
+    its_data.insert(its_data.end(), {0x01, 0x01, 0x02, 0x00});
+    its_data.insert(its_data.end(), its_payload.begin(), its_payload.end());
+    return its_data;
+}
+} // namespace
+
+// Argument: arena block size, 0 allocates each entry and option separately
+static void BM_sd_deserialize(benchmark::State& state)
+{
+    const auto                   its_data = create_sd_message();
+    vsomeip_v3::sd::deserializer its_deserializer(0);
+
+    for (auto _ : state)
+    {
+        its_deserializer.set_view(its_data.data(), its_data.size());
+        std::unique_ptr<vsomeip_v3::sd::message_impl> its_message(
+            new vsomeip_v3::sd::message_impl(static_cast<std::size_t>(state.range(0))));
+        if (!its_message->deserialize(&its_deserializer)
+            || its_message->get_entries().size() != entry_count
+            || its_message->get_options().size() != option_count)
+        {
+            state.SkipWithError("SD message deserialization failed");
+            break;
+        }
+        its_deserializer.reset();
+        benchmark::DoNotOptimize(its_message);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_sd_deserialize)->Arg(0)->Arg(VSOMEIP_SOMEIP_SD_ARENA_BLOCK_SIZE);
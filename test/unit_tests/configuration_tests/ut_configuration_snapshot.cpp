@@ -0,0 +1,115 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include "../../../implementation/configuration/include/configuration_snapshot.hpp"
+
+using vsomeip_v3::configuration_element;
+using vsomeip_v3::cfg::configuration_snapshot;
+
+namespace {
+class configuration_snapshot_test : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        folder_ = boost::filesystem::temp_directory_path()
+                / boost::filesystem::unique_path("vsomeip-snapshot-%%%%-%%%%");
+        boost::filesystem::create_directories(folder_);
+        snapshot_ = (folder_ / "vsomeip.snapshot").string();
+
+        write_file("vsomeip.json", R"({ "unicast" : "10.0.2.15",
+            "applications" : [ { "name" : "client", "id" : "0x1343" },
+                               { "name" : "service", "id" : "0x1277" } ],
+            "routing" : "service" })");
+        write_file("vsomeip_services.json", R"({ "services" : [
+            { "service" : "0x1234", "instance" : "0x5678", "unreliable" : "30509" } ] })");
+    }
+
+    void TearDown() override { boost::filesystem::remove_all(folder_); }
+
+    std::string write_file(const std::string& _name, const std::string& _content)
+    {
+        const std::string its_name = (folder_ / _name).string();
+        std::ofstream     its_file(its_name, std::ios::trunc);
+        its_file << _content;
+        return its_name;
+    }
+
+    std::vector<configuration_element> parse_files()
+    {
+        std::vector<configuration_element> its_elements;
+        for (const auto& n : {"vsomeip.json", "vsomeip_services.json"})
+        {
+            boost::property_tree::ptree its_tree;
+            boost::property_tree::json_parser::read_json((folder_ / n).string(), its_tree);
+            its_elements.push_back({(folder_ / n).string(), its_tree});
+        }
+        return its_elements;
+    }
+
+    boost::filesystem::path folder_;
+    std::string             snapshot_;
+};
+} // namespace
+
+TEST_F(configuration_snapshot_test, restore_trees)
+{
+    const auto its_elements = parse_files();
+    ASSERT_TRUE(configuration_snapshot::write(snapshot_, its_elements));
+
+    auto its_snapshot = configuration_snapshot::open(snapshot_);
+    ASSERT_NE(its_snapshot, nullptr);
+    EXPECT_EQ(its_snapshot->get_size(), its_elements.size());
+
+    for (const auto& e : its_elements)
+    {
+        boost::property_tree::ptree its_tree;
+        ASSERT_TRUE(its_snapshot->get(e.name_, its_tree)) << e.name_;
+        EXPECT_EQ(its_tree, e.tree_);
+    }
+    boost::property_tree::ptree its_tree;
+    EXPECT_FALSE(its_snapshot->get((folder_ / "vsomeip_other.json").string(), its_tree));
+}
+
+TEST_F(configuration_snapshot_test, changed_files)
+{
+    ASSERT_TRUE(configuration_snapshot::write(snapshot_, parse_files()));
+    auto its_snapshot = configuration_snapshot::open(snapshot_);
+    ASSERT_NE(its_snapshot, nullptr);
+
+    const std::string its_name =
+        write_file("vsomeip_services.json", R"({ "services" : [ ] })");
+    boost::property_tree::ptree its_tree;
+    EXPECT_FALSE(its_snapshot->get(its_name, its_tree));
+    EXPECT_TRUE(its_snapshot->get((folder_ / "vsomeip.json").string(), its_tree));
+
+    // Writing a new snapshot does not invalidate the mapped one
+    ASSERT_TRUE(configuration_snapshot::write(snapshot_, parse_files()));
+    auto its_new_snapshot = configuration_snapshot::open(snapshot_);
+    ASSERT_NE(its_new_snapshot, nullptr);
+    EXPECT_TRUE(its_new_snapshot->get(its_name, its_tree));
+    EXPECT_TRUE(its_tree.get_child("services").empty());
+    EXPECT_TRUE(its_snapshot->get((folder_ / "vsomeip.json").string(), its_tree));
+}
+
+TEST_F(configuration_snapshot_test, invalid_snapshots)
+{
+    EXPECT_EQ(configuration_snapshot::open(snapshot_), nullptr);
+
+    write_file("vsomeip.snapshot", "{ \"unicast\" : \"10.0.2.15\" }");
+    EXPECT_EQ(configuration_snapshot::open(snapshot_), nullptr);
+
+    // Truncated snapshot
+    ASSERT_TRUE(configuration_snapshot::write(snapshot_, parse_files()));
+    boost::filesystem::resize_file(snapshot_, boost::filesystem::file_size(snapshot_) - 1);
+    EXPECT_EQ(configuration_snapshot::open(snapshot_), nullptr);
+}
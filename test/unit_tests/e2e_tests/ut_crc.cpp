@@ -0,0 +1,140 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+
+#include "../../../implementation/e2e_protection/include/crc/crc.hpp"
+
+using vsomeip_v3::buffer_view;
+using vsomeip_v3::e2e_buffer;
+using vsomeip_v3::e2e_crc;
+
+namespace {
+// Bitwise reference implementations without any tables
+
+template<typename crc_t_>
+crc_t_ calculate_reflected(crc_t_ _poly, crc_t_ _crc, const uint8_t* _data, size_t _length)
+{
+    crc_t_ its_reflected_poly(0);
+    for (unsigned i = 0; i < sizeof(crc_t_) * 8; ++i)
+        if (_poly & (crc_t_(1) << i))
+            its_reflected_poly |= crc_t_(1) << (sizeof(crc_t_) * 8 - 1 - i);
+
+    for (size_t i = 0; i < _length; ++i)
+    {
+        _crc ^= _data[i];
+        for (int b = 0; b < 8; ++b)
+            _crc = (_crc & 1) ? static_cast<crc_t_>((_crc >> 1) ^ its_reflected_poly)
+                              : static_cast<crc_t_>(_crc >> 1);
+    }
+    return _crc;
+}
+
+uint32_t calculate_04(const uint8_t* _data, size_t _length, uint32_t _start_value)
+{
+    return calculate_reflected<uint32_t>(0xF4ACFB13U, _start_value ^ 0xFFFFFFFFU, _data, _length)
+         ^ 0xFFFFFFFFU;
+}
+
+uint16_t calculate_05(const uint8_t* _data, size_t _length, uint16_t _start_value)
+{
+    uint16_t its_crc(_start_value);
+    for (size_t i = 0; i < _length; ++i)
+    {
+        its_crc = static_cast<uint16_t>(its_crc ^ (_data[i] << 8));
+        for (int b = 0; b < 8; ++b)
+            its_crc = (its_crc & 0x8000U) ? static_cast<uint16_t>((its_crc << 1) ^ 0x1021U)
+                                          : static_cast<uint16_t>(its_crc << 1);
+    }
+    return its_crc;
+}
+
+uint64_t calculate_07(const uint8_t* _data, size_t _length, uint64_t _start_value)
+{
+    return calculate_reflected<uint64_t>(0x42F0E1EBA9EA3693U, _start_value ^ 0xFFFFFFFFFFFFFFFFU,
+                                         _data, _length)
+         ^ 0xFFFFFFFFFFFFFFFFU;
+}
+
+uint32_t calculate_custom(const uint8_t* _data, size_t _length)
+{
+    return calculate_reflected<uint32_t>(0x04C11DB7U, 0xFFFFFFFFU, _data, _length) ^ 0xFFFFFFFFU;
+}
+
+e2e_buffer create_buffer(size_t _length, std::mt19937& _random)
+{
+    e2e_buffer its_buffer(_length);
+    for (auto& b : its_buffer)
+        b = static_cast<uint8_t>(_random());
+    return its_buffer;
+}
+} // namespace
+
+TEST(e2e_crc_test, check_values)
+{
+    const std::string its_check("123456789");
+    const buffer_view its_view(reinterpret_cast<const uint8_t*>(its_check.data()),
+                               its_check.size());
+
+    EXPECT_EQ(e2e_crc::calculate_profile_04(its_view), 0x1697D06AU);
+    EXPECT_EQ(e2e_crc::calculate_profile_05(its_view), 0x29B1U);
+    EXPECT_EQ(e2e_crc::calculate_profile_07(its_view), 0x995DC9BBDF1939FAU);
+    EXPECT_EQ(e2e_crc::calculate_profile_custom(its_view), 0xCBF43926U);
+}
+
+TEST(e2e_crc_test, matches_bitwise_calculation)
+{
+    std::mt19937 its_random(42);
+
+    // All lengths around the slice and fold block sizes, at all alignments
+    const e2e_buffer its_buffer = create_buffer(1200, its_random);
+    for (size_t its_offset = 0; its_offset < 8; ++its_offset)
+    {
+        for (size_t its_length = 0; its_offset + its_length <= 1100; ++its_length)
+        {
+            const uint8_t*    its_data = its_buffer.data() + its_offset;
+            const buffer_view its_view(its_data, its_length);
+            const auto        its_start = static_cast<uint64_t>(its_random()) << 32 | its_random();
+
+            ASSERT_EQ(e2e_crc::calculate_profile_04(its_view, static_cast<uint32_t>(its_start)),
+                      calculate_04(its_data, its_length, static_cast<uint32_t>(its_start)))
+                << "length " << its_length;
+            ASSERT_EQ(e2e_crc::calculate_profile_05(its_view, static_cast<uint16_t>(its_start)),
+                      calculate_05(its_data, its_length, static_cast<uint16_t>(its_start)))
+                << "length " << its_length;
+            ASSERT_EQ(e2e_crc::calculate_profile_07(its_view, its_start),
+                      calculate_07(its_data, its_length, its_start))
+                << "length " << its_length;
+            ASSERT_EQ(e2e_crc::calculate_profile_custom(its_view),
+                      calculate_custom(its_data, its_length))
+                << "length " << its_length;
+        }
+    }
+}
+
+TEST(e2e_crc_test, large_buffers)
+{
+    std::mt19937     its_random(7);
+    const e2e_buffer its_buffer = create_buffer(4 * 1024 * 1024 + 13, its_random);
+    const buffer_view its_view(its_buffer);
+
+    EXPECT_EQ(e2e_crc::calculate_profile_04(its_view),
+              calculate_04(its_buffer.data(), its_buffer.size(), 0));
+    EXPECT_EQ(e2e_crc::calculate_profile_05(its_view),
+              calculate_05(its_buffer.data(), its_buffer.size(), 0xFFFF));
+    EXPECT_EQ(e2e_crc::calculate_profile_07(its_view),
+              calculate_07(its_buffer.data(), its_buffer.size(), 0));
+    EXPECT_EQ(e2e_crc::calculate_profile_custom(its_view),
+              calculate_custom(its_buffer.data(), its_buffer.size()));
+
+    // Calculation in parts
+    const size_t its_split(1024 * 1024 + 5);
+    const auto   its_first = e2e_crc::calculate_profile_07(buffer_view(its_buffer, its_split));
+    EXPECT_EQ(e2e_crc::calculate_profile_07(buffer_view(its_buffer, its_split, its_buffer.size()),
+                                            its_first),
+              e2e_crc::calculate_profile_07(its_view));
+}
@@ -0,0 +1,137 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <vsomeip/defines.hpp>
+
+#include "../../../implementation/configuration/include/e2e.hpp"
+#include "../../../implementation/e2e_protection/include/e2e/profile/e2e_provider_impl.hpp"
+#include "../../../implementation/e2e_protection/include/e2e/profile/profile_interface/instance_counters.hpp"
+#include "../../../implementation/utility/include/bithelper.hpp"
+
+using vsomeip_v3::bithelper;
+using vsomeip_v3::buffer_span;
+using vsomeip_v3::buffer_view;
+using vsomeip_v3::e2e_buffer;
+using vsomeip_v3::e2e::e2e_provider_impl;
+using vsomeip_v3::e2e::profile_interface::check_status_t;
+using vsomeip_v3::e2e::profile_interface::generic_check_status;
+using vsomeip_v3::e2e::profile_interface::instance_counters;
+
+namespace {
+const vsomeip_v3::service_t SERVICE = 0x1234;
+const vsomeip_v3::event_t   EVENT   = 0x8001;
+
+std::shared_ptr<e2e_provider_impl> create_provider(const std::string& _profile)
+{
+    auto its_provider = std::make_shared<e2e_provider_impl>();
+    auto its_config   = std::make_shared<vsomeip_v3::cfg::e2e>(
+        "both", _profile, SERVICE, EVENT,
+        vsomeip_v3::cfg::e2e::custom_parameters_t{{"data_id", "0x2d"}, {"crc_offset", "64"}});
+    its_provider->add_configuration(its_config);
+    return its_provider;
+}
+
+// A message as it leaves the serializer: SOME/IP header followed by the payload
+e2e_buffer create_message(size_t _payload_length)
+{
+    e2e_buffer its_message(VSOMEIP_SOMEIP_HEADER_SIZE + _payload_length, 0x00);
+    for (size_t i = VSOMEIP_SOMEIP_HEADER_SIZE; i < its_message.size(); ++i)
+        its_message[i] = static_cast<uint8_t>(i);
+    return its_message;
+}
+} // namespace
+
+TEST(e2e_protection_test, protect_and_check_in_place)
+{
+    auto its_provider = create_provider("P04");
+    ASSERT_TRUE(its_provider->is_protected({SERVICE, EVENT}));
+    const size_t its_base = its_provider->get_protection_base({SERVICE, EVENT});
+
+    e2e_buffer        its_message = create_message(40);
+    const e2e_buffer  its_header(its_message.begin(), its_message.begin() + its_base);
+    const buffer_span its_span(its_message.data() + its_base, its_message.size() - its_base);
+
+    for (uint16_t its_counter = 0; its_counter < 3; ++its_counter)
+    {
+        its_provider->protect({SERVICE, EVENT}, its_span, 0x01);
+
+        // Counter and CRC are written behind the header, the header is untouched
+        EXPECT_TRUE(std::equal(its_header.begin(), its_header.end(), its_message.begin()));
+        EXPECT_EQ(bithelper::read_uint16_be(&its_span[8 + 2]), its_counter);
+
+        check_status_t its_status(generic_check_status::E2E_ERROR);
+        its_provider->check({SERVICE, EVENT}, its_span, 0x01, its_status);
+        EXPECT_EQ(its_status, generic_check_status::E2E_OK);
+    }
+
+    its_message.back() ^= 0x01;
+    check_status_t its_status(generic_check_status::E2E_OK);
+    its_provider->check({SERVICE, EVENT}, buffer_view(its_span), 0x01, its_status);
+    EXPECT_EQ(its_status, generic_check_status::E2E_WRONG_CRC);
+}
+
+TEST(e2e_protection_test, concurrent_counters)
+{
+    auto its_provider = create_provider("P07");
+
+    const int                its_threads(4);
+    const uint32_t           its_messages(2000);
+    std::mutex               its_mutex;
+    std::vector<uint32_t>    its_counters;
+    std::vector<std::thread> its_workers;
+    for (int t = 0; t < its_threads; ++t)
+    {
+        its_workers.emplace_back([&]() {
+            e2e_buffer            its_message = create_message(64);
+            const buffer_span     its_span(its_message.data() + VSOMEIP_SOMEIP_HEADER_SIZE,
+                                           its_message.size() - VSOMEIP_SOMEIP_HEADER_SIZE);
+            std::vector<uint32_t> its_own;
+            for (uint32_t i = 0; i < its_messages; ++i)
+            {
+                its_provider->protect({SERVICE, EVENT}, its_span, 0x02);
+                its_own.push_back(bithelper::read_uint32_be(&its_span[8 + 12]));
+            }
+            std::lock_guard<std::mutex> its_lock(its_mutex);
+            its_counters.insert(its_counters.end(), its_own.begin(), its_own.end());
+        });
+    }
+    for (auto& w : its_workers)
+        w.join();
+
+    // Every counter value is used exactly once
+    std::sort(its_counters.begin(), its_counters.end());
+    ASSERT_EQ(its_counters.size(), size_t(its_threads) * its_messages);
+    for (uint32_t i = 0; i < its_counters.size(); ++i)
+        ASSERT_EQ(its_counters[i], i);
+}
+
+TEST(e2e_protection_test, instance_counters)
+{
+    instance_counters<uint16_t, 4> its_counters;
+    bool                           is_inserted(false);
+
+    auto its_first = its_counters.get(0x0101, 7, is_inserted);
+    ASSERT_NE(its_first, nullptr);
+    EXPECT_TRUE(is_inserted);
+    EXPECT_EQ(its_first->load(), 7);
+    EXPECT_EQ(its_counters.get(0x0101, 9, is_inserted), its_first);
+    EXPECT_FALSE(is_inserted);
+
+    // Colliding instances probe the next slots until the table is full
+    for (vsomeip_v3::instance_t its_instance :
+         std::initializer_list<vsomeip_v3::instance_t>{0x0001, 0x0005, 0x0009})
+    {
+        ASSERT_NE(its_counters.get(its_instance, 0, is_inserted), nullptr);
+        EXPECT_TRUE(is_inserted);
+    }
+    EXPECT_EQ(its_counters.get(0x000d, 0, is_inserted), nullptr);
+    EXPECT_EQ(its_counters.get(0x0005)->load(), 0);
+}
@@ -0,0 +1,132 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "../../../implementation/endpoints/include/endpoint_definition.hpp"
+
+using namespace vsomeip_v3;
+
+namespace {
+const auto v4_address = boost::asio::ip::make_address("192.168.0.1");
+const auto v6_address = boost::asio::ip::make_address("fd00::1");
+} // namespace
+
+TEST(endpoint_definition_test, interns_definitions)
+{
+    const auto its_definition = endpoint_definition::get(v4_address, 30509, false, 0x1234, 0x5678);
+    EXPECT_EQ(its_definition, endpoint_definition::get(v4_address, 30509, false, 0x1234, 0x5678));
+    EXPECT_EQ(its_definition->get_address(), v4_address);
+    EXPECT_EQ(its_definition->get_port(), 30509);
+    EXPECT_FALSE(its_definition->is_reliable());
+
+    EXPECT_NE(its_definition, endpoint_definition::get(v4_address, 30509, true, 0x1234, 0x5678));
+    EXPECT_NE(its_definition, endpoint_definition::get(v4_address, 30510, false, 0x1234, 0x5678));
+    EXPECT_NE(its_definition, endpoint_definition::get(v4_address, 30509, false, 0x1235, 0x5678));
+    EXPECT_NE(its_definition, endpoint_definition::get(v4_address, 30509, false, 0x1234, 0x5679));
+
+    const auto its_v6_definition =
+        endpoint_definition::get(v6_address, 30509, false, 0x1234, 0x5678);
+    EXPECT_NE(its_definition, its_v6_definition);
+    EXPECT_EQ(its_v6_definition,
+              endpoint_definition::get(v6_address, 30509, false, 0x1234, 0x5678));
+    EXPECT_EQ(its_v6_definition->get_address(), v6_address);
+
+    // The remote port is shared by all users of the definition
+    its_definition->set_remote_port(40000);
+    EXPECT_EQ(endpoint_definition::get(v4_address, 30509, false, 0x1234, 0x5678)->get_remote_port(),
+              40000);
+}
+
+TEST(endpoint_definition_test, reclaims_unreferenced_definitions)
+{
+    const auto its_start = endpoint_definition::get_statistics();
+
+    const std::uint16_t its_count(2000);
+    {
+        std::vector<std::shared_ptr<endpoint_definition>> its_definitions;
+        for (std::uint16_t i = 0; i < its_count; ++i)
+            its_definitions.push_back(
+                endpoint_definition::get(v4_address, i, true, 0x0001, 0x0001));
+
+        const auto its_statistics = endpoint_definition::get_statistics();
+        EXPECT_EQ(its_statistics.misses_ - its_start.misses_, its_count);
+        EXPECT_GE(its_statistics.size_, its_count);
+
+        endpoint_definition::get(v4_address, 0, true, 0x0001, 0x0001);
+        EXPECT_EQ(endpoint_definition::get_statistics().hits_, its_statistics.hits_ + 1);
+    }
+
+    // Churning ports: the expired definitions are dropped by later insertions
+    for (std::uint16_t i = 0; i < its_count; ++i)
+        endpoint_definition::get(v4_address, i, false, 0x0001, 0x0001);
+
+    const auto its_statistics = endpoint_definition::get_statistics();
+    EXPECT_GE(its_statistics.reclaimed_ - its_start.reclaimed_, its_count);
+    EXPECT_LT(its_statistics.size_, its_start.size_ + its_count);
+}
+
+TEST(endpoint_definition_test, reuses_expired_slots)
+{
+    endpoint_definition::get(v4_address, 1, false, 0x0004, 0x0001);
+    const auto its_start = endpoint_definition::get_statistics();
+
+    // The expired definition is replaced in place, the table does not grow.
+    // Insertions may also reclaim expired definitions of other tests.
+    for (int i = 0; i < 100; ++i)
+        EXPECT_NE(endpoint_definition::get(v4_address, 1, false, 0x0004, 0x0001), nullptr);
+
+    const auto its_statistics = endpoint_definition::get_statistics();
+    EXPECT_EQ(its_statistics.misses_ - its_start.misses_, 100u);
+    EXPECT_GE(its_statistics.reclaimed_ - its_start.reclaimed_, 100u);
+    EXPECT_LE(its_statistics.size_, its_start.size_);
+}
+
+TEST(endpoint_definition_test, concurrent_get)
+{
+    std::vector<std::shared_ptr<endpoint_definition>> its_results[4];
+    std::vector<std::thread>                          its_threads;
+    for (auto& its_result : its_results)
+    {
+        its_threads.emplace_back([&its_result]() {
+            for (std::uint16_t i = 0; i < 500; ++i)
+                its_result.push_back(
+                    endpoint_definition::get(v6_address, i, false, 0x0002, 0x0001));
+        });
+    }
+    for (auto& t : its_threads)
+        t.join();
+
+    for (const auto& its_result : its_results)
+        EXPECT_EQ(its_result, its_results[0]);
+}
+
+TEST(endpoint_definition_test, writers_progress_under_steady_lookups)
+{
+    const auto its_definition = endpoint_definition::get(v4_address, 1, true, 0x0003, 0x0001);
+    std::atomic<bool>        is_running(true);
+    std::vector<std::thread> its_readers;
+    for (int i = 0; i < 2; ++i)
+    {
+        its_readers.emplace_back([&is_running]() {
+            while (is_running)
+                endpoint_definition::get(v4_address, 1, true, 0x0003, 0x0001);
+        });
+    }
+
+    // Insertions publish into free slots and never wait for the lookups
+    std::vector<std::shared_ptr<endpoint_definition>> its_definitions;
+    for (std::uint16_t i = 2; i < 1000; ++i)
+        its_definitions.push_back(endpoint_definition::get(v4_address, i, true, 0x0003, 0x0001));
+
+    is_running = false;
+    for (auto& t : its_readers)
+        t.join();
+    EXPECT_EQ(its_definition, endpoint_definition::get(v4_address, 1, true, 0x0003, 0x0001));
+}
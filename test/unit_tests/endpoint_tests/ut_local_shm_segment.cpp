@@ -0,0 +1,140 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "../../../implementation/endpoints/include/local_shm_segment.hpp"
+
+using vsomeip_v3::byte_t;
+using vsomeip_v3::local_shm_segment;
+
+namespace {
+std::string get_name()
+{
+    return "/vsomeip-ut-shm-" + std::to_string(getpid());
+}
+
+std::vector<byte_t> get_message(std::size_t _size, byte_t _value)
+{
+    return std::vector<byte_t>(_size, _value);
+}
+} // namespace
+
+TEST(local_shm_segment_test, write_read_release)
+{
+    auto its_writer =
+        local_shm_segment::create(get_name(), 4, 4096, 0600, std::chrono::milliseconds(1000));
+    ASSERT_NE(its_writer, nullptr);
+    auto its_reader = local_shm_segment::open(get_name());
+    ASSERT_NE(its_reader, nullptr);
+    EXPECT_EQ(its_reader->get_slot_count(), 4u);
+    EXPECT_EQ(its_reader->get_slot_size(), 4096u);
+
+    const auto    its_message = get_message(3000, 0x5a);
+    std::uint32_t its_slot;
+    std::uint64_t its_sequence;
+    ASSERT_TRUE(its_writer->write(its_message.data(), 3000, 2, its_slot, its_sequence));
+    EXPECT_EQ(its_writer->get_used(), 1u);
+
+    std::vector<byte_t> its_copy(3000);
+    ASSERT_TRUE(its_reader->read(its_slot, its_sequence, 3000, its_copy.data()));
+    EXPECT_EQ(its_copy, its_message);
+    EXPECT_FALSE(its_reader->read(its_slot, its_sequence, 2999, its_copy.data()));
+
+    // The slot is free after both references were released
+    its_reader->release(its_slot, its_sequence);
+    EXPECT_EQ(its_writer->get_used(), 1u);
+    its_reader->release(its_slot, its_sequence);
+    EXPECT_EQ(its_writer->get_used(), 0u);
+    its_reader->release(its_slot, its_sequence);
+    EXPECT_EQ(its_writer->get_used(), 0u);
+    EXPECT_FALSE(its_reader->read(its_slot, its_sequence, 3000, its_copy.data()));
+
+    // Too large
+    const auto its_large_message = get_message(4097, 0x5a);
+    EXPECT_FALSE(its_writer->write(its_large_message.data(), 4097, 1, its_slot, its_sequence));
+}
+
+TEST(local_shm_segment_test, full_ring_is_reclaimed)
+{
+    auto its_writer =
+        local_shm_segment::create(get_name(), 2, 1024, 0600, std::chrono::milliseconds(20));
+    ASSERT_NE(its_writer, nullptr);
+    auto its_reader = local_shm_segment::open(get_name());
+    ASSERT_NE(its_reader, nullptr);
+
+    const auto    its_message = get_message(1024, 0x01);
+    std::uint32_t its_slot[3];
+    std::uint64_t its_sequence[3];
+    ASSERT_TRUE(its_writer->write(its_message.data(), 1024, 1, its_slot[0], its_sequence[0]));
+    ASSERT_TRUE(its_writer->write(its_message.data(), 1024, 1, its_slot[1], its_sequence[1]));
+    EXPECT_NE(its_slot[0], its_slot[1]);
+    EXPECT_FALSE(its_writer->write(its_message.data(), 1024, 1, its_slot[2], its_sequence[2]));
+
+    // A receiver that did not release its slot in time loses the message
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    ASSERT_TRUE(its_writer->write(its_message.data(), 1024, 1, its_slot[2], its_sequence[2]));
+    EXPECT_EQ(its_slot[2], its_slot[0]);
+    EXPECT_NE(its_sequence[2], its_sequence[0]);
+
+    std::vector<byte_t> its_copy(1024);
+    EXPECT_FALSE(its_reader->read(its_slot[0], its_sequence[0], 1024, its_copy.data()));
+    its_reader->release(its_slot[0], its_sequence[0]);
+    EXPECT_EQ(its_writer->get_used(), 2u);
+    EXPECT_TRUE(its_reader->read(its_slot[2], its_sequence[2], 1024, its_copy.data()));
+}
+
+TEST(local_shm_segment_test, invalid_segments)
+{
+    EXPECT_EQ(local_shm_segment::open(get_name()), nullptr);
+    EXPECT_EQ(local_shm_segment::create(get_name(), 0, 1024, 0600, std::chrono::milliseconds(0)),
+              nullptr);
+
+    // The owner removes the shared memory object
+    auto its_writer =
+        local_shm_segment::create(get_name(), 1, 1024, 0600, std::chrono::milliseconds(0));
+    ASSERT_NE(its_writer, nullptr);
+    its_writer.reset();
+    EXPECT_EQ(local_shm_segment::open(get_name()), nullptr);
+}
+
+TEST(local_shm_segment_test, stale_segments_are_removed)
+{
+    // A process that does not exist anymore
+    const pid_t its_child = fork();
+    ASSERT_GE(its_child, 0);
+    if (its_child == 0)
+        _exit(0);
+    ASSERT_EQ(waitpid(its_child, nullptr, 0), its_child);
+
+    const std::string its_prefix = get_name() + "-";
+    const std::string its_stale  = its_prefix + std::to_string(its_child);
+    const std::string its_own    = its_prefix + std::to_string(getpid());
+
+    auto its_crashed =
+        local_shm_segment::create(its_stale, 1, 1024, 0600, std::chrono::milliseconds(0));
+    ASSERT_NE(its_crashed, nullptr);
+    auto its_running =
+        local_shm_segment::create(its_own, 1, 1024, 0600, std::chrono::milliseconds(0));
+    ASSERT_NE(its_running, nullptr);
+
+    EXPECT_EQ(local_shm_segment::remove_stale(its_prefix), 1u);
+    EXPECT_EQ(local_shm_segment::open(its_stale), nullptr);
+    EXPECT_NE(local_shm_segment::open(its_own), nullptr);
+    EXPECT_EQ(local_shm_segment::remove_stale(its_prefix), 0u);
+
+    // Mappings of the removed object stay valid
+    const auto    its_message = get_message(100, 0x01);
+    std::uint32_t its_slot;
+    std::uint64_t its_sequence;
+    EXPECT_TRUE(its_crashed->write(its_message.data(), 100, 1, its_slot, its_sequence));
+}
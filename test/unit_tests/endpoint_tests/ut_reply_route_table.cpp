@@ -0,0 +1,141 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/ip/udp.hpp>
+
+#include "../../../implementation/endpoints/include/reply_route_table.hpp"
+
+using endpoint_type = boost::asio::ip::udp::endpoint;
+using vsomeip_v3::reply_route_table;
+
+namespace {
+endpoint_type get_remote(unsigned short _port)
+{
+    return endpoint_type(boost::asio::ip::make_address("192.168.0.1"), _port);
+}
+} // namespace
+
+TEST(reply_route_table_test, routes_are_taken_once)
+{
+    reply_route_table<endpoint_type> its_routes(16, std::chrono::milliseconds(1000));
+    EXPECT_EQ(its_routes.capacity(), 16u);
+
+    its_routes.insert(0x1234, 0x0001, get_remote(30001));
+    its_routes.insert(0x1234, 0x0002, get_remote(30002));
+    its_routes.insert(0x1234, 0x0001, get_remote(30003));
+
+    endpoint_type its_remote;
+    EXPECT_TRUE(its_routes.take(0x1234, 0x0001, its_remote));
+    EXPECT_EQ(its_remote, get_remote(30003));
+    EXPECT_FALSE(its_routes.take(0x1234, 0x0001, its_remote));
+    EXPECT_TRUE(its_routes.take(0x1234, 0x0002, its_remote));
+    EXPECT_EQ(its_remote, get_remote(30002));
+
+    const auto its_statistics = its_routes.get_statistics();
+    EXPECT_EQ(its_statistics.inserts_, 3u);
+    EXPECT_EQ(its_statistics.hits_, 2u);
+    EXPECT_EQ(its_statistics.misses_, 1u);
+    EXPECT_EQ(its_statistics.evictions_, 0u);
+}
+
+TEST(reply_route_table_test, memory_is_bounded)
+{
+    reply_route_table<endpoint_type> its_routes(64, std::chrono::milliseconds(1));
+
+    for (unsigned short i = 0; i < 64; i++)
+        its_routes.insert(0x1000, i, get_remote(30000));
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    for (unsigned short i = 64; i < 1024; i++)
+        its_routes.insert(0x1000, i, get_remote(30000));
+
+    const auto its_statistics = its_routes.get_statistics();
+    EXPECT_EQ(its_statistics.inserts_, 1024u);
+    EXPECT_GE(its_statistics.evictions_ + its_statistics.expirations_, 1024u - 2 * 64u);
+    EXPECT_GT(its_statistics.expirations_, 0u);
+
+    // The most recent request is still routed
+    endpoint_type its_remote;
+    EXPECT_TRUE(its_routes.take(0x1000, 1023, its_remote));
+}
+
+TEST(reply_route_table_test, full_buckets_keep_live_routes)
+{
+    // A single bucket, further routes go to the overflow area
+    reply_route_table<endpoint_type> its_routes(4, std::chrono::milliseconds(10000));
+    for (unsigned short i = 0; i < 9; i++)
+        its_routes.insert(0x1000, i, get_remote(static_cast<unsigned short>(30000 + i)));
+
+    // Only the oldest overflow route is evicted when the overflow bucket is full
+    endpoint_type its_remote;
+    for (unsigned short i = 0; i < 9; i++)
+    {
+        SCOPED_TRACE(i);
+        EXPECT_EQ(its_routes.take(0x1000, i, its_remote), i != 4);
+        if (i != 4)
+        {
+            EXPECT_EQ(its_remote, get_remote(static_cast<unsigned short>(30000 + i)));
+        }
+    }
+
+    const auto its_statistics = its_routes.get_statistics();
+    EXPECT_EQ(its_statistics.evictions_, 1u);
+    EXPECT_EQ(its_statistics.expirations_, 0u);
+}
+
+TEST(reply_route_table_test, overflow_routes_are_replaced)
+{
+    reply_route_table<endpoint_type> its_routes(4, std::chrono::milliseconds(10000));
+    for (unsigned short i = 0; i < 5; i++)
+        its_routes.insert(0x1000, i, get_remote(30000));
+
+    // Once again in the overflow area and then in the bucket, which drops
+    // the overflow route
+    its_routes.insert(0x1000, 4, get_remote(30001));
+    endpoint_type its_remote;
+    EXPECT_TRUE(its_routes.take(0x1000, 0, its_remote));
+    its_routes.insert(0x1000, 4, get_remote(30002));
+
+    EXPECT_TRUE(its_routes.take(0x1000, 4, its_remote));
+    EXPECT_EQ(its_remote, get_remote(30002));
+    EXPECT_FALSE(its_routes.take(0x1000, 4, its_remote));
+}
+
+TEST(reply_route_table_test, contended_bucket)
+{
+    // All threads share a single bucket, but each only holds one route
+    const unsigned short its_threads_count(4);
+    const unsigned       its_requests(20000);
+
+    reply_route_table<endpoint_type> its_routes(4, std::chrono::milliseconds(10000));
+    std::vector<std::thread>         its_threads;
+    for (unsigned short t = 0; t < its_threads_count; t++)
+    {
+        its_threads.emplace_back([&its_routes, t, its_requests]() {
+            const auto its_client = static_cast<vsomeip_v3::client_t>(0x1000 + t);
+            for (unsigned i = 0; i < its_requests; i++)
+            {
+                const auto its_session = static_cast<vsomeip_v3::session_t>(i);
+                its_routes.insert(its_client, its_session, get_remote(its_client));
+
+                endpoint_type its_remote;
+                EXPECT_TRUE(its_routes.take(its_client, its_session, its_remote));
+                EXPECT_EQ(its_remote, get_remote(its_client));
+            }
+        });
+    }
+    for (auto& t : its_threads)
+        t.join();
+
+    const auto its_statistics = its_routes.get_statistics();
+    EXPECT_EQ(its_statistics.inserts_, std::uint64_t(its_threads_count) * its_requests);
+    EXPECT_EQ(its_statistics.hits_, std::uint64_t(its_threads_count) * its_requests);
+    EXPECT_EQ(its_statistics.misses_, 0u);
+    EXPECT_EQ(its_statistics.evictions_, 0u);
+}
@@ -0,0 +1,124 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <vsomeip/constants.hpp>
+#include <vsomeip/defines.hpp>
+
+#include "../../../implementation/endpoints/include/tcp_framing.hpp"
+
+using namespace vsomeip_v3;
+
+namespace {
+void append_message(std::vector<byte_t>& _stream, std::size_t _payload_size,
+                    byte_t _payload_value = 0x00)
+{
+    const auto its_length = static_cast<std::uint32_t>(VSOMEIP_SOMEIP_HEADER_SIZE + _payload_size);
+    const byte_t its_header[VSOMEIP_FULL_HEADER_SIZE] = {
+        0x12, 0x34, 0x00, 0x01,
+        static_cast<byte_t>(its_length >> 24), static_cast<byte_t>(its_length >> 16),
+        static_cast<byte_t>(its_length >> 8), static_cast<byte_t>(its_length),
+        0x00, 0x01, 0x00, 0x01,
+        VSOMEIP_PROTOCOL_VERSION, 0x01, 0x00, 0x00};
+    _stream.insert(_stream.end(), its_header, its_header + VSOMEIP_FULL_HEADER_SIZE);
+    _stream.insert(_stream.end(), _payload_size, _payload_value);
+}
+
+// Straightforward search, as reference
+std::size_t find_cookie(const std::vector<byte_t>& _data, const byte_t* _cookie)
+{
+    for (std::size_t i = 0; i + sizeof(CLIENT_COOKIE) <= _data.size(); ++i)
+    {
+        if (std::equal(_cookie, _cookie + sizeof(CLIENT_COOKIE), _data.begin() + i))
+            return i;
+    }
+    return _data.size();
+}
+} // namespace
+
+TEST(tcp_framing_test, find_magic_cookie)
+{
+    for (std::size_t its_size : {0, 15, 16, 17, 31, 33, 64, 100, 1000})
+    {
+        // Prefixes of the cookie everywhere, but no cookie
+        std::vector<byte_t> its_data(its_size, 0xFF);
+        for (std::size_t i = 2; i < its_size; i += 3)
+            its_data[i] = MAGIC_COOKIE_CLIENT_MESSAGE;
+        EXPECT_EQ(tcp_framing::find_magic_cookie(its_data.data(), its_size, CLIENT_COOKIE),
+                  its_size);
+
+        for (std::size_t its_offset = 0; its_offset + sizeof(CLIENT_COOKIE) <= its_size;
+             its_offset += 7)
+        {
+            SCOPED_TRACE(its_size);
+            SCOPED_TRACE(its_offset);
+            auto its_copy = its_data;
+            std::copy(CLIENT_COOKIE, CLIENT_COOKIE + sizeof(CLIENT_COOKIE),
+                      its_copy.begin() + static_cast<std::ptrdiff_t>(its_offset));
+            const auto its_expected = find_cookie(its_copy, CLIENT_COOKIE);
+            EXPECT_EQ(tcp_framing::find_magic_cookie(its_copy.data(), its_size, CLIENT_COOKIE),
+                      its_expected);
+            EXPECT_EQ(tcp_framing::find_magic_cookie(its_copy.data(), its_size, SERVICE_COOKIE),
+                      find_cookie(its_copy, SERVICE_COOKIE));
+        }
+    }
+}
+
+TEST(tcp_framing_test, scan_stops_at_special_messages)
+{
+    std::vector<byte_t> its_stream;
+    append_message(its_stream, 0);
+    append_message(its_stream, 100);
+    append_message(its_stream, 3000, 0xFF);
+
+    std::uint32_t its_sizes[tcp_framing::max_frames_];
+    EXPECT_EQ(tcp_framing::scan(its_stream.data(), its_stream.size(), CLIENT_COOKIE, true,
+                                its_sizes, tcp_framing::max_frames_),
+              3u);
+    EXPECT_EQ(its_sizes[0], 16u);
+    EXPECT_EQ(its_sizes[1], 116u);
+    EXPECT_EQ(its_sizes[2], 3016u);
+
+    // Incomplete message
+    EXPECT_EQ(tcp_framing::scan(its_stream.data(), its_stream.size() - 1, CLIENT_COOKIE, true,
+                                its_sizes, tcp_framing::max_frames_),
+              2u);
+    // Limited number of messages
+    EXPECT_EQ(tcp_framing::scan(its_stream.data(), its_stream.size(), CLIENT_COOKIE, true,
+                                its_sizes, 1),
+              1u);
+
+    // Magic cookie
+    auto its_cookie = its_stream;
+    its_cookie.insert(its_cookie.begin() + 16, CLIENT_COOKIE,
+                      CLIENT_COOKIE + sizeof(CLIENT_COOKIE));
+    EXPECT_EQ(tcp_framing::scan(its_cookie.data(), its_cookie.size(), CLIENT_COOKIE, true,
+                                its_sizes, tcp_framing::max_frames_),
+              1u);
+
+    // Magic cookie within a message, only relevant if cookies are enabled
+    auto its_embedded = its_stream;
+    std::copy(CLIENT_COOKIE, CLIENT_COOKIE + sizeof(CLIENT_COOKIE), its_embedded.begin() + 40);
+    EXPECT_EQ(tcp_framing::scan(its_embedded.data(), its_embedded.size(), CLIENT_COOKIE, true,
+                                its_sizes, tcp_framing::max_frames_),
+              1u);
+    EXPECT_EQ(tcp_framing::scan(its_embedded.data(), its_embedded.size(), CLIENT_COOKIE, false,
+                                its_sizes, tcp_framing::max_frames_),
+              3u);
+
+    // Invalid protocol version, message type and return code
+    for (std::size_t its_position :
+         {VSOMEIP_PROTOCOL_VERSION_POS, VSOMEIP_MESSAGE_TYPE_POS, VSOMEIP_RETURN_CODE_POS})
+    {
+        auto its_invalid = its_stream;
+        its_invalid[16 + its_position] = 0x1F;
+        EXPECT_EQ(tcp_framing::scan(its_invalid.data(), its_invalid.size(), CLIENT_COOKIE, true,
+                                    its_sizes, tcp_framing::max_frames_),
+                  1u);
+    }
+}
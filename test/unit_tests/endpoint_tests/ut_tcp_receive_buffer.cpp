@@ -0,0 +1,108 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "../../../implementation/endpoints/include/tcp_receive_buffer.hpp"
+
+using namespace vsomeip_v3;
+
+namespace {
+void receive(tcp_receive_buffer& _buffer, std::size_t _size, std::size_t _bytes, byte_t _first)
+{
+    ASSERT_LE(_bytes, _buffer.get_free_size(_size));
+    for (std::size_t i = 0; i < _bytes; ++i)
+        _buffer.get_free(_size)[i] = static_cast<byte_t>(_first + i);
+}
+} // namespace
+
+TEST(tcp_receive_buffer_test, messages_stay_in_place)
+{
+    tcp_receive_buffer its_buffer(64);
+    receive(its_buffer, 0, 40, 0);
+
+    // Two messages of 16 bytes are processed, 8 bytes of the third remain
+    const byte_t* its_partial = &its_buffer[32];
+    its_buffer.consume(32, 8);
+    EXPECT_EQ(&its_buffer[0], its_partial);
+    EXPECT_EQ(its_buffer[0], 32);
+    EXPECT_EQ(its_buffer.get_free_size(8), 24u);
+
+    // The rest of the message fits behind
+    EXPECT_FALSE(its_buffer.prepare(8, 8, 1024));
+    EXPECT_EQ(&its_buffer[0], its_partial);
+    receive(its_buffer, 8, 8, 40);
+    for (std::size_t i = 0; i < 16; ++i)
+        EXPECT_EQ(its_buffer[i], 32 + i);
+
+    // Everything processed, the next receive starts at the front again
+    its_buffer.consume(16, 0);
+    EXPECT_EQ(its_buffer.get_free_size(0), 64u);
+    EXPECT_EQ(its_buffer.size(), 64u);
+}
+
+TEST(tcp_receive_buffer_test, straddling_message_is_moved)
+{
+    tcp_receive_buffer its_buffer(64);
+    receive(its_buffer, 0, 60, 0);
+    its_buffer.consume(50, 10);
+
+    // 20 more bytes fit into the capacity, but not behind the partial message
+    EXPECT_FALSE(its_buffer.prepare(10, 20, 1024));
+    EXPECT_EQ(its_buffer.capacity(), 64u);
+    EXPECT_EQ(its_buffer.get_free_size(10), 54u);
+    for (std::size_t i = 0; i < 10; ++i)
+        EXPECT_EQ(its_buffer[i], 50 + i);
+}
+
+TEST(tcp_receive_buffer_test, grow_and_reset)
+{
+    tcp_receive_buffer its_buffer(16);
+    receive(its_buffer, 0, 16, 0);
+    its_buffer.consume(4, 12);
+
+    // A large message grows the buffer to the required size
+    EXPECT_TRUE(its_buffer.prepare(12, 1000, 4096));
+    EXPECT_EQ(its_buffer.capacity(), 1012u);
+    for (std::size_t i = 0; i < 12; ++i)
+        EXPECT_EQ(its_buffer[i], 4 + i);
+
+    // A small one at least doubles it
+    its_buffer.consume(12, 0);
+    receive(its_buffer, 0, 1012, 0);
+    EXPECT_TRUE(its_buffer.prepare(1012, 1, 4096));
+    EXPECT_EQ(its_buffer.capacity(), 2024u);
+
+    its_buffer.reset(16);
+    EXPECT_EQ(its_buffer.capacity(), 16u);
+    EXPECT_EQ(its_buffer.get_free_size(0), 16u);
+}
+
+TEST(tcp_receive_buffer_test, growth_is_limited)
+{
+    tcp_receive_buffer its_buffer(16);
+    receive(its_buffer, 0, 16, 0);
+
+    // Doubling stops at the limit
+    EXPECT_TRUE(its_buffer.prepare(16, 8, 24));
+    EXPECT_EQ(its_buffer.capacity(), 24u);
+    for (std::size_t i = 0; i < 16; ++i)
+        EXPECT_EQ(its_buffer[i], i);
+
+    // A larger message grows it to the required size
+    its_buffer.consume(16, 0);
+    receive(its_buffer, 0, 24, 0);
+    its_buffer.consume(4, 20);
+    EXPECT_TRUE(its_buffer.prepare(20, 60, 100));
+    EXPECT_EQ(its_buffer.capacity(), 80u);
+
+    // The required capacity wins over the limit
+    its_buffer.consume(20, 0);
+    receive(its_buffer, 0, 80, 0);
+    EXPECT_TRUE(its_buffer.prepare(80, 20, 64));
+    EXPECT_EQ(its_buffer.capacity(), 100u);
+}
@@ -0,0 +1,79 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <vsomeip/defines.hpp>
+
+#include "../../../implementation/endpoints/include/tp.hpp"
+
+using namespace vsomeip_v3;
+
+namespace {
+message_buffer_ptr_t get_message(std::size_t _payload_size)
+{
+    auto its_message = std::make_shared<message_buffer_t>(VSOMEIP_FULL_HEADER_SIZE + _payload_size);
+    const byte_t its_header[VSOMEIP_FULL_HEADER_SIZE] = {0x12, 0x34, 0x80, 0x01, 0x00, 0x00,
+                                                         0x00, 0x00, 0x00, 0x01, 0x00, 0x02,
+                                                         0x01, 0x01, 0x02, 0x00};
+    std::copy(its_header, its_header + VSOMEIP_FULL_HEADER_SIZE, its_message->begin());
+    for (std::size_t i = 0; i < _payload_size; ++i)
+        (*its_message)[VSOMEIP_FULL_HEADER_SIZE + i] = static_cast<byte_t>(i % 251);
+    return its_message;
+}
+
+// Checks that the segment views describe the same datagrams as tp_split_message
+void check_segments(std::size_t _payload_size, std::uint16_t _max_segment_length)
+{
+    const auto its_message = get_message(_payload_size);
+    const auto its_split   = tp::tp::tp_split_message(
+        its_message->data(), static_cast<std::uint32_t>(its_message->size()), _max_segment_length);
+    ASSERT_FALSE(its_split.empty());
+
+    tp::tp_segment its_segment;
+    its_segment.first(its_message, _max_segment_length);
+    for (std::size_t i = 0; i < its_split.size(); ++i)
+    {
+        SCOPED_TRACE(i);
+        ASSERT_TRUE(its_segment.is_segment_of(its_message));
+        EXPECT_EQ(its_segment.is_last(), i + 1 == its_split.size());
+
+        message_buffer_t its_datagram(its_segment.get_header(),
+                                      its_segment.get_header() + its_segment.get_header_size());
+        its_datagram.insert(its_datagram.end(), its_segment.get_payload(),
+                            its_segment.get_payload() + its_segment.get_payload_size());
+        EXPECT_EQ(its_datagram.size(), its_segment.get_size());
+        EXPECT_EQ(its_datagram, *its_split[i]);
+
+        EXPECT_EQ(its_segment.next(), i + 1 < its_split.size());
+    }
+    EXPECT_FALSE(its_segment.next());
+}
+} // namespace
+
+TEST(tp_segment_test, segments_match_split_message)
+{
+    check_segments(5000, tp::tp::tp_max_segment_length_);
+    // Last segment of the same length as the others
+    check_segments(4 * 1392, 1392);
+    check_segments(1024 * 1024, 1392);
+    check_segments(VSOMEIP_MAX_UDP_MESSAGE_SIZE, 16);
+}
+
+TEST(tp_segment_test, reset)
+{
+    const auto     its_message = get_message(4000);
+    tp::tp_segment its_segment;
+    EXPECT_FALSE(its_segment.is_segment_of(its_message));
+    EXPECT_FALSE(its_segment.next());
+
+    its_segment.first(its_message, 1392);
+    EXPECT_TRUE(its_segment.next());
+    EXPECT_EQ(its_segment.get_offset(), 1392u);
+
+    its_segment.reset();
+    EXPECT_FALSE(its_segment.is_segment_of(its_message));
+    EXPECT_FALSE(its_segment.get_message());
+}
@@ -0,0 +1,183 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "../../../implementation/configuration/include/configuration_impl.hpp"
+#include "../../../implementation/logger/include/logger_impl.hpp"
+
+using vsomeip_v3::logger::level_e;
+using vsomeip_v3::logger::logger_impl;
+
+namespace {
+class logger_impl_test : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        folder_ = boost::filesystem::temp_directory_path()
+                  / boost::filesystem::unique_path("vsomeip-logger-%%%%-%%%%");
+        boost::filesystem::create_directories(folder_);
+        logfile_ = (folder_ / "vsomeip.log").string();
+    }
+
+    void TearDown() override
+    {
+        boost::filesystem::remove_all(folder_);
+    }
+
+    // Creates a logger that only writes to the log file of the test
+    std::shared_ptr<logger_impl> create_logger(const std::string& _async, std::uint32_t _rate_limit)
+    {
+        const std::string its_name = (folder_ / "vsomeip.json").string();
+        {
+            std::ofstream its_file(its_name, std::ios::trunc);
+            its_file << R"({ "logging" : { "level" : "info", "console" : "false",
+                "file" : { "enable" : "true", "path" : ")"
+                     << logfile_ << R"(" }, "async" : )" << _async << R"(, "rate-limit" : ")"
+                     << _rate_limit << R"(" } })";
+        }
+        auto its_configuration = std::make_shared<vsomeip_v3::cfg::configuration_impl>(its_name);
+        its_configuration->load("logger_test");
+
+        auto its_logger = std::make_shared<logger_impl>();
+        its_logger->set_configuration(its_configuration);
+        return its_logger;
+    }
+
+    std::vector<std::string> read_lines() const
+    {
+        std::vector<std::string> its_lines;
+        std::ifstream            its_file(logfile_);
+        for (std::string its_line; std::getline(its_file, its_line);)
+            its_lines.push_back(its_line);
+        return its_lines;
+    }
+
+    // Waits for the next second of the clock the rate limiter uses
+    static void wait_for_next_second()
+    {
+        const auto its_now = []() {
+            return std::chrono::duration_cast<std::chrono::seconds>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+        };
+        const auto its_second = its_now();
+        while (its_now() == its_second)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    boost::filesystem::path folder_;
+    std::string             logfile_;
+};
+} // namespace
+
+TEST_F(logger_impl_test, rate_limit_per_call_site)
+{
+    auto its_logger = create_logger(R"({ "enable" : "false" })", 3);
+    int  its_first_site(0), its_second_site(0);
+
+    wait_for_next_second();
+    std::uint32_t its_suppressed(0);
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(its_logger->check_rate(&its_first_site, its_suppressed), i < 3);
+        EXPECT_EQ(its_suppressed, 0u);
+    }
+    // Another call site has a budget of its own
+    EXPECT_TRUE(its_logger->check_rate(&its_second_site, its_suppressed));
+
+    // The first message of the next second reports the suppressed ones
+    wait_for_next_second();
+    EXPECT_TRUE(its_logger->check_rate(&its_first_site, its_suppressed));
+    EXPECT_EQ(its_suppressed, 2u);
+    EXPECT_TRUE(its_logger->check_rate(&its_second_site, its_suppressed));
+    EXPECT_EQ(its_suppressed, 0u);
+}
+
+TEST_F(logger_impl_test, rate_limit_distinct_call_sites)
+{
+    auto its_logger = create_logger(R"({ "enable" : "false" })", 1);
+
+    // Call sites do not share their budget as long as there are free slots
+    std::vector<char> its_sites(1500);
+    wait_for_next_second();
+    std::uint32_t its_suppressed(0);
+    for (auto& s : its_sites)
+        EXPECT_TRUE(its_logger->check_rate(&s, its_suppressed));
+    for (auto& s : its_sites)
+        EXPECT_FALSE(its_logger->check_rate(&s, its_suppressed));
+
+    // Without a limit, nothing is suppressed
+    auto its_unlimited = create_logger(R"({ "enable" : "false" })", 0);
+    for (int i = 0; i < 100; ++i)
+        EXPECT_TRUE(its_unlimited->check_rate(&its_sites[0], its_suppressed));
+}
+
+TEST_F(logger_impl_test, async_drops_are_counted)
+{
+    const int its_threads(2);
+    const int its_messages(5000);
+    {
+        auto its_logger = create_logger(R"({ "enable" : "true", "buffer-size" : "8" })", 0);
+        ASSERT_TRUE(its_logger->has_async_log());
+
+        std::vector<std::thread> its_workers;
+        for (int t = 0; t < its_threads; ++t)
+        {
+            its_workers.emplace_back([&its_logger, t]() {
+                for (int i = 0; i < its_messages; ++i)
+                {
+                    EXPECT_TRUE(its_logger->enqueue(
+                        level_e::LL_INFO, std::chrono::system_clock::now(),
+                        "thread " + std::to_string(t) + " message " + std::to_string(i)));
+                }
+            });
+        }
+        for (auto& w : its_workers)
+            w.join();
+        // Destroying the logger drains the buffers
+    }
+
+    // Every message is either written or counted as dropped, and the
+    // messages of a thread keep their order
+    std::uint64_t      its_written(0), its_dropped(0);
+    std::map<int, int> its_last;
+    for (const auto& l : read_lines())
+    {
+        int its_thread(0), its_message(0);
+        if (std::sscanf(l.c_str() + l.find("] ") + 2, "thread %d message %d", &its_thread,
+                        &its_message)
+            == 2)
+        {
+            auto found_last = its_last.find(its_thread);
+            if (found_last != its_last.end())
+            {
+                EXPECT_LT(found_last->second, its_message);
+            }
+            its_last[its_thread] = its_message;
+            its_written++;
+        }
+        else
+        {
+            // Loading the configuration logs to the same file
+            unsigned long long its_count(0);
+            if (std::sscanf(l.c_str() + l.find("] ") + 2, "Dropped %llu log messages", &its_count)
+                == 1)
+                its_dropped += its_count;
+        }
+    }
+    EXPECT_GT(its_written, 0u);
+    EXPECT_EQ(its_written + its_dropped, std::uint64_t(its_threads) * its_messages);
+}
@@ -553,3 +553,66 @@ TEST(deserialize_test, reset)
     // Expect the size to be 0 since the data vector is now empty.
     ASSERT_EQ(its_deserializer->get_remaining(), 0);
 }
+
+TEST(deserialize_test, set_view)
+{
+    std::array<vsomeip_v3::byte_t, array_size> byte_array_{byte1, byte2, byte3, byte4};
+
+    std::unique_ptr<vsomeip_v3::deserializer> its_deserializer(
+        new vsomeip_v3::deserializer(buffer_shrink_threshold));
+
+    // Test Method.
+    its_deserializer->set_view(byte_array_.data(), byte_array_.size());
+    ASSERT_EQ(its_deserializer->get_available(), array_size);
+    ASSERT_EQ(its_deserializer->get_remaining(), array_size);
+
+    // The data is read in place, changes are visible.
+    byte_array_[0] = byte4;
+    vsomeip_v3::byte_t deserialized_byte_;
+    ASSERT_TRUE(its_deserializer->deserialize(deserialized_byte_));
+    ASSERT_EQ(deserialized_byte_, byte4);
+
+    // Appending to a view copies the data first.
+    its_deserializer->append_data(&byte1, 1);
+    byte_array_[1] = byte1;
+    ASSERT_TRUE(its_deserializer->deserialize(deserialized_byte_));
+    ASSERT_EQ(deserialized_byte_, byte2);
+    ASSERT_EQ(its_deserializer->get_remaining(), array_size - 1);
+
+    its_deserializer->reset();
+    ASSERT_EQ(its_deserializer->get_remaining(), 0);
+    ASSERT_FALSE(its_deserializer->deserialize(deserialized_byte_));
+}
+
+TEST(deserialize_test, set_shared_view)
+{
+    auto its_data = std::make_shared<std::vector<vsomeip_v3::byte_t>>(
+        std::vector<vsomeip_v3::byte_t>{byte1, byte2, byte3, byte4});
+
+    std::unique_ptr<vsomeip_v3::deserializer> its_deserializer(
+        new vsomeip_v3::deserializer(buffer_shrink_threshold));
+
+    // Test Method.
+    its_deserializer->set_view(its_data, 1, 2);
+    ASSERT_EQ(its_deserializer->get_shared_data(), its_data);
+    ASSERT_EQ(its_deserializer->get_remaining(), 2);
+
+    // Ranges of the shared data are returned without copying them.
+    std::shared_ptr<std::vector<vsomeip_v3::byte_t>> its_buffer;
+    vsomeip_v3::byte_t*                              its_range(nullptr);
+    ASSERT_FALSE(its_deserializer->deserialize(3, its_buffer, its_range));
+    ASSERT_TRUE(its_deserializer->deserialize(2, its_buffer, its_range));
+    ASSERT_EQ(its_buffer, its_data);
+    ASSERT_EQ(its_range, its_data->data() + 1);
+    ASSERT_EQ(its_deserializer->get_remaining(), 0);
+
+    // Invalid ranges are rejected.
+    its_deserializer->set_view(its_data, 3, 2);
+    ASSERT_EQ(its_deserializer->get_shared_data(), nullptr);
+    ASSERT_EQ(its_deserializer->get_remaining(), 0);
+
+    its_deserializer->set_view(its_data, 0, 4);
+    its_deserializer->reset();
+    ASSERT_EQ(its_deserializer->get_shared_data(), nullptr);
+    ASSERT_EQ(its_data.use_count(), 2);
+}
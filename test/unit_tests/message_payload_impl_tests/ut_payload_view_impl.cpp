@@ -0,0 +1,95 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include "../../../implementation/message/include/deserializer.hpp"
+#include "../../../implementation/message/include/payload_impl.hpp"
+#include "../../../implementation/message/include/payload_view_impl.hpp"
+#include "../../../implementation/message/include/serializer.hpp"
+
+namespace {
+const std::uint32_t      buffer_shrink_threshold = 1;
+const vsomeip_v3::byte_t byte1                   = 1;
+const vsomeip_v3::byte_t byte2                   = 2;
+const vsomeip_v3::byte_t byte3                   = 3;
+const vsomeip_v3::byte_t byte4                   = 4;
+
+} // namespace
+
+TEST(payload_view_impl_test, deserialize_references_shared_data)
+{
+    auto its_data = std::make_shared<std::vector<vsomeip_v3::byte_t>>(
+        std::vector<vsomeip_v3::byte_t>{byte1, byte2, byte3, byte4});
+
+    vsomeip_v3::deserializer its_deserializer(buffer_shrink_threshold);
+    its_deserializer.set_view(its_data, 1, 3);
+
+    // Test Method.
+    vsomeip_v3::payload_view_impl its_payload;
+    ASSERT_TRUE(its_payload.deserialize(&its_deserializer, 2));
+    its_deserializer.reset();
+
+    // The payload references the data instead of copying it.
+    ASSERT_TRUE(its_payload.is_view());
+    ASSERT_EQ(its_payload.get_length(), 2);
+    ASSERT_EQ(its_payload.get_data(), its_data->data() + 1);
+    ASSERT_EQ(its_data.use_count(), 2);
+
+    vsomeip_v3::payload_impl its_expected(std::vector<vsomeip_v3::byte_t>{byte2, byte3});
+    ASSERT_TRUE(its_payload == its_expected);
+
+    // Serializing a view writes its data.
+    vsomeip_v3::serializer its_serializer(buffer_shrink_threshold);
+    ASSERT_TRUE(its_payload.serialize(&its_serializer));
+    ASSERT_EQ(its_serializer.get_size(), 2);
+    ASSERT_EQ(its_serializer.get_data()[0], byte2);
+    ASSERT_EQ(its_serializer.get_data()[1], byte3);
+}
+
+TEST(payload_view_impl_test, deserialize_needs_shared_data)
+{
+    std::vector<vsomeip_v3::byte_t> its_data{byte1, byte2, byte3, byte4};
+
+    vsomeip_v3::deserializer its_deserializer(buffer_shrink_threshold);
+    its_deserializer.set_view(its_data.data(), its_data.size());
+
+    // Test Method.
+    vsomeip_v3::payload_view_impl its_payload;
+    ASSERT_FALSE(its_payload.deserialize(&its_deserializer));
+    ASSERT_FALSE(its_payload.is_view());
+    ASSERT_EQ(its_payload.get_length(), 0);
+}
+
+TEST(payload_view_impl_test, set_data_copies)
+{
+    auto its_data = std::make_shared<std::vector<vsomeip_v3::byte_t>>(
+        std::vector<vsomeip_v3::byte_t>{byte1, byte2, byte3, byte4});
+
+    vsomeip_v3::deserializer its_deserializer(buffer_shrink_threshold);
+    its_deserializer.set_view(its_data, 0, its_data->size());
+
+    vsomeip_v3::payload_view_impl its_payload;
+    ASSERT_TRUE(its_payload.deserialize(&its_deserializer));
+    its_deserializer.reset();
+
+    // Writing through get_data() modifies the referenced data in place.
+    its_payload.get_data()[0] = byte4;
+    ASSERT_EQ(its_data->at(0), byte4);
+
+    // Changing the capacity copies the data and releases the reference.
+    its_payload.set_capacity(16);
+    ASSERT_FALSE(its_payload.is_view());
+    ASSERT_EQ(its_data.use_count(), 1);
+    ASSERT_EQ(its_payload.get_length(), 4);
+    ASSERT_NE(its_payload.get_data(), its_data->data());
+    ASSERT_EQ(its_payload.get_data()[0], byte4);
+
+    // Test Method.
+    its_payload.set_data(std::vector<vsomeip_v3::byte_t>{byte3, byte2, byte1});
+    ASSERT_EQ(its_payload.get_length(), 3);
+    ASSERT_EQ(its_payload.get_data()[0], byte3);
+    ASSERT_EQ(its_payload.get_data()[2], byte1);
+}
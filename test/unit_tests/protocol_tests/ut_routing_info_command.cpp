@@ -0,0 +1,67 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include "../../../implementation/protocol/include/routing_info_command.hpp"
+#include "../../../implementation/protocol/include/protocol.hpp"
+
+namespace routing_info_command_tests {
+
+using namespace vsomeip_v3;
+
+const client_t routing_client = 0x0100;
+
+protocol::routing_info_entry get_entry()
+{
+    protocol::routing_info_entry its_entry;
+    its_entry.set_type(protocol::routing_info_entry_type_e::RIE_ADD_SERVICE_INSTANCE);
+    its_entry.set_client(0x0002);
+    its_entry.add_service({0x1000, 0x0001, 0x01, 0x00000000});
+    return its_entry;
+}
+
+TEST(routing_info_command_test, epoch_serialization)
+{
+    protocol::routing_info_command its_command;
+    its_command.set_client(routing_client);
+    its_command.add_entry(get_entry());
+
+    // Without epoch, the legacy format is used
+    std::vector<byte_t> its_legacy_buffer;
+    protocol::error_e   its_error;
+    its_command.serialize(its_legacy_buffer, its_error);
+    ASSERT_EQ(its_error, protocol::error_e::ERROR_OK);
+
+    its_command.set_epoch(0x01020304);
+    its_command.set_full(true);
+    std::vector<byte_t> its_buffer;
+    its_command.serialize(its_buffer, its_error);
+    ASSERT_EQ(its_error, protocol::error_e::ERROR_OK);
+    ASSERT_EQ(its_buffer.size(), its_legacy_buffer.size() + 5);
+    EXPECT_EQ(its_buffer[protocol::COMMAND_POSITION_VERSION], 0x01);
+    EXPECT_EQ(its_buffer[protocol::COMMAND_HEADER_SIZE], 0x04);
+    EXPECT_EQ(its_buffer[protocol::COMMAND_HEADER_SIZE + 4], 0x01);
+
+    protocol::routing_info_command its_legacy_command;
+    its_legacy_command.deserialize(its_legacy_buffer, its_error);
+    ASSERT_EQ(its_error, protocol::error_e::ERROR_OK);
+    EXPECT_EQ(its_legacy_command.get_epoch(), 0u);
+    EXPECT_EQ(its_legacy_command.get_entries().size(), 1u);
+
+    protocol::routing_info_command its_epoch_command;
+    its_epoch_command.deserialize(its_buffer, its_error);
+    ASSERT_EQ(its_error, protocol::error_e::ERROR_OK);
+    EXPECT_EQ(its_epoch_command.get_epoch(), 0x01020304u);
+    EXPECT_TRUE(its_epoch_command.is_full());
+    ASSERT_EQ(its_epoch_command.get_entries().size(), 1u);
+    EXPECT_EQ(its_epoch_command.get_entries().front().get_services().front().service_, 0x1000);
+
+    its_buffer.resize(protocol::COMMAND_HEADER_SIZE + 2);
+    its_epoch_command.deserialize(its_buffer, its_error);
+    EXPECT_EQ(its_error, protocol::error_e::ERROR_NOT_ENOUGH_BYTES);
+}
+
+} // namespace routing_info_command_tests
@@ -0,0 +1,71 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include "../../../implementation/protocol/include/shm_send_command.hpp"
+#include "../../../implementation/protocol/include/protocol.hpp"
+
+namespace shm_send_command_tests {
+
+// Tester Note: Expect Little-Endian representation for serialized data.
+const std::vector<std::uint8_t> serialized_shm_send_command = {
+    0x32,                   // shm_send_command
+    0x00, 0x00,             // Version.
+    0x01, 0x00,             // Client.
+    0x1a, 0x00, 0x00, 0x00, // Size.
+    0x02, 0x00,             // Instance.
+    0x01,                   // Reliable.
+    0x00,                   // Status.
+    0x01, 0x00,             // Destination.
+    0x03, 0x00, 0x00, 0x00, // Slot.
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // Sequence.
+    0x00, 0x00, 0x01, 0x00, // Length.
+    0x2f, 0x73, 0x68, 0x6d  // "/shm"
+};
+
+TEST(shm_send_command_test, serialize)
+{
+    vsomeip_v3::protocol::shm_send_command command;
+    command.set_client(0x0001);
+    command.set_instance(0x0002);
+    command.set_reliable(true);
+    command.set_status(0x00);
+    command.set_target(0x0001);
+    command.set_slot(3);
+    command.set_sequence(5);
+    command.set_length(0x10000);
+    command.set_name("/shm");
+
+    std::vector<std::uint8_t>     buffer;
+    vsomeip_v3::protocol::error_e error;
+    command.serialize(buffer, error);
+    ASSERT_EQ(error, vsomeip_v3::protocol::error_e::ERROR_OK);
+    ASSERT_EQ(buffer, serialized_shm_send_command);
+}
+
+TEST(shm_send_command_test, deserialize)
+{
+    vsomeip_v3::protocol::shm_send_command command;
+    vsomeip_v3::protocol::error_e          error;
+    command.deserialize(serialized_shm_send_command, error);
+    ASSERT_EQ(error, vsomeip_v3::protocol::error_e::ERROR_OK);
+    EXPECT_EQ(command.get_client(), 0x0001);
+    EXPECT_EQ(command.get_instance(), 0x0002);
+    EXPECT_TRUE(command.is_reliable());
+    EXPECT_EQ(command.get_target(), 0x0001);
+    EXPECT_EQ(command.get_slot(), 3u);
+    EXPECT_EQ(command.get_sequence(), 5u);
+    EXPECT_EQ(command.get_length(), 0x10000u);
+    EXPECT_EQ(command.get_name(), "/shm");
+
+    // Truncated command
+    std::vector<std::uint8_t> truncated(serialized_shm_send_command.begin(),
+                                        serialized_shm_send_command.end() - 8);
+    command.deserialize(truncated, error);
+    EXPECT_EQ(error, vsomeip_v3::protocol::error_e::ERROR_NOT_ENOUGH_BYTES);
+}
+
+} // namespace shm_send_command_tests
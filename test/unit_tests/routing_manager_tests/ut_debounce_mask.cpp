@@ -0,0 +1,116 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <vector>
+
+#include "../../../implementation/routing/include/debounce_mask.hpp"
+
+using vsomeip_v3::byte_t;
+using vsomeip_v3::debounce_mask;
+
+namespace {
+using ignore_t = std::map<std::size_t, byte_t>;
+
+// Comparison as formerly done by the debounce filters
+bool is_changed(const ignore_t& _ignore, const std::vector<byte_t>& _old,
+                const std::vector<byte_t>& _new)
+{
+    const std::size_t its_min_length = std::min(_old.size(), _new.size());
+    const std::size_t its_max_length = std::max(_old.size(), _new.size());
+
+    for (std::size_t i = its_min_length; i < its_max_length; i++)
+    {
+        auto j = _ignore.find(i);
+        if (j == _ignore.end() || j->second != 0xFF)
+            return true;
+    }
+    for (std::size_t i = 0; i < its_min_length; i++)
+    {
+        auto j = _ignore.find(i);
+        if (j == _ignore.end())
+        {
+            if (_old[i] != _new[i])
+                return true;
+        }
+        else if ((_old[i] & ~(j->second)) != (_new[i] & ~(j->second)))
+            return true;
+    }
+    return false;
+}
+
+bool is_changed(const debounce_mask& _mask, const std::vector<byte_t>& _old,
+                const std::vector<byte_t>& _new)
+{
+    return _mask.is_changed(_old.data(), _old.size(), _new.data(), _new.size());
+}
+} // namespace
+
+TEST(debounce_mask_test, ignored_bits_and_lengths)
+{
+    const ignore_t      its_ignore{{1, 0xFF}, {2, 0x0F}, {4, 0xFF}};
+    const debounce_mask its_mask(its_ignore);
+
+    std::vector<byte_t> its_old(40, 0x00);
+    auto                its_new = its_old;
+
+    EXPECT_FALSE(is_changed(its_mask, its_old, its_new));
+    its_new[1] = 0xFF;
+    its_new[2] = 0x0F;
+    EXPECT_FALSE(is_changed(its_mask, its_old, its_new));
+    its_new[2] = 0x10;
+    EXPECT_TRUE(is_changed(its_mask, its_old, its_new));
+    its_new[2] = 0x00;
+    its_new[39] = 0x01;
+    EXPECT_TRUE(is_changed(its_mask, its_old, its_new));
+
+    // Additional bytes that are completely ignored are no change
+    const std::vector<byte_t> its_short(4, 0x00);
+    const std::vector<byte_t> its_long(5, 0x00);
+    EXPECT_FALSE(is_changed(its_mask, its_short, its_long));
+    EXPECT_TRUE(is_changed(its_mask, its_short, std::vector<byte_t>(6, 0x00)));
+    EXPECT_TRUE(is_changed(its_mask, std::vector<byte_t>(2, 0x00), its_short));
+
+    EXPECT_TRUE(debounce_mask(its_ignore) == its_mask);
+    EXPECT_FALSE(debounce_mask(ignore_t{{1, 0xFF}}) == its_mask);
+}
+
+TEST(debounce_mask_test, matches_map_lookup)
+{
+    std::mt19937                               its_random(42);
+    std::uniform_int_distribution<int>         its_byte(0, 255);
+    std::uniform_int_distribution<std::size_t> its_length(0, 200);
+
+    for (int n = 0; n < 2000; ++n)
+    {
+        ignore_t its_ignore;
+        for (std::size_t i = its_length(its_random) % 16; i > 0; --i)
+        {
+            const int its_bits = its_byte(its_random);
+            its_ignore[its_length(its_random)] =
+                static_cast<byte_t>(its_bits < 128 ? 0xFF : its_bits);
+        }
+        const debounce_mask its_mask(its_ignore);
+
+        std::vector<byte_t> its_old(its_length(its_random));
+        for (auto& b : its_old)
+            b = static_cast<byte_t>(its_byte(its_random));
+
+        // Mostly equal payloads with a few flipped bits
+        std::vector<byte_t> its_new(its_old);
+        its_new.resize(its_byte(its_random) < 32 ? its_length(its_random) : its_old.size());
+        if (!its_new.empty())
+        {
+            for (int i = its_byte(its_random) % 3; i > 0; --i)
+                its_new[its_length(its_random) % its_new.size()] ^=
+                    static_cast<byte_t>(1 << (its_byte(its_random) % 8));
+        }
+
+        EXPECT_EQ(is_changed(its_mask, its_old, its_new), is_changed(its_ignore, its_old, its_new))
+            << "iteration " << n;
+    }
+}
@@ -0,0 +1,124 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <memory>
+#include <vector>
+
+#include <boost/asio/io_context.hpp>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <common/utility.hpp>
+
+#include "../../../implementation/endpoints/include/endpoint_definition.hpp"
+#include "../../../implementation/endpoints/include/endpoint_manager_impl.hpp"
+#include "../../../implementation/runtime/include/io_shards.hpp"
+#include "mocks/mock_routing_manager_host.hpp"
+
+using ::testing::Return;
+using ::testing::ReturnRef;
+
+namespace {
+const vsomeip_v3::service_t  service  = 0x1234;
+const vsomeip_v3::instance_t instance = 0x5678;
+const std::uint16_t          port     = 30509;
+
+// Host that runs the network endpoints on io shards, as application_impl
+// does if 'io_shards' is configured
+class sharded_routing_manager_host : public mock_routing_manager_host {
+public:
+    boost::asio::io_context& get_endpoint_io(std::size_t _hash) override
+    {
+        hashes_.push_back(_hash);
+        return shards_.get(_hash);
+    }
+
+    vsomeip_v3::io_shards    shards_;
+    std::vector<std::size_t> hashes_;
+};
+
+template<typename Host_>
+class endpoint_io_test : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        configuration_ = std::make_shared<vsomeip_v3::cfg::configuration_impl>("");
+
+        EXPECT_CALL(host_, get_io()).WillRepeatedly(ReturnRef(io_));
+        EXPECT_CALL(host_, get_name()).WillRepeatedly(ReturnRef(name_));
+        EXPECT_CALL(host_, get_configuration()).WillRepeatedly(Return(configuration_));
+
+        // Not initialized: the endpoint manager is created with the routing
+        // manager, and neither routing nor service discovery are needed
+        manager_ = std::make_shared<vsomeip_v3::routing_manager_impl>(&host_);
+    }
+
+    void TearDown() override
+    {
+        manager_.reset();
+        configuration_.reset();
+    }
+
+    Host_                                                host_;
+    boost::asio::io_context                              io_;
+    const std::string                                    name_ = "endpoint_io_test";
+    std::shared_ptr<vsomeip_v3::cfg::configuration_impl> configuration_;
+    std::shared_ptr<vsomeip_v3::routing_manager_impl>    manager_;
+};
+
+class sharded_endpoint_io_test : public endpoint_io_test<sharded_routing_manager_host> {
+protected:
+    void SetUp() override
+    {
+        host_.shards_.init(4);
+        endpoint_io_test<sharded_routing_manager_host>::SetUp();
+    }
+};
+
+using unsharded_endpoint_io_test = endpoint_io_test<mock_routing_manager_host>;
+} // namespace
+
+TEST_F(sharded_endpoint_io_test, endpoints_select_shard_by_address_and_port)
+{
+    auto its_endpoint_manager = manager_->get_endpoint_manager();
+    ASSERT_NE(its_endpoint_manager, nullptr);
+
+    auto its_server = its_endpoint_manager->create_server_endpoint(port, false, true);
+    ASSERT_NE(its_server, nullptr);
+    ASSERT_EQ(host_.hashes_.size(), 1u);
+
+    // A client endpoint to the same address and port selects the same shard
+    its_endpoint_manager->add_remote_service_info(
+        service, instance,
+        vsomeip_v3::endpoint_definition::get(configuration_->get_unicast_address(), port, false,
+                                             service, instance));
+    its_endpoint_manager->find_or_create_remote_client(service, instance);
+    ASSERT_EQ(host_.hashes_.size(), 2u);
+    EXPECT_EQ(host_.hashes_[1], host_.hashes_[0]);
+
+    // The reliability is part of the hash
+    auto its_reliable_server = its_endpoint_manager->create_server_endpoint(port, true, true);
+    ASSERT_NE(its_reliable_server, nullptr);
+    ASSERT_EQ(host_.hashes_.size(), 3u);
+    EXPECT_NE(host_.hashes_[2], host_.hashes_[0]);
+
+    // Endpoints that are not started do not need an I/O context
+    its_endpoint_manager->create_server_endpoint(static_cast<std::uint16_t>(port + 1), false,
+                                                 false);
+    EXPECT_EQ(host_.hashes_.size(), 3u);
+
+    its_server->stop();
+    its_reliable_server->stop();
+}
+
+TEST_F(unsharded_endpoint_io_test, endpoints_use_main_context)
+{
+    EXPECT_EQ(&manager_->get_endpoint_io(0), &io_);
+    EXPECT_EQ(&manager_->get_endpoint_io(0x12345678), &io_);
+
+    auto its_server = manager_->get_endpoint_manager()->create_server_endpoint(port, false, true);
+    ASSERT_NE(its_server, nullptr);
+    its_server->stop();
+}
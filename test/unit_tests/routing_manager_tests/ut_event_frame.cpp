@@ -0,0 +1,253 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <memory>
+#include <vector>
+
+#include <boost/asio/io_context.hpp>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <common/utility.hpp>
+#include <vsomeip/runtime.hpp>
+
+#include "../../../implementation/endpoints/include/endpoint_definition.hpp"
+#include "../../../implementation/message/include/serializer.hpp"
+#include "../../../implementation/routing/include/event.hpp"
+#include "mocks/mock_routing_manager_host.hpp"
+
+using ::testing::Invoke;
+using ::testing::Return;
+using ::testing::ReturnRef;
+using ::testing::_;
+
+namespace {
+const vsomeip_v3::service_t  service  = 0x1234;
+const vsomeip_v3::instance_t instance = 0x0001;
+const vsomeip_v3::event_t    notifier = 0x8001;
+
+// Keeps the data that the events pass to the routing manager
+class capturing_routing_manager : public vsomeip_v3::routing_manager_impl {
+public:
+    explicit capturing_routing_manager(vsomeip_v3::routing_manager_host* _host)
+        : vsomeip_v3::routing_manager_impl(_host)
+    {}
+
+    bool send(vsomeip_v3::client_t _client, const vsomeip_v3::byte_t* _data, uint32_t _size,
+              vsomeip_v3::instance_t _instance, bool _reliable, vsomeip_v3::client_t _bound_client,
+              const vsomeip_sec_client_t* _sec_client, uint8_t _status_check,
+              bool _sent_from_remote, bool _force) override
+    {
+        (void)_client;
+        (void)_instance;
+        (void)_reliable;
+        (void)_bound_client;
+        (void)_sec_client;
+        (void)_status_check;
+        (void)_sent_from_remote;
+        (void)_force;
+        frames_.emplace_back(_data, _data + _size);
+        return true;
+    }
+
+    bool send_to(const vsomeip_v3::client_t                                _client,
+                 const std::shared_ptr<vsomeip_v3::endpoint_definition>& _target,
+                 const vsomeip_v3::byte_t* _data, uint32_t _size,
+                 vsomeip_v3::instance_t _instance) override
+    {
+        (void)_client;
+        (void)_target;
+        (void)_instance;
+        frames_.emplace_back(_data, _data + _size);
+        return true;
+    }
+
+    std::vector<std::vector<vsomeip_v3::byte_t>> frames_;
+};
+
+class event_frame_test : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        configuration_ = std::make_shared<vsomeip_v3::cfg::configuration_impl>("");
+
+        EXPECT_CALL(host_, get_io()).WillRepeatedly(ReturnRef(io_));
+        EXPECT_CALL(host_, get_name()).WillRepeatedly(ReturnRef(name_));
+        EXPECT_CALL(host_, get_configuration()).WillRepeatedly(Return(configuration_));
+        EXPECT_CALL(host_, get_client()).WillRepeatedly(Return(0x0100));
+        EXPECT_CALL(host_, get_sec_client()).WillRepeatedly(Return(nullptr));
+        EXPECT_CALL(host_, get_session(_)).WillRepeatedly(Invoke([this](bool) {
+            return ++session_;
+        }));
+
+        manager_ = std::make_shared<capturing_routing_manager>(&host_);
+
+        event_ = std::make_shared<vsomeip_v3::event>(manager_.get());
+        event_->set_service(service);
+        event_->set_instance(instance);
+        event_->set_event(notifier);
+        event_->set_version(1);
+        event_->set_type(vsomeip_v3::event_type_e::ET_EVENT);
+        event_->set_reliability(vsomeip_v3::reliability_type_e::RT_UNRELIABLE);
+        event_->set_provided(true);
+    }
+
+    void TearDown() override
+    {
+        event_.reset();
+        manager_.reset();
+        configuration_.reset();
+    }
+
+    static std::shared_ptr<vsomeip_v3::payload>
+    create_payload(const std::vector<vsomeip_v3::byte_t>& _data)
+    {
+        return vsomeip_v3::runtime::get()->create_payload(_data);
+    }
+
+    // Serializes the notification the event should have sent last
+    std::vector<vsomeip_v3::byte_t> serialize(vsomeip_v3::event_t _notifier,
+                                              vsomeip_v3::major_version_t         _version,
+                                              const std::shared_ptr<vsomeip_v3::payload>& _payload)
+    {
+        auto its_message = vsomeip_v3::runtime::get()->create_notification();
+        its_message->set_service(service);
+        its_message->set_instance(instance);
+        its_message->set_method(_notifier);
+        its_message->set_interface_version(_version);
+        its_message->set_session(session_);
+        its_message->set_payload(_payload);
+
+        vsomeip_v3::serializer its_serializer(0);
+        EXPECT_TRUE(its_serializer.serialize(its_message.get()));
+        return std::vector<vsomeip_v3::byte_t>(
+            its_serializer.get_data(), its_serializer.get_data() + its_serializer.get_size());
+    }
+
+    // Checks the frame that was sent last against a fresh serialization
+    void expect_frame(vsomeip_v3::event_t _notifier, vsomeip_v3::major_version_t _version,
+                      const std::shared_ptr<vsomeip_v3::payload>& _payload)
+    {
+        ASSERT_FALSE(manager_->frames_.empty());
+        EXPECT_EQ(manager_->frames_.back(), serialize(_notifier, _version, _payload));
+    }
+
+    mock_routing_manager_host                            host_;
+    boost::asio::io_context                              io_;
+    const std::string                                    name_ = "event_frame_test";
+    vsomeip_v3::session_t                                session_ = 0;
+    std::shared_ptr<vsomeip_v3::cfg::configuration_impl> configuration_;
+    std::shared_ptr<capturing_routing_manager>           manager_;
+    std::shared_ptr<vsomeip_v3::event>                   event_;
+};
+} // namespace
+
+TEST_F(event_frame_test, cached_frame_patches_session)
+{
+    auto its_payload = create_payload({0x01, 0x02, 0x03, 0x04});
+    event_->set_payload(its_payload, false);
+    ASSERT_EQ(manager_->frames_.size(), 1u);
+    expect_frame(notifier, 1, its_payload);
+
+    // Further notifications reuse the frame with a new session
+    event_->notify_one(0x0200, false);
+    ASSERT_EQ(manager_->frames_.size(), 2u);
+    expect_frame(notifier, 1, its_payload);
+    EXPECT_NE(manager_->frames_[0], manager_->frames_[1]);
+
+    event_->notify_one(0x0200, vsomeip_v3::endpoint_definition::get(
+                                   boost::asio::ip::make_address("127.0.0.1"), 30509, false,
+                                   service, instance));
+    ASSERT_EQ(manager_->frames_.size(), 3u);
+    expect_frame(notifier, 1, its_payload);
+}
+
+TEST_F(event_frame_test, payload_change_invalidates_frame)
+{
+    auto its_payload = create_payload({0x01, 0x02, 0x03, 0x04});
+    event_->set_payload(its_payload, false);
+    expect_frame(notifier, 1, its_payload);
+
+    // Same length, other content
+    its_payload = create_payload({0x05, 0x06, 0x07, 0x08});
+    event_->set_payload(its_payload, false);
+    ASSERT_EQ(manager_->frames_.size(), 2u);
+    expect_frame(notifier, 1, its_payload);
+
+    // Longer and shorter
+    its_payload = create_payload({0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10});
+    event_->set_payload(its_payload, false);
+    expect_frame(notifier, 1, its_payload);
+
+    its_payload = create_payload({0x11});
+    event_->set_payload(its_payload, false);
+    expect_frame(notifier, 1, its_payload);
+
+    its_payload = create_payload({});
+    event_->set_payload(its_payload, false);
+    ASSERT_EQ(manager_->frames_.size(), 5u);
+    expect_frame(notifier, 1, its_payload);
+}
+
+TEST_F(event_frame_test, type_change_keeps_frame_valid)
+{
+    auto its_payload = create_payload({0x01, 0x02});
+    event_->set_payload(its_payload, false);
+    expect_frame(notifier, 1, its_payload);
+
+    // Unchanged fields are not sent, a forced update reuses the frame
+    event_->set_type(vsomeip_v3::event_type_e::ET_FIELD);
+    event_->set_payload(create_payload({0x01, 0x02}), false);
+    ASSERT_EQ(manager_->frames_.size(), 1u);
+    event_->set_payload(its_payload, true);
+    ASSERT_EQ(manager_->frames_.size(), 2u);
+    expect_frame(notifier, 1, its_payload);
+
+    its_payload = create_payload({0x03, 0x04, 0x05});
+    event_->set_payload(its_payload, false);
+    ASSERT_EQ(manager_->frames_.size(), 3u);
+    expect_frame(notifier, 1, its_payload);
+
+    event_->set_type(vsomeip_v3::event_type_e::ET_SELECTIVE_EVENT);
+    event_->notify_one(0x0200, false);
+    expect_frame(notifier, 1, its_payload);
+}
+
+TEST_F(event_frame_test, reliability_change_keeps_frame_valid)
+{
+    auto its_payload = create_payload({0x01, 0x02, 0x03});
+    event_->set_payload(its_payload, false);
+    expect_frame(notifier, 1, its_payload);
+
+    event_->set_reliability(vsomeip_v3::reliability_type_e::RT_RELIABLE);
+    event_->notify_one(0x0200, false);
+    ASSERT_EQ(manager_->frames_.size(), 2u);
+    expect_frame(notifier, 1, its_payload);
+
+    its_payload = create_payload({0x04});
+    event_->set_payload(its_payload, false);
+    expect_frame(notifier, 1, its_payload);
+
+    event_->set_reliability(vsomeip_v3::reliability_type_e::RT_BOTH);
+    event_->notify_one(0x0200, false);
+    ASSERT_EQ(manager_->frames_.size(), 4u);
+    expect_frame(notifier, 1, its_payload);
+}
+
+TEST_F(event_frame_test, header_change_invalidates_frame)
+{
+    auto its_payload = create_payload({0x01, 0x02, 0x03});
+    event_->set_payload(its_payload, false);
+    expect_frame(notifier, 1, its_payload);
+
+    event_->set_event(0x8002);
+    event_->notify_one(0x0200, false);
+    expect_frame(0x8002, 1, its_payload);
+
+    event_->set_version(2);
+    event_->notify_one(0x0200, false);
+    ASSERT_EQ(manager_->frames_.size(), 3u);
+    expect_frame(0x8002, 2, its_payload);
+}
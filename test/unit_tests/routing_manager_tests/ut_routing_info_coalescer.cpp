@@ -0,0 +1,122 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <vector>
+
+#include "../../../implementation/protocol/include/routing_info_command.hpp"
+#include "../../../implementation/routing/include/routing_info_coalescer.hpp"
+
+using namespace vsomeip_v3;
+
+namespace {
+const client_t routing_client = 0x0100;
+
+protocol::routing_info_entry get_entry(protocol::routing_info_entry_type_e _type, client_t _client,
+                                       service_t _service = 0)
+{
+    protocol::routing_info_entry its_entry;
+    its_entry.set_type(_type);
+    its_entry.set_client(_client);
+    if (_service)
+        its_entry.add_service({_service, 0x0001, 0x01, 0x00000000});
+    return its_entry;
+}
+
+class routing_info_coalescer_test : public ::testing::Test {
+protected:
+    routing_info_coalescer_test()
+        : coalescer_([this](client_t _target, const std::vector<byte_t>& _command) {
+              protocol::routing_info_command its_command;
+              protocol::error_e              its_error;
+              its_command.deserialize(_command, its_error);
+              EXPECT_EQ(its_error, protocol::error_e::ERROR_OK);
+              EXPECT_EQ(its_command.get_client(), routing_client);
+              received_[_target].push_back(its_command);
+              return is_sending_;
+          })
+    {
+    }
+
+    routing_info_coalescer                                          coalescer_;
+    std::map<client_t, std::vector<protocol::routing_info_command>> received_;
+    bool                                                            is_sending_ = true;
+};
+} // namespace
+
+TEST_F(routing_info_coalescer_test, merges_changes_per_target)
+{
+    const auto its_add = protocol::routing_info_entry_type_e::RIE_ADD_SERVICE_INSTANCE;
+    const auto its_del = protocol::routing_info_entry_type_e::RIE_DELETE_SERVICE_INSTANCE;
+
+    EXPECT_TRUE(coalescer_.add(0x0001, get_entry(its_add, 0x0002, 0x1000)));
+    EXPECT_FALSE(coalescer_.add(0x0001, get_entry(its_add, 0x0002, 0x1001)));
+    EXPECT_FALSE(coalescer_.add(0x0001, get_entry(its_add, 0x0002, 0x1001)));
+    EXPECT_FALSE(coalescer_.add(0x0001, get_entry(its_del, 0x0003, 0x2000)));
+    // Not merged across the change of another client
+    EXPECT_FALSE(coalescer_.add(0x0001, get_entry(its_add, 0x0002, 0x1002)));
+    EXPECT_FALSE(coalescer_.add(0x0004, get_entry(its_add, 0x0002, 0x1000)));
+    EXPECT_TRUE(coalescer_.has_pending());
+    EXPECT_TRUE(received_.empty());
+
+    coalescer_.flush(routing_client);
+    EXPECT_FALSE(coalescer_.has_pending());
+    ASSERT_EQ(received_[0x0001].size(), 1u);
+    ASSERT_EQ(received_[0x0004].size(), 1u);
+
+    const auto& its_command = received_[0x0001].front();
+    EXPECT_EQ(its_command.get_version(), protocol::ROUTING_INFO_EPOCH_VERSION);
+    EXPECT_EQ(its_command.get_epoch(), 1u);
+    EXPECT_FALSE(its_command.is_full());
+
+    const auto& its_entries = its_command.get_entries();
+    ASSERT_EQ(its_entries.size(), 3u);
+    EXPECT_EQ(its_entries[0].get_client(), 0x0002);
+    EXPECT_EQ(its_entries[0].get_services().size(), 2u);
+    EXPECT_EQ(its_entries[1].get_type(), its_del);
+    EXPECT_EQ(its_entries[1].get_client(), 0x0003);
+    EXPECT_EQ(its_entries[2].get_services().size(), 1u);
+    EXPECT_EQ(its_entries[2].get_services().front().service_, 0x1002);
+
+    // Nothing pending, nothing to send
+    coalescer_.flush(routing_client);
+    EXPECT_EQ(received_[0x0001].size(), 1u);
+}
+
+TEST_F(routing_info_coalescer_test, epochs_are_counted_per_target)
+{
+    const auto its_add = protocol::routing_info_entry_type_e::RIE_ADD_CLIENT;
+
+    coalescer_.add(0x0001, get_entry(its_add, 0x0001));
+    coalescer_.flush(routing_client, 0x0001);
+    coalescer_.add(0x0001, get_entry(its_add, 0x0002));
+    coalescer_.add(0x0002, get_entry(its_add, 0x0002));
+
+    // A failed send consumes its epoch
+    is_sending_ = false;
+    coalescer_.flush(routing_client, 0x0001);
+    is_sending_ = true;
+    EXPECT_TRUE(coalescer_.has_pending());
+
+    coalescer_.send_full(routing_client, 0x0001, {get_entry(its_add, 0x0003)});
+    coalescer_.flush(routing_client);
+
+    ASSERT_EQ(received_[0x0001].size(), 3u);
+    EXPECT_EQ(received_[0x0001][0].get_epoch(), 1u);
+    EXPECT_EQ(received_[0x0001][1].get_epoch(), 2u);
+    EXPECT_EQ(received_[0x0001][2].get_epoch(), 3u);
+    EXPECT_TRUE(received_[0x0001][2].is_full());
+    ASSERT_EQ(received_[0x0002].size(), 1u);
+    EXPECT_EQ(received_[0x0002][0].get_epoch(), 1u);
+
+    // A deregistered client starts again with the first epoch
+    coalescer_.remove(0x0001);
+    coalescer_.add(0x0001, get_entry(its_add, 0x0001));
+    coalescer_.flush(routing_client);
+    ASSERT_EQ(received_[0x0001].size(), 4u);
+    EXPECT_EQ(received_[0x0001][3].get_epoch(), 1u);
+}
@@ -0,0 +1,174 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <fstream>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <boost/asio/post.hpp>
+#include <boost/filesystem.hpp>
+
+#include "../../../implementation/configuration/include/configuration_impl.hpp"
+#include "../../../implementation/configuration/include/internal.hpp"
+#include "../../../implementation/runtime/include/application_impl.hpp"
+#include "../../../implementation/runtime/include/io_shards.hpp"
+
+using vsomeip_v3::io_shards;
+
+namespace {
+struct shard_thread_t {
+    std::thread::id id_;
+    std::string     name_;
+    std::vector<int> cpus_;
+};
+
+// Runs a handler on the shard of the hash and reports the executing thread
+shard_thread_t get_shard_thread(io_shards& _shards, std::size_t _hash)
+{
+    std::promise<shard_thread_t> its_promise;
+    auto                         its_future = its_promise.get_future();
+    boost::asio::post(_shards.get(_hash), [&its_promise]() {
+        shard_thread_t its_thread;
+        its_thread.id_ = std::this_thread::get_id();
+#if defined(__linux__)
+        char its_name[16] = {0};
+        pthread_getname_np(pthread_self(), its_name, sizeof(its_name));
+        its_thread.name_ = its_name;
+
+        cpu_set_t its_cpus;
+        CPU_ZERO(&its_cpus);
+        if (pthread_getaffinity_np(pthread_self(), sizeof(its_cpus), &its_cpus) == 0)
+        {
+            for (int i = 0; i < CPU_SETSIZE; i++)
+                if (CPU_ISSET(i, &its_cpus))
+                    its_thread.cpus_.push_back(i);
+        }
+#endif
+        its_promise.set_value(its_thread);
+    });
+    EXPECT_EQ(its_future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    return its_future.get();
+}
+
+std::string write_configuration(const boost::filesystem::path& _folder)
+{
+    const std::string its_name = (_folder / "vsomeip.json").string();
+    std::ofstream     its_file(its_name, std::ios::trunc);
+    its_file << R"({ "unicast" : "127.0.0.1",
+        "applications" : [
+            { "name" : "sharded", "id" : "0x1111", "io_shards" : "4",
+              "io_shard_cpus" : [ "0", "2", "-1" ] },
+            { "name" : "too_many", "id" : "0x1112", "io_shards" : "1000" },
+            { "name" : "plain", "id" : "0x1113" } ] })";
+    return its_name;
+}
+} // namespace
+
+TEST(io_shards_test, disabled_without_shards)
+{
+    io_shards its_shards;
+    EXPECT_EQ(its_shards.size(), 0u);
+
+    // Nothing to start or stop
+    its_shards.start("shrd", 0, {});
+    its_shards.stop();
+}
+
+TEST(io_shards_test, hashes_select_fixed_shards)
+{
+    io_shards its_shards;
+    its_shards.init(3);
+    ASSERT_EQ(its_shards.size(), 3u);
+
+    EXPECT_EQ(&its_shards.get(0), &its_shards.get(3));
+    EXPECT_EQ(&its_shards.get(1), &its_shards.get(0x30000001));
+    EXPECT_NE(&its_shards.get(0), &its_shards.get(1));
+    EXPECT_NE(&its_shards.get(1), &its_shards.get(2));
+    EXPECT_NE(&its_shards.get(0), &its_shards.get(2));
+
+    // Initializing again keeps the contexts the endpoints already use
+    boost::asio::io_context* its_context = &its_shards.get(2);
+    its_shards.init(2);
+    EXPECT_EQ(its_shards.size(), 3u);
+    EXPECT_EQ(&its_shards.get(2), its_context);
+}
+
+TEST(io_shards_test, each_shard_runs_on_its_own_thread)
+{
+    io_shards its_shards;
+    its_shards.init(2);
+    its_shards.start("shrd", 0, {});
+
+    const auto its_first  = get_shard_thread(its_shards, 0);
+    const auto its_second = get_shard_thread(its_shards, 1);
+    EXPECT_NE(its_first.id_, its_second.id_);
+    EXPECT_NE(its_first.id_, std::this_thread::get_id());
+    EXPECT_EQ(get_shard_thread(its_shards, 2).id_, its_first.id_);
+#if defined(__linux__)
+    EXPECT_EQ(its_first.name_, "shrd00");
+    EXPECT_EQ(its_second.name_, "shrd01");
+#endif
+
+    its_shards.stop();
+
+    // Restarting runs handlers again
+    its_shards.start("shrd", 0, {});
+    EXPECT_NE(get_shard_thread(its_shards, 1).id_, std::thread::id());
+    its_shards.stop();
+}
+
+#if defined(__linux__)
+TEST(io_shards_test, shards_are_pinned)
+{
+    io_shards its_shards;
+    its_shards.init(2);
+    // Both shards use the only entry
+    its_shards.start("shrd", 0, {0});
+
+    EXPECT_EQ(get_shard_thread(its_shards, 0).cpus_, std::vector<int>({0}));
+    EXPECT_EQ(get_shard_thread(its_shards, 1).cpus_, std::vector<int>({0}));
+
+    its_shards.stop();
+}
+#endif
+
+TEST(io_shards_test, configuration)
+{
+    const auto its_folder = boost::filesystem::temp_directory_path()
+                          / boost::filesystem::unique_path("vsomeip-shards-%%%%-%%%%");
+    boost::filesystem::create_directories(its_folder);
+
+    auto its_configuration =
+        std::make_shared<vsomeip_v3::cfg::configuration_impl>(write_configuration(its_folder));
+    ASSERT_TRUE(its_configuration->load("sharded"));
+
+    EXPECT_EQ(its_configuration->get_io_shards("sharded"), 4u);
+    // Negative CPU numbers are ignored
+    EXPECT_EQ(its_configuration->get_io_shard_cpus("sharded"), std::vector<int>({0, 2}));
+
+    EXPECT_EQ(its_configuration->get_io_shards("too_many"), std::size_t(VSOMEIP_MAX_IO_SHARDS));
+    EXPECT_TRUE(its_configuration->get_io_shard_cpus("too_many").empty());
+
+    EXPECT_EQ(its_configuration->get_io_shards("plain"), std::size_t(VSOMEIP_DEFAULT_IO_SHARDS));
+    EXPECT_EQ(its_configuration->get_io_shards("unknown"), std::size_t(VSOMEIP_DEFAULT_IO_SHARDS));
+
+    boost::filesystem::remove_all(its_folder);
+}
+
+TEST(io_shards_test, endpoints_use_main_context_without_shards)
+{
+    vsomeip_v3::application_impl its_application("io_shards_test", "");
+    EXPECT_EQ(&its_application.get_endpoint_io(0), &its_application.get_io());
+    EXPECT_EQ(&its_application.get_endpoint_io(0x12345678), &its_application.get_io());
+}
@@ -4,6 +4,7 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <memory>
+#include <vector>
 #include "gtest/gtest.h"
 #include <common/utility.hpp>
 
@@ -28,6 +29,51 @@ vsomeip_v3::gid_t ANY_GID     = 0xFFFFFFFF;
 vsomeip_v3::gid_t     deny_uid     = 9999;
 vsomeip_v3::gid_t     deny_gid     = 9999;
 vsomeip_v3::service_t deny_service = 0x40;
+
+void serialize_u16(uint16_t _value, std::vector<vsomeip_v3::byte_t>& _data)
+{
+    _data.push_back(vsomeip_v3::byte_t(_value >> 8));
+    _data.push_back(vsomeip_v3::byte_t(_value));
+}
+
+void serialize_u32(uint32_t _value, std::vector<vsomeip_v3::byte_t>& _data)
+{
+    serialize_u16(uint16_t(_value >> 16), _data);
+    serialize_u16(uint16_t(_value), _data);
+}
+
+// Serializes a policy that allows the credentials to request a single method, in the format of
+// security policy updates
+std::vector<vsomeip_v3::byte_t> serialize_policy(vsomeip_v3::uid_t _uid, vsomeip_v3::gid_t _gid,
+                                                 vsomeip_v3::service_t  _service,
+                                                 vsomeip_v3::instance_t _instance,
+                                                 vsomeip_v3::method_t   _method)
+{
+    // length, type (single id) and id
+    const uint32_t its_item_size = 4 + 4 + 2;
+    // length and one item for the instances and for the methods
+    const uint32_t its_ids_size = 2 * (4 + its_item_size);
+
+    std::vector<vsomeip_v3::byte_t> its_data;
+    serialize_u32(_uid, its_data);
+    serialize_u32(_gid, its_data);
+
+    // requests
+    serialize_u32(2 + 4 + its_ids_size, its_data);
+    serialize_u16(_service, its_data);
+    serialize_u32(its_ids_size, its_data);
+    for (uint16_t its_id : {_instance, _method})
+    {
+        serialize_u32(its_item_size, its_data);
+        serialize_u32(2, its_data);
+        serialize_u32(1, its_data);
+        serialize_u16(its_id, its_data);
+    }
+
+    // offers
+    serialize_u32(0, its_data);
+    return its_data;
+}
 } // namespace
 
 TEST(is_client_allowed_test, check_no_policies_loaded)
@@ -182,3 +228,49 @@ TEST(is_client_allowed_test, check_policies_loaded_in_audit_mode)
     // credencials exists in deny policy, but not for that service
     EXPECT_TRUE(its_manager->is_client_allowed(&its_sec_client_deny, service_2, instance, method));
 }
+
+// Denied requests must not stay denied once a matching policy is added
+TEST(is_client_allowed_test, check_policy_updates)
+{
+    std::unique_ptr<vsomeip_v3::policy_manager_impl> its_manager(
+        new vsomeip_v3::policy_manager_impl);
+
+    // force load of some policies
+    std::set<std::string>                          its_failed;
+    std::vector<vsomeip_v3::configuration_element> policy_elements;
+    std::vector<std::string>                       dir_skip;
+    utility::read_data(utility::get_all_files_in_dir(utility::get_policies_path(), dir_skip),
+                       policy_elements, its_failed);
+    for (const auto& e : policy_elements)
+    {
+        its_manager->load(e, false);
+    }
+    ASSERT_TRUE(its_manager->is_enabled());
+
+    vsomeip_sec_client_t its_sec_client_invalid =
+        utility::create_uds_client(invalid_uid, invalid_gid, host_address);
+    EXPECT_FALSE(
+        its_manager->is_client_allowed(&its_sec_client_invalid, service_1, instance, method));
+
+    // allow the service / instance / method for the credentials, serialized as a security policy
+    // update from another application
+    const auto its_data = serialize_policy(invalid_uid, invalid_gid, service_1, instance, method);
+    const vsomeip_v3::byte_t* its_buffer = its_data.data();
+    auto                      its_size   = static_cast<uint32_t>(its_data.size());
+    vsomeip_v3::uid_t         its_uid;
+    vsomeip_v3::gid_t         its_gid;
+    auto                      its_policy = its_manager->create_policy();
+    ASSERT_TRUE(its_manager->parse_policy(its_buffer, its_size, its_uid, its_gid, its_policy));
+    ASSERT_EQ(its_uid, invalid_uid);
+    ASSERT_EQ(its_gid, invalid_gid);
+
+    its_manager->update_security_policy(invalid_uid, invalid_gid, its_policy);
+    EXPECT_TRUE(
+        its_manager->is_client_allowed(&its_sec_client_invalid, service_1, instance, method));
+    EXPECT_FALSE(
+        its_manager->is_client_allowed(&its_sec_client_invalid, service_1, instance, method_2));
+
+    ASSERT_TRUE(its_manager->remove_security_policy(invalid_uid, invalid_gid));
+    EXPECT_FALSE(
+        its_manager->is_client_allowed(&its_sec_client_invalid, service_1, instance, method));
+}
@@ -0,0 +1,49 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gmock/gmock.h>
+#include "../../../../implementation/endpoints/include/endpoint.hpp"
+
+using namespace vsomeip_v3;
+class mock_endpoint : public endpoint {
+public:
+
+    MOCK_METHOD(void, start, (), (override));
+    MOCK_METHOD(void, restart, (bool _force), (override));
+    MOCK_METHOD(void, stop, (), (override));
+
+    MOCK_METHOD(void, prepare_stop, (const prepare_stop_handler_t &_handler,
+            service_t _service), (override));
+
+    MOCK_METHOD(bool, is_established, (), (const, override));
+    MOCK_METHOD(bool, is_established_or_connected, (), (const, override));
+
+    MOCK_METHOD(bool, send, (const byte_t *_data, uint32_t _size), (override));
+    MOCK_METHOD(bool, send_shared, (const message_buffer_ptr_t &_buffer), (override));
+    MOCK_METHOD(bool, send_to, (const std::shared_ptr<endpoint_definition> _target,
+            const byte_t *_data, uint32_t _size), (override));
+    MOCK_METHOD(bool, send_error, (const std::shared_ptr<endpoint_definition> _target,
+            const byte_t *_data, uint32_t _size), (override));
+    MOCK_METHOD(void, enable_magic_cookies, (), (override));
+    MOCK_METHOD(void, receive, (), (override));
+
+    MOCK_METHOD(void, add_default_target, (service_t _service,
+            const std::string &_address, uint16_t _port), (override));
+    MOCK_METHOD(void, remove_default_target, (service_t _service), (override));
+    MOCK_METHOD(void, remove_stop_handler, (service_t _service), (override));
+
+    MOCK_METHOD(std::uint16_t, get_local_port, (), (const, override));
+    MOCK_METHOD(void, set_local_port, (uint16_t _port), (override));
+    MOCK_METHOD(bool, is_reliable, (), (const, override));
+    MOCK_METHOD(bool, is_local, (), (const, override));
+
+    MOCK_METHOD(void, register_error_handler, (const error_handler_t &_error), (override));
+
+    MOCK_METHOD(void, print_status, (), (override));
+    MOCK_METHOD(size_t, get_queue_size, (), (const, override));
+
+    MOCK_METHOD(void, set_established, (bool _established), (override));
+    MOCK_METHOD(void, set_connected, (bool _connected), (override));
+};
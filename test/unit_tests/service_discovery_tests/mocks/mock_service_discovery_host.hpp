@@ -0,0 +1,81 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gmock/gmock.h>
+#include "../../../../implementation/service_discovery/include/service_discovery_host.hpp"
+
+using namespace vsomeip_v3;
+class mock_service_discovery_host : public sd::service_discovery_host {
+public:
+
+    MOCK_METHOD(boost::asio::io_context &, get_io, (), (override));
+
+    MOCK_METHOD(std::shared_ptr<endpoint>, create_service_discovery_endpoint,
+            (const std::string &_address, uint16_t _port, bool _reliable), (override));
+
+    MOCK_METHOD(services_t, get_offered_services, (), (const, override));
+    MOCK_METHOD(std::shared_ptr<eventgroupinfo>, find_eventgroup, (service_t _service,
+            instance_t _instance, eventgroup_t _eventgroup), (const, override));
+
+    MOCK_METHOD(bool, send, (client_t _client, std::shared_ptr<message> _message,
+            bool _force), (override));
+
+    MOCK_METHOD(bool, send_via_sd, (const std::shared_ptr<endpoint_definition> &_target,
+            const byte_t *_data, uint32_t _size, uint16_t _sd_port), (override));
+
+    MOCK_METHOD(void, add_routing_info, (service_t _service, instance_t _instance,
+            major_version_t _major, minor_version_t _minor, ttl_t _ttl,
+            const boost::asio::ip::address &_reliable_address,
+            uint16_t _reliable_port,
+            const boost::asio::ip::address &_unreliable_address,
+            uint16_t _unreliable_port), (override));
+
+    MOCK_METHOD(void, del_routing_info, (service_t _service, instance_t _instance,
+            bool _has_reliable, bool _has_unreliable), (override));
+
+    MOCK_METHOD(void, update_routing_info, (std::chrono::milliseconds _elapsed), (override));
+
+    MOCK_METHOD(void, on_remote_unsubscribe,
+            (std::shared_ptr<remote_subscription> &_subscription), (override));
+
+    MOCK_METHOD(void, on_subscribe_ack, (client_t _client,
+            service_t _service, instance_t _instance, eventgroup_t _eventgroup,
+            event_t _event, remote_subscription_id_t _subscription_id), (override));
+
+    MOCK_METHOD(void, on_subscribe_ack_with_multicast, (
+            service_t _service, instance_t _instance,
+            const boost::asio::ip::address &_sender,
+            const boost::asio::ip::address &_address, uint16_t _port), (override));
+
+    MOCK_METHOD(std::shared_ptr<endpoint>, find_or_create_remote_client, (
+            service_t _service, instance_t _instance, bool _reliable), (override));
+
+    MOCK_METHOD(void, expire_subscriptions, (const boost::asio::ip::address &_address),
+            (override));
+    MOCK_METHOD(void, expire_subscriptions, (const boost::asio::ip::address &_address,
+            std::uint16_t _port, bool _reliable), (override));
+    MOCK_METHOD(void, expire_services, (const boost::asio::ip::address &_address), (override));
+    MOCK_METHOD(void, expire_services, (const boost::asio::ip::address &_address,
+            std::uint16_t _port, bool _reliable), (override));
+
+    MOCK_METHOD(void, on_remote_subscribe, (
+            std::shared_ptr<remote_subscription> &_subscription,
+            const remote_subscription_callback_t& _callback), (override));
+
+    MOCK_METHOD(void, on_subscribe_nack, (client_t _client,
+            service_t _service, instance_t _instance, eventgroup_t _eventgroup,
+            bool _remove, remote_subscription_id_t _subscription_id), (override));
+
+    MOCK_METHOD(std::chrono::steady_clock::time_point, expire_subscriptions, (bool _force),
+            (override));
+
+    MOCK_METHOD(std::shared_ptr<serviceinfo>, get_offered_service, (
+            service_t _service, instance_t _instance), (const, override));
+    MOCK_METHOD((std::map<instance_t, std::shared_ptr<serviceinfo>>),
+            get_offered_service_instances, (service_t _service), (const, override));
+
+    MOCK_METHOD(std::set<eventgroup_t>, get_subscribed_eventgroups, (service_t _service,
+            instance_t _instance), (override));
+};
@@ -0,0 +1,188 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <memory>
+#include <vector>
+
+#include <boost/asio/io_context.hpp>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <common/utility.hpp>
+
+#include "../../../implementation/message/include/serializer.hpp"
+#include "../../../implementation/routing/include/serviceinfo.hpp"
+#include "../../../implementation/service_discovery/include/defines.hpp"
+#include "../../../implementation/service_discovery/include/deserializer.hpp"
+#include "../../../implementation/service_discovery/include/message_impl.hpp"
+#include "../../../implementation/service_discovery/include/service_discovery_impl.hpp"
+#include "mocks/mock_endpoint.hpp"
+#include "mocks/mock_service_discovery_host.hpp"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::ReturnRef;
+
+namespace {
+const vsomeip_v3::service_t  service  = 0x1234;
+const vsomeip_v3::instance_t instance = 0x0001;
+
+class offer_cache_test : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        configuration_ = std::make_shared<vsomeip_v3::cfg::configuration_impl>("");
+
+        endpoint_ = std::make_shared<NiceMock<mock_endpoint>>();
+        ON_CALL(*endpoint_, get_local_port()).WillByDefault(Return(30509));
+
+        auto its_info = std::make_shared<vsomeip_v3::serviceinfo>(service, instance, 1, 0,
+                                                                  vsomeip_v3::DEFAULT_TTL, true);
+        its_info->set_endpoint(endpoint_, false);
+        its_info->set_is_in_mainphase(true);
+        offers_[service][instance] = its_info;
+
+        ON_CALL(host_, get_io()).WillByDefault(ReturnRef(io_));
+        ON_CALL(host_, create_service_discovery_endpoint(_, _, _)).WillByDefault(Return(endpoint_));
+        ON_CALL(host_, get_offered_services()).WillByDefault(Invoke([this]() {
+            rebuilds_++;
+            return offers_;
+        }));
+        ON_CALL(host_, send_via_sd(_, _, _, _))
+            .WillByDefault(
+                Invoke([this](const std::shared_ptr<vsomeip_v3::endpoint_definition>&,
+                              const vsomeip_v3::byte_t* _data, uint32_t _size, uint16_t) {
+                    frame_.assign(_data, _data + _size);
+                    frames_++;
+                    return true;
+                }));
+
+        discovery_ =
+            std::make_shared<vsomeip_v3::sd::service_discovery_impl>(&host_, configuration_);
+        discovery_->init();
+    }
+
+    void TearDown() override
+    {
+        discovery_->stop();
+        discovery_.reset();
+        offers_.clear();
+        endpoint_.reset();
+        configuration_.reset();
+    }
+
+    // Checks the frame that was sent last against a full serialization of
+    // the message it contains.
+    void expect_frame(vsomeip_v3::session_t _session, bool _reboot)
+    {
+        ASSERT_GT(frame_.size(), std::size_t(VSOMEIP_SOMEIP_SD_FLAGS_POS));
+
+        vsomeip_v3::sd::deserializer its_deserializer(
+            frame_.data(), frame_.size(), configuration_->get_buffer_shrink_threshold());
+        std::unique_ptr<vsomeip_v3::sd::message_impl> its_message(
+            its_deserializer.deserialize_sd_message());
+        ASSERT_NE(its_message, nullptr);
+        EXPECT_TRUE(its_message->has_entry());
+        EXPECT_EQ(its_message->get_session(), _session);
+        EXPECT_EQ(its_message->get_reboot_flag(), _reboot);
+
+        vsomeip_v3::serializer its_serializer(0);
+        ASSERT_TRUE(its_message->serialize(&its_serializer));
+        EXPECT_EQ(frame_, std::vector<vsomeip_v3::byte_t>(its_serializer.get_data(),
+                                                          its_serializer.get_data()
+                                                              + its_serializer.get_size()));
+    }
+
+    NiceMock<mock_service_discovery_host>                   host_;
+    boost::asio::io_context                                 io_;
+    std::shared_ptr<vsomeip_v3::cfg::configuration_impl>    configuration_;
+    std::shared_ptr<NiceMock<mock_endpoint>>                endpoint_;
+    vsomeip_v3::services_t                                  offers_;
+    std::shared_ptr<vsomeip_v3::sd::service_discovery_impl> discovery_;
+
+    std::size_t                     rebuilds_ = 0;
+    std::size_t                     frames_   = 0;
+    std::vector<vsomeip_v3::byte_t> frame_;
+};
+} // namespace
+
+TEST_F(offer_cache_test, rebuilt_on_revision_suspend_and_diagnosis)
+{
+    ASSERT_TRUE(discovery_->send(true));
+    EXPECT_EQ(rebuilds_, 1u);
+    EXPECT_EQ(frames_, 1u);
+
+    // Unchanged offers are sent from the cache
+    ASSERT_TRUE(discovery_->send(true));
+    ASSERT_TRUE(discovery_->send(true));
+    EXPECT_EQ(rebuilds_, 1u);
+    EXPECT_EQ(frames_, 3u);
+
+    vsomeip_v3::serviceinfo::update_offer_revision();
+    ASSERT_TRUE(discovery_->send(true));
+    EXPECT_EQ(rebuilds_, 2u);
+    ASSERT_TRUE(discovery_->send(true));
+    EXPECT_EQ(rebuilds_, 2u);
+
+    // SOME/IP services are not offered in diagnosis mode
+    discovery_->set_diagnosis_mode(true);
+    EXPECT_FALSE(discovery_->send(true));
+    EXPECT_EQ(rebuilds_, 3u);
+    EXPECT_FALSE(discovery_->send(true));
+    EXPECT_EQ(rebuilds_, 3u);
+    discovery_->set_diagnosis_mode(false);
+    ASSERT_TRUE(discovery_->send(true));
+    EXPECT_EQ(rebuilds_, 4u);
+    EXPECT_EQ(frames_, 6u);
+
+    // Nothing is offered while suspended
+    discovery_->stop();
+    EXPECT_FALSE(discovery_->send(true));
+    EXPECT_EQ(rebuilds_, 5u);
+    EXPECT_FALSE(discovery_->send(true));
+    EXPECT_EQ(rebuilds_, 5u);
+    EXPECT_EQ(frames_, 6u);
+
+    discovery_->start();
+    ASSERT_TRUE(discovery_->send(true));
+    EXPECT_EQ(rebuilds_, 6u);
+    EXPECT_EQ(frames_, 7u);
+}
+
+TEST_F(offer_cache_test, patched_frames_match_full_serialization)
+{
+    ASSERT_TRUE(discovery_->send(true));
+    expect_frame(1, true);
+    ASSERT_TRUE(discovery_->send(true));
+    expect_frame(2, true);
+
+    // A rebuilt cache continues the session
+    vsomeip_v3::serviceinfo::update_offer_revision();
+    ASSERT_TRUE(discovery_->send(true));
+    expect_frame(3, true);
+
+    // The reboot flag is cleared once the session wrapped around, both in
+    // the cached frame and in a rebuilt one
+    for (vsomeip_v3::session_t its_session = 4; its_session != 0; its_session++)
+        ASSERT_TRUE(discovery_->send(true));
+    expect_frame(0xFFFF, true);
+    ASSERT_TRUE(discovery_->send(true));
+    expect_frame(1, false);
+    ASSERT_TRUE(discovery_->send(true));
+    expect_frame(2, false);
+
+    vsomeip_v3::serviceinfo::update_offer_revision();
+    ASSERT_TRUE(discovery_->send(true));
+    expect_frame(3, false);
+    EXPECT_EQ(rebuilds_, 3u);
+
+    // A restart sets the reboot flag again
+    discovery_->stop();
+    discovery_->start();
+    ASSERT_TRUE(discovery_->send(true));
+    expect_frame(1, true);
+}
@@ -0,0 +1,56 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+
+#include "../../../implementation/utility/include/arena.hpp"
+
+using vsomeip_v3::arena;
+using vsomeip_v3::arena_allocator;
+
+TEST(arena_test, allocations_are_aligned_and_share_blocks)
+{
+    arena its_arena(256);
+
+    auto its_byte = static_cast<char*>(its_arena.allocate(1, 1));
+    auto its_long = its_arena.allocate(sizeof(std::uint64_t), alignof(std::uint64_t));
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(its_long) % alignof(std::uint64_t), 0u);
+    EXPECT_GT(static_cast<char*>(its_long), its_byte);
+    EXPECT_EQ(its_arena.get_block_count(), 1u);
+
+    // Exceeds the rest of the first block
+    its_arena.allocate(250, 1);
+    EXPECT_EQ(its_arena.get_block_count(), 2u);
+
+    // Exceeds the block size
+    its_arena.allocate(1024, 8);
+    EXPECT_EQ(its_arena.get_block_count(), 3u);
+}
+
+TEST(arena_test, shared_objects_keep_the_arena_alive)
+{
+    struct element_t {
+        explicit element_t(int _value) : value_(_value) {}
+        int value_;
+    };
+
+    auto its_arena = std::make_shared<arena>(256);
+    auto its_first =
+        std::allocate_shared<element_t>(arena_allocator<element_t>(its_arena), 1);
+    auto its_second =
+        std::allocate_shared<element_t>(arena_allocator<element_t>(its_arena), 2);
+    EXPECT_EQ(its_arena->get_block_count(), 1u);
+
+    std::weak_ptr<arena> its_weak(its_arena);
+    its_arena.reset();
+    EXPECT_FALSE(its_weak.expired());
+
+    its_first.reset();
+    EXPECT_EQ(its_second->value_, 2);
+    its_second.reset();
+    EXPECT_TRUE(its_weak.expired());
+}
@@ -0,0 +1,134 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "../../../implementation/utility/include/epoch_snapshot.hpp"
+
+using vsomeip_v3::epoch_snapshot;
+
+namespace {
+std::atomic<int> deleted_snapshots(0);
+
+struct snapshot_t {
+    explicit snapshot_t(unsigned _value) : first_(_value), second_(_value) {}
+    ~snapshot_t()
+    {
+        first_  = 0;
+        second_ = 0;
+        deleted_snapshots++;
+    }
+
+    unsigned first_;
+    unsigned second_;
+};
+} // namespace
+
+TEST(epoch_snapshot_test, publish_replaces_and_deletes)
+{
+    deleted_snapshots = 0;
+    {
+        epoch_snapshot<snapshot_t> its_snapshot;
+        EXPECT_EQ(its_snapshot.get_published(), nullptr);
+        {
+            epoch_snapshot<snapshot_t>::reader_t its_reader(its_snapshot);
+            EXPECT_EQ(its_reader.get(), nullptr);
+        }
+
+        its_snapshot.publish(new snapshot_t(1));
+        {
+            epoch_snapshot<snapshot_t>::reader_t its_reader(its_snapshot);
+            ASSERT_NE(its_reader.get(), nullptr);
+            EXPECT_EQ(its_reader.get()->first_, 1u);
+        }
+        EXPECT_EQ(deleted_snapshots, 0);
+
+        its_snapshot.publish(new snapshot_t(2));
+        EXPECT_EQ(deleted_snapshots, 1);
+        EXPECT_EQ(its_snapshot.get_published()->first_, 2u);
+
+        // Reset
+        its_snapshot.publish(nullptr);
+        EXPECT_EQ(deleted_snapshots, 2);
+        EXPECT_EQ(its_snapshot.get_published(), nullptr);
+
+        its_snapshot.publish(new snapshot_t(3));
+    }
+    EXPECT_EQ(deleted_snapshots, 3);
+}
+
+TEST(epoch_snapshot_test, writer_waits_for_readers)
+{
+    deleted_snapshots = 0;
+    epoch_snapshot<snapshot_t> its_snapshot;
+    its_snapshot.publish(new snapshot_t(1));
+
+    std::atomic<bool> is_published(false);
+    std::thread       its_writer;
+    {
+        epoch_snapshot<snapshot_t>::reader_t its_reader(its_snapshot);
+        its_writer = std::thread([&its_snapshot, &is_published]() {
+            its_snapshot.publish(new snapshot_t(2));
+            is_published = true;
+        });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_FALSE(is_published);
+        EXPECT_EQ(deleted_snapshots, 0);
+        EXPECT_EQ(its_reader.get()->first_, 1u);
+
+        // Readers that arrive later see the new snapshot and do not block the writer
+        while (its_snapshot.get_published()->first_ != 2)
+            std::this_thread::yield();
+        epoch_snapshot<snapshot_t>::reader_t its_later_reader(its_snapshot);
+        EXPECT_EQ(its_later_reader.get()->first_, 2u);
+    }
+    its_writer.join();
+    EXPECT_TRUE(is_published);
+    EXPECT_EQ(deleted_snapshots, 1);
+}
+
+TEST(epoch_snapshot_test, concurrent_readers_and_writer)
+{
+    const unsigned its_readers(4);
+    const unsigned its_snapshots(2000);
+
+    epoch_snapshot<snapshot_t> its_snapshot;
+    its_snapshot.publish(new snapshot_t(1));
+
+    std::atomic<bool>        is_running(true);
+    std::atomic<unsigned>    its_errors(0);
+    std::vector<std::thread> its_threads;
+    for (unsigned r = 0; r < its_readers; r++)
+    {
+        its_threads.emplace_back([&its_snapshot, &is_running, &its_errors]() {
+            unsigned its_last(0);
+            while (is_running)
+            {
+                epoch_snapshot<snapshot_t>::reader_t its_reader(its_snapshot);
+                const snapshot_t*                    its_current = its_reader.get();
+                // A deleted snapshot would be zeroed, and snapshots never go back
+                if (its_current->first_ == 0 || its_current->first_ != its_current->second_
+                    || its_current->first_ < its_last)
+                    its_errors++;
+                its_last = its_current->first_;
+            }
+        });
+    }
+
+    for (unsigned i = 2; i <= its_snapshots; i++)
+        its_snapshot.publish(new snapshot_t(i));
+
+    is_running = false;
+    for (auto& t : its_threads)
+        t.join();
+
+    EXPECT_EQ(its_errors, 0u);
+    EXPECT_EQ(its_snapshot.get_published()->first_, its_snapshots);
+}
@@ -0,0 +1,114 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+
+#include "../../../implementation/utility/include/flat_index.hpp"
+
+using vsomeip_v3::flat_index;
+
+namespace {
+uint64_t get_key(uint16_t _service, uint16_t _instance, uint16_t _event)
+{
+    return (uint64_t(_service) << 32) | (uint64_t(_instance) << 16) | _event;
+}
+
+struct colliding_hash {
+    std::size_t operator()(uint32_t) const
+    {
+        return 0;
+    }
+};
+} // namespace
+
+TEST(flat_index_test, insert_and_find)
+{
+    flat_index<uint64_t, int> its_index(3);
+    EXPECT_EQ(its_index.size(), 0u);
+    EXPECT_EQ(its_index.find(get_key(0x1234, 0x0001, 0x8001)), nullptr);
+
+    EXPECT_TRUE(its_index.insert(get_key(0x1234, 0x0001, 0x8001), 1));
+    EXPECT_TRUE(its_index.insert(get_key(0x1234, 0x0002, 0x8001), 2));
+    EXPECT_TRUE(its_index.insert(get_key(0x1234, 0x0001, 0x8002), 3));
+    EXPECT_EQ(its_index.size(), 3u);
+
+    // Keys are not replaced
+    EXPECT_FALSE(its_index.insert(get_key(0x1234, 0x0001, 0x8001), 4));
+    EXPECT_EQ(its_index.size(), 3u);
+
+    ASSERT_NE(its_index.find(get_key(0x1234, 0x0001, 0x8001)), nullptr);
+    EXPECT_EQ(*its_index.find(get_key(0x1234, 0x0001, 0x8001)), 1);
+    ASSERT_NE(its_index.find(get_key(0x1234, 0x0002, 0x8001)), nullptr);
+    EXPECT_EQ(*its_index.find(get_key(0x1234, 0x0002, 0x8001)), 2);
+    ASSERT_NE(its_index.find(get_key(0x1234, 0x0001, 0x8002)), nullptr);
+    EXPECT_EQ(*its_index.find(get_key(0x1234, 0x0001, 0x8002)), 3);
+    EXPECT_EQ(its_index.find(get_key(0x1234, 0x0002, 0x8002)), nullptr);
+}
+
+TEST(flat_index_test, empty_index)
+{
+    flat_index<uint64_t, std::shared_ptr<int>> its_index(0);
+    EXPECT_EQ(its_index.find(0), nullptr);
+    EXPECT_EQ(its_index.find(get_key(0xFFFF, 0xFFFF, 0xFFFF)), nullptr);
+}
+
+TEST(flat_index_test, stays_at_most_half_full)
+{
+    // Capacity for 3 entries is 8 slots, thus 4 entries fit
+    flat_index<uint64_t, int> its_index(3);
+    for (uint16_t i = 0; i < 4; i++)
+        EXPECT_TRUE(its_index.insert(get_key(0x1000, 0x0001, i), i));
+    EXPECT_FALSE(its_index.insert(get_key(0x1000, 0x0001, 4), 4));
+    EXPECT_EQ(its_index.size(), 4u);
+    EXPECT_EQ(its_index.find(get_key(0x1000, 0x0001, 4)), nullptr);
+}
+
+TEST(flat_index_test, packed_identifiers)
+{
+    // 1k services with 10 events, the keys only differ in the upper bits
+    const uint16_t its_services(1000);
+    const uint16_t its_events(10);
+
+    flat_index<uint64_t, std::shared_ptr<int>> its_index(its_services * its_events);
+    for (uint16_t s = 0; s < its_services; s++)
+        for (uint16_t e = 0; e < its_events; e++)
+            ASSERT_TRUE(its_index.insert(get_key(static_cast<uint16_t>(0x1000 + s), 0x0001,
+                                                 static_cast<uint16_t>(0x8001 + e)),
+                                         std::make_shared<int>(s * its_events + e)));
+    EXPECT_EQ(its_index.size(), std::size_t(its_services * its_events));
+
+    for (uint16_t s = 0; s < its_services; s++)
+    {
+        for (uint16_t e = 0; e < its_events; e++)
+        {
+            const auto its_value = its_index.find(get_key(static_cast<uint16_t>(0x1000 + s), 0x0001,
+                                                          static_cast<uint16_t>(0x8001 + e)));
+            ASSERT_NE(its_value, nullptr);
+            EXPECT_EQ(**its_value, s * its_events + e);
+        }
+        // Other instance and unknown event
+        EXPECT_EQ(its_index.find(get_key(static_cast<uint16_t>(0x1000 + s), 0x0002, 0x8001)),
+                  nullptr);
+        EXPECT_EQ(its_index.find(get_key(static_cast<uint16_t>(0x1000 + s), 0x0001, 0x8000)),
+                  nullptr);
+    }
+}
+
+TEST(flat_index_test, colliding_hashes_are_probed)
+{
+    flat_index<uint32_t, uint32_t, colliding_hash> its_index(16);
+    for (uint32_t i = 0; i < 16; i++)
+        EXPECT_TRUE(its_index.insert(i, i + 100));
+    EXPECT_FALSE(its_index.insert(7, 0));
+
+    for (uint32_t i = 0; i < 16; i++)
+    {
+        ASSERT_NE(its_index.find(i), nullptr);
+        EXPECT_EQ(*its_index.find(i), i + 100);
+    }
+    EXPECT_EQ(its_index.find(16), nullptr);
+}
@@ -0,0 +1,207 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "../../../implementation/utility/include/message_statistics.hpp"
+
+using namespace vsomeip_v3;
+
+TEST(histogram_test, buckets)
+{
+    for (std::uint32_t v : {0u, 1u, 3u, 4u, 7u, 8u, 9u, 10u, 1000u, 65535u, 0xFFFFFFFFu})
+    {
+        SCOPED_TRACE(v);
+        const auto its_bucket = histogram::get_bucket(v);
+        ASSERT_LT(its_bucket, histogram::buckets_);
+        EXPECT_GE(histogram::get_upper_bound(its_bucket), v);
+        if (its_bucket > 0)
+        {
+            EXPECT_LT(histogram::get_upper_bound(its_bucket - 1), v);
+        }
+    }
+    EXPECT_EQ(histogram::get_bucket(0xFFFFFFFFu), histogram::buckets_ - 1);
+
+    histogram its_histogram;
+    its_histogram.record(9);
+    its_histogram.record(8);
+    EXPECT_EQ(its_histogram.get_count(histogram::get_bucket(8)), 2u);
+    EXPECT_EQ(its_histogram.get_sum(), 17u);
+}
+
+TEST(message_statistics_test, disabled)
+{
+    message_statistics its_statistics;
+    EXPECT_FALSE(its_statistics.insert(0x1234, 0x0001, 0x8001, 1));
+    EXPECT_FALSE(its_statistics.insert_latency(0x1234, 0x0001, 0x8001, 1));
+
+    // Latencies are only recorded if requested
+    its_statistics.enable(false);
+    EXPECT_FALSE(its_statistics.is_latency_enabled());
+    EXPECT_TRUE(its_statistics.insert(0x1234, 0x0001, 0x8001, 1));
+    EXPECT_FALSE(its_statistics.insert_latency(0x1234, 0x0001, 0x8001, 1));
+
+    its_statistics.disable(false);
+    EXPECT_FALSE(its_statistics.is_enabled());
+    EXPECT_FALSE(its_statistics.insert(0x1234, 0x0001, 0x8001, 1));
+
+    std::uint64_t its_ignored(0);
+    EXPECT_EQ(its_statistics.rotate(its_ignored).size(), 1u);
+}
+
+TEST(message_statistics_test, shared_by_users)
+{
+    // E.g. the routing manager and an application of the same process
+    message_statistics its_statistics;
+    its_statistics.enable(false);
+    its_statistics.enable(true);
+    EXPECT_TRUE(its_statistics.is_latency_enabled());
+
+    its_statistics.disable(true);
+    EXPECT_TRUE(its_statistics.is_enabled());
+    EXPECT_FALSE(its_statistics.is_latency_enabled());
+    EXPECT_TRUE(its_statistics.insert(0x1234, 0x0001, 0x8001, 1));
+
+    its_statistics.disable(false);
+    EXPECT_FALSE(its_statistics.is_enabled());
+    EXPECT_FALSE(its_statistics.insert(0x1234, 0x0001, 0x8001, 1));
+}
+
+TEST(message_statistics_test, counts_across_threads)
+{
+    message_statistics its_statistics;
+    its_statistics.enable(true);
+    std::vector<std::thread> its_threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        its_threads.emplace_back([&its_statistics]() {
+            for (int i = 0; i < 1000; ++i)
+            {
+                its_statistics.insert(0x1234, 0x0001, 0x8001, 10);
+                its_statistics.insert(0x1234, 0x0001, static_cast<method_t>(0x8002 + i % 3), 20);
+            }
+        });
+    }
+    for (auto& t : its_threads)
+        t.join();
+
+    std::uint64_t its_ignored(0);
+    const auto    its_counters = its_statistics.rotate(its_ignored);
+    ASSERT_EQ(its_counters.size(), 4u);
+    EXPECT_EQ(its_counters[0].method_, 0x8001);
+    EXPECT_EQ(its_counters[0].count_, 4000u);
+    EXPECT_EQ(its_counters[0].bytes_, 40000u);
+    std::uint64_t its_others(0);
+    for (std::size_t i = 1; i < its_counters.size(); ++i)
+        its_others += its_counters[i].count_;
+    EXPECT_EQ(its_others, 4000u);
+    EXPECT_EQ(its_ignored, 0u);
+}
+
+TEST(message_statistics_test, rotate_while_counting)
+{
+    message_statistics its_statistics;
+    its_statistics.enable(false);
+    std::atomic<bool>          is_running(true);
+    std::atomic<std::uint64_t> its_inserted(0);
+    std::vector<std::thread>   its_threads;
+    for (int t = 0; t < 2; ++t)
+    {
+        its_threads.emplace_back([&]() {
+            while (is_running)
+            {
+                if (its_statistics.insert(0x1234, 0x0001, 0x8001, 1))
+                    its_inserted++;
+            }
+        });
+    }
+
+    // Every message is counted in exactly one interval
+    std::uint64_t its_counted(0), its_ignored(0);
+    for (int i = 0; i < 20; ++i)
+    {
+        for (const auto& c : its_statistics.rotate(its_ignored))
+            its_counted += c.count_;
+        std::this_thread::yield();
+    }
+    is_running = false;
+    for (auto& t : its_threads)
+        t.join();
+    for (const auto& c : its_statistics.rotate(its_ignored))
+        its_counted += c.count_;
+    EXPECT_EQ(its_counted, its_inserted.load());
+}
+
+TEST(message_statistics_test, max_messages)
+{
+    message_statistics its_statistics;
+    its_statistics.enable(true);
+    its_statistics.set_max_messages(2);
+    EXPECT_TRUE(its_statistics.insert(0x1234, 0x0001, 0x8001, 1));
+    EXPECT_TRUE(its_statistics.insert(0x1234, 0x0001, 0x8002, 1));
+    EXPECT_FALSE(its_statistics.insert(0x1234, 0x0001, 0x8003, 1));
+
+    // Latencies have a budget of their own
+    EXPECT_TRUE(its_statistics.insert_latency(0x1234, 0x0001, 0x8003, 1));
+    EXPECT_TRUE(its_statistics.insert_latency(0x1234, 0x0001, 0x8004, 1));
+    EXPECT_FALSE(its_statistics.insert_latency(0x1234, 0x0001, 0x8005, 1));
+
+    std::uint64_t its_ignored(0);
+    EXPECT_EQ(its_statistics.rotate(its_ignored).size(), 2u);
+    EXPECT_EQ(its_ignored, 1u);
+
+    // The budget is reset per interval
+    EXPECT_TRUE(its_statistics.insert(0x1234, 0x0001, 0x8003, 1));
+    const auto its_counters = its_statistics.rotate(its_ignored);
+    ASSERT_EQ(its_counters.size(), 1u);
+    EXPECT_EQ(its_counters[0].method_, 0x8003);
+    EXPECT_EQ(its_ignored, 0u);
+}
+
+TEST(message_statistics_test, write)
+{
+    message_statistics its_statistics;
+    its_statistics.enable(true);
+    its_statistics.insert(0x1234, 0x0001, 0x8001, 100);
+    its_statistics.insert_latency(0x1234, 0x0001, 0x8001, 5);
+    const auto its_gauge = its_statistics.add_gauge(
+        "vsomeip_test_gauge", [](std::vector<std::pair<std::string, std::uint64_t>>& _values) {
+            _values.emplace_back("port=\"30509\"", 42);
+        });
+
+    // Only closed intervals are written, as totals
+    std::uint64_t its_ignored(0);
+    its_statistics.rotate(its_ignored);
+    its_statistics.insert(0x1234, 0x0001, 0x8001, 100);
+    its_statistics.rotate(its_ignored);
+    its_statistics.insert(0x1234, 0x0001, 0x8001, 100);
+
+    std::stringstream its_out;
+    its_statistics.write(its_out);
+    const std::string its_text   = its_out.str();
+    const std::string its_labels = "service=\"0x1234\",instance=\"0x0001\",method=\"0x8001\"";
+    EXPECT_NE(its_text.find("vsomeip_messages_received_total{" + its_labels + "} 2\n"),
+              std::string::npos);
+    EXPECT_NE(its_text.find("vsomeip_payload_received_bytes_total{" + its_labels + "} 200\n"),
+              std::string::npos);
+    EXPECT_NE(
+        its_text.find("vsomeip_payload_size_bytes_bucket{" + its_labels + ",le=\"+Inf\"} 2\n"),
+        std::string::npos);
+    EXPECT_NE(its_text.find("vsomeip_handler_latency_microseconds_sum{" + its_labels + "} 5\n"),
+              std::string::npos);
+    EXPECT_NE(its_text.find("# TYPE vsomeip_test_gauge gauge\n"
+                            "vsomeip_test_gauge{port=\"30509\"} 42\n"),
+              std::string::npos);
+
+    its_statistics.remove_gauge(its_gauge);
+    std::stringstream its_removed;
+    its_statistics.write(its_removed);
+    EXPECT_EQ(its_removed.str().find("vsomeip_test_gauge"), std::string::npos);
+}
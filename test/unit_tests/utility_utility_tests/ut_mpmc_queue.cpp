@@ -0,0 +1,126 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../../../implementation/utility/include/mpmc_queue.hpp"
+
+using vsomeip_v3::mpmc_queue;
+
+TEST(mpmc_queue_test, capacity_is_rounded_up)
+{
+    mpmc_queue<int> its_queue(5);
+    EXPECT_EQ(its_queue.capacity(), 8u);
+}
+
+TEST(mpmc_queue_test, fifo_order_and_bounds)
+{
+    mpmc_queue<int> its_queue(4);
+    EXPECT_TRUE(its_queue.empty());
+
+    for (int i = 0; i < 4; i++)
+        EXPECT_TRUE(its_queue.push(int(i)));
+
+    int its_value(42);
+    EXPECT_FALSE(its_queue.push(std::move(its_value)));
+    EXPECT_EQ(its_value, 42);
+    EXPECT_FALSE(its_queue.empty());
+
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_TRUE(its_queue.pop(its_value));
+        EXPECT_EQ(its_value, i);
+    }
+    EXPECT_FALSE(its_queue.pop(its_value));
+    EXPECT_TRUE(its_queue.empty());
+}
+
+TEST(mpmc_queue_test, failed_push_keeps_value)
+{
+    mpmc_queue<std::shared_ptr<int>> its_queue(2);
+    EXPECT_TRUE(its_queue.push(std::make_shared<int>(1)));
+    EXPECT_TRUE(its_queue.push(std::make_shared<int>(2)));
+
+    auto its_value = std::make_shared<int>(3);
+    EXPECT_FALSE(its_queue.push(std::move(its_value)));
+    ASSERT_NE(its_value, nullptr);
+    EXPECT_EQ(*its_value, 3);
+}
+
+TEST(mpmc_queue_test, popped_slots_release_their_value)
+{
+    mpmc_queue<std::shared_ptr<int>> its_queue(2);
+    auto                             its_value = std::make_shared<int>(1);
+    EXPECT_TRUE(its_queue.push(std::shared_ptr<int>(its_value)));
+
+    std::shared_ptr<int> its_popped;
+    EXPECT_TRUE(its_queue.pop(its_popped));
+    its_popped.reset();
+    EXPECT_EQ(its_value.use_count(), 1);
+}
+
+TEST(mpmc_queue_test, concurrent_producers_and_consumers)
+{
+    const int its_producers(4);
+    const int its_items(20000);
+
+    mpmc_queue<int> its_queue(64);
+
+    std::vector<std::thread> its_threads;
+    for (int p = 0; p < its_producers; p++)
+    {
+        its_threads.emplace_back([&its_queue, p, its_items]() {
+            for (int i = 0; i < its_items; i++)
+            {
+                while (!its_queue.push(int(p * its_items + i)))
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    // Each consumer checks that the items of each producer arrive in order
+    std::vector<std::vector<int>> its_received(2);
+    std::atomic<int>              its_count(0);
+    for (auto& its_list : its_received)
+    {
+        its_threads.emplace_back([&its_queue, &its_list, &its_count, its_producers, its_items]() {
+            while (its_count < its_producers * its_items)
+            {
+                int its_value;
+                if (its_queue.pop(its_value))
+                {
+                    its_list.push_back(its_value);
+                    its_count++;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& t : its_threads)
+        t.join();
+
+    std::vector<int> its_seen(static_cast<std::size_t>(its_producers * its_items), 0);
+    for (const auto& its_list : its_received)
+    {
+        std::vector<int> its_last(static_cast<std::size_t>(its_producers), -1);
+        for (auto its_value : its_list)
+        {
+            const auto its_producer = static_cast<std::size_t>(its_value / its_items);
+            EXPECT_LT(its_last[its_producer], its_value);
+            its_last[its_producer] = its_value;
+            its_seen[static_cast<std::size_t>(its_value)]++;
+        }
+    }
+    for (auto its_times : its_seen)
+        EXPECT_EQ(its_times, 1);
+}
@@ -0,0 +1,118 @@
+// Copyright (C) 2024 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <cstdlib>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include "../implementation/configuration/include/configuration_snapshot.hpp"
+
+static void print_help(char* binary_name)
+{
+    std::cout << "Usage example:" << std::endl;
+    std::cout << binary_name << " --output /etc/vsomeip.snapshot /etc/vsomeip.json /etc/vsomeip\n"
+              << "This will write the parsed configuration files to /etc/vsomeip.snapshot."
+              << std::endl
+              << std::endl;
+    std::cout << "Available options:\n"
+                 "--help     | -h : print this help\n"
+                 "--output   | -o : path of the snapshot to write (required)\n\n"
+                 "All other arguments are configuration files or folders. Folders are read\n"
+                 "like vsomeip does, including the security configuration of their sub folders.\n"
+                 "Applications use the snapshot if VSOMEIP_CONFIGURATION_SNAPSHOT is set to\n"
+                 "its path. Files that changed after the snapshot was written are parsed again."
+              << std::endl;
+}
+
+// Collects the files vsomeip would read for _input
+static void collect(const std::string& _input, std::set<std::string>& _files)
+{
+    if (boost::filesystem::is_regular_file(_input))
+    {
+        _files.insert(_input);
+    }
+    else if (boost::filesystem::is_directory(_input))
+    {
+        for (auto i = boost::filesystem::directory_iterator(_input);
+             i != boost::filesystem::directory_iterator(); i++)
+        {
+            if (!boost::filesystem::is_directory(i->path()))
+            {
+                _files.insert(i->path().string());
+            }
+            else
+            {
+                std::string its_security = i->path().string() + "/vsomeip_security.json";
+                if (boost::filesystem::is_regular_file(its_security))
+                    _files.insert(its_security);
+            }
+        }
+    }
+    else
+    {
+        std::cerr << "Configuration file or folder \"" << _input << "\" does not exist."
+                  << std::endl;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::string           output;
+    std::set<std::string> files;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg(argv[i]);
+        if (arg == "--help" || arg == "-h")
+        {
+            print_help(argv[0]);
+            exit(EXIT_SUCCESS);
+        }
+        else if (arg == "--output" || arg == "-o")
+        {
+            if (i + 1 < argc)
+                output = argv[++i];
+        }
+        else
+        {
+            collect(arg, files);
+        }
+    }
+
+    if (output.empty())
+    {
+        std::cerr << "Please provide the path of the snapshot (see --help)" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    std::vector<vsomeip_v3::configuration_element> elements;
+    for (const auto& f : files)
+    {
+        try
+        {
+            boost::property_tree::ptree tree;
+            boost::property_tree::json_parser::read_json(f, tree);
+            elements.push_back({f, tree});
+        } catch (const boost::property_tree::json_parser_error& e)
+        {
+            std::cerr << "Skipping \"" << f << "\": " << e.what() << std::endl;
+        }
+    }
+
+    if (!vsomeip_v3::cfg::configuration_snapshot::write(output, elements))
+    {
+        std::cerr << "Writing snapshot \"" << output << "\" failed." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    std::cout << "Wrote " << elements.size() << " configuration file(s) to \"" << output << "\"."
+              << std::endl;
+    return EXIT_SUCCESS;
+}